@@ -24,6 +24,18 @@ void cuda_convert_lwe_bootstrap_key_64(void *dest, void *src,
                                        uint32_t glwe_dim, uint32_t level_count,
                                        uint32_t polynomial_size);
 
+int cuda_export_lwe_bootstrap_key_64(const char *path, void *src,
+                                     cuda_stream_t *stream,
+                                     uint32_t input_lwe_dim, uint32_t glwe_dim,
+                                     uint32_t level_count,
+                                     uint32_t polynomial_size);
+
+int cuda_import_lwe_bootstrap_key_64(void *dest, const char *path,
+                                     cuda_stream_t *stream,
+                                     uint32_t input_lwe_dim, uint32_t glwe_dim,
+                                     uint32_t level_count,
+                                     uint32_t polynomial_size);
+
 void scratch_cuda_bootstrap_amortized_32(
     cuda_stream_t *stream, int8_t **pbs_buffer, uint32_t glwe_dimension,
     uint32_t polynomial_size, uint32_t input_lwe_ciphertext_count,
@@ -73,6 +85,15 @@ void cuda_bootstrap_low_latency_lwe_ciphertext_vector_32(
     uint32_t base_log, uint32_t level_count, uint32_t num_samples,
     uint32_t num_lut_vectors, uint32_t lwe_idx, uint32_t max_shared_memory);
 
+void cuda_bootstrap_low_latency_many_lut_lwe_ciphertext_vector_32(
+    cuda_stream_t *stream, void *lwe_array_out, void *lwe_output_indexes,
+    void *lut_vector, void *lut_vector_indexes, void *lwe_array_in,
+    void *lwe_input_indexes, void *bootstrapping_key, int8_t *pbs_buffer,
+    uint32_t lwe_dimension, uint32_t glwe_dimension, uint32_t polynomial_size,
+    uint32_t base_log, uint32_t level_count, uint32_t num_samples,
+    uint32_t num_lut_vectors, uint32_t lwe_idx, uint32_t max_shared_memory,
+    uint32_t num_many_lut, uint32_t lut_stride);
+
 void cuda_bootstrap_low_latency_lwe_ciphertext_vector_64(
     cuda_stream_t *stream, void *lwe_array_out, void *lwe_output_indexes,
     void *lut_vector, void *lut_vector_indexes, void *lwe_array_in,
@@ -81,6 +102,37 @@ void cuda_bootstrap_low_latency_lwe_ciphertext_vector_64(
     uint32_t base_log, uint32_t level_count, uint32_t num_samples,
     uint32_t num_lut_vectors, uint32_t lwe_idx, uint32_t max_shared_memory);
 
+void cuda_bootstrap_low_latency_many_lut_lwe_ciphertext_vector_64(
+    cuda_stream_t *stream, void *lwe_array_out, void *lwe_output_indexes,
+    void *lut_vector, void *lut_vector_indexes, void *lwe_array_in,
+    void *lwe_input_indexes, void *bootstrapping_key, int8_t *pbs_buffer,
+    uint32_t lwe_dimension, uint32_t glwe_dimension, uint32_t polynomial_size,
+    uint32_t base_log, uint32_t level_count, uint32_t num_samples,
+    uint32_t num_lut_vectors, uint32_t lwe_idx, uint32_t max_shared_memory,
+    uint32_t num_many_lut, uint32_t lut_stride);
+
+void scratch_cuda_keyswitch_bootstrap_low_latency_64(
+    cuda_stream_t *stream, int8_t **pbs_buffer, uint32_t lwe_dimension,
+    uint32_t glwe_dimension, uint32_t polynomial_size, uint32_t level_count,
+    uint32_t input_lwe_ciphertext_count, uint32_t max_shared_memory,
+    bool allocate_gpu_memory);
+
+void scratch_cuda_bootstrap_low_latency_persistent_64(
+    cuda_stream_t *stream, int8_t **pbs_buffer, uint32_t glwe_dimension,
+    uint32_t polynomial_size, uint32_t level_count,
+    uint32_t input_lwe_ciphertext_count, uint32_t max_shared_memory,
+    bool allocate_gpu_memory);
+
+void cuda_keyswitch_bootstrap_low_latency_lwe_ciphertext_vector_64(
+    cuda_stream_t *stream, void *lwe_array_out, void *lwe_output_indexes,
+    void *lut_vector, void *lut_vector_indexes, void *lwe_array_in,
+    void *lwe_input_indexes, void *ksk, void *bootstrapping_key,
+    int8_t *pbs_buffer, void *lwe_array_after_ks, uint32_t lwe_dimension_in,
+    uint32_t lwe_dimension, uint32_t glwe_dimension, uint32_t polynomial_size,
+    uint32_t ks_base_log, uint32_t ks_level_count, uint32_t base_log,
+    uint32_t level_count, uint32_t num_samples, uint32_t num_lut_vectors,
+    uint32_t lwe_idx, uint32_t max_shared_memory);
+
 void cleanup_cuda_bootstrap_low_latency(cuda_stream_t *stream,
                                         int8_t **pbs_buffer);
 
@@ -113,6 +165,15 @@ __device__ T *get_multi_bit_ith_lwe_gth_group_kth_block(
     T *ptr, int g, int i, int k, int level, uint32_t grouping_factor,
     uint32_t polynomial_size, uint32_t glwe_dimension, uint32_t level_count);
 
+__host__ void register_low_latency_persistent_pbs_buffer(
+    const int8_t *pbs_buffer, uint32_t max_grid_size);
+
+__host__ void
+unregister_low_latency_persistent_pbs_buffer(const int8_t *pbs_buffer);
+
+__host__ uint32_t
+get_low_latency_persistent_max_grid_size(const int8_t *pbs_buffer);
+
 #endif
 
 #endif // CUDA_BOOTSTRAP_H
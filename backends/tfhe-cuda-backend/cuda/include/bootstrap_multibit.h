@@ -1,14 +1,76 @@
 #ifndef CUDA_MULTI_BIT_H
 #define CUDA_MULTI_BIT_H
 
+#include "multi_bit_tuning.h"
 #include <cstdint>
 
 extern "C" {
+void cuda_convert_lwe_multi_bit_bootstrap_key_32(
+    void *dest, void *src, cuda_stream_t *stream, uint32_t input_lwe_dim,
+    uint32_t glwe_dim, uint32_t level_count, uint32_t polynomial_size,
+    uint32_t grouping_factor);
+
 void cuda_convert_lwe_multi_bit_bootstrap_key_64(
     void *dest, void *src, cuda_stream_t *stream, uint32_t input_lwe_dim,
     uint32_t glwe_dim, uint32_t level_count, uint32_t polynomial_size,
     uint32_t grouping_factor);
 
+int cuda_export_lwe_multi_bit_bootstrap_key_64(
+    const char *path, void *src, cuda_stream_t *stream, uint32_t input_lwe_dim,
+    uint32_t glwe_dim, uint32_t level_count, uint32_t polynomial_size,
+    uint32_t grouping_factor);
+
+int cuda_import_lwe_multi_bit_bootstrap_key_64(
+    void *dest, const char *path, cuda_stream_t *stream,
+    uint32_t input_lwe_dim, uint32_t glwe_dim, uint32_t level_count,
+    uint32_t polynomial_size, uint32_t grouping_factor);
+
+void cuda_multi_bit_pbs_lwe_ciphertext_vector_32(
+    cuda_stream_t *stream, void *lwe_array_out, void *lwe_output_indexes,
+    void *lut_vector, void *lut_vector_indexes, void *lwe_array_in,
+    void *lwe_input_indexes, void *bootstrapping_key, int8_t *pbs_buffer,
+    uint32_t lwe_dimension, uint32_t glwe_dimension, uint32_t polynomial_size,
+    uint32_t grouping_factor, uint32_t base_log, uint32_t level_count,
+    uint32_t num_samples, uint32_t num_lut_vectors, uint32_t lwe_idx,
+    uint32_t max_shared_memory, uint32_t chunk_size = 0);
+
+/// Same as cuda_multi_bit_pbs_lwe_ciphertext_vector_32, where the samples come
+/// in runs of num_samples_per_input consecutive samples sharing the same
+/// input LWE (e.g. one input bootstrapped with several LUTs). The keybundles
+/// only depend on the input mask, they are computed once per run.
+///
+/// Sample s belongs to run s / num_samples_per_input, whatever its output
+/// index. The keybundles of a run are computed from the mask of the first
+/// sample of the run, at lwe_input_indexes[run * num_samples_per_input], and
+/// used for all its samples. Each sample still reads its own body, LUT and
+/// output index. The samples of a run must therefore have the same mask,
+/// which holds when they have the same input index; this is not checked, a
+/// sample with another mask is silently bootstrapped with the wrong one.
+/// num_samples must be a multiple of num_samples_per_input.
+void cuda_multi_bit_pbs_shared_input_lwe_ciphertext_vector_32(
+    cuda_stream_t *stream, void *lwe_array_out, void *lwe_output_indexes,
+    void *lut_vector, void *lut_vector_indexes, void *lwe_array_in,
+    void *lwe_input_indexes, void *bootstrapping_key, int8_t *pbs_buffer,
+    uint32_t lwe_dimension, uint32_t glwe_dimension, uint32_t polynomial_size,
+    uint32_t grouping_factor, uint32_t base_log, uint32_t level_count,
+    uint32_t num_samples, uint32_t num_samples_per_input,
+    uint32_t num_lut_vectors, uint32_t lwe_idx, uint32_t max_shared_memory,
+    uint32_t chunk_size = 0);
+
+/// Same as cuda_multi_bit_pbs_lwe_ciphertext_vector_32, evaluating the
+/// num_many_lut functions packed lut_stride coefficients apart in each LUT (see
+/// many_lut.h). lwe_array_out holds num_many_lut * num_samples LWEs, output i
+/// of sample s being at index i * num_samples + lwe_output_indexes[s].
+void cuda_multi_bit_pbs_many_lut_lwe_ciphertext_vector_32(
+    cuda_stream_t *stream, void *lwe_array_out, void *lwe_output_indexes,
+    void *lut_vector, void *lut_vector_indexes, void *lwe_array_in,
+    void *lwe_input_indexes, void *bootstrapping_key, int8_t *pbs_buffer,
+    uint32_t lwe_dimension, uint32_t glwe_dimension, uint32_t polynomial_size,
+    uint32_t grouping_factor, uint32_t base_log, uint32_t level_count,
+    uint32_t num_samples, uint32_t num_lut_vectors, uint32_t lwe_idx,
+    uint32_t max_shared_memory, uint32_t num_many_lut, uint32_t lut_stride,
+    uint32_t chunk_size = 0);
+
 void cuda_multi_bit_pbs_lwe_ciphertext_vector_64(
     cuda_stream_t *stream, void *lwe_array_out, void *lwe_output_indexes,
     void *lut_vector, void *lut_vector_indexes, void *lwe_array_in,
@@ -18,6 +80,35 @@ void cuda_multi_bit_pbs_lwe_ciphertext_vector_64(
     uint32_t num_samples, uint32_t num_lut_vectors, uint32_t lwe_idx,
     uint32_t max_shared_memory, uint32_t chunk_size = 0);
 
+/// 64-bit version of cuda_multi_bit_pbs_shared_input_lwe_ciphertext_vector_32
+void cuda_multi_bit_pbs_shared_input_lwe_ciphertext_vector_64(
+    cuda_stream_t *stream, void *lwe_array_out, void *lwe_output_indexes,
+    void *lut_vector, void *lut_vector_indexes, void *lwe_array_in,
+    void *lwe_input_indexes, void *bootstrapping_key, int8_t *pbs_buffer,
+    uint32_t lwe_dimension, uint32_t glwe_dimension, uint32_t polynomial_size,
+    uint32_t grouping_factor, uint32_t base_log, uint32_t level_count,
+    uint32_t num_samples, uint32_t num_samples_per_input,
+    uint32_t num_lut_vectors, uint32_t lwe_idx, uint32_t max_shared_memory,
+    uint32_t chunk_size = 0);
+
+/// 64-bit version of cuda_multi_bit_pbs_many_lut_lwe_ciphertext_vector_32
+void cuda_multi_bit_pbs_many_lut_lwe_ciphertext_vector_64(
+    cuda_stream_t *stream, void *lwe_array_out, void *lwe_output_indexes,
+    void *lut_vector, void *lut_vector_indexes, void *lwe_array_in,
+    void *lwe_input_indexes, void *bootstrapping_key, int8_t *pbs_buffer,
+    uint32_t lwe_dimension, uint32_t glwe_dimension, uint32_t polynomial_size,
+    uint32_t grouping_factor, uint32_t base_log, uint32_t level_count,
+    uint32_t num_samples, uint32_t num_lut_vectors, uint32_t lwe_idx,
+    uint32_t max_shared_memory, uint32_t num_many_lut, uint32_t lut_stride,
+    uint32_t chunk_size = 0);
+
+void scratch_cuda_multi_bit_pbs_32(
+    cuda_stream_t *stream, int8_t **pbs_buffer, uint32_t lwe_dimension,
+    uint32_t glwe_dimension, uint32_t polynomial_size, uint32_t level_count,
+    uint32_t grouping_factor, uint32_t input_lwe_ciphertext_count,
+    uint32_t max_shared_memory, bool allocate_gpu_memory,
+    uint32_t chunk_size = 0);
+
 void scratch_cuda_multi_bit_pbs_64(
     cuda_stream_t *stream, int8_t **pbs_buffer, uint32_t lwe_dimension,
     uint32_t glwe_dimension, uint32_t polynomial_size, uint32_t level_count,
@@ -26,21 +117,55 @@ void scratch_cuda_multi_bit_pbs_64(
     uint32_t chunk_size = 0);
 
 void cleanup_cuda_multi_bit_pbs(cuda_stream_t *stream, int8_t **pbs_buffer);
+
+uint32_t cuda_tune_multi_bit_pbs_chunk_size_64(
+    cuda_stream_t *stream, void *bootstrapping_key, uint32_t lwe_dimension,
+    uint32_t glwe_dimension, uint32_t polynomial_size, uint32_t grouping_factor,
+    uint32_t base_log, uint32_t level_count, uint32_t num_samples,
+    uint32_t max_shared_memory);
 }
 #ifdef __CUDACC__
-__host__ uint32_t get_lwe_chunk_size(uint32_t lwe_dimension,
+__host__ uint32_t get_lwe_chunk_size(uint32_t gpu_index,
+                                     uint32_t lwe_dimension,
                                      uint32_t level_count,
                                      uint32_t glwe_dimension,
                                      uint32_t num_samples);
 
-__host__ uint32_t get_average_lwe_chunk_size(uint32_t lwe_dimension,
+__host__ uint32_t get_average_lwe_chunk_size(uint32_t gpu_index,
+                                             uint32_t lwe_dimension,
                                              uint32_t level_count,
                                              uint32_t glwe_dimension,
                                              uint32_t ct_count);
 
+__host__ uint32_t get_tuned_lwe_chunk_size(
+    uint32_t gpu_index, uint32_t lwe_dimension, uint32_t glwe_dimension,
+    uint32_t polynomial_size, uint32_t level_count, uint32_t grouping_factor,
+    uint32_t num_samples);
+
+__host__ uint32_t get_scratch_lwe_chunk_size(
+    uint32_t gpu_index, uint32_t lwe_dimension, uint32_t glwe_dimension,
+    uint32_t polynomial_size, uint32_t level_count, uint32_t grouping_factor,
+    uint32_t max_num_samples);
+
+__host__ void register_multi_bit_pbs_buffer(const int8_t *pbs_buffer,
+                                            uint32_t lwe_chunk_size,
+                                            uint32_t max_num_samples);
+
+__host__ void unregister_multi_bit_pbs_buffer(const int8_t *pbs_buffer);
+
+__host__ multi_bit_pbs_buffer_layout
+get_multi_bit_pbs_buffer_layout(const int8_t *pbs_buffer,
+                                uint32_t lwe_chunk_size, uint32_t num_samples);
+
+__host__ uint32_t get_execution_lwe_chunk_size(
+    const int8_t *pbs_buffer, uint32_t gpu_index, uint32_t lwe_dimension,
+    uint32_t glwe_dimension, uint32_t polynomial_size, uint32_t level_count,
+    uint32_t grouping_factor, uint32_t num_samples, uint32_t lwe_chunk_size);
+
 __host__ uint64_t get_max_buffer_size_multibit_bootstrap(
-    uint32_t lwe_dimension, uint32_t glwe_dimension, uint32_t polynomial_size,
-    uint32_t level_count, uint32_t max_input_lwe_ciphertext_count);
+    uint32_t gpu_index, uint32_t lwe_dimension, uint32_t glwe_dimension,
+    uint32_t polynomial_size, uint32_t level_count,
+    uint32_t max_input_lwe_ciphertext_count);
 #endif
 
 #endif // CUDA_MULTI_BIT_H
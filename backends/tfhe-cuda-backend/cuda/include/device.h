@@ -9,11 +9,41 @@
 
 #define synchronize_threads_in_block() __syncthreads()
 
+struct scratch_arena;
+struct staging_pool;
+struct pbs_pipeline;
+
 extern "C" {
 
+struct cuda_stream_t;
+
+void cuda_release_scratch_arena(cuda_stream_t *stream);
+
+void cuda_release_staging_pool(cuda_stream_t *stream);
+
+void cuda_release_pbs_pipeline(cuda_stream_t *stream);
+
 struct cuda_stream_t {
   cudaStream_t stream;
   uint32_t gpu_index;
+  // Bump allocator for the integer scratch buffers, created on first use
+  scratch_arena *arena = nullptr;
+  // Page-locked staging buffers for host to device copies, created on first
+  // use
+  staging_pool *staging = nullptr;
+  // Side stream and events of the pipelined multi-bit PBS, created on first
+  // use
+  pbs_pipeline *pipeline = nullptr;
+  // Set by cuda_create_measuring_stream: nothing is executed on the stream,
+  // device allocations return placeholder addresses and their sizes are
+  // summed in measured_bytes
+  bool measuring = false;
+  uint64_t measured_bytes = 0;
+  // Bytes allocated by cuda_malloc_async on the other streams, the chunks of
+  // the scratch arena included. Never decreases: a fresh stream tells how
+  // much device memory a scratch function took, which must match what it
+  // measures on a measuring stream.
+  uint64_t allocated_bytes = 0;
 
   cuda_stream_t(uint32_t gpu_index) {
     this->gpu_index = gpu_index;
@@ -23,6 +53,9 @@ struct cuda_stream_t {
 
   void release() {
     cudaSetDevice(gpu_index);
+    cuda_release_scratch_arena(this);
+    cuda_release_staging_pool(this);
+    cuda_release_pbs_pipeline(this);
     cudaStreamDestroy(stream);
   }
 
@@ -31,6 +64,8 @@ struct cuda_stream_t {
 
 cuda_stream_t *cuda_create_stream(uint32_t gpu_index);
 
+cuda_stream_t *cuda_create_measuring_stream(uint32_t gpu_index);
+
 int cuda_destroy_stream(cuda_stream_t *stream);
 
 void *cuda_malloc(uint64_t size, uint32_t gpu_index);
@@ -39,13 +74,16 @@ void *cuda_malloc_async(uint64_t size, cuda_stream_t *stream);
 
 int cuda_check_valid_malloc(uint64_t size, uint32_t gpu_index);
 
-int cuda_check_support_cooperative_groups();
+int cuda_check_support_cooperative_groups(uint32_t gpu_index);
 
 int cuda_memcpy_to_cpu(void *dest, const void *src, uint64_t size);
 
 int cuda_memcpy_async_to_gpu(void *dest, void *src, uint64_t size,
                              cuda_stream_t *stream);
 
+int cuda_memcpy_async_to_gpu_staged(void *dest, void *src, uint64_t size,
+                                    cuda_stream_t *stream);
+
 int cuda_memcpy_async_gpu_to_gpu(void *dest, void *src, uint64_t size,
                                  cuda_stream_t *stream);
 
@@ -69,6 +107,12 @@ int cuda_get_max_shared_memory(uint32_t gpu_index);
 
 int cuda_synchronize_stream(cuda_stream_t *stream);
 
+int cuda_get_scratch_arena_usage(cuda_stream_t *stream, uint64_t *current_usage,
+                                 uint64_t *peak_usage, uint64_t *capacity);
+
+int cuda_get_staging_pool_stats(cuda_stream_t *stream, uint64_t *bytes_staged,
+                                uint64_t *bytes_direct, uint64_t *stall_time_us);
+
 #define check_cuda_error(ans)                                                  \
   { cuda_error((ans), __FILE__, __LINE__); }
 inline void cuda_error(cudaError_t code, const char *file, int line,
@@ -82,7 +126,42 @@ inline void cuda_error(cudaError_t code, const char *file, int line,
 }
 }
 
+/*
+ *  Device capabilities used by the dispatch heuristics. They are queried once
+ *  per process for every visible GPU and then served from the registry.
+ */
+struct cuda_device_profile {
+  char name[256];
+  int major;
+  int minor;
+  int sm_count;
+  int shared_memory_per_block;
+  int shared_memory_per_sm;
+  bool cooperative_launch;
+  bool memory_pools;
+
+  // Same value as the one returned by cuda_get_max_shared_memory
+  int max_shared_memory() const {
+    return major >= 6 ? shared_memory_per_sm : shared_memory_per_block;
+  }
+};
+
+// Returns nullptr if gpu_index doesn't exist
+const cuda_device_profile *cuda_get_device_profile(uint32_t gpu_index);
+
+// Profile of the device currently selected by cudaSetDevice
+const cuda_device_profile *cuda_get_current_device_profile();
+
+// Replaces the registry content with synthetic profiles, so that dispatch
+// heuristics can be exercised without the matching hardware. Pointers
+// previously returned by the registry keep pointing to the old profiles.
+void cuda_set_device_profiles(const cuda_device_profile *profiles,
+                              uint32_t num_devices);
+
+// Drops the registry content, the devices are queried again on next access
+void cuda_reset_device_profiles();
+
 template <typename Torus>
-void cuda_set_value_async(cudaStream_t *stream, Torus *d_array, Torus value,
+void cuda_set_value_async(cuda_stream_t *stream, Torus *d_array, Torus value,
                           Torus n);
 #endif
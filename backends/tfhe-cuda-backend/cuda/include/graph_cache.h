@@ -0,0 +1,223 @@
+#ifndef CUDA_GRAPH_CACHE_H
+#define CUDA_GRAPH_CACHE_H
+
+#include "device.h"
+#include <cassert>
+#include <cstdint>
+#include <vector>
+
+/*
+ *  Operations the graph cache relies on. The device implementation records the
+ *  work enqueued on a stream into a CUDA graph, the host one keeps track of the
+ *  calls it receives so that the capture and replay logic can be checked on a
+ *  machine without a GPU.
+ */
+struct graph_launcher {
+  virtual void begin_capture(cuda_stream_t *stream) = 0;
+  // Returns the executable graph holding the captured work. previous, when not
+  // nullptr, is updated in place and returned if its topology matches the
+  // capture, otherwise a new graph is instantiated and previous is left as is.
+  // Returns nullptr if the graph could not be instantiated.
+  virtual void *end_capture(cuda_stream_t *stream, void *previous) = 0;
+  virtual void launch(void *graph, cuda_stream_t *stream) = 0;
+  // graph may still be running on stream
+  virtual void destroy(void *graph, cuda_stream_t *stream) = 0;
+  virtual ~graph_launcher() {}
+};
+
+struct device_graph_launcher : graph_launcher {
+  void begin_capture(cuda_stream_t *stream) override {
+    cudaSetDevice(stream->gpu_index);
+    // Thread local, so that other host threads working on their own streams
+    // don't invalidate the capture
+    check_cuda_error(cudaStreamBeginCapture(stream->stream,
+                                            cudaStreamCaptureModeThreadLocal));
+  }
+  void *end_capture(cuda_stream_t *stream, void *previous) override {
+    cudaSetDevice(stream->gpu_index);
+    cudaGraph_t graph;
+    check_cuda_error(cudaStreamEndCapture(stream->stream, &graph));
+#if CUDART_VERSION >= 12000
+    if (previous != nullptr) {
+      // Rewrites the kernel parameters of the nodes, launches already enqueued
+      // keep the previous ones
+      cudaGraphExecUpdateResultInfo info;
+      if (cudaGraphExecUpdate((cudaGraphExec_t)previous, graph, &info) ==
+          cudaSuccess) {
+        cudaGraphDestroy(graph);
+        return previous;
+      }
+      cudaGetLastError();
+    }
+#endif
+    cudaGraphExec_t graph_exec;
+    cudaError_t status = cudaGraphInstantiateWithFlags(&graph_exec, graph, 0);
+    cudaGraphDestroy(graph);
+    if (status != cudaSuccess) {
+      // Clear the error so that it does not leak into later checks
+      cudaGetLastError();
+      return nullptr;
+    }
+    return (void *)graph_exec;
+  }
+  void launch(void *graph, cuda_stream_t *stream) override {
+    cudaSetDevice(stream->gpu_index);
+    check_cuda_error(cudaGraphLaunch((cudaGraphExec_t)graph, stream->stream));
+  }
+  void destroy(void *graph, cuda_stream_t *stream) override {
+    cudaSetDevice(stream->gpu_index);
+    // A graph still in flight is freed by the driver once it completes, no
+    // need to wait for the stream
+    cudaGraphExecDestroy((cudaGraphExec_t)graph);
+  }
+};
+
+// Host stand-in: graphs are plain handles and nothing is executed. Failed
+// instantiations and updates can be simulated to exercise the fallback paths.
+struct host_graph_launcher : graph_launcher {
+  bool fail_instantiation = false;
+  bool fail_update = false;
+  bool capturing = false;
+  uint64_t num_captures = 0;
+  uint64_t num_updates = 0;
+  uint64_t num_launches = 0;
+  uint64_t num_destroyed = 0;
+  uint64_t next_graph = 1;
+
+  void begin_capture(cuda_stream_t *) override {
+    assert(("Error (graph cache): nested capture", !capturing));
+    capturing = true;
+  }
+  void *end_capture(cuda_stream_t *, void *previous) override {
+    assert(("Error (graph cache): no capture in progress", capturing));
+    capturing = false;
+    num_captures++;
+    if (previous != nullptr && !fail_update) {
+      num_updates++;
+      return previous;
+    }
+    if (fail_instantiation)
+      return nullptr;
+    return (void *)next_graph++;
+  }
+  void launch(void *, cuda_stream_t *) override {
+    assert(("Error (graph cache): launch during capture", !capturing));
+    num_launches++;
+  }
+  void destroy(void *, cuda_stream_t *) override { num_destroyed++; }
+  // Graphs instantiated and not destroyed yet
+  uint64_t num_live() const { return next_graph - 1 - num_destroyed; }
+};
+
+/*
+ *  Replays the kernel sequence of an integer operation from a CUDA graph.
+ *
+ *  An operation is identified by a shape key holding the parameters its kernel
+ *  sequence depends on, e.g. the number of blocks, and is called with a list of
+ *  device pointers. The first call with a given shape runs eagerly, which also
+ *  lets the operation refresh the lookup tables it generates lazily. The second
+ *  call captures the work into a graph and launches it, later calls with the
+ *  same shape and pointers only launch the graph. A call with the same shape
+ *  and other pointers captures the work again and updates the kernel
+ *  parameters of the existing graph in place, which is much cheaper than
+ *  instantiating a new one. A call with another shape drops the graph and
+ *  starts over.
+ *
+ *  Replays read the current contents of device memory, but whatever the
+ *  operation decided on the host is frozen at capture time. invalidate() has
+ *  to be called when such a decision changes without the shape changing, e.g.
+ *  the multi-bit PBS chunk size after tuning. Operations that synchronize with
+ *  the host or use other streams must not go through the cache.
+ */
+struct graph_cache {
+  graph_launcher *launcher;
+  bool owns_launcher;
+
+  std::vector<uint64_t> key;
+  // Pointers the graph was captured or last updated with
+  std::vector<const void *> pointers;
+  // Whether the operation already ran eagerly with key
+  bool warm = false;
+  // Set when the graph for key could not be instantiated, the operation then
+  // keeps running eagerly until the key changes
+  bool capture_failed = false;
+  void *graph = nullptr;
+
+  uint64_t num_eager_runs = 0;
+  // Captures, including the ones only used to update the graph in place
+  uint64_t num_captures = 0;
+  uint64_t num_updates = 0;
+  uint64_t num_replays = 0;
+
+  graph_cache(graph_launcher *launcher, bool owns_launcher)
+      : launcher(launcher), owns_launcher(owns_launcher) {}
+
+  ~graph_cache() {
+    assert(("Error (graph cache): released without its stream",
+            graph == nullptr));
+    if (owns_launcher)
+      delete launcher;
+  }
+
+  // Enqueues work(), a callable taking no argument, on stream
+  template <typename Work>
+  void run(cuda_stream_t *stream, const std::vector<uint64_t> &shape,
+           const std::vector<const void *> &call_pointers, Work &&work) {
+    if (shape != key) {
+      invalidate(stream);
+      key = shape;
+    }
+
+    if (graph != nullptr && call_pointers == pointers) {
+      launcher->launch(graph, stream);
+      num_replays++;
+      return;
+    }
+
+    if (!warm || capture_failed) {
+      work();
+      warm = true;
+      num_eager_runs++;
+      return;
+    }
+
+    launcher->begin_capture(stream);
+    work();
+    void *captured = launcher->end_capture(stream, graph);
+    num_captures++;
+    if (graph != nullptr && captured == graph)
+      num_updates++;
+    else if (graph != nullptr)
+      launcher->destroy(graph, stream);
+    graph = captured;
+    pointers = call_pointers;
+    if (graph == nullptr) {
+      // Nothing was executed during the capture
+      capture_failed = true;
+      work();
+      num_eager_runs++;
+      return;
+    }
+    launcher->launch(graph, stream);
+  }
+
+  // Drops the graph without waiting for it to complete, the next call runs
+  // eagerly
+  void invalidate(cuda_stream_t *stream) {
+    if (graph != nullptr)
+      launcher->destroy(graph, stream);
+    graph = nullptr;
+    key.clear();
+    pointers.clear();
+    warm = false;
+    capture_failed = false;
+  }
+
+  void release(cuda_stream_t *stream) { invalidate(stream); }
+};
+
+// Cooperative kernels, which the PBS may launch, can only be captured from
+// CUDA 12 on
+inline bool cuda_graph_capture_supported() { return CUDART_VERSION >= 12000; }
+
+#endif // CUDA_GRAPH_CACHE_H
@@ -3,6 +3,10 @@
 
 #include "bootstrap.h"
 #include "bootstrap_multibit.h"
+#include "graph_cache.h"
+#include "radix_carry_simulation.h"
+#include "radix_mult_plan.h"
+#include "scratch_arena.h"
 #include <cassert>
 #include <cmath>
 #include <functional>
@@ -60,6 +64,20 @@ void generate_device_accumulator(cuda_stream_t *stream, Torus *acc,
                                  uint32_t carry_modulus,
                                  std::function<Torus(Torus)> f);
 
+/*
+ *  generate many-LUT accumulator for device pointer
+ *    v_stream - cuda stream
+ *    acc - device pointer for accumulator
+ *    ...
+ *    functions - evaluating functions with one Torus input, packed in the
+ *    accumulator as described in many_lut.h
+ */
+template <typename Torus>
+void generate_device_many_lut_accumulator(
+    cuda_stream_t *stream, Torus *acc, uint32_t glwe_dimension,
+    uint32_t polynomial_size, uint32_t message_modulus, uint32_t carry_modulus,
+    const std::vector<std::function<Torus(Torus)>> &functions);
+
 extern "C" {
 void scratch_cuda_full_propagation_64(
     cuda_stream_t *stream, int8_t **mem_ptr, uint32_t lwe_dimension,
@@ -68,6 +86,12 @@ void scratch_cuda_full_propagation_64(
     uint32_t message_modulus, uint32_t carry_modulus, PBS_TYPE pbs_type,
     bool allocate_gpu_memory);
 
+uint64_t get_buffer_size_full_propagation_64(
+    uint32_t gpu_index, uint32_t lwe_dimension, uint32_t glwe_dimension,
+    uint32_t polynomial_size, uint32_t level_count, uint32_t grouping_factor,
+    uint32_t input_lwe_ciphertext_count, uint32_t message_modulus,
+    uint32_t carry_modulus, PBS_TYPE pbs_type);
+
 void cuda_full_propagation_64_inplace(
     cuda_stream_t *stream, void *input_blocks, int8_t *mem_ptr, void *ksk,
     void *bsk, uint32_t lwe_dimension, uint32_t glwe_dimension,
@@ -84,7 +108,15 @@ void scratch_cuda_integer_mult_radix_ciphertext_kb_64(
     uint32_t polynomial_size, uint32_t pbs_base_log, uint32_t pbs_level,
     uint32_t ks_base_log, uint32_t ks_level, uint32_t grouping_factor,
     uint32_t num_blocks, PBS_TYPE pbs_type, uint32_t max_shared_memory,
-    bool allocate_gpu_memory);
+    bool allocate_gpu_memory, uint32_t karatsuba_threshold);
+
+uint64_t get_buffer_size_integer_mult_radix_ciphertext_kb_64(
+    uint32_t gpu_index, uint32_t message_modulus, uint32_t carry_modulus,
+    uint32_t glwe_dimension, uint32_t lwe_dimension, uint32_t polynomial_size,
+    uint32_t pbs_base_log, uint32_t pbs_level, uint32_t ks_base_log,
+    uint32_t ks_level, uint32_t grouping_factor, uint32_t num_blocks,
+    PBS_TYPE pbs_type, uint32_t max_shared_memory,
+    uint32_t karatsuba_threshold);
 
 void cuda_integer_mult_radix_ciphertext_kb_64(
     cuda_stream_t *stream, void *radix_lwe_out, void *radix_lwe_left,
@@ -97,6 +129,11 @@ void cuda_integer_mult_radix_ciphertext_kb_64(
 
 void cleanup_cuda_integer_mult(cuda_stream_t *stream, int8_t **mem_ptr_void);
 
+void enable_graph_cuda_integer_mult(cuda_stream_t *stream, int8_t *mem_ptr);
+
+void invalidate_graph_cuda_integer_mult(cuda_stream_t *stream,
+                                        int8_t *mem_ptr);
+
 void cuda_negate_integer_radix_ciphertext_64_inplace(
     cuda_stream_t *stream, void *lwe_array, uint32_t lwe_dimension,
     uint32_t lwe_ciphertext_count, uint32_t message_modulus,
@@ -123,6 +160,13 @@ void scratch_cuda_integer_radix_scalar_shift_kb_64(
     uint32_t num_blocks, uint32_t message_modulus, uint32_t carry_modulus,
     PBS_TYPE pbs_type, SHIFT_TYPE shift_type, bool allocate_gpu_memory);
 
+uint64_t get_buffer_size_integer_radix_scalar_shift_kb_64(
+    uint32_t gpu_index, uint32_t glwe_dimension, uint32_t polynomial_size,
+    uint32_t big_lwe_dimension, uint32_t small_lwe_dimension, uint32_t ks_level,
+    uint32_t ks_base_log, uint32_t pbs_level, uint32_t pbs_base_log,
+    uint32_t grouping_factor, uint32_t num_blocks, uint32_t message_modulus,
+    uint32_t carry_modulus, PBS_TYPE pbs_type, SHIFT_TYPE shift_type);
+
 void cuda_integer_radix_scalar_shift_kb_64_inplace(
     cuda_stream_t *stream, void *lwe_array, uint32_t shift, int8_t *mem_ptr,
     void *bsk, void *ksk, uint32_t num_blocks);
@@ -139,6 +183,14 @@ void scratch_cuda_integer_radix_comparison_kb_64(
     uint32_t carry_modulus, PBS_TYPE pbs_type, COMPARISON_TYPE op_type,
     bool allocate_gpu_memory);
 
+uint64_t get_buffer_size_integer_radix_comparison_kb_64(
+    uint32_t gpu_index, uint32_t glwe_dimension, uint32_t polynomial_size,
+    uint32_t big_lwe_dimension, uint32_t small_lwe_dimension, uint32_t ks_level,
+    uint32_t ks_base_log, uint32_t pbs_level, uint32_t pbs_base_log,
+    uint32_t grouping_factor, uint32_t lwe_ciphertext_count,
+    uint32_t message_modulus, uint32_t carry_modulus, PBS_TYPE pbs_type,
+    COMPARISON_TYPE op_type);
+
 void cuda_comparison_integer_radix_ciphertext_kb_64(
     cuda_stream_t *stream, void *lwe_array_out, void *lwe_array_1,
     void *lwe_array_2, int8_t *mem_ptr, void *bsk, void *ksk,
@@ -152,6 +204,12 @@ void cuda_scalar_comparison_integer_radix_ciphertext_kb_64(
 void cleanup_cuda_integer_comparison(cuda_stream_t *stream,
                                      int8_t **mem_ptr_void);
 
+void enable_graph_cuda_integer_comparison(cuda_stream_t *stream,
+                                          int8_t *mem_ptr);
+
+void invalidate_graph_cuda_integer_comparison(cuda_stream_t *stream,
+                                              int8_t *mem_ptr);
+
 void scratch_cuda_integer_radix_bitop_kb_64(
     cuda_stream_t *stream, int8_t **mem_ptr, uint32_t glwe_dimension,
     uint32_t polynomial_size, uint32_t big_lwe_dimension,
@@ -161,6 +219,14 @@ void scratch_cuda_integer_radix_bitop_kb_64(
     uint32_t carry_modulus, PBS_TYPE pbs_type, BITOP_TYPE op_type,
     bool allocate_gpu_memory);
 
+uint64_t get_buffer_size_integer_radix_bitop_kb_64(
+    uint32_t gpu_index, uint32_t glwe_dimension, uint32_t polynomial_size,
+    uint32_t big_lwe_dimension, uint32_t small_lwe_dimension, uint32_t ks_level,
+    uint32_t ks_base_log, uint32_t pbs_level, uint32_t pbs_base_log,
+    uint32_t grouping_factor, uint32_t lwe_ciphertext_count,
+    uint32_t message_modulus, uint32_t carry_modulus, PBS_TYPE pbs_type,
+    BITOP_TYPE op_type);
+
 void cuda_bitop_integer_radix_ciphertext_kb_64(
     cuda_stream_t *stream, void *lwe_array_out, void *lwe_array_1,
     void *lwe_array_2, int8_t *mem_ptr, void *bsk, void *ksk,
@@ -185,6 +251,13 @@ void scratch_cuda_integer_radix_cmux_kb_64(
     uint32_t lwe_ciphertext_count, uint32_t message_modulus,
     uint32_t carry_modulus, PBS_TYPE pbs_type, bool allocate_gpu_memory);
 
+uint64_t get_buffer_size_integer_radix_cmux_kb_64(
+    uint32_t gpu_index, uint32_t glwe_dimension, uint32_t polynomial_size,
+    uint32_t big_lwe_dimension, uint32_t small_lwe_dimension, uint32_t ks_level,
+    uint32_t ks_base_log, uint32_t pbs_level, uint32_t pbs_base_log,
+    uint32_t grouping_factor, uint32_t lwe_ciphertext_count,
+    uint32_t message_modulus, uint32_t carry_modulus, PBS_TYPE pbs_type);
+
 void cuda_cmux_integer_radix_ciphertext_kb_64(
     cuda_stream_t *stream, void *lwe_array_out, void *lwe_condition,
     void *lwe_array_true, void *lwe_array_false, int8_t *mem_ptr, void *bsk,
@@ -201,6 +274,13 @@ void scratch_cuda_integer_radix_scalar_rotate_kb_64(
     uint32_t num_blocks, uint32_t message_modulus, uint32_t carry_modulus,
     PBS_TYPE pbs_type, SHIFT_TYPE shift_type, bool allocate_gpu_memory);
 
+uint64_t get_buffer_size_integer_radix_scalar_rotate_kb_64(
+    uint32_t gpu_index, uint32_t glwe_dimension, uint32_t polynomial_size,
+    uint32_t big_lwe_dimension, uint32_t small_lwe_dimension, uint32_t ks_level,
+    uint32_t ks_base_log, uint32_t pbs_level, uint32_t pbs_base_log,
+    uint32_t grouping_factor, uint32_t num_blocks, uint32_t message_modulus,
+    uint32_t carry_modulus, PBS_TYPE pbs_type, SHIFT_TYPE shift_type);
+
 void cuda_integer_radix_scalar_rotate_kb_64_inplace(cuda_stream_t *stream,
                                                     void *lwe_array, uint32_t n,
                                                     int8_t *mem_ptr, void *bsk,
@@ -216,7 +296,14 @@ void scratch_cuda_propagate_single_carry_low_latency_kb_64_inplace(
     uint32_t small_lwe_dimension, uint32_t ks_level, uint32_t ks_base_log,
     uint32_t pbs_level, uint32_t pbs_base_log, uint32_t grouping_factor,
     uint32_t num_blocks, uint32_t message_modulus, uint32_t carry_modulus,
-    PBS_TYPE pbs_type, bool allocate_gpu_memory);
+    PBS_TYPE pbs_type, CARRY_SCAN_TYPE scan_type, bool allocate_gpu_memory);
+
+uint64_t get_buffer_size_propagate_single_carry_low_latency_kb_64_inplace(
+    uint32_t gpu_index, uint32_t glwe_dimension, uint32_t polynomial_size,
+    uint32_t big_lwe_dimension, uint32_t small_lwe_dimension, uint32_t ks_level,
+    uint32_t ks_base_log, uint32_t pbs_level, uint32_t pbs_base_log,
+    uint32_t grouping_factor, uint32_t num_blocks, uint32_t message_modulus,
+    uint32_t carry_modulus, PBS_TYPE pbs_type, CARRY_SCAN_TYPE scan_type);
 
 void cuda_propagate_single_carry_low_latency_kb_64_inplace(
     cuda_stream_t *stream, void *lwe_array, int8_t *mem_ptr, void *bsk,
@@ -224,6 +311,63 @@ void cuda_propagate_single_carry_low_latency_kb_64_inplace(
 
 void cleanup_cuda_propagate_single_carry_low_latency(cuda_stream_t *stream,
                                                      int8_t **mem_ptr_void);
+
+void enable_graph_cuda_propagate_single_carry_low_latency(
+    cuda_stream_t *stream, int8_t *mem_ptr);
+
+void invalidate_graph_cuda_propagate_single_carry_low_latency(
+    cuda_stream_t *stream, int8_t *mem_ptr);
+
+void scratch_cuda_full_propagation_tree_kb_64_inplace(
+    cuda_stream_t *stream, int8_t **mem_ptr, uint32_t glwe_dimension,
+    uint32_t polynomial_size, uint32_t big_lwe_dimension,
+    uint32_t small_lwe_dimension, uint32_t ks_level, uint32_t ks_base_log,
+    uint32_t pbs_level, uint32_t pbs_base_log, uint32_t grouping_factor,
+    uint32_t num_blocks, uint32_t message_modulus, uint32_t carry_modulus,
+    PBS_TYPE pbs_type, bool allocate_gpu_memory);
+
+uint64_t get_buffer_size_full_propagation_tree_kb_64_inplace(
+    uint32_t gpu_index, uint32_t glwe_dimension, uint32_t polynomial_size,
+    uint32_t big_lwe_dimension, uint32_t small_lwe_dimension, uint32_t ks_level,
+    uint32_t ks_base_log, uint32_t pbs_level, uint32_t pbs_base_log,
+    uint32_t grouping_factor, uint32_t num_blocks, uint32_t message_modulus,
+    uint32_t carry_modulus, PBS_TYPE pbs_type);
+
+void cuda_full_propagation_tree_kb_64_inplace(cuda_stream_t *stream,
+                                              void *lwe_array, int8_t *mem_ptr,
+                                              void *bsk, void *ksk,
+                                              uint32_t num_blocks);
+
+void cleanup_cuda_full_propagation_tree(cuda_stream_t *stream,
+                                        int8_t **mem_ptr_void);
+}
+
+/*
+ *  Device memory allocated by a scratch function, in bytes. The scratch
+ *  function runs on a measuring stream, so the sizes come from the same code
+ *  as the real allocations. The scratch arena counts for the chunks it holds,
+ *  which is what it takes from the device.
+ */
+template <typename Buffer>
+uint64_t get_scratch_buffer_size(
+    uint32_t gpu_index,
+    std::function<void(cuda_stream_t *, int8_t **)> scratch,
+    std::function<void(cuda_stream_t *, int8_t **)> cleanup) {
+  cuda_stream_t *stream = cuda_create_measuring_stream(gpu_index);
+  int8_t *mem_ptr = nullptr;
+  scratch(stream, &mem_ptr);
+
+  uint64_t size = stream->measured_bytes;
+  if (stream->arena != nullptr)
+    size += stream->arena->capacity;
+
+  if (mem_ptr != nullptr) {
+    cleanup(stream, &mem_ptr);
+    delete (Buffer *)mem_ptr;
+  }
+  cuda_destroy_stream(stream);
+  delete stream;
+  return size;
 }
 
 struct int_radix_params {
@@ -273,13 +417,13 @@ template <typename Torus> struct int_radix_lut {
   uint32_t num_blocks;
   bool mem_reuse = false;
 
-  int8_t *pbs_buffer;
+  int8_t *pbs_buffer = nullptr;
 
-  Torus *lut_indexes;
-  Torus *lwe_indexes;
+  Torus *lut_indexes = nullptr;
+  Torus *lwe_indexes = nullptr;
 
-  Torus *tmp_lwe_before_ks;
-  Torus *tmp_lwe_after_ks;
+  Torus *tmp_lwe_before_ks = nullptr;
+  Torus *tmp_lwe_after_ks = nullptr;
 
   Torus *lut = nullptr;
 
@@ -299,15 +443,18 @@ template <typename Torus> struct int_radix_lut {
     ///////////////
     // PBS
     if (params.pbs_type == MULTI_BIT) {
-      // Only 64 bits is supported
-      static_assert(
-          sizeof(Torus) == 8,
-          "Error (GPU multi bit PBS): only 64 bits Torus is supported");
-      scratch_cuda_multi_bit_pbs_64(
-          stream, &pbs_buffer, params.small_lwe_dimension,
-          params.glwe_dimension, params.polynomial_size, params.pbs_level,
-          params.grouping_factor, num_radix_blocks,
-          cuda_get_max_shared_memory(stream->gpu_index), allocate_gpu_memory);
+      if (sizeof(Torus) == sizeof(uint32_t))
+        scratch_cuda_multi_bit_pbs_32(
+            stream, &pbs_buffer, params.small_lwe_dimension,
+            params.glwe_dimension, params.polynomial_size, params.pbs_level,
+            params.grouping_factor, num_radix_blocks,
+            cuda_get_max_shared_memory(stream->gpu_index), allocate_gpu_memory);
+      else
+        scratch_cuda_multi_bit_pbs_64(
+            stream, &pbs_buffer, params.small_lwe_dimension,
+            params.glwe_dimension, params.polynomial_size, params.pbs_level,
+            params.grouping_factor, num_radix_blocks,
+            cuda_get_max_shared_memory(stream->gpu_index), allocate_gpu_memory);
     } else {
       // Classic
       // We only use low latency for classic mode
@@ -317,19 +464,22 @@ template <typename Torus> struct int_radix_lut {
             params.pbs_level, num_radix_blocks,
             cuda_get_max_shared_memory(stream->gpu_index), allocate_gpu_memory);
       else
-        scratch_cuda_bootstrap_low_latency_64(
-            stream, &pbs_buffer, params.glwe_dimension, params.polynomial_size,
-            params.pbs_level, num_radix_blocks,
-            cuda_get_max_shared_memory(stream->gpu_index), allocate_gpu_memory);
+        // Also sets up the fused keyswitch and PBS of the 64-bit LUTs
+        scratch_cuda_keyswitch_bootstrap_low_latency_64(
+            stream, &pbs_buffer, params.small_lwe_dimension,
+            params.glwe_dimension, params.polynomial_size, params.pbs_level,
+            num_radix_blocks, cuda_get_max_shared_memory(stream->gpu_index),
+            allocate_gpu_memory);
     }
 
     if (allocate_gpu_memory) {
+      auto arena = get_scratch_arena(stream);
       // Allocate LUT
       // LUT is used as a trivial encryption and must be initialized outside
       // this contructor
-      lut = (Torus *)cuda_malloc_async(num_luts * lut_buffer_size, stream);
+      lut = (Torus *)arena->allocate(num_luts * lut_buffer_size);
 
-      lut_indexes = (Torus *)cuda_malloc_async(lut_indexes_size, stream);
+      lut_indexes = (Torus *)arena->allocate(lut_indexes_size);
 
       // lut_indexes is initialized to 0 by default
       // if a different behavior is wanted, it should be rewritten later
@@ -337,20 +487,19 @@ template <typename Torus> struct int_radix_lut {
 
       // lwe_(input/output)_indexes are initialized to range(num_radix_blocks)
       // by default
-      lwe_indexes = (Torus *)cuda_malloc(num_radix_blocks * sizeof(Torus),
-                                         stream->gpu_index);
+      lwe_indexes = (Torus *)arena->allocate(num_radix_blocks * sizeof(Torus));
       auto h_lwe_indexes = (Torus *)malloc(num_radix_blocks * sizeof(Torus));
 
       for (int i = 0; i < num_radix_blocks; i++)
         h_lwe_indexes[i] = i;
 
-      cuda_memcpy_to_gpu(lwe_indexes, h_lwe_indexes,
-                         num_radix_blocks * sizeof(Torus));
+      cuda_memcpy_async_to_gpu_staged(lwe_indexes, h_lwe_indexes,
+                                      num_radix_blocks * sizeof(Torus), stream);
       free(h_lwe_indexes);
 
       // Keyswitch
-      tmp_lwe_before_ks = (Torus *)cuda_malloc_async(big_size, stream);
-      tmp_lwe_after_ks = (Torus *)cuda_malloc_async(small_size, stream);
+      tmp_lwe_before_ks = (Torus *)arena->allocate(big_size);
+      tmp_lwe_after_ks = (Torus *)arena->allocate(small_size);
     }
   }
 
@@ -378,12 +527,13 @@ template <typename Torus> struct int_radix_lut {
 
     mem_reuse = true;
 
+    auto arena = get_scratch_arena(stream);
     // Allocate LUT
     // LUT is used as a trivial encryption and must be initialized outside
     // this contructor
-    lut = (Torus *)cuda_malloc_async(num_luts * lut_buffer_size, stream);
+    lut = (Torus *)arena->allocate(num_luts * lut_buffer_size);
 
-    lut_indexes = (Torus *)cuda_malloc_async(lut_indexes_size, stream);
+    lut_indexes = (Torus *)arena->allocate(lut_indexes_size);
 
     // lut_indexes is initialized to 0 by default
     // if a different behavior is wanted, it should be rewritten later
@@ -391,15 +541,14 @@ template <typename Torus> struct int_radix_lut {
 
     // lwe_(input/output)_indexes are initialized to range(num_radix_blocks)
     // by default
-    lwe_indexes = (Torus *)cuda_malloc(num_radix_blocks * sizeof(Torus),
-                                       stream->gpu_index);
+    lwe_indexes = (Torus *)arena->allocate(num_radix_blocks * sizeof(Torus));
     auto h_lwe_indexes = (Torus *)malloc(num_radix_blocks * sizeof(Torus));
 
     for (int i = 0; i < num_radix_blocks; i++)
       h_lwe_indexes[i] = i;
 
-    cuda_memcpy_to_gpu(lwe_indexes, h_lwe_indexes,
-                       num_radix_blocks * sizeof(Torus));
+    cuda_memcpy_async_to_gpu_staged(lwe_indexes, h_lwe_indexes,
+                                    num_radix_blocks * sizeof(Torus), stream);
     free(h_lwe_indexes);
   }
 
@@ -409,15 +558,18 @@ template <typename Torus> struct int_radix_lut {
   }
 
   Torus *get_tvi(size_t ind) { return &lut_indexes[ind]; }
+  // The scratch arena needs the reverse order of the constructors, and the
+  // LUTs reusing this one's memory to be released first
   void release(cuda_stream_t *stream) {
-    cuda_drop_async(lut_indexes, stream);
-    cuda_drop_async(lwe_indexes, stream);
-    cuda_drop_async(lut, stream);
+    auto arena = get_scratch_arena(stream);
     if (!mem_reuse) {
       cuda_drop_async(pbs_buffer, stream);
-      cuda_drop_async(tmp_lwe_before_ks, stream);
-      cuda_drop_async(tmp_lwe_after_ks, stream);
+      arena->release(tmp_lwe_after_ks);
+      arena->release(tmp_lwe_before_ks);
     }
+    arena->release(lwe_indexes);
+    arena->release(lut_indexes);
+    arena->release(lut);
   }
 };
 
@@ -433,10 +585,37 @@ template <typename Torus> struct int_fullprop_buffer {
   Torus *tmp_big_lwe_vector;
 };
 
+/*
+ *  Rough number of PBS a GPU runs at once for these parameters: each sample
+ *  of the low latency and multi-bit PBS is spread over
+ *  (glwe_dimension + 1) * pbs_level thread blocks, about one per SM.
+ */
+inline uint32_t get_concurrent_pbs_estimate(uint32_t gpu_index,
+                                            int_radix_params params) {
+  auto profile = cuda_get_device_profile(gpu_index);
+  if (profile == nullptr)
+    return 1;
+  uint32_t blocks_per_sample =
+      params.pbs_type == AMORTIZED
+          ? 1
+          : (params.glwe_dimension + 1) * params.pbs_level;
+  uint32_t concurrent_pbs = profile->sm_count / blocks_per_sample;
+  return concurrent_pbs > 0 ? concurrent_pbs : 1;
+}
+
 template <typename Torus> struct int_sc_prop_memory {
   Torus *generates_or_propagates;
   Torus *step_output;
 
+  // Prefix scan of the carry flags. For every round, scan_rounds holds the
+  // offset of the round in scan_indexes and its number of pairs, and
+  // scan_indexes holds the dst blocks of the pairs followed by the src ones.
+  // Hillis-Steele scans don't use them. Hillis-Steele is the default, the
+  // other scans are opted in by the caller.
+  CARRY_SCAN_TYPE scan_type;
+  std::vector<std::pair<uint32_t, uint32_t>> scan_rounds;
+  Torus *scan_indexes = nullptr;
+
   // test_vector_array[2] = {lut_does_block_generate_carry,
   // lut_does_block_generate_or_propagate}
   int_radix_lut<Torus> *test_vector_array;
@@ -445,8 +624,12 @@ template <typename Torus> struct int_sc_prop_memory {
 
   int_radix_params params;
 
+  // Set by enable_graph_cuda_propagate_single_carry_low_latency
+  graph_cache *graph = nullptr;
+
   int_sc_prop_memory(cuda_stream_t *stream, int_radix_params params,
-                     uint32_t num_radix_blocks, bool allocate_gpu_memory) {
+                     uint32_t num_radix_blocks, bool allocate_gpu_memory,
+                     CARRY_SCAN_TYPE scan_type = CARRY_SCAN_HILLIS_STEELE) {
     this->params = params;
     auto glwe_dimension = params.glwe_dimension;
     auto polynomial_size = params.polynomial_size;
@@ -456,10 +639,11 @@ template <typename Torus> struct int_sc_prop_memory {
     auto big_lwe_size_bytes = big_lwe_size * sizeof(Torus);
 
     // allocate memory for intermediate calculations
-    generates_or_propagates = (Torus *)cuda_malloc_async(
-        num_radix_blocks * big_lwe_size_bytes, stream);
-    step_output = (Torus *)cuda_malloc_async(
-        num_radix_blocks * big_lwe_size_bytes, stream);
+    auto arena = get_scratch_arena(stream);
+    generates_or_propagates =
+        (Torus *)arena->allocate(num_radix_blocks * big_lwe_size_bytes);
+    step_output =
+        (Torus *)arena->allocate(num_radix_blocks * big_lwe_size_bytes);
 
     // declare functions for test vector generation
     auto f_lut_does_block_generate_carry = [message_modulus](Torus x) -> Torus {
@@ -506,8 +690,7 @@ template <typename Torus> struct int_sc_prop_memory {
         stream, lut_does_block_generate_or_propagate, glwe_dimension,
         polynomial_size, message_modulus, carry_modulus,
         f_lut_does_block_generate_or_propagate);
-    cuda_set_value_async<Torus>(&(stream->stream),
-                                test_vector_array->get_tvi(1), 1,
+    cuda_set_value_async<Torus>(stream, test_vector_array->get_tvi(1), 1,
                                 num_radix_blocks - 1);
 
     generate_device_accumulator_bivariate<Torus>(
@@ -517,15 +700,46 @@ template <typename Torus> struct int_sc_prop_memory {
     generate_device_accumulator<Torus>(stream, message_acc->lut, glwe_dimension,
                                        polynomial_size, message_modulus,
                                        carry_modulus, f_message_acc);
+
+    if (scan_type == CARRY_SCAN_AUTO)
+      scan_type = select_carry_scan_type(
+          num_radix_blocks,
+          get_concurrent_pbs_estimate(stream->gpu_index, params));
+    this->scan_type = scan_type;
+    if (scan_type != CARRY_SCAN_HILLIS_STEELE) {
+      std::vector<Torus> h_scan_indexes;
+      for (auto &round : generate_carry_scan(scan_type, num_radix_blocks)) {
+        scan_rounds.push_back(
+            {(uint32_t)h_scan_indexes.size(), (uint32_t)round.size()});
+        for (auto &pair : round)
+          h_scan_indexes.push_back(pair.first);
+        for (auto &pair : round)
+          h_scan_indexes.push_back(pair.second);
+      }
+      if (!h_scan_indexes.empty()) {
+        auto scan_indexes_size = h_scan_indexes.size() * sizeof(Torus);
+        scan_indexes = (Torus *)arena->allocate(scan_indexes_size);
+        cuda_memcpy_async_to_gpu_staged(scan_indexes, h_scan_indexes.data(),
+                                        scan_indexes_size, stream);
+      }
+    }
   }
 
   void release(cuda_stream_t *stream) {
-    cuda_drop_async(generates_or_propagates, stream);
-    cuda_drop_async(step_output, stream);
+    if (graph != nullptr) {
+      graph->release(stream);
+      delete graph;
+    }
+
+    auto arena = get_scratch_arena(stream);
+    arena->release(scan_indexes);
 
-    test_vector_array->release(stream);
-    lut_carry_propagation_sum->release(stream);
     message_acc->release(stream);
+    lut_carry_propagation_sum->release(stream);
+    test_vector_array->release(stream);
+
+    arena->release(step_output);
+    arena->release(generates_or_propagates);
 
     delete test_vector_array;
     delete lut_carry_propagation_sum;
@@ -533,6 +747,213 @@ template <typename Torus> struct int_sc_prop_memory {
   }
 };
 
+template <typename Torus> struct int_fullprop_tree_memory {
+  // num_radix_blocks copies of the input followed by num_radix_blocks more,
+  // turned into the messages and the carries by message_carry_lut
+  Torus *messages_and_carries;
+
+  // message_carry_lut[2] = {message_acc, carry_acc}, applied to
+  // 2 * num_radix_blocks blocks
+  int_radix_lut<Torus> *message_carry_lut;
+  int_sc_prop_memory<Torus> *sc_prop_mem;
+
+  // Number of message/carry split rounds before every block outputs at most
+  // one carry, see get_full_propagation_tree_split_rounds
+  uint32_t num_split_rounds;
+
+  int_radix_params params;
+
+  int_fullprop_tree_memory(cuda_stream_t *stream, int_radix_params params,
+                           uint32_t num_radix_blocks,
+                           bool allocate_gpu_memory) {
+    this->params = params;
+    auto glwe_dimension = params.glwe_dimension;
+    auto polynomial_size = params.polynomial_size;
+    auto message_modulus = params.message_modulus;
+    auto carry_modulus = params.carry_modulus;
+    auto big_lwe_size = (polynomial_size * glwe_dimension + 1);
+    auto big_lwe_size_bytes = big_lwe_size * sizeof(Torus);
+
+    num_split_rounds =
+        get_full_propagation_tree_split_rounds(message_modulus, carry_modulus);
+
+    auto arena = get_scratch_arena(stream);
+    messages_and_carries =
+        (Torus *)arena->allocate(2 * num_radix_blocks * big_lwe_size_bytes);
+
+    auto f_message_acc = [message_modulus](Torus x) -> Torus {
+      return x % message_modulus;
+    };
+    auto f_carry_acc = [message_modulus](Torus x) -> Torus {
+      return x / message_modulus;
+    };
+
+    message_carry_lut = new int_radix_lut<Torus>(
+        stream, params, 2, 2 * num_radix_blocks, allocate_gpu_memory);
+
+    generate_device_accumulator<Torus>(
+        stream, message_carry_lut->get_lut(0), glwe_dimension, polynomial_size,
+        message_modulus, carry_modulus, f_message_acc);
+    generate_device_accumulator<Torus>(
+        stream, message_carry_lut->get_lut(1), glwe_dimension, polynomial_size,
+        message_modulus, carry_modulus, f_carry_acc);
+    cuda_set_value_async<Torus>(stream,
+                                message_carry_lut->get_tvi(num_radix_blocks),
+                                1, num_radix_blocks);
+
+    sc_prop_mem = new int_sc_prop_memory<Torus>(
+        stream, params, num_radix_blocks, allocate_gpu_memory);
+  }
+
+  void release(cuda_stream_t *stream) {
+    sc_prop_mem->release(stream);
+    message_carry_lut->release(stream);
+
+    get_scratch_arena(stream)->release(messages_and_carries);
+
+    delete message_carry_lut;
+    delete sc_prop_mem;
+  }
+};
+
+/*
+ *  Buffers of a radix multiplication executed as a radix_mult_plan.
+ *  For every step, step_offsets holds its offset in step_indexes, where
+ *  - LUT steps store lhs[k], rhs[k], out[k] and lut[k], then carry_out[k] of
+ *    their leading many-LUT items
+ *  - SUM steps store out[k], the encoded constant[k], first_term[k],
+ *    num_terms[k], then the slot and the sign of every term
+ *  followed by the output slots, at output_offset.
+ */
+template <typename Torus> struct int_mul_plan_memory {
+  radix_mult_plan plan;
+  int_radix_params params;
+
+  Torus *slots;
+  // Two outputs per item in steps with many-LUT items
+  Torus *step_output;
+  Torus *step_indexes;
+  std::vector<uint64_t> step_offsets;
+  uint64_t output_offset;
+
+  // One LUT per RADIX_PLAN_LUT, lut_indexes is rewritten by every LUT step
+  int_radix_lut<Torus> *plan_luts;
+  uint32_t many_lut_stride;
+
+  int_mul_plan_memory(cuda_stream_t *stream, int_radix_params params,
+                      uint32_t num_radix_blocks, uint32_t karatsuba_threshold,
+                      bool allocate_gpu_memory) {
+    this->params = params;
+    auto glwe_dimension = params.glwe_dimension;
+    auto polynomial_size = params.polynomial_size;
+    auto message_modulus = params.message_modulus;
+    auto carry_modulus = params.carry_modulus;
+    auto big_lwe_size = params.big_lwe_dimension + 1;
+
+    auto scan_type = select_carry_scan_type(
+        num_radix_blocks,
+        get_concurrent_pbs_estimate(stream->gpu_index, params));
+    // The amortized PBS can't extract several LWEs per accumulator
+    plan = generate_radix_mult_plan(num_radix_blocks, message_modulus,
+                                    carry_modulus, karatsuba_threshold,
+                                    scan_type, params.pbs_type != AMORTIZED);
+    many_lut_stride = get_many_lut_stride(polynomial_size, message_modulus,
+                                          carry_modulus, 2);
+
+    uint64_t delta = ((uint64_t)1 << 63) / (message_modulus * carry_modulus);
+    uint32_t max_step_items = 1;
+    std::vector<Torus> h_step_indexes;
+    for (auto &step : plan.steps) {
+      step_offsets.push_back(h_step_indexes.size());
+      if (step.is_lut) {
+        max_step_items = std::max(max_step_items, (uint32_t)step.luts.size());
+        for (auto &item : step.luts)
+          h_step_indexes.push_back(item.lhs);
+        for (auto &item : step.luts)
+          h_step_indexes.push_back(item.rhs);
+        for (auto &item : step.luts)
+          h_step_indexes.push_back(item.out);
+        for (auto &item : step.luts)
+          h_step_indexes.push_back(item.lut);
+        for (uint32_t k = 0; k < step.num_many_lut_items(); k++)
+          h_step_indexes.push_back(step.luts[k].carry_out);
+        if (step.num_many_lut_items() > 0)
+          max_step_items =
+              std::max(max_step_items, 2 * (uint32_t)step.luts.size());
+      } else {
+        max_step_items = std::max(max_step_items, (uint32_t)step.sums.size());
+        for (auto &item : step.sums)
+          h_step_indexes.push_back(item.out);
+        for (auto &item : step.sums)
+          h_step_indexes.push_back((Torus)(item.constant * delta));
+        for (auto &item : step.sums)
+          h_step_indexes.push_back(item.first_term);
+        for (auto &item : step.sums)
+          h_step_indexes.push_back(item.num_terms);
+        for (auto &term : step.terms)
+          h_step_indexes.push_back(term.slot);
+        for (auto &term : step.terms)
+          h_step_indexes.push_back((Torus)(int64_t)term.sign);
+      }
+    }
+    output_offset = h_step_indexes.size();
+    for (auto slot : plan.output_slots)
+      h_step_indexes.push_back(slot);
+
+    plan_luts = new int_radix_lut<Torus>(
+        stream, params, PLAN_LUT_COUNT, std::max(plan.max_lut_items, 1u),
+        allocate_gpu_memory);
+
+    auto arena = get_scratch_arena(stream);
+    slots = (Torus *)arena->allocate(plan.num_slots * big_lwe_size *
+                                     sizeof(Torus));
+    step_output = (Torus *)arena->allocate(max_step_items * big_lwe_size *
+                                           sizeof(Torus));
+    auto step_indexes_size =
+        std::max<size_t>(h_step_indexes.size(), 1) * sizeof(Torus);
+    step_indexes = (Torus *)arena->allocate(step_indexes_size);
+    cuda_memcpy_async_to_gpu_staged(step_indexes, h_step_indexes.data(),
+                                    h_step_indexes.size() * sizeof(Torus),
+                                    stream);
+
+    for (uint32_t lut = 0; lut < PLAN_LUT_COUNT; lut++) {
+      if (lut == PLAN_LUT_MESSAGE_AND_CARRY) {
+        std::vector<std::function<Torus(Torus)>> functions;
+        for (uint32_t f : {PLAN_LUT_MESSAGE, PLAN_LUT_CARRY})
+          functions.push_back([f, message_modulus](Torus x) -> Torus {
+            return radix_plan_eval_lut(f, x, 0, message_modulus);
+          });
+        generate_device_many_lut_accumulator<Torus>(
+            stream, plan_luts->get_lut(lut), glwe_dimension, polynomial_size,
+            message_modulus, carry_modulus, functions);
+      } else if (radix_plan_lut_is_bivariate(lut)) {
+        auto f = [lut, message_modulus](Torus x, Torus y) -> Torus {
+          return radix_plan_eval_lut(lut, x, y, message_modulus);
+        };
+        generate_device_accumulator_bivariate<Torus>(
+            stream, plan_luts->get_lut(lut), glwe_dimension, polynomial_size,
+            message_modulus, carry_modulus, f);
+      } else {
+        auto f = [lut, message_modulus](Torus x) -> Torus {
+          return radix_plan_eval_lut(lut, x, 0, message_modulus);
+        };
+        generate_device_accumulator<Torus>(
+            stream, plan_luts->get_lut(lut), glwe_dimension, polynomial_size,
+            message_modulus, carry_modulus, f);
+      }
+    }
+  }
+
+  void release(cuda_stream_t *stream) {
+    auto arena = get_scratch_arena(stream);
+    arena->release(step_indexes);
+    arena->release(step_output);
+    arena->release(slots);
+    plan_luts->release(stream);
+    delete plan_luts;
+  }
+};
+
 template <typename Torus> struct int_mul_memory {
   Torus *vector_result_sb;
   Torus *block_mul_res;
@@ -544,8 +965,17 @@ template <typename Torus> struct int_mul_memory {
   int_sc_prop_memory<Torus> *scp_mem;
   int_radix_params params;
 
+  // Set when the multiplication is executed as a plan, Karatsuba on operands
+  // of more than karatsuba_threshold blocks. None of the other buffers, which
+  // grow as num_radix_blocks^2, are allocated then.
+  int_mul_plan_memory<Torus> *plan_mem = nullptr;
+
+  // Set by enable_graph_cuda_integer_mult
+  graph_cache *graph = nullptr;
+
   int_mul_memory(cuda_stream_t *stream, int_radix_params params,
-                 uint32_t num_radix_blocks, bool allocate_gpu_memory) {
+                 uint32_t num_radix_blocks, bool allocate_gpu_memory,
+                 uint32_t karatsuba_threshold = 0) {
     this->params = params;
     auto glwe_dimension = params.glwe_dimension;
     auto polynomial_size = params.polynomial_size;
@@ -553,6 +983,14 @@ template <typename Torus> struct int_mul_memory {
     auto carry_modulus = params.carry_modulus;
     auto lwe_dimension = params.small_lwe_dimension;
 
+    if (karatsuba_threshold > 0 && num_radix_blocks > karatsuba_threshold) {
+      plan_mem = new int_mul_plan_memory<Torus>(stream, params,
+                                                num_radix_blocks,
+                                                karatsuba_threshold,
+                                                allocate_gpu_memory);
+      return;
+    }
+
     // create single carry propagation memory object
     scp_mem = new int_sc_prop_memory<Torus>(stream, params, num_radix_blocks,
                                             allocate_gpu_memory);
@@ -567,20 +1005,18 @@ template <typename Torus> struct int_mul_memory {
     int total_block_count = lsb_vector_block_count + msb_vector_block_count;
 
     // allocate memory for intermediate buffers
-    vector_result_sb = (Torus *)cuda_malloc_async(
+    auto arena = get_scratch_arena(stream);
+    vector_result_sb = (Torus *)arena->allocate(
         2 * total_block_count * (polynomial_size * glwe_dimension + 1) *
-            sizeof(Torus),
-        stream);
-    block_mul_res = (Torus *)cuda_malloc_async(
+        sizeof(Torus));
+    block_mul_res = (Torus *)arena->allocate(
         2 * total_block_count * (polynomial_size * glwe_dimension + 1) *
-            sizeof(Torus),
-        stream);
-    small_lwe_vector = (Torus *)cuda_malloc_async(
-        total_block_count * (lwe_dimension + 1) * sizeof(Torus), stream);
+        sizeof(Torus));
+    small_lwe_vector = (Torus *)arena->allocate(
+        total_block_count * (lwe_dimension + 1) * sizeof(Torus));
     lwe_pbs_out_array =
-        (Torus *)cuda_malloc_async((glwe_dimension * polynomial_size + 1) *
-                                       total_block_count * sizeof(Torus),
-                                   stream);
+        (Torus *)arena->allocate((glwe_dimension * polynomial_size + 1) *
+                                 total_block_count * sizeof(Torus));
 
     // create int_radix_lut objects for lsb, msb, message, carry
     // test_vector_array -> lut = {lsb_acc, msb_acc}
@@ -629,19 +1065,31 @@ template <typename Torus> struct int_mul_memory {
     // last msb_vector_block_count values should reference to msb_acc
     // for message and carry default tvi is fine
     cuda_set_value_async<Torus>(
-        &(stream->stream), test_vector_array->get_tvi(lsb_vector_block_count),
-        1, msb_vector_block_count);
+        stream, test_vector_array->get_tvi(lsb_vector_block_count), 1,
+        msb_vector_block_count);
   }
 
   void release(cuda_stream_t *stream) {
-    cuda_drop_async(vector_result_sb, stream);
-    cuda_drop_async(block_mul_res, stream);
-    cuda_drop_async(small_lwe_vector, stream);
-    cuda_drop_async(lwe_pbs_out_array, stream);
+    if (graph != nullptr) {
+      graph->release(stream);
+      delete graph;
+    }
+
+    if (plan_mem != nullptr) {
+      plan_mem->release(stream);
+      delete plan_mem;
+      return;
+    }
 
-    test_vector_array->release(stream);
-    test_vector_message->release(stream);
     test_vector_carry->release(stream);
+    test_vector_message->release(stream);
+    test_vector_array->release(stream);
+
+    auto arena = get_scratch_arena(stream);
+    arena->release(lwe_pbs_out_array);
+    arena->release(small_lwe_vector);
+    arena->release(block_mul_res);
+    arena->release(vector_result_sb);
 
     scp_mem->release(stream);
 
@@ -660,7 +1108,7 @@ template <typename Torus> struct int_shift_buffer {
 
   SHIFT_TYPE shift_type;
 
-  Torus *tmp_rotated;
+  Torus *tmp_rotated = nullptr;
 
   int_shift_buffer(cuda_stream_t *stream, SHIFT_TYPE shift_type,
                    int_radix_params params, uint32_t num_radix_blocks,
@@ -673,8 +1121,8 @@ template <typename Torus> struct int_shift_buffer {
       uint32_t big_lwe_size = params.big_lwe_dimension + 1;
       uint32_t big_lwe_size_bytes = big_lwe_size * sizeof(Torus);
 
-      tmp_rotated = (Torus *)cuda_malloc_async(
-          max_amount_of_pbs * big_lwe_size_bytes, stream);
+      tmp_rotated = (Torus *)get_scratch_arena(stream)->allocate(
+          max_amount_of_pbs * big_lwe_size_bytes);
 
       uint32_t num_bits_in_block = (uint32_t)std::log2(params.message_modulus);
 
@@ -769,18 +1217,20 @@ template <typename Torus> struct int_shift_buffer {
   }
 
   void release(cuda_stream_t *stream) {
-    for (auto &buffer : lut_buffers_bivariate) {
-      buffer->release(stream);
-      delete buffer;
+    for (auto it = lut_buffers_univariate.rbegin();
+         it != lut_buffers_univariate.rend(); it++) {
+      (*it)->release(stream);
+      delete *it;
     }
-    for (auto &buffer : lut_buffers_univariate) {
-      buffer->release(stream);
-      delete buffer;
+    for (auto it = lut_buffers_bivariate.rbegin();
+         it != lut_buffers_bivariate.rend(); it++) {
+      (*it)->release(stream);
+      delete *it;
     }
     lut_buffers_bivariate.clear();
     lut_buffers_univariate.clear();
 
-    cuda_drop_async(tmp_rotated, stream);
+    get_scratch_arena(stream)->release(tmp_rotated);
   }
 };
 
@@ -788,9 +1238,9 @@ template <typename Torus> struct int_zero_out_if_buffer {
 
   int_radix_params params;
 
-  Torus *tmp;
+  Torus *tmp = nullptr;
 
-  cuda_stream_t *local_stream;
+  cuda_stream_t *local_stream = nullptr;
 
   int_zero_out_if_buffer(cuda_stream_t *stream, int_radix_params params,
                          uint32_t num_radix_blocks, bool allocate_gpu_memory) {
@@ -800,14 +1250,19 @@ template <typename Torus> struct int_zero_out_if_buffer {
         (params.big_lwe_dimension + 1) * num_radix_blocks * sizeof(Torus);
     if (allocate_gpu_memory) {
 
-      tmp = (Torus *)cuda_malloc_async(big_size, stream);
-      // We may use a different stream to allow concurrent operation
-      local_stream = new cuda_stream_t(stream->gpu_index);
+      tmp = (Torus *)get_scratch_arena(stream)->allocate(big_size);
+      // We may use a different stream to allow concurrent operation, nothing
+      // runs on measuring streams so they don't need one
+      if (!stream->measuring)
+        local_stream = new cuda_stream_t(stream->gpu_index);
     }
   }
   void release(cuda_stream_t *stream) {
-    cuda_drop_async(tmp, stream);
-    local_stream->release();
+    get_scratch_arena(stream)->release(tmp);
+    if (local_stream != nullptr) {
+      local_stream->release();
+      delete local_stream;
+    }
   }
 };
 
@@ -816,8 +1271,8 @@ template <typename Torus> struct int_cmux_buffer {
   int_radix_lut<Torus> *inverted_predicate_lut;
   int_radix_lut<Torus> *message_extract_lut;
 
-  Torus *tmp_true_ct;
-  Torus *tmp_false_ct;
+  Torus *tmp_true_ct = nullptr;
+  Torus *tmp_false_ct = nullptr;
 
   int_zero_out_if_buffer<Torus> *zero_if_true_buffer;
   int_zero_out_if_buffer<Torus> *zero_if_false_buffer;
@@ -837,8 +1292,9 @@ template <typename Torus> struct int_cmux_buffer {
       Torus small_size =
           (params.small_lwe_dimension + 1) * num_radix_blocks * sizeof(Torus);
 
-      tmp_true_ct = (Torus *)cuda_malloc_async(big_size, stream);
-      tmp_false_ct = (Torus *)cuda_malloc_async(big_size, stream);
+      auto arena = get_scratch_arena(stream);
+      tmp_true_ct = (Torus *)arena->allocate(big_size);
+      tmp_false_ct = (Torus *)arena->allocate(big_size);
 
       zero_if_true_buffer = new int_zero_out_if_buffer<Torus>(
           stream, params, num_radix_blocks, allocate_gpu_memory);
@@ -883,20 +1339,21 @@ template <typename Torus> struct int_cmux_buffer {
   }
 
   void release(cuda_stream_t *stream) {
-    predicate_lut->release(stream);
-    delete predicate_lut;
-    inverted_predicate_lut->release(stream);
-    delete inverted_predicate_lut;
     message_extract_lut->release(stream);
     delete message_extract_lut;
+    inverted_predicate_lut->release(stream);
+    delete inverted_predicate_lut;
+    predicate_lut->release(stream);
+    delete predicate_lut;
 
-    zero_if_true_buffer->release(stream);
-    delete zero_if_true_buffer;
     zero_if_false_buffer->release(stream);
     delete zero_if_false_buffer;
+    zero_if_true_buffer->release(stream);
+    delete zero_if_true_buffer;
 
-    cuda_drop_async(tmp_true_ct, stream);
-    cuda_drop_async(tmp_false_ct, stream);
+    auto arena = get_scratch_arena(stream);
+    arena->release(tmp_false_ct);
+    arena->release(tmp_true_ct);
   }
 };
 
@@ -906,6 +1363,9 @@ template <typename Torus> struct int_are_all_block_true_buffer {
 
   int_radix_lut<Torus> *is_max_value_lut;
   int_radix_lut<Torus> *is_equal_to_num_blocks_lut;
+  // Number of blocks is_equal_to_num_blocks_lut was last generated for, 0 if
+  // it was never generated
+  uint32_t is_equal_to_num_blocks_lut_blocks = 0;
 
   Torus *tmp_block_accumulated;
 
@@ -947,10 +1407,10 @@ template <typename Torus> struct int_are_all_block_true_buffer {
   }
 
   void release(cuda_stream_t *stream) {
-    is_max_value_lut->release(stream);
-    delete is_max_value_lut;
     is_equal_to_num_blocks_lut->release(stream);
     delete is_equal_to_num_blocks_lut;
+    is_max_value_lut->release(stream);
+    delete is_max_value_lut;
 
     cuda_drop_async(tmp_block_accumulated, stream);
   }
@@ -1011,10 +1471,10 @@ template <typename Torus> struct int_comparison_eq_buffer {
   }
 
   void release(cuda_stream_t *stream) {
-    operator_lut->release(stream);
-    delete operator_lut;
     is_non_zero_lut->release(stream);
     delete is_non_zero_lut;
+    operator_lut->release(stream);
+    delete operator_lut;
 
     are_all_block_true_buffer->release(stream);
     delete are_all_block_true_buffer;
@@ -1028,6 +1488,9 @@ template <typename Torus> struct int_tree_sign_reduction_buffer {
 
   int_radix_lut<Torus> *tree_inner_leaf_lut;
   int_radix_lut<Torus> *tree_last_leaf_lut;
+  // Number of blocks the reduction ended with when tree_last_leaf_lut was
+  // generated, if the caller allowed it to be reused, 0 otherwise
+  uint32_t tree_last_leaf_lut_blocks = 0;
 
   int_radix_lut<Torus> *tree_last_leaf_scalar_lut;
 
@@ -1080,12 +1543,12 @@ template <typename Torus> struct int_tree_sign_reduction_buffer {
   }
 
   void release(cuda_stream_t *stream) {
-    tree_inner_leaf_lut->release(stream);
-    delete tree_inner_leaf_lut;
-    tree_last_leaf_lut->release(stream);
-    delete tree_last_leaf_lut;
     tree_last_leaf_scalar_lut->release(stream);
     delete tree_last_leaf_scalar_lut;
+    tree_last_leaf_lut->release(stream);
+    delete tree_last_leaf_lut;
+    tree_inner_leaf_lut->release(stream);
+    delete tree_inner_leaf_lut;
 
     cuda_drop_async(tmp_x, stream);
     cuda_drop_async(tmp_y, stream);
@@ -1106,8 +1569,8 @@ template <typename Torus> struct int_comparison_diff_buffer {
   int_tree_sign_reduction_buffer<Torus> *tree_buffer;
 
   // Used for scalar comparisons
-  cuda_stream_t *lsb_stream;
-  cuda_stream_t *msb_stream;
+  cuda_stream_t *lsb_stream = nullptr;
+  cuda_stream_t *msb_stream = nullptr;
 
   int_comparison_diff_buffer(cuda_stream_t *stream, COMPARISON_TYPE op,
                              int_radix_params params, uint32_t num_radix_blocks,
@@ -1132,8 +1595,11 @@ template <typename Torus> struct int_comparison_diff_buffer {
     };
 
     if (allocate_gpu_memory) {
-      lsb_stream = cuda_create_stream(stream->gpu_index);
-      msb_stream = cuda_create_stream(stream->gpu_index);
+      // Nothing runs on measuring streams, they don't need side streams
+      if (!stream->measuring) {
+        lsb_stream = cuda_create_stream(stream->gpu_index);
+        msb_stream = cuda_create_stream(stream->gpu_index);
+      }
 
       Torus big_size = (params.big_lwe_dimension + 1) * sizeof(Torus);
 
@@ -1163,16 +1629,20 @@ template <typename Torus> struct int_comparison_diff_buffer {
   }
 
   void release(cuda_stream_t *stream) {
-    is_zero_lut->release(stream);
-    delete is_zero_lut;
     tree_buffer->release(stream);
     delete tree_buffer;
+    is_zero_lut->release(stream);
+    delete is_zero_lut;
 
     cuda_drop_async(tmp_packed_left, stream);
     cuda_drop_async(tmp_packed_right, stream);
 
-    cuda_destroy_stream(lsb_stream);
-    cuda_destroy_stream(msb_stream);
+    if (lsb_stream != nullptr) {
+      cuda_destroy_stream(lsb_stream);
+      cuda_destroy_stream(msb_stream);
+      delete lsb_stream;
+      delete msb_stream;
+    }
   }
 };
 
@@ -1194,6 +1664,10 @@ template <typename Torus> struct int_comparison_buffer {
   Torus *tmp_lwe_array_out;
   int_cmux_buffer<Torus> *cmux_buffer;
 
+  // Set by enable_graph_cuda_integer_comparison, except for MAX and MIN whose
+  // selection synchronizes its own streams
+  graph_cache *graph = nullptr;
+
   int_comparison_buffer(cuda_stream_t *stream, COMPARISON_TYPE op,
                         int_radix_params params, uint32_t num_radix_blocks,
                         bool allocate_gpu_memory) {
@@ -1249,20 +1723,17 @@ template <typename Torus> struct int_comparison_buffer {
   }
 
   void release(cuda_stream_t *stream) {
-    switch (op) {
-    case COMPARISON_TYPE::MAX:
-    case COMPARISON_TYPE::MIN:
-      cmux_buffer->release(stream);
-    case COMPARISON_TYPE::GT:
-    case COMPARISON_TYPE::GE:
-    case COMPARISON_TYPE::LT:
-    case COMPARISON_TYPE::LE:
-      diff_buffer->release(stream);
-    case COMPARISON_TYPE::EQ:
-    case COMPARISON_TYPE::NE:
-      eq_buffer->release(stream);
-      break;
+    if (graph != nullptr) {
+      graph->release(stream);
+      delete graph;
     }
+
+    // Reverse order of the constructor
+    eq_buffer->release(stream);
+    if (op != COMPARISON_TYPE::EQ && op != COMPARISON_TYPE::NE)
+      diff_buffer->release(stream);
+    if (op == COMPARISON_TYPE::MAX || op == COMPARISON_TYPE::MIN)
+      cmux_buffer->release(stream);
     cleaning_lut->release(stream);
     cuda_drop_async(tmp_lwe_array_out, stream);
     cuda_drop_async(tmp_block_comparisons, stream);
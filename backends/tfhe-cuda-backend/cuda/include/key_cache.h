@@ -0,0 +1,251 @@
+#ifndef CUDA_KEY_CACHE_H
+#define CUDA_KEY_CACHE_H
+
+#include "negacyclic_fft.h"
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/*
+ *  On-disk cache of bootstrap keys in the representation used by the GPU,
+ *  which lets a process skip the conversion of its keys at startup.
+ *
+ *  A file is a key_cache_header followed by the payload, the key exactly as
+ *  it is laid out in device memory. The header records the format version,
+ *  the kind of key, the parameters it was converted with, the format of the
+ *  FFT for keys in the Fourier domain and a checksum of the payload. Files
+ *  are written in the native byte order and are meant to be read back on the
+ *  same kind of machine.
+ *
+ *  Everything in this file only needs the host, so the format can be
+ *  exercised without a GPU.
+ */
+enum KEY_CACHE_TYPE {
+  // Classical bootstrap key in the Fourier domain, as produced by
+  // cuda_convert_lwe_bootstrap_key_64
+  KEY_CACHE_FOURIER_BSK_64 = 0,
+  // Multi-bit bootstrap key, as produced by
+  // cuda_convert_lwe_multi_bit_bootstrap_key_64
+  KEY_CACHE_MULTI_BIT_BSK_64 = 1,
+};
+
+// "TFHEBSKC" in little endian
+constexpr uint64_t key_cache_magic = 0x434b534245484654;
+constexpr uint32_t key_cache_version = 2;
+
+struct key_cache_header {
+  uint64_t magic;
+  uint32_t version;
+  uint32_t key_type;
+  uint32_t input_lwe_dim;
+  uint32_t glwe_dim;
+  uint32_t level_count;
+  uint32_t polynomial_size;
+  uint32_t grouping_factor;
+  // negacyclic_fft_format for Fourier keys, 0 otherwise
+  uint32_t fft_format;
+  uint32_t reserved[2];
+  uint64_t payload_size;
+  uint64_t checksum;
+};
+// Keeps the payload aligned on 64 bytes in mapped files
+static_assert(sizeof(key_cache_header) == 64, "unexpected key cache header");
+
+inline uint64_t key_cache_payload_size(uint32_t key_type,
+                                       uint32_t input_lwe_dim,
+                                       uint32_t glwe_dim, uint32_t level_count,
+                                       uint32_t polynomial_size,
+                                       uint32_t grouping_factor) {
+  uint64_t ggsw_polynomials =
+      (uint64_t)(glwe_dim + 1) * (glwe_dim + 1) * level_count;
+  switch (key_type) {
+  case KEY_CACHE_FOURIER_BSK_64:
+    // polynomial_size / 2 double2 per polynomial
+    return input_lwe_dim * ggsw_polynomials * polynomial_size / 2 *
+           (2 * sizeof(double));
+  case KEY_CACHE_MULTI_BIT_BSK_64:
+    return (uint64_t)input_lwe_dim / grouping_factor *
+           (1 << grouping_factor) * ggsw_polynomials * polynomial_size *
+           sizeof(uint64_t);
+  default:
+    return 0;
+  }
+}
+
+inline key_cache_header
+make_key_cache_header(uint32_t key_type, uint32_t input_lwe_dim,
+                      uint32_t glwe_dim, uint32_t level_count,
+                      uint32_t polynomial_size, uint32_t grouping_factor) {
+  key_cache_header header;
+  memset(&header, 0, sizeof(header));
+  header.magic = key_cache_magic;
+  header.version = key_cache_version;
+  header.key_type = key_type;
+  header.input_lwe_dim = input_lwe_dim;
+  header.glwe_dim = glwe_dim;
+  header.level_count = level_count;
+  header.polynomial_size = polynomial_size;
+  header.grouping_factor = grouping_factor;
+  if (key_type == KEY_CACHE_FOURIER_BSK_64)
+    header.fft_format = negacyclic_fft_format;
+  header.payload_size =
+      key_cache_payload_size(key_type, input_lwe_dim, glwe_dim, level_count,
+                             polynomial_size, grouping_factor);
+  return header;
+}
+
+/*
+ *  FNV-1a over 64-bit words, with a xorshift after each step so that every
+ *  bit of a word reaches the low bits of the state. Meant to catch truncated
+ *  or corrupted files, not tampering.
+ */
+inline uint64_t key_cache_checksum(const void *data, uint64_t size) {
+  const uint64_t prime = 0x100000001b3;
+  const uint8_t *bytes = (const uint8_t *)data;
+  uint64_t hash = 0xcbf29ce484222325;
+  uint64_t i = 0;
+  for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t)) {
+    uint64_t word;
+    memcpy(&word, bytes + i, sizeof(uint64_t));
+    hash = (hash ^ word) * prime;
+    hash ^= hash >> 29;
+  }
+  for (; i < size; i++) {
+    hash = (hash ^ bytes[i]) * prime;
+    hash ^= hash >> 29;
+  }
+  return hash;
+}
+
+/// Writes header and payload to path. The file is written next to its
+/// destination and renamed once complete, so that a reader never sees a
+/// partially written cache.
+/// 0: success
+/// -1: error, the file cannot be written
+inline int key_cache_write(const char *path, key_cache_header header,
+                           const void *payload) {
+  header.checksum = key_cache_checksum(payload, header.payload_size);
+
+  size_t path_length = strlen(path);
+  char *tmp_path = new char[path_length + 5];
+  memcpy(tmp_path, path, path_length);
+  memcpy(tmp_path + path_length, ".tmp", 5);
+
+  FILE *file = fopen(tmp_path, "wb");
+  bool ok = file != nullptr;
+  if (ok) {
+    ok = fwrite(&header, sizeof(header), 1, file) == 1;
+    if (ok && header.payload_size > 0)
+      ok = fwrite(payload, header.payload_size, 1, file) == 1;
+    ok = (fclose(file) == 0) && ok;
+  }
+  if (ok)
+    ok = rename(tmp_path, path) == 0;
+  if (!ok)
+    remove(tmp_path);
+
+  delete[] tmp_path;
+  // error code: cannot write file
+  return ok ? 0 : -1;
+}
+
+// Read-only mapping of a cache file, payload points to the key
+struct key_cache_mapping {
+  void *base = nullptr;
+  uint64_t mapped_size = 0;
+  const void *payload = nullptr;
+  uint64_t payload_size = 0;
+};
+
+inline void key_cache_unmap(key_cache_mapping *mapping) {
+  if (mapping->base != nullptr)
+    munmap(mapping->base, mapping->mapped_size);
+  *mapping = key_cache_mapping();
+}
+
+/// Maps path in memory and checks that it holds the key described by
+/// expected, whose checksum is ignored.
+/// 0: success
+/// -1: error, the file cannot be opened or mapped
+/// -2: error, not a key cache, unsupported version or FFT format
+/// -3: error, the key type or parameters do not match expected
+/// -4: error, the payload is truncated or corrupted
+inline int key_cache_map(const char *path, const key_cache_header &expected,
+                         key_cache_mapping *mapping) {
+  int fd = open(path, O_RDONLY);
+  if (fd < 0) {
+    // error code: cannot open file
+    return -1;
+  }
+  struct stat file_stat;
+  if (fstat(fd, &file_stat) != 0) {
+    close(fd);
+    // error code: cannot open file
+    return -1;
+  }
+  uint64_t file_size = file_stat.st_size;
+  if (file_size < sizeof(key_cache_header)) {
+    close(fd);
+    // error code: not a key cache
+    return -2;
+  }
+  void *base = mmap(nullptr, file_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (base == MAP_FAILED) {
+    // error code: cannot map file
+    return -1;
+  }
+  mapping->base = base;
+  mapping->mapped_size = file_size;
+  madvise(base, file_size, MADV_SEQUENTIAL);
+
+  key_cache_header header;
+  memcpy(&header, base, sizeof(header));
+  if (header.magic != key_cache_magic || header.version != key_cache_version ||
+      header.fft_format != expected.fft_format) {
+    key_cache_unmap(mapping);
+    // error code: not a key cache, unsupported version or FFT format
+    return -2;
+  }
+  if (header.key_type != expected.key_type ||
+      header.input_lwe_dim != expected.input_lwe_dim ||
+      header.glwe_dim != expected.glwe_dim ||
+      header.level_count != expected.level_count ||
+      header.polynomial_size != expected.polynomial_size ||
+      header.grouping_factor != expected.grouping_factor ||
+      header.payload_size != expected.payload_size) {
+    key_cache_unmap(mapping);
+    // error code: key mismatch
+    return -3;
+  }
+  const int8_t *payload = (const int8_t *)base + sizeof(key_cache_header);
+  if (file_size - sizeof(key_cache_header) != header.payload_size ||
+      key_cache_checksum(payload, header.payload_size) != header.checksum) {
+    key_cache_unmap(mapping);
+    // error code: corrupted payload
+    return -4;
+  }
+
+  mapping->payload = payload;
+  mapping->payload_size = header.payload_size;
+  return 0;
+}
+
+/// Loads the key described by expected from path into dest, a host buffer of
+/// expected.payload_size bytes. Returns the error codes of key_cache_map.
+inline int key_cache_load(const char *path, const key_cache_header &expected,
+                          void *dest) {
+  key_cache_mapping mapping;
+  int err = key_cache_map(path, expected, &mapping);
+  if (err != 0)
+    return err;
+  memcpy(dest, mapping.payload, mapping.payload_size);
+  key_cache_unmap(&mapping);
+  return 0;
+}
+
+#endif // CUDA_KEY_CACHE_H
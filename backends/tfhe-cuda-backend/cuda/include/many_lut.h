@@ -0,0 +1,146 @@
+#ifndef CUDA_MANY_LUT_H
+#define CUDA_MANY_LUT_H
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+/*
+ *  Many-LUT accumulators: several univariate functions evaluated by a single
+ *  blind rotation.
+ *
+ *  A regular accumulator spends a box of polynomial_size / modulus_sup
+ *  coefficients on each of the modulus_sup inputs. When the inputs are known
+ *  to be smaller than modulus_sup / num_many_lut, the boxes of the other
+ *  inputs are free: function i is laid out from coefficient i * lut_stride,
+ *  lut_stride being the size of modulus_sup / num_many_lut boxes. After the
+ *  blind rotation by the phase of x, coefficient i * lut_stride of the
+ *  accumulator holds f_i(x), and the PBS extracts the num_many_lut LWEs from
+ *  the same accumulator (see sample_extract_many_lut). Output i of sample s
+ *  is written to the LWE i * num_samples + lwe_output_indexes[s] of the
+ *  output array.
+ *
+ *  Nothing here depends on CUDA.
+ */
+
+// Inputs must be smaller than this for the packed functions to be evaluated
+// correctly
+inline uint32_t get_many_lut_input_modulus(uint32_t message_modulus,
+                                           uint32_t carry_modulus,
+                                           uint32_t num_many_lut) {
+  return message_modulus * carry_modulus / num_many_lut;
+}
+
+// Distance, in coefficients, between two functions packed in an accumulator
+inline uint32_t get_many_lut_stride(uint32_t polynomial_size,
+                                    uint32_t message_modulus,
+                                    uint32_t carry_modulus,
+                                    uint32_t num_many_lut) {
+  uint32_t box_size = polynomial_size / (message_modulus * carry_modulus);
+  return get_many_lut_input_modulus(message_modulus, carry_modulus,
+                                    num_many_lut) *
+         box_size;
+}
+
+// Whether a PBS can extract num_many_lut functions lut_stride coefficients
+// apart from an accumulator of polynomial_size coefficients
+inline bool is_valid_many_lut(uint32_t polynomial_size, uint32_t num_many_lut,
+                              uint32_t lut_stride) {
+  return num_many_lut >= 1 &&
+         (uint64_t)lut_stride * (num_many_lut - 1) < polynomial_size;
+}
+
+/*
+ *  Fills acc, a GLWE of glwe_dimension + 1 polynomials, with the trivial
+ *  encryption of the accumulator packing functions. With a single function it
+ *  is the regular accumulator of generate_lookup_table.
+ */
+template <typename Torus>
+void generate_many_lookup_table(
+    Torus *acc, uint32_t glwe_dimension, uint32_t polynomial_size,
+    uint32_t message_modulus, uint32_t carry_modulus,
+    const std::vector<std::function<Torus(Torus)>> &functions) {
+
+  uint32_t num_many_lut = functions.size();
+  uint32_t modulus_sup = message_modulus * carry_modulus;
+  uint32_t box_size = polynomial_size / modulus_sup;
+  uint32_t input_modulus = get_many_lut_input_modulus(
+      message_modulus, carry_modulus, num_many_lut);
+  uint32_t lut_stride = get_many_lut_stride(polynomial_size, message_modulus,
+                                            carry_modulus, num_many_lut);
+  // The most significant bit is the padding bit
+  Torus delta = ((Torus)1 << (sizeof(Torus) * 8 - 1)) / modulus_sup;
+
+  // The coefficients after the last function, if num_many_lut doesn't divide
+  // modulus_sup, are never read
+  std::fill(acc, acc + (glwe_dimension + 1) * polynomial_size, 0);
+  Torus *body = &acc[glwe_dimension * polynomial_size];
+
+  for (uint32_t f = 0; f < num_many_lut; f++)
+    for (uint32_t x = 0; x < input_modulus; x++) {
+      Torus f_eval = functions[f](x) * delta;
+      uint32_t index = f * lut_stride + x * box_size;
+      std::fill(body + index, body + index + box_size, f_eval);
+    }
+
+  // Center the boxes on the inputs: the first half box, reached with a
+  // negative noise, wraps around negacyclically
+  uint32_t half_box_size = box_size / 2;
+  for (uint32_t i = 0; i < half_box_size; i++)
+    body[i] = -body[i];
+  std::rotate(body, body + half_box_size, body + polynomial_size);
+}
+
+/*
+ *  Checks a many-LUT accumulator body on cleartexts: for every input x below
+ *  the input modulus and every noise in [-box_size / 2, box_size / 2), the
+ *  blind rotation by the phase of x plus the noise must leave f_i(x) * delta
+ *  at coefficient i * lut_stride. Returns false, with a reason in 'error' if
+ *  given, on the first mismatch.
+ */
+template <typename Torus>
+bool check_many_lookup_table(
+    const Torus *body, uint32_t polynomial_size, uint32_t message_modulus,
+    uint32_t carry_modulus,
+    const std::vector<std::function<Torus(Torus)>> &functions,
+    const char **error = nullptr) {
+  auto fail = [&](const char *reason) {
+    if (error != nullptr)
+      *error = reason;
+    return false;
+  };
+
+  uint32_t N = polynomial_size;
+  uint32_t num_many_lut = functions.size();
+  uint32_t modulus_sup = message_modulus * carry_modulus;
+  uint32_t box_size = N / modulus_sup;
+  uint32_t input_modulus = get_many_lut_input_modulus(
+      message_modulus, carry_modulus, num_many_lut);
+  uint32_t lut_stride = get_many_lut_stride(N, message_modulus, carry_modulus,
+                                            num_many_lut);
+  Torus delta = ((Torus)1 << (sizeof(Torus) * 8 - 1)) / modulus_sup;
+
+  if (input_modulus == 0)
+    return fail("more functions than inputs");
+  if (!is_valid_many_lut(N, num_many_lut, lut_stride))
+    return fail("functions packed past the end of the accumulator");
+
+  for (uint32_t x = 0; x < input_modulus; x++)
+    for (int64_t noise = -(int64_t)(box_size / 2);
+         noise < (int64_t)(box_size / 2); noise++) {
+      // Phase rescaled to [0, 2N), the blind rotation multiplies the
+      // accumulator by X^(-phase)
+      uint32_t phase = (uint32_t)(((int64_t)x * box_size + noise + 2 * N) %
+                                  (2 * N));
+      for (uint32_t f = 0; f < num_many_lut; f++) {
+        uint32_t index = (f * lut_stride + phase) % (2 * N);
+        Torus coefficient = index < N ? body[index] : -body[index - N];
+        if (coefficient != (Torus)(functions[f](x) * delta))
+          return fail("wrong function value");
+      }
+    }
+  return true;
+}
+
+#endif // CUDA_MANY_LUT_H
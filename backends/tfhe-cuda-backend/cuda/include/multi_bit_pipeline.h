@@ -0,0 +1,217 @@
+#ifndef CUDA_MULTI_BIT_PIPELINE_H
+#define CUDA_MULTI_BIT_PIPELINE_H
+
+#include <cstdint>
+#include <vector>
+
+/*
+ *  Schedule of the pipelined multi-bit PBS.
+ *
+ *  The LWE mask is processed in chunks. The keybundles of a chunk only depend
+ *  on the input LWE and the bootstrapping key, so they are computed on a side
+ *  stream into one of two keybundle buffers (slots) while the main stream
+ *  accumulates the previous chunk from the other slot. Events order the two
+ *  streams:
+ *  - the main stream waits for the keybundles of a chunk before accumulating
+ *    it,
+ *  - the side stream waits for the accumulation of chunk k before writing the
+ *    keybundles of chunk k + 2 to the same slot,
+ *  - the side stream starts after the work enqueued on the main stream before
+ *    the PBS, and the main stream ends after the last keybundle.
+ *
+ *  host_multi_bit_pbs enqueues exactly the operations of
+ *  make_multi_bit_pipeline_schedule, in order, and
+ *  check_multi_bit_pipeline_schedule verifies a schedule without a GPU.
+ */
+
+enum MULTI_BIT_PIPELINE_OP {
+  PIPELINE_KEYBUNDLE = 0,
+  PIPELINE_ACCUMULATE = 1,
+  PIPELINE_RECORD = 2,
+  PIPELINE_WAIT = 3,
+};
+
+enum MULTI_BIT_PIPELINE_STREAM {
+  PIPELINE_MAIN_STREAM = 0,
+  PIPELINE_SIDE_STREAM = 1,
+};
+
+// Events: the work enqueued before the PBS, then for each slot its keybundles
+// being ready and the slot being free again
+constexpr uint32_t multi_bit_pipeline_num_slots = 2;
+constexpr uint32_t multi_bit_pipeline_inputs_ready = 0;
+constexpr uint32_t multi_bit_pipeline_num_events =
+    1 + 2 * multi_bit_pipeline_num_slots;
+
+inline uint32_t multi_bit_pipeline_keybundle_ready(uint32_t slot) {
+  return 1 + slot;
+}
+inline uint32_t multi_bit_pipeline_slot_free(uint32_t slot) {
+  return 1 + multi_bit_pipeline_num_slots + slot;
+}
+
+struct multi_bit_pipeline_op {
+  MULTI_BIT_PIPELINE_OP type;
+  MULTI_BIT_PIPELINE_STREAM stream;
+  // Chunk computed or accumulated, unused by events
+  uint32_t chunk;
+  // Keybundle slot for the kernels, event index for records and waits
+  uint32_t index;
+};
+
+/*
+ *  Operations to enqueue, in order, for num_chunks chunks. The keybundles of
+ *  chunk k + 1 are enqueued before the accumulation of chunk k, so that the
+ *  side stream never waits on the host. A single chunk has nothing to overlap
+ *  and runs on the main stream alone.
+ */
+inline std::vector<multi_bit_pipeline_op>
+make_multi_bit_pipeline_schedule(uint32_t num_chunks) {
+  std::vector<multi_bit_pipeline_op> schedule;
+  if (num_chunks == 0)
+    return schedule;
+  if (num_chunks == 1) {
+    schedule.push_back({PIPELINE_KEYBUNDLE, PIPELINE_MAIN_STREAM, 0, 0});
+    schedule.push_back({PIPELINE_ACCUMULATE, PIPELINE_MAIN_STREAM, 0, 0});
+    return schedule;
+  }
+
+  auto keybundle = [&](uint32_t chunk) {
+    uint32_t slot = chunk % multi_bit_pipeline_num_slots;
+    if (chunk >= multi_bit_pipeline_num_slots)
+      schedule.push_back({PIPELINE_WAIT, PIPELINE_SIDE_STREAM, 0,
+                          multi_bit_pipeline_slot_free(slot)});
+    schedule.push_back({PIPELINE_KEYBUNDLE, PIPELINE_SIDE_STREAM, chunk, slot});
+    schedule.push_back({PIPELINE_RECORD, PIPELINE_SIDE_STREAM, 0,
+                        multi_bit_pipeline_keybundle_ready(slot)});
+  };
+
+  schedule.push_back({PIPELINE_RECORD, PIPELINE_MAIN_STREAM, 0,
+                      multi_bit_pipeline_inputs_ready});
+  schedule.push_back({PIPELINE_WAIT, PIPELINE_SIDE_STREAM, 0,
+                      multi_bit_pipeline_inputs_ready});
+  keybundle(0);
+  for (uint32_t chunk = 0; chunk < num_chunks; chunk++) {
+    uint32_t slot = chunk % multi_bit_pipeline_num_slots;
+    if (chunk + 1 < num_chunks)
+      keybundle(chunk + 1);
+    schedule.push_back({PIPELINE_WAIT, PIPELINE_MAIN_STREAM, 0,
+                        multi_bit_pipeline_keybundle_ready(slot)});
+    schedule.push_back(
+        {PIPELINE_ACCUMULATE, PIPELINE_MAIN_STREAM, chunk, slot});
+    schedule.push_back({PIPELINE_RECORD, PIPELINE_MAIN_STREAM, 0,
+                        multi_bit_pipeline_slot_free(slot)});
+  }
+  return schedule;
+}
+
+/*
+ *  Dependency simulator. Builds the happens-before relation of a schedule
+ *  with the semantics of CUDA streams and events (operations of a stream run
+ *  in order, a wait blocks its stream until the last record of the event
+ *  enqueued before it has completed) and checks that:
+ *  - every chunk's keybundles are computed once, before its accumulation and
+ *    into the slot it is accumulated from,
+ *  - chunks are accumulated in order,
+ *  - a slot is only overwritten after the accumulation reading it,
+ *  - no operation of the side stream may start before the inputs are ready
+ *    nor finish after the last operation of the main stream.
+ *  Returns false, with a reason in 'error' if given, on the first violation.
+ */
+inline bool
+check_multi_bit_pipeline_schedule(const std::vector<multi_bit_pipeline_op> &ops,
+                                  uint32_t num_chunks,
+                                  const char **error = nullptr) {
+  auto fail = [&](const char *reason) {
+    if (error != nullptr)
+      *error = reason;
+    return false;
+  };
+
+  uint32_t n = ops.size();
+  // predecessors[i]: operations that must complete before i starts
+  std::vector<std::vector<uint32_t>> predecessors(n);
+  int64_t last_of_stream[2] = {-1, -1};
+  std::vector<int64_t> last_record(multi_bit_pipeline_num_events, -1);
+  for (uint32_t i = 0; i < n; i++) {
+    auto &op = ops[i];
+    if (last_of_stream[op.stream] >= 0)
+      predecessors[i].push_back(last_of_stream[op.stream]);
+    last_of_stream[op.stream] = i;
+    if (op.type == PIPELINE_RECORD || op.type == PIPELINE_WAIT) {
+      if (op.index >= multi_bit_pipeline_num_events)
+        return fail("unknown event");
+      if (op.type == PIPELINE_RECORD)
+        last_record[op.index] = i;
+      else if (last_record[op.index] >= 0)
+        predecessors[i].push_back(last_record[op.index]);
+    }
+  }
+
+  // before[i][j]: i completes before j starts. Predecessors always come
+  // first in the schedule, a single pass in order is enough.
+  std::vector<std::vector<bool>> before(n, std::vector<bool>(n, false));
+  for (uint32_t j = 0; j < n; j++)
+    for (uint32_t p : predecessors[j]) {
+      before[p][j] = true;
+      for (uint32_t i = 0; i < n; i++)
+        if (before[i][p])
+          before[i][j] = true;
+    }
+
+  std::vector<int64_t> keybundle_of(num_chunks, -1);
+  std::vector<int64_t> accumulate_of(num_chunks, -1);
+  for (uint32_t i = 0; i < n; i++) {
+    auto &op = ops[i];
+    if (op.type != PIPELINE_KEYBUNDLE && op.type != PIPELINE_ACCUMULATE)
+      continue;
+    if (op.chunk >= num_chunks || op.index >= multi_bit_pipeline_num_slots)
+      return fail("chunk or slot out of range");
+    auto &seen = op.type == PIPELINE_KEYBUNDLE ? keybundle_of : accumulate_of;
+    if (seen[op.chunk] >= 0)
+      return fail("chunk computed or accumulated twice");
+    seen[op.chunk] = i;
+  }
+
+  int64_t first_main = -1, last_main = -1;
+  for (uint32_t i = 0; i < n; i++)
+    if (ops[i].stream == PIPELINE_MAIN_STREAM) {
+      if (first_main < 0)
+        first_main = i;
+      last_main = i;
+    }
+
+  for (uint32_t c = 0; c < num_chunks; c++) {
+    int64_t k = keybundle_of[c], a = accumulate_of[c];
+    if (k < 0 || a < 0)
+      return fail("chunk missing");
+    if (ops[k].index != ops[a].index)
+      return fail("chunk accumulated from another slot");
+    if (!before[k][a])
+      return fail("accumulation may start before its keybundles are ready");
+    if (c > 0 && !before[accumulate_of[c - 1]][a])
+      return fail("chunks accumulated out of order");
+    // Any later keybundle written to the same slot must wait for this
+    // accumulation
+    for (uint32_t d = c + 1; d < num_chunks; d++) {
+      int64_t later = keybundle_of[d];
+      if (later >= 0 && ops[later].index == ops[a].index &&
+          !before[a][later])
+        return fail("slot overwritten while it is accumulated");
+    }
+  }
+
+  for (uint32_t i = 0; i < n; i++) {
+    if (ops[i].stream != PIPELINE_SIDE_STREAM)
+      continue;
+    if (first_main < 0 || !before[first_main][i] ||
+        ops[first_main].type != PIPELINE_RECORD ||
+        ops[first_main].index != multi_bit_pipeline_inputs_ready)
+      return fail("side stream not ordered after the inputs");
+    if (!before[i][last_main])
+      return fail("side stream not joined by the main stream");
+  }
+  return true;
+}
+
+#endif // CUDA_MULTI_BIT_PIPELINE_H
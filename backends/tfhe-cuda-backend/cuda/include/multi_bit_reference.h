@@ -0,0 +1,240 @@
+#ifndef CUDA_MULTI_BIT_REFERENCE_H
+#define CUDA_MULTI_BIT_REFERENCE_H
+
+#include <cstdint>
+#include <vector>
+
+/*
+ *  Host reference of the multi-bit PBS implemented in
+ *  pbs/bootstrap_multibit.cuh and pbs/bootstrap_fast_multibit.cuh, for 32 and
+ *  64-bit Torus.
+ *
+ *  It takes the bootstrapping key in the layout uploaded by
+ *  cuda_convert_lwe_multi_bit_bootstrap_key_*: for each group of
+ *  grouping_factor LWE coefficients, 2^grouping_factor GGSWs of level_count
+ *  levels, each made of (glwe_dimension + 1)^2 polynomials. The blind rotation
+ *  is computed with exact negacyclic products, in the same order as the
+ *  device (groups are processed from the last one). The device results only
+ *  differ from the reference by the error of the floating point FFT, which
+ *  shows in the low bits of each coefficient.
+ *
+ *  Nothing here depends on CUDA.
+ */
+
+// Rounds x to its level_count * base_log most significant bits
+template <typename Torus>
+Torus multi_bit_reference_round(Torus x, uint32_t base_log,
+                                uint32_t level_count) {
+  uint32_t shift = sizeof(Torus) * 8 - level_count * base_log;
+  Torus b = (x >> (shift - 1)) & 1;
+  return ((x >> shift) + b) << shift;
+}
+
+// Closest multiple of 2^(bits - log_modulus) to x, as an element of
+// Z / 2^log_modulus Z. Matches rescale_torus_element, which rounds in double
+// precision, as long as log_modulus is small.
+template <typename Torus>
+uint32_t multi_bit_reference_rescale(Torus x, uint32_t log_modulus) {
+  uint32_t shift = sizeof(Torus) * 8 - log_modulus;
+  Torus rounded = (x >> shift) + ((x >> (shift - 1)) & 1);
+  return (uint32_t)(rounded & (((Torus)1 << log_modulus) - 1));
+}
+
+// result += poly * X^degree in Z[X] / (X^N + 1), degree in [0, 2N)
+template <typename Torus>
+void multi_bit_reference_add_monomial_product(Torus *result, const Torus *poly,
+                                              uint32_t degree,
+                                              uint32_t polynomial_size) {
+  for (uint32_t i = 0; i < polynomial_size; i++) {
+    uint32_t position = (i + degree) % (2 * polynomial_size);
+    if (position < polynomial_size)
+      result[position] += poly[i];
+    else
+      result[position - polynomial_size] -= poly[i];
+  }
+}
+
+// result += a * b in Z[X] / (X^N + 1), quadratic
+template <typename Torus>
+void multi_bit_reference_add_product(Torus *result, const Torus *a,
+                                     const Torus *b, uint32_t polynomial_size) {
+  for (uint32_t i = 0; i < polynomial_size; i++) {
+    if (a[i] == 0)
+      continue;
+    for (uint32_t j = 0; j < polynomial_size; j++) {
+      Torus product = a[i] * b[j];
+      if (i + j < polynomial_size)
+        result[i + j] += product;
+      else
+        result[i + j - polynomial_size] -= product;
+    }
+  }
+}
+
+// log2(2 * polynomial_size), the modulus the LWE coefficients are rescaled to
+inline uint32_t multi_bit_reference_log_2n(uint32_t polynomial_size) {
+  uint32_t log_2n = 0;
+  while ((1u << log_2n) < 2 * polynomial_size)
+    log_2n++;
+  return log_2n;
+}
+
+/// Keybundles of lwe_in: for each group, in the order the blind rotation
+/// processes them, the sum over g of X^<g, mask> times the g-th GGSW of the
+/// group, the first one being a constant. They only depend on the mask of the
+/// input, not on its body nor on the LUT.
+template <typename Torus>
+std::vector<Torus> reference_multi_bit_keybundles(
+    const Torus *lwe_in, const Torus *bootstrapping_key, uint32_t lwe_dimension,
+    uint32_t glwe_dimension, uint32_t polynomial_size, uint32_t grouping_factor,
+    uint32_t level_count) {
+  uint32_t N = polynomial_size;
+  uint32_t glwe_size = glwe_dimension + 1;
+  uint32_t log_2n = multi_bit_reference_log_2n(N);
+  uint64_t ggsw_size = (uint64_t)level_count * glwe_size * glwe_size * N;
+  uint32_t num_groups = lwe_dimension / grouping_factor;
+
+  std::vector<Torus> keybundles(num_groups * ggsw_size);
+  for (uint32_t iteration = 0; iteration < num_groups; iteration++) {
+    uint32_t group = num_groups - iteration - 1;
+    const Torus *group_key = bootstrapping_key + (uint64_t)group *
+                                                     (1 << grouping_factor) *
+                                                     ggsw_size;
+    const Torus *group_mask = lwe_in + group * grouping_factor;
+    Torus *keybundle = &keybundles[iteration * ggsw_size];
+
+    for (uint64_t i = 0; i < ggsw_size; i++)
+      keybundle[i] = group_key[i];
+    for (uint32_t g = 1; g < (1u << grouping_factor); g++) {
+      Torus selected = 0;
+      for (uint32_t i = 0; i < grouping_factor; i++)
+        if ((g >> (grouping_factor - i - 1)) & 1)
+          selected += group_mask[i];
+      uint32_t degree = multi_bit_reference_rescale(selected, log_2n);
+      for (uint64_t poly = 0; poly < ggsw_size / N; poly++)
+        multi_bit_reference_add_monomial_product(
+            &keybundle[poly * N], &group_key[g * ggsw_size + poly * N],
+            degree, N);
+    }
+  }
+  return keybundles;
+}
+
+/// Blind rotation of lut by lwe_in using keybundles, as returned by
+/// reference_multi_bit_keybundles for an input with the same mask, followed by
+/// the sample extraction to lwe_out
+template <typename Torus>
+void reference_multi_bit_pbs_with_keybundles(
+    Torus *lwe_out, const Torus *lwe_in, const Torus *lut,
+    const std::vector<Torus> &keybundles, uint32_t lwe_dimension,
+    uint32_t glwe_dimension, uint32_t polynomial_size, uint32_t grouping_factor,
+    uint32_t base_log, uint32_t level_count) {
+  uint32_t N = polynomial_size;
+  uint32_t glwe_size = glwe_dimension + 1;
+  uint32_t log_2n = multi_bit_reference_log_2n(N);
+  uint64_t ggsw_size = (uint64_t)level_count * glwe_size * glwe_size * N;
+  uint32_t num_groups = lwe_dimension / grouping_factor;
+
+  // Accumulator initialized to LUT * X^(-b)
+  std::vector<Torus> accumulator(glwe_size * N);
+  uint32_t b_hat = multi_bit_reference_rescale(lwe_in[lwe_dimension], log_2n);
+  for (uint32_t p = 0; p < glwe_size; p++)
+    multi_bit_reference_add_monomial_product(
+        &accumulator[p * N], &lut[p * N], (2 * N - b_hat) % (2 * N), N);
+
+  std::vector<Torus> digits(level_count * glwe_size * N);
+  for (uint32_t iteration = 0; iteration < num_groups; iteration++) {
+    const Torus *keybundle = &keybundles[iteration * ggsw_size];
+
+    // Signed decomposition of the rounded accumulator, level 0 being the most
+    // significant one
+    uint32_t shift = sizeof(Torus) * 8 - base_log * level_count;
+    Torus mask = ((Torus)1 << base_log) - 1;
+    for (uint32_t i = 0; i < glwe_size * N; i++) {
+      Torus state =
+          multi_bit_reference_round(accumulator[i], base_log, level_count) >>
+          shift;
+      for (int level = level_count - 1; level >= 0; level--) {
+        Torus digit = state & mask;
+        state >>= base_log;
+        Torus carry = ((digit - 1) | state) & digit;
+        carry >>= base_log - 1;
+        state += carry;
+        digit -= carry << base_log;
+        digits[level * glwe_size * N + i] = digit;
+      }
+    }
+
+    // External product of the keybundle with the accumulator
+    for (uint32_t i = 0; i < glwe_size * N; i++)
+      accumulator[i] = 0;
+    for (uint32_t level = 0; level < level_count; level++)
+      for (uint32_t row = 0; row < glwe_size; row++)
+        for (uint32_t p = 0; p < glwe_size; p++)
+          multi_bit_reference_add_product(
+              &accumulator[p * N], &digits[(level * glwe_size + row) * N],
+              &keybundle[((level * glwe_size + row) * glwe_size + p) * N], N);
+  }
+
+  // Sample extract
+  for (uint32_t p = 0; p < glwe_dimension; p++) {
+    lwe_out[p * N] = accumulator[p * N];
+    for (uint32_t i = 1; i < N; i++)
+      lwe_out[p * N + i] = -accumulator[p * N + N - i];
+  }
+  lwe_out[glwe_dimension * N] = accumulator[glwe_dimension * N];
+}
+
+/// Bootstraps lwe_in (lwe_dimension + 1 coefficients) with the look-up table
+/// lut (glwe_dimension + 1 polynomials) and writes the extracted LWE of
+/// dimension glwe_dimension * polynomial_size to lwe_out
+template <typename Torus>
+void reference_multi_bit_pbs(Torus *lwe_out, const Torus *lwe_in,
+                             const Torus *lut, const Torus *bootstrapping_key,
+                             uint32_t lwe_dimension, uint32_t glwe_dimension,
+                             uint32_t polynomial_size, uint32_t grouping_factor,
+                             uint32_t base_log, uint32_t level_count) {
+  auto keybundles = reference_multi_bit_keybundles(
+      lwe_in, bootstrapping_key, lwe_dimension, glwe_dimension,
+      polynomial_size, grouping_factor, level_count);
+  reference_multi_bit_pbs_with_keybundles(
+      lwe_out, lwe_in, lut, keybundles, lwe_dimension, glwe_dimension,
+      polynomial_size, grouping_factor, base_log, level_count);
+}
+
+/// Reference of cuda_multi_bit_pbs_shared_input_lwe_ciphertext_vector_*:
+/// sample i reads lwe_array_in[lwe_input_indexes[i]] and
+/// lut_vector[lut_vector_indexes[i]], and writes
+/// lwe_array_out[lwe_output_indexes[i]]. The keybundles are computed from the
+/// first sample of each run of num_samples_per_input samples and reused for
+/// the whole run, so samples of a run are expected to hold the same mask.
+template <typename Torus>
+void reference_multi_bit_pbs_shared_input(
+    Torus *lwe_array_out, const Torus *lwe_output_indexes,
+    const Torus *lut_vector, const Torus *lut_vector_indexes,
+    const Torus *lwe_array_in, const Torus *lwe_input_indexes,
+    const Torus *bootstrapping_key, uint32_t lwe_dimension,
+    uint32_t glwe_dimension, uint32_t polynomial_size, uint32_t grouping_factor,
+    uint32_t base_log, uint32_t level_count, uint32_t num_samples,
+    uint32_t num_samples_per_input) {
+  uint32_t N = polynomial_size;
+  uint64_t lut_size = (uint64_t)(glwe_dimension + 1) * N;
+  uint64_t lwe_in_size = lwe_dimension + 1;
+  uint64_t lwe_out_size = (uint64_t)glwe_dimension * N + 1;
+
+  std::vector<Torus> keybundles;
+  for (uint32_t i = 0; i < num_samples; i++) {
+    const Torus *lwe_in = lwe_array_in + lwe_input_indexes[i] * lwe_in_size;
+    if (i % num_samples_per_input == 0)
+      keybundles = reference_multi_bit_keybundles(
+          lwe_in, bootstrapping_key, lwe_dimension, glwe_dimension,
+          polynomial_size, grouping_factor, level_count);
+    reference_multi_bit_pbs_with_keybundles(
+        lwe_array_out + lwe_output_indexes[i] * lwe_out_size, lwe_in,
+        lut_vector + lut_vector_indexes[i] * lut_size, keybundles,
+        lwe_dimension, glwe_dimension, polynomial_size, grouping_factor,
+        base_log, level_count);
+  }
+}
+
+#endif // CUDA_MULTI_BIT_REFERENCE_H
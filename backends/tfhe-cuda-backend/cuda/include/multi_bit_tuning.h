@@ -0,0 +1,228 @@
+#ifndef CUDA_MULTI_BIT_TUNING_H
+#define CUDA_MULTI_BIT_TUNING_H
+
+#include <cstdint>
+#include <fstream>
+#include <istream>
+#include <map>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+// Parameters a multi-bit PBS chunk size is tuned for, apart from the number
+// of samples
+struct multi_bit_pbs_shape {
+  uint32_t lwe_dimension;
+  uint32_t glwe_dimension;
+  uint32_t polynomial_size;
+  uint32_t level_count;
+  uint32_t grouping_factor;
+
+  bool operator<(const multi_bit_pbs_shape &other) const {
+    return std::tie(lwe_dimension, glwe_dimension, polynomial_size,
+                    level_count, grouping_factor) <
+           std::tie(other.lwe_dimension, other.glwe_dimension,
+                    other.polynomial_size, other.level_count,
+                    other.grouping_factor);
+  }
+};
+
+struct multi_bit_tuning_entry {
+  uint32_t lwe_chunk_size;
+  // Average time of one PBS batch with this chunk size, in microseconds
+  double time_us;
+};
+
+/*
+ *  Identifies a GPU model in the tuning cache. Tabs are not allowed since they
+ *  separate the fields of the cache file.
+ */
+inline std::string make_device_fingerprint(const char *name, int major,
+                                           int minor, int sm_count) {
+  std::ostringstream fingerprint;
+  for (const char *c = name; *c != '\0'; c++)
+    fingerprint << (*c == '\t' ? ' ' : *c);
+  fingerprint << "/sm_" << major << minor << "/" << sm_count;
+  return fingerprint.str();
+}
+
+/*
+ *  Picks the fastest chunk size out of a list of (chunk size, time) timings.
+ *  Ties go to the smallest chunk size, which needs the least memory.
+ *  Returns 0 if there is no timing.
+ */
+inline uint32_t
+select_lwe_chunk_size(const std::vector<std::pair<uint32_t, double>> &timings) {
+  uint32_t best_chunk_size = 0;
+  double best_time = 0;
+  for (auto &timing : timings) {
+    if (best_chunk_size == 0 || timing.second < best_time ||
+        (timing.second == best_time && timing.first < best_chunk_size)) {
+      best_chunk_size = timing.first;
+      best_time = timing.second;
+    }
+  }
+  return best_chunk_size;
+}
+
+/*
+ *  Keybundle capacity a multi-bit PBS buffer was scratched with. Any batch of
+ *  at most max_num_samples samples executed in the buffer must keep its
+ *  num_samples * chunk size product within the scratched one, whatever the
+ *  tuning cache says by then.
+ */
+struct multi_bit_pbs_buffer_layout {
+  uint32_t lwe_chunk_size;
+  uint32_t max_num_samples;
+
+  // Chunk size a batch of num_samples is executed with: the requested one if
+  // its keybundle fits in the buffer, the scratched one otherwise
+  uint32_t execution_chunk_size(uint32_t requested_chunk_size,
+                                uint32_t num_samples) const {
+    if (requested_chunk_size != 0 &&
+        (uint64_t)requested_chunk_size * num_samples <=
+            (uint64_t)lwe_chunk_size * max_num_samples)
+      return requested_chunk_size;
+    return lwe_chunk_size;
+  }
+
+  // Size of a keybundle pipeline slot, given the size of the keybundle of one
+  // sample for one iteration of a chunk. Slots are laid out for the scratched
+  // chunk size, whatever the chunk size a batch is executed with.
+  uint64_t keybundle_slot_size(uint64_t keybundle_size_per_iteration) const {
+    return (uint64_t)max_num_samples * lwe_chunk_size *
+           keybundle_size_per_iteration;
+  }
+};
+
+/*
+ *  Tuned chunk sizes, per device fingerprint, shape and number of samples.
+ *
+ *  The on-disk format is a text file whose first line is the format header,
+ *  followed by one tab-separated entry per line:
+ *    fingerprint lwe_dimension glwe_dimension polynomial_size level_count
+ *    grouping_factor num_samples lwe_chunk_size time_us
+ *  Files with another header are ignored, as well as malformed lines.
+ */
+struct multi_bit_tuning_cache {
+  static constexpr const char *format_header =
+      "tfhe-cuda-backend multi-bit chunk size cache v1";
+
+  typedef std::map<uint32_t, multi_bit_tuning_entry> samples_map;
+  std::map<std::string, std::map<multi_bit_pbs_shape, samples_map>> entries;
+
+  void record(const std::string &fingerprint, multi_bit_pbs_shape shape,
+              uint32_t num_samples, multi_bit_tuning_entry entry) {
+    entries[fingerprint][shape][num_samples] = entry;
+  }
+
+  // Chunk size to use for num_samples: the one tuned for the largest number
+  // of samples not above num_samples, or for the smallest one if there is
+  // none. Returns 0 if nothing was tuned for this device and shape.
+  uint32_t lookup(const std::string &fingerprint, multi_bit_pbs_shape shape,
+                  uint32_t num_samples) const {
+    auto samples = find(fingerprint, shape);
+    if (samples == nullptr)
+      return 0;
+    auto it = samples->upper_bound(num_samples);
+    if (it != samples->begin())
+      it--;
+    return it->second.lwe_chunk_size;
+  }
+
+  // Largest num_samples * chunk size product lookup can lead to for a number
+  // of samples in [1, max_num_samples], which bounds the keybundle size a
+  // buffer scratched for max_num_samples must hold. Returns 0 if nothing was
+  // tuned for this device and shape.
+  uint64_t max_chunk_product(const std::string &fingerprint,
+                             multi_bit_pbs_shape shape,
+                             uint32_t max_num_samples) const {
+    auto samples = find(fingerprint, shape);
+    if (samples == nullptr)
+      return 0;
+    uint64_t product = 0;
+    for (auto it = samples->begin(); it != samples->end(); it++) {
+      // Entry it serves the numbers of samples up to the next entry's one,
+      // the first entry also serves the ones below it
+      auto next = std::next(it);
+      uint64_t last = next == samples->end() ? max_num_samples
+                                             : (uint64_t)next->first - 1;
+      if (last > max_num_samples)
+        last = max_num_samples;
+      uint64_t candidate = last * it->second.lwe_chunk_size;
+      if (candidate > product)
+        product = candidate;
+      if (last == max_num_samples)
+        break;
+    }
+    return product;
+  }
+
+  bool load(std::istream &in) {
+    std::string line;
+    if (!std::getline(in, line) || line != format_header)
+      return false;
+    while (std::getline(in, line)) {
+      std::istringstream fields(line);
+      std::string fingerprint;
+      multi_bit_pbs_shape shape;
+      uint32_t num_samples;
+      multi_bit_tuning_entry entry;
+      if (!std::getline(fields, fingerprint, '\t'))
+        continue;
+      if (!(fields >> shape.lwe_dimension >> shape.glwe_dimension >>
+            shape.polynomial_size >> shape.level_count >>
+            shape.grouping_factor >> num_samples >> entry.lwe_chunk_size >>
+            entry.time_us))
+        continue;
+      if (entry.lwe_chunk_size == 0 || num_samples == 0)
+        continue;
+      record(fingerprint, shape, num_samples, entry);
+    }
+    return true;
+  }
+
+  void save(std::ostream &out) const {
+    out << format_header << "\n";
+    for (auto &device : entries)
+      for (auto &shape : device.second)
+        for (auto &samples : shape.second)
+          out << device.first << "\t" << shape.first.lwe_dimension << "\t"
+              << shape.first.glwe_dimension << "\t"
+              << shape.first.polynomial_size << "\t"
+              << shape.first.level_count << "\t"
+              << shape.first.grouping_factor << "\t" << samples.first << "\t"
+              << samples.second.lwe_chunk_size << "\t"
+              << samples.second.time_us << "\n";
+  }
+
+  bool load_file(const std::string &path) {
+    std::ifstream in(path);
+    return in.good() && load(in);
+  }
+
+  bool save_file(const std::string &path) const {
+    std::ofstream out(path, std::ios::trunc);
+    if (!out.good())
+      return false;
+    save(out);
+    return out.good();
+  }
+
+private:
+  const samples_map *find(const std::string &fingerprint,
+                          multi_bit_pbs_shape shape) const {
+    auto device = entries.find(fingerprint);
+    if (device == entries.end())
+      return nullptr;
+    auto samples = device->second.find(shape);
+    if (samples == device->second.end() || samples->second.empty())
+      return nullptr;
+    return &samples->second;
+  }
+};
+
+#endif // CUDA_MULTI_BIT_TUNING_H
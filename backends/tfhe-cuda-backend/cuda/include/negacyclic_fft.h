@@ -0,0 +1,339 @@
+#ifndef CUDA_NEGACYCLIC_FFT_H
+#define CUDA_NEGACYCLIC_FFT_H
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+#ifdef __CUDACC__
+#define NEGACYCLIC_FFT_HOST_DEVICE __host__ __device__
+#else
+#define NEGACYCLIC_FFT_HOST_DEVICE
+#endif
+
+#ifdef __CUDACC__
+#define NEGACYCLIC_FFT_UNROLL _Pragma("unroll")
+#define NEGACYCLIC_FFT_NO_EXEC_CHECK _Pragma("nv_exec_check_disable")
+#else
+#define NEGACYCLIC_FFT_UNROLL
+#define NEGACYCLIC_FFT_NO_EXEC_CHECK
+#endif
+
+/*
+ *  Host side description of the negacyclic FFT implemented in fft/bnsmfft.cuh.
+ *
+ *  A polynomial of N real coefficients is folded into M = N/2 complex values
+ *  (a_j + i a_{j + M}), then transformed by log2(M) levels of butterflies.
+ *  The butterflies of level k use the twiddles T[2^(k-1) + j], where T is
+ *  the table of the 2M-th roots of -1 stored in bit-reversed order:
+ *
+ *    T[2^m + j] = exp(i pi (4 bitrev_m(j) + 1) / 2^(m+2))
+ *
+ *  The output is in bit-reversed order, X[k] being the evaluation of the
+ *  folded polynomial at exp(i pi (4 bitrev(k) + 1) / N).
+ *
+ *  Nothing here depends on CUDA: the twiddle table of the device FFT is
+ *  generated with these functions, the bootstrap key conversion folds its
+ *  polynomials with compress_torus_coefficients, and the reference transforms
+ *  let the device results be checked in double precision on the host.
+ */
+
+// Version of what the device FFT produces: bump it whenever the twiddles or
+// the layout of the transformed polynomials change, so that bootstrap keys
+// cached in the Fourier domain by an older build are converted again.
+//  1: twiddles from a literal table
+//  2: twiddles generated by generate_negacyclic_twiddles, which differ from
+//     the literal table in the last bit
+constexpr uint32_t negacyclic_fft_format = 2;
+
+inline uint64_t negacyclic_fft_bit_reverse(uint64_t value, uint32_t bits) {
+  uint64_t reversed = 0;
+  for (uint32_t i = 0; i < bits; i++) {
+    reversed = (reversed << 1) | (value & 1);
+    value >>= 1;
+  }
+  return reversed;
+}
+
+template <typename Complex>
+NEGACYCLIC_FFT_HOST_DEVICE inline Complex negacyclic_fft_multiply(Complex a,
+                                                                  Complex b) {
+  Complex c;
+  c.x = a.x * b.x - a.y * b.y;
+  c.y = a.x * b.y + a.y * b.x;
+  return c;
+}
+
+/// Butterfly of the direct transform on lo and hi, the coefficients a
+/// distance apart, with twiddle w.
+template <typename Complex>
+NEGACYCLIC_FFT_HOST_DEVICE inline void
+negacyclic_fft_direct_butterfly(Complex &lo, Complex &hi, Complex w) {
+  Complex v = negacyclic_fft_multiply(hi, w);
+  hi.x = lo.x - v.x;
+  hi.y = lo.y - v.y;
+  lo.x += v.x;
+  lo.y += v.y;
+}
+
+/// Butterfly of the inverse transform, undoes negacyclic_fft_direct_butterfly
+/// up to a factor 2.
+template <typename Complex>
+NEGACYCLIC_FFT_HOST_DEVICE inline void
+negacyclic_fft_inverse_butterfly(Complex &lo, Complex &hi, Complex w) {
+  Complex u;
+  u.x = lo.x - hi.x;
+  u.y = lo.y - hi.y;
+  lo.x += hi.x;
+  lo.y += hi.y;
+  w.y = -w.y;
+  hi = negacyclic_fft_multiply(u, w);
+}
+
+/// Folds the coefficients a_j and a_{j + N/2} of a Torus polynomial into one
+/// complex value, divided by the max of the Torus T.
+template <typename T, typename Complex, typename ST>
+NEGACYCLIC_FFT_HOST_DEVICE inline Complex compress_torus_coefficients(ST re,
+                                                                      ST im) {
+  Complex c;
+  c.x = (double)re / (double)std::numeric_limits<T>::max();
+  c.y = (double)im / (double)std::numeric_limits<T>::max();
+  return c;
+}
+
+/// Writes T[first_index], ..., T[first_index + count - 1] to dest. Complex is
+/// any struct with double x and y members, e.g. double2. The twiddles are
+/// computed in long double so that they are correctly rounded to double.
+template <typename Complex>
+void generate_negacyclic_twiddles(Complex *dest, uint64_t first_index,
+                                  uint64_t count) {
+  const long double pi = 3.141592653589793238462643383279502884L;
+  for (uint64_t index = first_index; index < first_index + count; index++) {
+    // T[0] is never used by the butterflies
+    if (index == 0) {
+      dest[index - first_index].x = 0;
+      dest[index - first_index].y = 0;
+      continue;
+    }
+    uint32_t m = 0;
+    while ((index >> (m + 1)) != 0)
+      m++;
+    uint64_t j = index - ((uint64_t)1 << m);
+    long double angle =
+        pi * (long double)(4 * negacyclic_fft_bit_reverse(j, m) + 1) /
+        (long double)((uint64_t)1 << (m + 2));
+    dest[index - first_index].x = (double)cosl(angle);
+    dest[index - first_index].y = (double)sinl(angle);
+  }
+}
+
+/// Value k (bit-reversed order) of the reference forward transform of the
+/// polynomial a of polynomial_size real coefficients.
+template <typename Complex>
+Complex reference_negacyclic_fft_value(const double *a,
+                                       uint32_t polynomial_size, uint32_t k) {
+  const long double pi = 3.141592653589793238462643383279502884L;
+  uint32_t half = polynomial_size / 2;
+  uint32_t log2_half = 0;
+  while ((1u << (log2_half + 1)) <= half)
+    log2_half++;
+
+  uint64_t root = 4 * negacyclic_fft_bit_reverse(k, log2_half) + 1;
+  long double re = 0, im = 0;
+  for (uint32_t j = 0; j < half; j++) {
+    // j * root only matters modulo 2 * polynomial_size
+    long double angle = pi *
+                        (long double)((j * root) % (2 * polynomial_size)) /
+                        (long double)polynomial_size;
+    long double c = cosl(angle), s = sinl(angle);
+    re += a[j] * c - a[j + half] * s;
+    im += a[j] * s + a[j + half] * c;
+  }
+  Complex value;
+  value.x = (double)re;
+  value.y = (double)im;
+  return value;
+}
+
+/// Reference forward transform of the polynomial a of polynomial_size real
+/// coefficients, written to dest (polynomial_size / 2 values, bit-reversed
+/// order). Quadratic, meant for validation only.
+template <typename Complex>
+void reference_negacyclic_fft(Complex *dest, const double *a,
+                              uint32_t polynomial_size) {
+  for (uint32_t k = 0; k < polynomial_size / 2; k++)
+    dest[k] = reference_negacyclic_fft_value<Complex>(a, polynomial_size, k);
+}
+
+/// Reference inverse of reference_negacyclic_fft, writes the polynomial_size
+/// real coefficients to dest.
+template <typename Complex>
+void reference_negacyclic_ifft(double *dest, const Complex *A,
+                               uint32_t polynomial_size) {
+  const long double pi = 3.141592653589793238462643383279502884L;
+  uint32_t half = polynomial_size / 2;
+  uint32_t log2_half = 0;
+  while ((1u << (log2_half + 1)) <= half)
+    log2_half++;
+
+  for (uint32_t j = 0; j < half; j++) {
+    long double re = 0, im = 0;
+    for (uint32_t k = 0; k < half; k++) {
+      uint64_t root = 4 * negacyclic_fft_bit_reverse(k, log2_half) + 1;
+      long double angle = -pi *
+                          (long double)((j * root) % (2 * polynomial_size)) /
+                          (long double)polynomial_size;
+      long double c = cosl(angle), s = sinl(angle);
+      re += A[k].x * c - A[k].y * s;
+      im += A[k].x * s + A[k].y * c;
+    }
+    dest[j] = (double)(re / half);
+    dest[j + half] = (double)(im / half);
+  }
+}
+
+/// Forward transform of the polynomial_size / 2 folded values of A, in place,
+/// one level of radix-2 butterflies after the other: the order of the device
+/// FFT before its levels were merged. twiddles holds T[0], ...,
+/// T[polynomial_size / 2 - 1]. Unlike the reference transforms it runs in
+/// O(N log N), so that it can check the largest sizes.
+template <typename Complex>
+void negacyclic_fft_radix2(Complex *A, const Complex *twiddles,
+                           uint32_t polynomial_size) {
+  uint32_t half = polynomial_size / 2;
+  uint32_t level = 1;
+  for (uint32_t distance = half / 2; distance >= 1; distance /= 2, level++) {
+    for (uint32_t block = 0; block < half / (2 * distance); block++) {
+      Complex w = twiddles[(1u << (level - 1)) + block];
+      for (uint32_t j = 2 * block * distance; j < (2 * block + 1) * distance;
+           j++) {
+        negacyclic_fft_direct_butterfly(A[j], A[j + distance], w);
+      }
+    }
+  }
+}
+
+/// Inverse of negacyclic_fft_radix2, including the division by
+/// polynomial_size / 2.
+template <typename Complex>
+void negacyclic_ifft_radix2(Complex *A, const Complex *twiddles,
+                            uint32_t polynomial_size) {
+  uint32_t half = polynomial_size / 2;
+  for (uint32_t j = 0; j < half; j++) {
+    A[j].x /= half;
+    A[j].y /= half;
+  }
+  uint32_t level = 1;
+  while ((2u << level) <= half)
+    level++;
+  for (uint32_t distance = 1; distance < half; distance *= 2, level--) {
+    for (uint32_t block = 0; block < half / (2 * distance); block++) {
+      Complex w = twiddles[(1u << (level - 1)) + block];
+      for (uint32_t j = 2 * block * distance; j < (2 * block + 1) * distance;
+           j++)
+        negacyclic_fft_inverse_butterfly(A[j], A[j + distance], w);
+    }
+  }
+}
+
+/*
+ *  Schedule of the device FFT, shared with the host so that it can be
+ *  emulated there and checked against the transforms above.
+ *
+ *  A transform of 2^L points applies levels 1 to L - negacyclic_fft_warp_levels
+ *  in radix-2^k stages of negacyclic_fft_stage_levels(opt) levels (the last
+ *  one may be shorter), then the last negacyclic_fft_warp_levels levels in a
+ *  warp stage. The inverse runs the warp stage first, then the radix-2^k
+ *  stages from level L - negacyclic_fft_warp_levels down (the first one may
+ *  be shorter).
+ *
+ *  The functions take the twiddles from twiddle(level, j), which returns
+ *  T[2^(level-1) + j].
+ */
+constexpr int negacyclic_fft_warp_levels = 6;
+
+/// Levels merged in a radix-2^k stage when each thread holds opt
+/// coefficients, up to 3 (radix-8).
+constexpr int negacyclic_fft_stage_levels(int opt) {
+  return opt >= 8 ? 3 : (opt >= 4 ? 2 : 1);
+}
+
+/// Index of the first of the 2^levels coefficients of group `group` of a
+/// stage, the coefficients being stride apart.
+NEGACYCLIC_FFT_HOST_DEVICE inline size_t
+negacyclic_fft_group_first(size_t group, size_t stride, int levels) {
+  return (group / stride) * (stride << levels) + (group & (stride - 1));
+}
+
+/// Applies levels first_level to first_level + levels - 1 of the direct
+/// transform to the 2^levels coefficients x of a group, block being the
+/// twiddle index of the group at first_level (group / stride).
+NEGACYCLIC_FFT_NO_EXEC_CHECK
+template <int first_level, int levels, typename Complex, typename Twiddle>
+NEGACYCLIC_FFT_HOST_DEVICE inline void
+negacyclic_fft_direct_group(Complex *x, size_t block, Twiddle twiddle) {
+  constexpr int radix = 1 << levels;
+  NEGACYCLIC_FFT_UNROLL
+  for (int s = 0; s < levels; ++s) {
+    int half = radix >> (s + 1);
+    NEGACYCLIC_FFT_UNROLL
+    for (int q = 0; q < (1 << s); ++q) {
+      Complex w = twiddle(first_level + s, (block << s) + q);
+      NEGACYCLIC_FFT_UNROLL
+      for (int t = 2 * half * q; t < 2 * half * q + half; ++t)
+        negacyclic_fft_direct_butterfly(x[t], x[t + half], w);
+    }
+  }
+}
+
+/// Same for the inverse transform, the levels being applied in reverse order.
+NEGACYCLIC_FFT_NO_EXEC_CHECK
+template <int first_level, int levels, typename Complex, typename Twiddle>
+NEGACYCLIC_FFT_HOST_DEVICE inline void
+negacyclic_fft_inverse_group(Complex *x, size_t block, Twiddle twiddle) {
+  constexpr int radix = 1 << levels;
+  NEGACYCLIC_FFT_UNROLL
+  for (int s = levels - 1; s >= 0; --s) {
+    int half = radix >> (s + 1);
+    NEGACYCLIC_FFT_UNROLL
+    for (int q = 0; q < (1 << s); ++q) {
+      Complex w = twiddle(first_level + s, (block << s) + q);
+      NEGACYCLIC_FFT_UNROLL
+      for (int t = 2 * half * q; t < 2 * half * q + half; ++t)
+        negacyclic_fft_inverse_butterfly(x[t], x[t + half], w);
+    }
+  }
+}
+
+/// Twiddle index of coefficient `coefficient` of chunk `chunk` at level
+/// first_level + s of the warp stage, a chunk holding the
+/// 2^negacyclic_fft_warp_levels coefficients the stage mixes together.
+NEGACYCLIC_FFT_HOST_DEVICE inline uint32_t
+negacyclic_fft_warp_twiddle_index(size_t chunk, size_t coefficient, int s) {
+  return (uint32_t)((chunk << negacyclic_fft_warp_levels) + coefficient) >>
+         (negacyclic_fft_warp_levels - s);
+}
+
+/// Level of the warp stage exchanged between lanes: returns the new value of
+/// own, partner being the coefficient of the other lane it shares a
+/// butterfly with and upper telling whether own is the higher of the two.
+template <typename Complex>
+NEGACYCLIC_FFT_HOST_DEVICE inline Complex
+negacyclic_fft_direct_lane(Complex own, Complex partner, Complex w,
+                           bool upper) {
+  Complex lo = upper ? partner : own, hi = upper ? own : partner;
+  negacyclic_fft_direct_butterfly(lo, hi, w);
+  return upper ? hi : lo;
+}
+
+template <typename Complex>
+NEGACYCLIC_FFT_HOST_DEVICE inline Complex
+negacyclic_fft_inverse_lane(Complex own, Complex partner, Complex w,
+                            bool upper) {
+  Complex lo = upper ? partner : own, hi = upper ? own : partner;
+  negacyclic_fft_inverse_butterfly(lo, hi, w);
+  return upper ? hi : lo;
+}
+
+#endif // CUDA_NEGACYCLIC_FFT_H
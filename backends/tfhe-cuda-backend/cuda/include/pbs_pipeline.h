@@ -0,0 +1,50 @@
+#ifndef CUDA_PBS_PIPELINE_H
+#define CUDA_PBS_PIPELINE_H
+
+#include "device.h"
+#include "multi_bit_pipeline.h"
+
+/*
+ *  Side stream and events used to overlap the keybundle computation of the
+ *  multi-bit PBS with its accumulation, see multi_bit_pipeline.h. One set is
+ *  attached to each cuda_stream_t, the PBS calls enqueued on a stream reuse
+ *  the same side stream so they stay ordered with each other.
+ */
+struct pbs_pipeline {
+  uint32_t gpu_index;
+  cudaStream_t side_stream;
+  cudaEvent_t events[multi_bit_pipeline_num_events];
+
+  pbs_pipeline(uint32_t gpu_index) : gpu_index(gpu_index) {
+    cudaSetDevice(gpu_index);
+    check_cuda_error(cudaStreamCreate(&side_stream));
+    for (uint32_t i = 0; i < multi_bit_pipeline_num_events; i++)
+      check_cuda_error(
+          cudaEventCreateWithFlags(&events[i], cudaEventDisableTiming));
+  }
+
+  ~pbs_pipeline() {
+    cudaSetDevice(gpu_index);
+    // The main stream may not have caught up with the side stream yet
+    cudaStreamSynchronize(side_stream);
+    for (uint32_t i = 0; i < multi_bit_pipeline_num_events; i++)
+      cudaEventDestroy(events[i]);
+    cudaStreamDestroy(side_stream);
+  }
+
+  cudaStream_t get_stream(cuda_stream_t *stream,
+                          MULTI_BIT_PIPELINE_STREAM which) {
+    return which == PIPELINE_MAIN_STREAM ? stream->stream : side_stream;
+  }
+};
+
+/*
+ *  Returns the pipeline attached to stream, creating it on first use
+ */
+inline pbs_pipeline *get_pbs_pipeline(cuda_stream_t *stream) {
+  if (stream->pipeline == nullptr)
+    stream->pipeline = new pbs_pipeline(stream->gpu_index);
+  return stream->pipeline;
+}
+
+#endif // CUDA_PBS_PIPELINE_H
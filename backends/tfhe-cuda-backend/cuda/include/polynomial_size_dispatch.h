@@ -0,0 +1,131 @@
+#ifndef CUDA_POLYNOMIAL_SIZE_DISPATCH_H
+#define CUDA_POLYNOMIAL_SIZE_DISPATCH_H
+
+#include <cassert>
+#include <cstdint>
+#include <mutex>
+#include <type_traits>
+
+/*
+ *  Compile-time dispatch over the polynomial sizes supported by the FFT.
+ *
+ *  Op is a class template on the polynomial size. All its instantiations
+ *  expose a static `run` function with the same signature, the Torus type and
+ *  the kind of kernel being part of Op itself. The registry holds one pointer
+ *  to Op<N>::run per supported size, indexed by log2(N), so that a call goes
+ *  through a single table lookup instead of a switch over every size.
+ *
+ *  Nothing here depends on CUDA so that the tables can be checked on the host.
+ */
+template <int... Sizes> struct polynomial_size_list {};
+
+using supported_polynomial_sizes =
+    polynomial_size_list<256, 512, 1024, 2048, 4096, 8192, 16384>;
+
+// Sizes up to 65536, whose last FFT level computes its twiddles on the fly,
+// only instantiated for the low latency PBS and the key conversion
+using large_polynomial_sizes =
+    polynomial_size_list<256, 512, 1024, 2048, 4096, 8192, 16384, 32768,
+                         65536>;
+
+// Number of slots of a dispatch table, enough for sizes up to 2^16
+constexpr uint32_t polynomial_size_dispatch_slots = 17;
+
+constexpr uint32_t log2_polynomial_size(uint32_t polynomial_size) {
+  uint32_t log = 0;
+  while ((1u << (log + 1)) <= polynomial_size)
+    log++;
+  return log;
+}
+
+template <int First, int... Rest> struct first_polynomial_size {
+  static constexpr int value = First;
+};
+
+template <template <int> class Op, class Sizes = supported_polynomial_sizes>
+struct polynomial_size_dispatch;
+
+template <template <int> class Op, int... Sizes>
+struct polynomial_size_dispatch<Op, polynomial_size_list<Sizes...>> {
+  using function_t =
+      decltype(&Op<first_polynomial_size<Sizes...>::value>::run);
+
+  struct table_t {
+    function_t entries[polynomial_size_dispatch_slots];
+  };
+
+  static constexpr table_t make_table() {
+    table_t table{};
+    ((table.entries[log2_polynomial_size(Sizes)] = &Op<Sizes>::run), ...);
+    return table;
+  }
+
+  static constexpr table_t table = make_table();
+
+  // Returns nullptr if polynomial_size is not supported
+  static function_t lookup(uint32_t polynomial_size) {
+    if (polynomial_size == 0 || (polynomial_size & (polynomial_size - 1)) != 0)
+      return nullptr;
+    uint32_t log = log2_polynomial_size(polynomial_size);
+    if (log >= polynomial_size_dispatch_slots)
+      return nullptr;
+    return table.entries[log];
+  }
+
+  static bool supports(uint32_t polynomial_size) {
+    return lookup(polynomial_size) != nullptr;
+  }
+
+  // Calls Op<polynomial_size>::run, or returns a value-initialized result
+  // when the size is not supported
+  template <typename... Args>
+  static auto run(uint32_t polynomial_size, Args... args) {
+    using result_t = std::invoke_result_t<function_t, Args...>;
+    function_t function = lookup(polynomial_size);
+    assert(("Error (GPU): unsupported polynomial size", function != nullptr));
+    if (function == nullptr)
+      return result_t();
+    return function(args...);
+  }
+};
+
+/*
+ *  Runs configure the first time it is called for a given Tag on gpu_index,
+ *  used to set kernel attributes once per device instead of before every
+ *  launch.
+ */
+constexpr uint32_t max_configured_devices = 64;
+
+template <class Tag> struct device_once_flags {
+  static inline std::once_flag flags[max_configured_devices];
+};
+
+template <class Tag, class F>
+void call_once_per_device(uint32_t gpu_index, F &&configure) {
+  assert(("Error (GPU): gpu index out of range",
+          gpu_index < max_configured_devices));
+  std::call_once(device_once_flags<Tag>::flags[gpu_index], configure);
+}
+
+/*
+ *  Result of query on gpu_index, only computed the first time it is needed
+ *  for a given Tag. Used for the device properties of a kernel, such as its
+ *  occupancy, which the dispatch functions would otherwise query before
+ *  every launch.
+ */
+template <class Tag> struct device_query_results {
+  static inline int values[max_configured_devices];
+};
+
+template <class Tag, class F>
+int query_once_per_device(uint32_t gpu_index, F &&query) {
+  call_once_per_device<Tag>(gpu_index, [&] {
+    device_query_results<Tag>::values[gpu_index] = query();
+  });
+  return device_query_results<Tag>::values[gpu_index];
+}
+
+// Tag of a kernel instantiation, e.g. kernel_tag<my_kernel<params, FULLSM>>
+template <auto Kernel> struct kernel_tag {};
+
+#endif // CUDA_POLYNOMIAL_SIZE_DISPATCH_H
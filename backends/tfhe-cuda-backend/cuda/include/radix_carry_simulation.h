@@ -0,0 +1,336 @@
+#ifndef CUDA_RADIX_CARRY_SIMULATION_H
+#define CUDA_RADIX_CARRY_SIMULATION_H
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+/*
+ *  Plaintext models of the carry propagation algorithms of the integer module.
+ *  Each block is represented by its cleartext value, and every lookup table
+ *  the GPU implementation evaluates is applied to it directly. They count the
+ *  number of PBS rounds (batches that have to run one after the other) and the
+ *  total number of PBS, so that algorithms can be checked against each other
+ *  without a GPU.
+ */
+
+// Values of the carry flags, matching OUTPUT_CARRY in integer.h
+enum SIMULATED_CARRY {
+  SIMULATED_NONE = 0,
+  SIMULATED_GENERATED = 1,
+  SIMULATED_PROPAGATED = 2
+};
+
+struct radix_carry_simulation_cost {
+  uint32_t pbs_rounds;
+  uint64_t pbs_count;
+
+  void add_round(uint64_t num_pbs) {
+    pbs_rounds++;
+    pbs_count += num_pbs;
+  }
+};
+
+/*
+ *  Number of message/carry split rounds the tree full propagation needs so
+ *  that every block holds at most 2 * message_modulus - 2, the largest value
+ *  for which a block outputs a single carry. The blocks are assumed to use
+ *  the whole plaintext space, i.e. values up to
+ *  message_modulus * carry_modulus - 1.
+ */
+inline uint32_t get_full_propagation_tree_split_rounds(uint32_t message_modulus,
+                                                       uint32_t carry_modulus) {
+  assert(("Error (carry propagation): message modulus should be at least 2",
+          message_modulus >= 2));
+  uint64_t max_value = (uint64_t)message_modulus * carry_modulus - 1;
+  uint32_t num_rounds = 0;
+  // A split round leaves at most message_modulus - 1 in a block, plus the
+  // carry coming from the previous block
+  while (max_value > 2 * (uint64_t)message_modulus - 2) {
+    max_value = message_modulus - 1 + max_value / message_modulus;
+    num_rounds++;
+  }
+  return num_rounds;
+}
+
+/*
+ *  Models host_full_propagate_inplace: one block at a time, the message and
+ *  carry of a block are extracted with 2 PBS and the carry is added to the
+ *  next block. The carry of the last block is dropped.
+ */
+inline radix_carry_simulation_cost
+simulate_full_propagation_sequential(std::vector<uint64_t> &blocks,
+                                     uint32_t message_modulus,
+                                     uint32_t carry_modulus) {
+  radix_carry_simulation_cost cost = {0, 0};
+  uint64_t modulus_sup = (uint64_t)message_modulus * carry_modulus;
+  for (size_t i = 0; i < blocks.size(); i++) {
+    assert(("Error (carry propagation): block overflows its plaintext space",
+            blocks[i] < modulus_sup));
+    uint64_t carry = blocks[i] / message_modulus;
+    blocks[i] %= message_modulus;
+    cost.add_round(2);
+    if (i + 1 < blocks.size())
+      blocks[i + 1] += carry;
+  }
+  return cost;
+}
+
+/*
+ *  Carry flag prefix scans.
+ *
+ *  A scan is a list of rounds, each round being a list of (dst, src) block
+ *  pairs evaluated as a single batch of bivariate PBS:
+ *    flags[dst] = combine(flags[dst], flags[src])
+ *  where src covers blocks below the ones dst covers. All the flags a round
+ *  reads are gathered before any of them is written back.
+ */
+enum CARRY_SCAN_TYPE {
+  // Picked from the parameters and the number of blocks, see
+  // select_carry_scan_type
+  CARRY_SCAN_AUTO = 0,
+  // Hillis-Steele (Kogge-Stone): ceil(log2 N) rounds, ~N log2 N PBS
+  CARRY_SCAN_HILLIS_STEELE = 1,
+  // Sklansky: ceil(log2 N) rounds, ~N/2 log2 N PBS
+  CARRY_SCAN_SKLANSKY = 2,
+  // Brent-Kung: ~2 log2 N rounds, < 2N PBS
+  CARRY_SCAN_BRENT_KUNG = 3,
+  // Blocks are grouped by pairs with a Brent-Kung level, the group carries
+  // are resolved with a Sklansky scan and then sent back to the blocks:
+  // ceil(log2 N) + 1 rounds, ~N/4 log2 N + N PBS
+  CARRY_SCAN_GROUPED_SKLANSKY = 4,
+};
+
+typedef std::vector<std::pair<uint32_t, uint32_t>> carry_scan_round;
+
+inline uint32_t carry_scan_log2_ceil(uint32_t n) {
+  uint32_t log = 0;
+  while (((uint64_t)1 << log) < n)
+    log++;
+  return log;
+}
+
+inline std::vector<carry_scan_round>
+generate_hillis_steele_scan(uint32_t num_blocks) {
+  std::vector<carry_scan_round> rounds;
+  for (uint32_t space = 1; space < num_blocks; space *= 2) {
+    carry_scan_round round;
+    for (uint32_t i = space; i < num_blocks; i++)
+      round.push_back({i, i - space});
+    rounds.push_back(round);
+  }
+  return rounds;
+}
+
+/*
+ *  Brent-Kung up-sweep over the first group_levels levels, so that the last
+ *  block of every group of 2^group_levels blocks holds the group flag, then a
+ *  Sklansky scan over those last blocks, then the matching Brent-Kung
+ *  down-sweep. group_levels = 0 is a plain Sklansky scan, and group_levels =
+ *  ceil(log2 N) a plain Brent-Kung scan.
+ */
+inline std::vector<carry_scan_round>
+generate_grouped_sklansky_scan(uint32_t num_blocks, uint32_t group_levels) {
+  std::vector<carry_scan_round> rounds;
+  auto push_round = [&rounds](carry_scan_round &round) {
+    if (!round.empty())
+      rounds.push_back(round);
+  };
+
+  auto max_levels = carry_scan_log2_ceil(num_blocks);
+  if (group_levels > max_levels)
+    group_levels = max_levels;
+
+  // Up-sweep
+  for (uint32_t level = 0; level < group_levels; level++) {
+    uint32_t span = 1 << level;
+    carry_scan_round round;
+    for (uint64_t i = 2 * span - 1; i < num_blocks; i += 2 * span)
+      round.push_back({i, i - span});
+    push_round(round);
+  }
+
+  // Sklansky over the last block of every full group
+  uint32_t group_size = 1 << group_levels;
+  uint32_t num_groups = num_blocks / group_size;
+  for (uint32_t span = 1; span < num_groups; span *= 2) {
+    carry_scan_round round;
+    for (uint32_t j = 0; j < num_groups; j++) {
+      if ((j & span) == 0)
+        continue;
+      uint32_t src = (j & ~(span - 1)) - 1;
+      round.push_back({j * group_size + group_size - 1,
+                       src * group_size + group_size - 1});
+    }
+    push_round(round);
+  }
+
+  // Down-sweep
+  for (uint32_t level = group_levels; level-- > 0;) {
+    uint32_t span = 1 << level;
+    carry_scan_round round;
+    for (uint64_t i = 3 * span - 1; i < num_blocks; i += 2 * span)
+      round.push_back({i, i - span});
+    push_round(round);
+  }
+  return rounds;
+}
+
+inline std::vector<carry_scan_round>
+generate_carry_scan(CARRY_SCAN_TYPE scan_type, uint32_t num_blocks) {
+  switch (scan_type) {
+  case CARRY_SCAN_SKLANSKY:
+    return generate_grouped_sklansky_scan(num_blocks, 0);
+  case CARRY_SCAN_BRENT_KUNG:
+    return generate_grouped_sklansky_scan(num_blocks,
+                                          carry_scan_log2_ceil(num_blocks));
+  case CARRY_SCAN_GROUPED_SKLANSKY:
+    return generate_grouped_sklansky_scan(num_blocks, 1);
+  default:
+    return generate_hillis_steele_scan(num_blocks);
+  }
+}
+
+/*
+ *  Estimated latency of a scan, in PBS waves: a round of n PBS takes
+ *  ceil(n / concurrent_pbs) waves when the GPU can run concurrent_pbs of them
+ *  at once.
+ */
+inline uint64_t
+estimate_carry_scan_waves(const std::vector<carry_scan_round> &rounds,
+                          uint32_t concurrent_pbs) {
+  if (concurrent_pbs == 0)
+    concurrent_pbs = 1;
+  uint64_t waves = 0;
+  for (auto &round : rounds)
+    waves += (round.size() + concurrent_pbs - 1) / concurrent_pbs;
+  return waves;
+}
+
+/*
+ *  Scan with the fewest estimated waves for num_blocks blocks, ties going to
+ *  the one with the fewest PBS. Small radix ciphertexts get the shallow
+ *  Sklansky scan, and the ones whose rounds exceed the GPU capacity the
+ *  work-efficient Brent-Kung or grouped scans.
+ */
+inline CARRY_SCAN_TYPE select_carry_scan_type(uint32_t num_blocks,
+                                              uint32_t concurrent_pbs) {
+  const CARRY_SCAN_TYPE candidates[] = {CARRY_SCAN_SKLANSKY,
+                                        CARRY_SCAN_GROUPED_SKLANSKY,
+                                        CARRY_SCAN_BRENT_KUNG};
+  CARRY_SCAN_TYPE best_type = CARRY_SCAN_SKLANSKY;
+  uint64_t best_waves = 0, best_pbs = 0;
+  bool first = true;
+  for (auto scan_type : candidates) {
+    auto rounds = generate_carry_scan(scan_type, num_blocks);
+    uint64_t waves = estimate_carry_scan_waves(rounds, concurrent_pbs);
+    uint64_t num_pbs = 0;
+    for (auto &round : rounds)
+      num_pbs += round.size();
+    if (first || waves < best_waves ||
+        (waves == best_waves && num_pbs < best_pbs)) {
+      best_type = scan_type;
+      best_waves = waves;
+      best_pbs = num_pbs;
+      first = false;
+    }
+  }
+  return best_type;
+}
+
+/*
+ *  Models host_propagate_single_carry_low_latency: generate/propagate flags,
+ *  prefix scan of the flags, then the resolved carries are added to the next
+ *  blocks and the messages are extracted. Every block must hold at most
+ *  2 * message_modulus - 2.
+ */
+inline radix_carry_simulation_cost simulate_propagate_single_carry(
+    std::vector<uint64_t> &blocks, uint32_t message_modulus,
+    uint32_t carry_modulus,
+    CARRY_SCAN_TYPE scan_type = CARRY_SCAN_HILLIS_STEELE) {
+  radix_carry_simulation_cost cost = {0, 0};
+  size_t num_blocks = blocks.size();
+  if (num_blocks == 0)
+    return cost;
+
+  std::vector<uint64_t> generates_or_propagates(num_blocks);
+  for (size_t i = 0; i < num_blocks; i++) {
+    assert(("Error (carry propagation): block may output more than one carry",
+            blocks[i] <= 2 * (uint64_t)message_modulus - 2));
+    if (blocks[i] >= message_modulus)
+      generates_or_propagates[i] = SIMULATED_GENERATED;
+    else if (i > 0 && blocks[i] == message_modulus - 1)
+      generates_or_propagates[i] = SIMULATED_PROPAGATED;
+    else
+      generates_or_propagates[i] = SIMULATED_NONE;
+  }
+  cost.add_round(num_blocks);
+
+  std::vector<uint64_t> step_output(num_blocks);
+  for (auto &round : generate_carry_scan(scan_type, num_blocks)) {
+    for (size_t k = 0; k < round.size(); k++) {
+      uint64_t msb = generates_or_propagates[round[k].first];
+      uint64_t lsb = generates_or_propagates[round[k].second];
+      step_output[k] = (msb == SIMULATED_PROPAGATED) ? lsb : msb;
+    }
+    for (size_t k = 0; k < round.size(); k++)
+      generates_or_propagates[round[k].first] = step_output[k];
+    cost.add_round(round.size());
+  }
+
+  for (size_t i = num_blocks - 1; i > 0; i--) {
+    assert(("Error (carry propagation): carry flag left unresolved",
+            generates_or_propagates[i - 1] != SIMULATED_PROPAGATED));
+    blocks[i] += generates_or_propagates[i - 1];
+  }
+  for (size_t i = 0; i < num_blocks; i++) {
+    assert(("Error (carry propagation): block overflows its plaintext space",
+            blocks[i] < (uint64_t)message_modulus * carry_modulus));
+    blocks[i] %= message_modulus;
+  }
+  cost.add_round(num_blocks);
+  return cost;
+}
+
+/*
+ *  Models host_full_propagate_tree_inplace: split rounds that extract the
+ *  message and the carry of every block in a single batch and add each carry
+ *  to the next block, until every block outputs at most one carry, followed
+ *  by the single carry propagation. Gives the same blocks as
+ *  simulate_full_propagation_sequential.
+ */
+inline radix_carry_simulation_cost simulate_full_propagation_tree(
+    std::vector<uint64_t> &blocks, uint32_t message_modulus,
+    uint32_t carry_modulus,
+    CARRY_SCAN_TYPE scan_type = CARRY_SCAN_HILLIS_STEELE) {
+  radix_carry_simulation_cost cost = {0, 0};
+  size_t num_blocks = blocks.size();
+  if (num_blocks == 0)
+    return cost;
+
+  uint64_t modulus_sup = (uint64_t)message_modulus * carry_modulus;
+  auto num_split_rounds =
+      get_full_propagation_tree_split_rounds(message_modulus, carry_modulus);
+  std::vector<uint64_t> carries(num_blocks);
+  for (uint32_t round = 0; round < num_split_rounds; round++) {
+    for (size_t i = 0; i < num_blocks; i++) {
+      assert(("Error (carry propagation): block overflows its plaintext space",
+              blocks[i] < modulus_sup));
+      carries[i] = blocks[i] / message_modulus;
+      blocks[i] %= message_modulus;
+    }
+    cost.add_round(2 * num_blocks);
+    for (size_t i = num_blocks - 1; i > 0; i--)
+      blocks[i] += carries[i - 1];
+  }
+
+  auto scan_cost = simulate_propagate_single_carry(blocks, message_modulus,
+                                                   carry_modulus, scan_type);
+  cost.pbs_rounds += scan_cost.pbs_rounds;
+  cost.pbs_count += scan_cost.pbs_count;
+  return cost;
+}
+
+#endif // CUDA_RADIX_CARRY_SIMULATION_H
@@ -0,0 +1,765 @@
+#ifndef CUDA_RADIX_MULT_PLAN_H
+#define CUDA_RADIX_MULT_PLAN_H
+
+#include "many_lut.h"
+#include "radix_carry_simulation.h"
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <vector>
+
+/*
+ *  Radix multiplication plans.
+ *
+ *  A plan is a straight-line program over "slots", each holding one radix
+ *  block (a big LWE ciphertext on the GPU, a cleartext value in
+ *  run_radix_mult_plan). It only depends on the number of blocks and the
+ *  parameters, so it is built once at scratch time. Slots [0, num_blocks)
+ *  hold the left operand and [num_blocks, 2 * num_blocks) the right one.
+ *
+ *  A plan is a list of steps of two kinds:
+ *  - LUT steps: a single batch of PBS, item k computes
+ *      slot[out] = lut(slot[lhs], slot[rhs])
+ *    bivariate LUTs read slot[lhs] * message_modulus + slot[rhs], univariate
+ *    ones have rhs = RADIX_PLAN_NO_SLOT. PLAN_LUT_MESSAGE_AND_CARRY items
+ *    also write the carry of slot[lhs] to slot[carry_out], both functions
+ *    being packed in a many-LUT accumulator (see many_lut.h): the step then
+ *    extracts two LWEs per PBS, and its many-LUT items come first.
+ *  - SUM steps: linear combinations, no PBS,
+ *      slot[out] = constant + sum(sign * slot[term])
+ *  Every step reads all its inputs before writing any output.
+ *
+ *  As in the sum of ciphertexts of the multiplication, a sum adds the noise
+ *  of its terms, and never more than max_noise_level fresh PBS outputs:
+ *  (message_modulus * carry_modulus - 1) / (message_modulus - 1), 5 for the
+ *  2_2 parameters. Constants don't add noise.
+ */
+
+#define RADIX_PLAN_NO_SLOT 0xFFFFFFFFu
+
+enum RADIX_PLAN_LUT {
+  PLAN_LUT_MUL_LSB = 0,
+  PLAN_LUT_MUL_MSB = 1,
+  PLAN_LUT_MESSAGE = 2,
+  PLAN_LUT_CARRY = 3,
+  PLAN_LUT_GENERATE = 4,
+  PLAN_LUT_GENERATE_OR_PROPAGATE = 5,
+  PLAN_LUT_CARRY_COMBINE = 6,
+  PLAN_LUT_MESSAGE_AND_CARRY = 7,
+  PLAN_LUT_COUNT = 8,
+};
+
+inline bool radix_plan_lut_is_bivariate(uint32_t lut) {
+  return lut == PLAN_LUT_MUL_LSB || lut == PLAN_LUT_MUL_MSB ||
+         lut == PLAN_LUT_CARRY_COMBINE;
+}
+
+// Cleartext function of every LUT, used both to generate the GPU accumulators
+// and to run plans on cleartexts. rhs is ignored by univariate LUTs.
+// PLAN_LUT_MESSAGE_AND_CARRY evaluates to the message, its carry is the one of
+// PLAN_LUT_CARRY.
+inline uint64_t radix_plan_eval_lut(uint32_t lut, uint64_t lhs, uint64_t rhs,
+                                    uint32_t message_modulus) {
+  switch (lut) {
+  case PLAN_LUT_MUL_LSB:
+    return (lhs * rhs) % message_modulus;
+  case PLAN_LUT_MUL_MSB:
+    return (lhs * rhs) / message_modulus;
+  case PLAN_LUT_MESSAGE:
+  case PLAN_LUT_MESSAGE_AND_CARRY:
+    return lhs % message_modulus;
+  case PLAN_LUT_CARRY:
+    return lhs / message_modulus;
+  case PLAN_LUT_GENERATE:
+    return lhs >= message_modulus ? SIMULATED_GENERATED : SIMULATED_NONE;
+  case PLAN_LUT_GENERATE_OR_PROPAGATE:
+    if (lhs >= message_modulus)
+      return SIMULATED_GENERATED;
+    if (lhs == message_modulus - 1)
+      return SIMULATED_PROPAGATED;
+    return SIMULATED_NONE;
+  case PLAN_LUT_CARRY_COMBINE:
+    return lhs == SIMULATED_PROPAGATED ? rhs : lhs;
+  default:
+    return 0;
+  }
+}
+
+struct radix_plan_lut_item {
+  uint32_t lhs;
+  uint32_t rhs;
+  uint32_t out;
+  uint32_t lut;
+  uint32_t carry_out = RADIX_PLAN_NO_SLOT;
+};
+
+struct radix_plan_sum_item {
+  uint32_t out;
+  uint32_t first_term;
+  uint32_t num_terms;
+  uint64_t constant;
+};
+
+struct radix_plan_term {
+  uint32_t slot;
+  int32_t sign;
+};
+
+struct radix_plan_step {
+  bool is_lut;
+  std::vector<radix_plan_lut_item> luts;
+  std::vector<radix_plan_sum_item> sums;
+  std::vector<radix_plan_term> terms;
+
+  // Leading items of a LUT step evaluated by a many-LUT
+  uint32_t num_many_lut_items() const {
+    uint32_t count = 0;
+    while (count < luts.size() && luts[count].carry_out != RADIX_PLAN_NO_SLOT)
+      count++;
+    return count;
+  }
+};
+
+struct radix_mult_plan {
+  uint32_t num_blocks;
+  uint32_t message_modulus;
+  uint32_t carry_modulus;
+  // Karatsuba is used on operands larger than this number of blocks,
+  // 0 builds a schoolbook plan
+  uint32_t karatsuba_threshold;
+  // Whether the message and the carry of a block may be extracted by a single
+  // many-LUT PBS, when its degree is small enough
+  bool many_lut;
+  uint32_t num_slots;
+  uint32_t max_lut_items;
+  std::vector<uint32_t> output_slots;
+  std::vector<radix_plan_step> steps;
+
+  uint64_t pbs_count() const {
+    uint64_t count = 0;
+    for (auto &step : steps)
+      count += step.luts.size();
+    return count;
+  }
+
+  uint32_t pbs_rounds() const {
+    uint32_t rounds = 0;
+    for (auto &step : steps)
+      rounds += step.is_lut;
+    return rounds;
+  }
+};
+
+inline uint64_t radix_mult_plan_max_noise_level(uint32_t message_modulus,
+                                                uint32_t carry_modulus) {
+  return ((uint64_t)message_modulus * carry_modulus - 1) /
+         (message_modulus - 1);
+}
+
+class radix_mult_plan_builder {
+public:
+  radix_mult_plan_builder(uint32_t num_blocks, uint32_t message_modulus,
+                          uint32_t carry_modulus, uint32_t karatsuba_threshold,
+                          CARRY_SCAN_TYPE scan_type, bool many_lut)
+      : scan_type(scan_type) {
+    assert(("Error (radix mult plan): carry flags and bivariate LUTs need "
+            "message_modulus > 2 and carry_modulus >= message_modulus",
+            carry_modulus >= message_modulus && message_modulus > 2));
+    plan.num_blocks = num_blocks;
+    plan.message_modulus = message_modulus;
+    plan.carry_modulus = carry_modulus;
+    plan.karatsuba_threshold = karatsuba_threshold;
+    plan.many_lut = many_lut;
+    plan.num_slots = 0;
+    plan.max_lut_items = 0;
+  }
+
+  radix_mult_plan build() {
+    auto num_blocks = plan.num_blocks;
+    std::vector<uint32_t> lhs, rhs;
+    for (uint32_t i = 0; i < num_blocks; i++)
+      lhs.push_back(allocate(message_modulus() - 1));
+    for (uint32_t i = 0; i < num_blocks; i++)
+      rhs.push_back(allocate(message_modulus() - 1));
+
+    std::vector<column> columns(num_blocks);
+    multiply(lhs, rhs, num_blocks, columns, 0);
+    plan.output_slots = normalize(columns);
+    return plan;
+  }
+
+private:
+  struct column_term {
+    uint32_t slot;
+    bool owned;
+  };
+  struct column {
+    std::vector<column_term> terms;
+    uint64_t constant = 0;
+  };
+
+  radix_mult_plan plan;
+  CARRY_SCAN_TYPE scan_type;
+  std::vector<uint64_t> degrees;
+  // In number of fresh PBS outputs
+  std::vector<uint64_t> noise_levels;
+  std::vector<uint32_t> free_slots;
+  std::vector<uint32_t> pending_release;
+  radix_plan_step current;
+
+  uint64_t message_modulus() const { return plan.message_modulus; }
+  uint64_t max_block_value() const {
+    return (uint64_t)plan.message_modulus * plan.carry_modulus - 1;
+  }
+  uint64_t max_noise_level() const {
+    return radix_mult_plan_max_noise_level(plan.message_modulus,
+                                           plan.carry_modulus);
+  }
+
+  uint32_t allocate(uint64_t degree, uint64_t noise_level = 1) {
+    uint32_t slot;
+    if (free_slots.empty()) {
+      slot = plan.num_slots++;
+      degrees.push_back(degree);
+      noise_levels.push_back(noise_level);
+    } else {
+      slot = free_slots.back();
+      free_slots.pop_back();
+      degrees[slot] = degree;
+      noise_levels[slot] = noise_level;
+    }
+    return slot;
+  }
+
+  // Slots read by the current step are only recycled once it is over
+  void release(uint32_t slot) { pending_release.push_back(slot); }
+
+  void begin_step(bool is_lut) {
+    current = radix_plan_step();
+    current.is_lut = is_lut;
+  }
+
+  void end_step() {
+    std::stable_partition(current.luts.begin(), current.luts.end(),
+                          [](const radix_plan_lut_item &item) {
+                            return item.carry_out != RADIX_PLAN_NO_SLOT;
+                          });
+    if (!current.luts.empty() || !current.sums.empty()) {
+      plan.max_lut_items =
+          std::max(plan.max_lut_items, (uint32_t)current.luts.size());
+      plan.steps.push_back(current);
+    }
+    free_slots.insert(free_slots.end(), pending_release.begin(),
+                      pending_release.end());
+    pending_release.clear();
+  }
+
+  uint32_t add_lut(uint32_t lhs, uint32_t rhs, uint32_t lut) {
+    uint64_t max_lhs = degrees[lhs];
+    uint64_t max_rhs = rhs == RADIX_PLAN_NO_SLOT ? 0 : degrees[rhs];
+    uint64_t degree;
+    switch (lut) {
+    case PLAN_LUT_MUL_LSB:
+      degree = std::min(message_modulus() - 1, max_lhs * max_rhs);
+      break;
+    case PLAN_LUT_MUL_MSB:
+      degree = max_lhs * max_rhs / message_modulus();
+      break;
+    case PLAN_LUT_MESSAGE:
+      degree = std::min(message_modulus() - 1, max_lhs);
+      break;
+    case PLAN_LUT_CARRY:
+      degree = max_lhs / message_modulus();
+      break;
+    case PLAN_LUT_GENERATE:
+      degree = SIMULATED_GENERATED;
+      break;
+    default:
+      degree = SIMULATED_PROPAGATED;
+      break;
+    }
+    uint32_t out = allocate(degree);
+    current.luts.push_back({lhs, rhs, out, lut});
+    return out;
+  }
+
+  // Message of slot, and its carry if with_carry (RADIX_PLAN_NO_SLOT
+  // otherwise). Both come from a single PBS when the degree of the block
+  // leaves room for two functions in the accumulator.
+  std::pair<uint32_t, uint32_t> add_message_and_carry(uint32_t slot,
+                                                      bool with_carry) {
+    uint64_t degree = degrees[slot];
+    if (with_carry && plan.many_lut &&
+        degree < get_many_lut_input_modulus(plan.message_modulus,
+                                            plan.carry_modulus, 2)) {
+      uint32_t message = allocate(std::min(message_modulus() - 1, degree));
+      uint32_t carry = allocate(degree / message_modulus());
+      current.luts.push_back({slot, RADIX_PLAN_NO_SLOT, message,
+                              PLAN_LUT_MESSAGE_AND_CARRY, carry});
+      return {message, carry};
+    }
+    uint32_t message = add_lut(slot, RADIX_PLAN_NO_SLOT, PLAN_LUT_MESSAGE);
+    uint32_t carry =
+        with_carry ? add_lut(slot, RADIX_PLAN_NO_SLOT, PLAN_LUT_CARRY)
+                   : RADIX_PLAN_NO_SLOT;
+    return {message, carry};
+  }
+
+  uint32_t add_sum(const std::vector<radix_plan_term> &terms,
+                   uint64_t constant) {
+    uint64_t degree = constant, noise_level = 0;
+    for (auto &term : terms) {
+      assert(("Error (radix mult plan): subtracted blocks must be normalized",
+              term.sign > 0 || degrees[term.slot] <= constant));
+      degree = term.sign > 0 ? degree + degrees[term.slot] : degree;
+      noise_level += noise_levels[term.slot];
+    }
+    assert(("Error (radix mult plan): sum exceeds the max noise level",
+            noise_level <= max_noise_level()));
+    uint32_t out = allocate(degree, noise_level);
+    current.sums.push_back(
+        {out, (uint32_t)current.terms.size(), (uint32_t)terms.size(),
+         constant});
+    current.terms.insert(current.terms.end(), terms.begin(), terms.end());
+    return out;
+  }
+
+  uint64_t column_degree(const column &col) const {
+    uint64_t degree = col.constant;
+    for (auto &term : col.terms)
+      degree += degrees[term.slot];
+    return degree;
+  }
+
+  bool column_fits(const column &col) const {
+    uint64_t noise_level = 0;
+    for (auto &term : col.terms)
+      noise_level += noise_levels[term.slot];
+    return column_degree(col) <= max_block_value() &&
+           noise_level <= max_noise_level();
+  }
+
+  void release_term(const column_term &term) {
+    if (term.owned)
+      release(term.slot);
+  }
+
+  // Partial products of a by b, modulo message_modulus^width, added to
+  // columns starting at offset
+  void multiply_schoolbook(const std::vector<uint32_t> &a,
+                           const std::vector<uint32_t> &b, uint32_t width,
+                           std::vector<column> &columns, uint32_t offset) {
+    begin_step(true);
+    for (uint32_t i = 0; i < a.size(); i++) {
+      for (uint32_t j = 0; j < b.size(); j++) {
+        if (i + j < width)
+          columns[offset + i + j].terms.push_back(
+              {add_lut(a[i], b[j], PLAN_LUT_MUL_LSB), true});
+        if (i + j + 1 < width && degrees[a[i]] * degrees[b[j]] >=
+                                     message_modulus())
+          columns[offset + i + j + 1].terms.push_back(
+              {add_lut(a[i], b[j], PLAN_LUT_MUL_MSB), true});
+      }
+    }
+    end_step();
+  }
+
+  /*
+   *  Adds a * b modulo message_modulus^width to columns, starting at offset.
+   *  a and b are normalized blocks that stay owned by the caller.
+   *
+   *  Operands larger than the Karatsuba threshold are split at h blocks:
+   *    a * b = a0 b0 + B^h (a0 b1 + a1 b0) + B^2h a1 b1
+   *  When a1 b1 lands in the kept window for a large enough part, the middle
+   *  term is computed as (a0 + a1)(b0 + b1) - a0 b0 - a1 b1, with 3 products
+   *  instead of 4. The subtractions use ~x + 1 = -x modulo B^width, where ~x
+   *  replaces every normalized block x_i with message_modulus - 1 - x_i.
+   *  Otherwise (truncated products) the middle term is computed directly,
+   *  which costs the same number of block products without any carry
+   *  propagation.
+   */
+  void multiply(std::vector<uint32_t> a, std::vector<uint32_t> b,
+                uint32_t width, std::vector<column> &columns,
+                uint32_t offset) {
+    if (a.size() > width)
+      a.resize(width);
+    if (b.size() > width)
+      b.resize(width);
+    if (width == 0 || a.empty() || b.empty())
+      return;
+
+    uint32_t n = std::max(a.size(), b.size());
+    if (plan.karatsuba_threshold == 0 || n <= plan.karatsuba_threshold ||
+        n < 2) {
+      multiply_schoolbook(a, b, width, columns, offset);
+      return;
+    }
+
+    uint32_t h = n / 2;
+    auto split = [h](const std::vector<uint32_t> &x, std::vector<uint32_t> &x0,
+                     std::vector<uint32_t> &x1) {
+      x0.assign(x.begin(), x.begin() + std::min((size_t)h, x.size()));
+      if (x.size() > h)
+        x1.assign(x.begin() + h, x.end());
+    };
+    std::vector<uint32_t> a0, a1, b0, b1;
+    split(a, a0, a1);
+    split(b, b0, b1);
+
+    uint32_t high_width = width > 2 * h ? width - 2 * h : 0;
+    uint32_t middle_width = width > h ? width - h : 0;
+    bool karatsuba = !a1.empty() && !b1.empty() &&
+                     2 * high_width >= middle_width && middle_width > 0;
+
+    if (!karatsuba) {
+      multiply(a0, b0, width, columns, offset);
+      multiply(a0, b1, middle_width, columns, offset + h);
+      multiply(a1, b0, middle_width, columns, offset + h);
+      multiply(a1, b1, high_width, columns, offset + 2 * h);
+      return;
+    }
+
+    auto z0 = multiply_normalized(a0, b0, std::min<uint32_t>(
+                                              width, a0.size() + b0.size()));
+    auto z2 = multiply_normalized(a1, b1, std::min<uint32_t>(
+                                              middle_width,
+                                              a1.size() + b1.size()));
+    auto sum_a = add_normalized(a0, a1, middle_width);
+    auto sum_b = add_normalized(b0, b1, middle_width);
+
+    multiply(sum_a, sum_b, middle_width, columns, offset + h);
+    begin_step(false);
+    for (auto slot : sum_a)
+      release(slot);
+    for (auto slot : sum_b)
+      release(slot);
+
+    // -z0 and -z2 modulo B^middle_width, at h
+    for (auto z : {&z0, &z2}) {
+      for (uint32_t i = 0; i < middle_width; i++) {
+        if (i < z->size())
+          columns[offset + h + i].terms.push_back(
+              {add_sum({{(*z)[i], -1}}, message_modulus() - 1), true});
+        else
+          columns[offset + h + i].constant += message_modulus() - 1;
+      }
+      columns[offset + h].constant += 1;
+    }
+    end_step();
+
+    for (uint32_t i = 0; i < z0.size(); i++)
+      columns[offset + i].terms.push_back({z0[i], true});
+    for (uint32_t i = 0; i < z2.size(); i++) {
+      if (i < high_width)
+        columns[offset + 2 * h + i].terms.push_back({z2[i], true});
+      else
+        release(z2[i]);
+    }
+  }
+
+  std::vector<uint32_t> multiply_normalized(const std::vector<uint32_t> &a,
+                                            const std::vector<uint32_t> &b,
+                                            uint32_t width) {
+    std::vector<column> columns(width);
+    multiply(a, b, width, columns, 0);
+    return normalize(columns);
+  }
+
+  std::vector<uint32_t> add_normalized(const std::vector<uint32_t> &a,
+                                       const std::vector<uint32_t> &b,
+                                       uint32_t max_width) {
+    uint32_t width = std::min<uint32_t>(
+        max_width, std::max(a.size(), b.size()) + 1);
+    std::vector<column> columns(width);
+    for (uint32_t i = 0; i < a.size() && i < width; i++)
+      columns[i].terms.push_back({a[i], false});
+    for (uint32_t i = 0; i < b.size() && i < width; i++)
+      columns[i].terms.push_back({b[i], false});
+    return normalize(columns);
+  }
+
+  /*
+   *  Sums every column into a single block that fits the plaintext space and
+   *  the max noise level. While a column is too large, it is split into
+   *  chunks that fit, and every chunk sends its message to the column and its
+   *  carry to the next one. Chunks of a single fresh block without carry are
+   *  kept as they are.
+   */
+  std::vector<uint32_t> reduce_columns(std::vector<column> &columns) {
+    uint32_t width = columns.size();
+    // Constants are cleartexts, their carries are propagated for free
+    for (uint32_t c = 0; c + 1 < width; c++) {
+      columns[c + 1].constant += columns[c].constant / message_modulus();
+      columns[c].constant %= message_modulus();
+    }
+    columns[width - 1].constant %= message_modulus();
+    while (true) {
+      bool fits = true;
+      for (auto &col : columns)
+        fits = fits && column_fits(col);
+
+      begin_step(false);
+      if (fits) {
+        std::vector<uint32_t> blocks;
+        for (auto &col : columns) {
+          if (col.terms.size() == 1 && col.constant == 0 &&
+              col.terms[0].owned) {
+            blocks.push_back(col.terms[0].slot);
+            continue;
+          }
+          std::vector<radix_plan_term> terms;
+          for (auto &term : col.terms) {
+            terms.push_back({term.slot, 1});
+            release_term(term);
+          }
+          blocks.push_back(add_sum(terms, col.constant));
+        }
+        end_step();
+        return blocks;
+      }
+
+      std::vector<std::pair<uint32_t, uint32_t>> chunks; // (slot, column)
+      for (uint32_t c = 0; c < width; c++) {
+        auto &col = columns[c];
+        bool col_fits = column_fits(col);
+        std::vector<column_term> kept;
+        std::vector<radix_plan_term> chunk;
+        uint64_t chunk_degree = col.constant, chunk_noise_level = 0;
+        auto add_chunk = [&](uint64_t constant) {
+          uint32_t slot = add_sum(chunk, constant);
+          if (col_fits ||
+              (degrees[slot] < message_modulus() && noise_levels[slot] <= 1))
+            kept.push_back({slot, true});
+          else
+            chunks.push_back({slot, c});
+        };
+        // Greedy chunking, the constant goes to the first chunk
+        uint64_t constant = col.constant;
+        for (auto &term : col.terms) {
+          uint64_t degree = degrees[term.slot];
+          uint64_t noise_level = noise_levels[term.slot];
+          if ((!chunk.empty() || constant != 0) &&
+              (chunk_degree + degree > max_block_value() ||
+               chunk_noise_level + noise_level > max_noise_level())) {
+            add_chunk(constant);
+            constant = 0;
+            chunk.clear();
+            chunk_degree = 0;
+            chunk_noise_level = 0;
+          }
+          chunk.push_back({term.slot, 1});
+          chunk_degree += degree;
+          chunk_noise_level += noise_level;
+          release_term(term);
+        }
+        if (!chunk.empty() || constant != 0)
+          add_chunk(constant);
+        col.terms = kept;
+        col.constant = 0;
+      }
+      end_step();
+
+      begin_step(true);
+      for (auto &chunk : chunks) {
+        uint32_t slot = chunk.first, c = chunk.second;
+        auto outputs = add_message_and_carry(
+            slot, c + 1 < width && degrees[slot] >= message_modulus());
+        columns[c].terms.push_back({outputs.first, true});
+        if (outputs.second != RADIX_PLAN_NO_SLOT)
+          columns[c + 1].terms.push_back({outputs.second, true});
+        release(slot);
+      }
+      end_step();
+    }
+  }
+
+  /*
+   *  Full carry propagation of blocks that fit the plaintext space, as in
+   *  host_full_propagate_tree_inplace: split rounds until every block outputs
+   *  at most one carry, then a carry flag prefix scan. Blocks whose degree
+   *  shows they have no carry are skipped, unless adding a carry to them
+   *  would exceed the max noise level.
+   */
+  std::vector<uint32_t> propagate(std::vector<uint32_t> blocks) {
+    uint32_t width = blocks.size();
+    auto max_degree = [&]() {
+      uint64_t degree = 0;
+      for (auto slot : blocks)
+        degree = std::max(degree, degrees[slot]);
+      return degree;
+    };
+
+    while (max_degree() > 2 * message_modulus() - 2) {
+      std::vector<uint32_t> carries(width, RADIX_PLAN_NO_SLOT);
+      begin_step(true);
+      for (uint32_t i = 0; i < width; i++) {
+        if (degrees[blocks[i]] < message_modulus() &&
+            (i == 0 || noise_levels[blocks[i]] < max_noise_level()))
+          continue;
+        auto outputs = add_message_and_carry(
+            blocks[i],
+            i + 1 < width && degrees[blocks[i]] >= message_modulus());
+        release(blocks[i]);
+        blocks[i] = outputs.first;
+        carries[i] = outputs.second;
+      }
+      end_step();
+
+      begin_step(false);
+      for (uint32_t i = 1; i < width; i++) {
+        if (carries[i - 1] == RADIX_PLAN_NO_SLOT)
+          continue;
+        release(blocks[i]);
+        release(carries[i - 1]);
+        blocks[i] = add_sum({{blocks[i], 1}, {carries[i - 1], 1}}, 0);
+      }
+      end_step();
+    }
+
+    if (max_degree() < message_modulus())
+      return blocks;
+
+    // Carry flags of blocks [0, width - 1), the last carry is dropped. The
+    // blocks that can't take one more carry are cleaned in the same batch:
+    // their flags are computed first, only their message is left to resolve.
+    uint32_t num_flags = width - 1;
+    std::vector<uint32_t> flags(num_flags, RADIX_PLAN_NO_SLOT);
+    begin_step(true);
+    for (uint32_t i = 0; i < num_flags; i++) {
+      if (degrees[blocks[i]] < message_modulus() - 1)
+        continue;
+      flags[i] = add_lut(blocks[i], RADIX_PLAN_NO_SLOT,
+                         i == 0 ? PLAN_LUT_GENERATE
+                                : PLAN_LUT_GENERATE_OR_PROPAGATE);
+    }
+    for (uint32_t i = 1; i < width; i++) {
+      if (noise_levels[blocks[i]] < max_noise_level())
+        continue;
+      release(blocks[i]);
+      blocks[i] = add_lut(blocks[i], RADIX_PLAN_NO_SLOT, PLAN_LUT_MESSAGE);
+    }
+    end_step();
+    begin_step(false);
+    for (uint32_t i = 0; i < num_flags; i++)
+      if (flags[i] == RADIX_PLAN_NO_SLOT)
+        flags[i] = add_sum({}, SIMULATED_NONE);
+    end_step();
+
+    auto scan = scan_type;
+    if (scan == CARRY_SCAN_AUTO)
+      scan = CARRY_SCAN_SKLANSKY;
+    for (auto &round : generate_carry_scan(scan, num_flags)) {
+      begin_step(true);
+      for (auto &pair : round) {
+        release(flags[pair.first]);
+        flags[pair.first] = add_lut(flags[pair.first], flags[pair.second],
+                                    PLAN_LUT_CARRY_COMBINE);
+      }
+      end_step();
+    }
+
+    begin_step(false);
+    for (uint32_t i = 1; i < width; i++) {
+      release(blocks[i]);
+      release(flags[i - 1]);
+      // The flags are resolved carries, at most 1
+      uint64_t degree = degrees[blocks[i]] + 1;
+      blocks[i] = add_sum({{blocks[i], 1}, {flags[i - 1], 1}}, 0);
+      degrees[blocks[i]] = degree;
+    }
+    end_step();
+
+    begin_step(true);
+    for (uint32_t i = 0; i < width; i++) {
+      if (degrees[blocks[i]] < message_modulus())
+        continue;
+      release(blocks[i]);
+      blocks[i] = add_lut(blocks[i], RADIX_PLAN_NO_SLOT, PLAN_LUT_MESSAGE);
+    }
+    end_step();
+    return blocks;
+  }
+
+  std::vector<uint32_t> normalize(std::vector<column> &columns) {
+    if (columns.empty())
+      return {};
+    return propagate(reduce_columns(columns));
+  }
+};
+
+inline radix_mult_plan generate_radix_mult_plan(
+    uint32_t num_blocks, uint32_t message_modulus, uint32_t carry_modulus,
+    uint32_t karatsuba_threshold,
+    CARRY_SCAN_TYPE scan_type = CARRY_SCAN_SKLANSKY, bool many_lut = false) {
+  radix_mult_plan_builder builder(num_blocks, message_modulus, carry_modulus,
+                                  karatsuba_threshold, scan_type, many_lut);
+  return builder.build();
+}
+
+/*
+ *  Runs a plan on cleartext blocks, checking that every block stays in the
+ *  plaintext space and that bivariate LUT inputs are normalized. Returns the
+ *  product blocks, lhs * rhs modulo message_modulus^num_blocks.
+ */
+inline std::vector<uint64_t>
+run_radix_mult_plan(const radix_mult_plan &plan,
+                    const std::vector<uint64_t> &lhs,
+                    const std::vector<uint64_t> &rhs) {
+  uint64_t message_modulus = plan.message_modulus;
+  uint64_t modulus_sup = message_modulus * plan.carry_modulus;
+  std::vector<uint64_t> slots(plan.num_slots, 0);
+  for (uint32_t i = 0; i < plan.num_blocks; i++) {
+    slots[i] = lhs[i];
+    slots[plan.num_blocks + i] = rhs[i];
+  }
+
+  std::vector<uint64_t> outputs, carry_outputs;
+  for (auto &step : plan.steps) {
+    outputs.clear();
+    carry_outputs.clear();
+    if (step.is_lut) {
+      for (auto &item : step.luts) {
+        uint64_t x = slots[item.lhs];
+        uint64_t y = item.rhs == RADIX_PLAN_NO_SLOT ? 0 : slots[item.rhs];
+        if (radix_plan_lut_is_bivariate(item.lut))
+          assert(("Error (radix mult plan): bivariate input out of range",
+                  x < message_modulus && y < message_modulus));
+        else
+          assert(("Error (radix mult plan): block overflows its plaintext "
+                  "space",
+                  x < modulus_sup));
+        if (item.carry_out != RADIX_PLAN_NO_SLOT)
+          assert(("Error (radix mult plan): many-LUT input out of range",
+                  x < get_many_lut_input_modulus(plan.message_modulus,
+                                                 plan.carry_modulus, 2)));
+        outputs.push_back(radix_plan_eval_lut(item.lut, x, y, message_modulus));
+        carry_outputs.push_back(
+            radix_plan_eval_lut(PLAN_LUT_CARRY, x, 0, message_modulus));
+      }
+      for (size_t k = 0; k < step.luts.size(); k++) {
+        slots[step.luts[k].out] = outputs[k];
+        if (step.luts[k].carry_out != RADIX_PLAN_NO_SLOT)
+          slots[step.luts[k].carry_out] = carry_outputs[k];
+      }
+    } else {
+      for (auto &item : step.sums) {
+        // Sums are computed modulo the padding, like on the GPU
+        uint64_t value = item.constant;
+        for (uint32_t t = 0; t < item.num_terms; t++) {
+          auto &term = step.terms[item.first_term + t];
+          value += term.sign > 0 ? slots[term.slot] : -slots[term.slot];
+        }
+        outputs.push_back(value);
+      }
+      for (size_t k = 0; k < step.sums.size(); k++)
+        slots[step.sums[k].out] = outputs[k];
+    }
+  }
+
+  std::vector<uint64_t> result;
+  for (auto slot : plan.output_slots)
+    result.push_back(slots[slot]);
+  return result;
+}
+
+#endif // CUDA_RADIX_MULT_PLAN_H
@@ -0,0 +1,262 @@
+#ifndef CUDA_SCRATCH_ARENA_H
+#define CUDA_SCRATCH_ARENA_H
+
+#include "device.h"
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+/*
+ *  Backing allocator used by scratch_arena to obtain and give back its chunks
+ */
+struct scratch_allocator {
+  virtual void *allocate(uint64_t size) = 0;
+  virtual void deallocate(void *ptr) = 0;
+  virtual ~scratch_allocator() {}
+};
+
+// Chunks are taken from the stream-ordered device allocator
+struct device_scratch_allocator : scratch_allocator {
+  cuda_stream_t *stream;
+
+  device_scratch_allocator(cuda_stream_t *stream) : stream(stream) {}
+
+  void *allocate(uint64_t size) override {
+    return cuda_malloc_async(size, stream);
+  }
+  void deallocate(void *ptr) override { cuda_drop_async(ptr, stream); }
+};
+
+// Host memory stand-in for the device allocator. It keeps track of the calls
+// it receives so that the arena accounting and reuse logic can be checked on
+// a machine without a GPU.
+struct host_scratch_allocator : scratch_allocator {
+  uint64_t num_allocations = 0;
+  uint64_t num_deallocations = 0;
+  uint64_t bytes_in_use = 0;
+  std::unordered_map<void *, uint64_t> sizes;
+
+  void *allocate(uint64_t size) override {
+    void *ptr = malloc(size);
+    sizes[ptr] = size;
+    num_allocations++;
+    bytes_in_use += size;
+    return ptr;
+  }
+  void deallocate(void *ptr) override {
+    auto it = sizes.find(ptr);
+    assert(("Error (scratch arena): unknown host chunk", it != sizes.end()));
+    bytes_in_use -= it->second;
+    sizes.erase(it);
+    num_deallocations++;
+    free(ptr);
+  }
+};
+
+// Backing allocator of measuring streams: hands out distinct placeholder
+// addresses that are never dereferenced, the arena does the accounting
+struct placeholder_scratch_allocator : scratch_allocator {
+  uint64_t next = 1 << 20;
+
+  void *allocate(uint64_t size) override {
+    void *ptr = (void *)next;
+    next += size;
+    return ptr;
+  }
+  void deallocate(void *) override {}
+};
+
+/*
+ *  Bump allocator for the temporaries of the integer radix buffers.
+ *
+ *  Memory is handed out from a list of chunks obtained from the backing
+ *  allocator. Allocations must be released in the reverse order they were
+ *  made, which the radix buffers do by releasing their members in the reverse
+ *  order of their constructors: releasing the most recent allocation rolls its
+ *  chunk offset back. Once every allocation has been released the arena
+ *  resets: if it had to grow, its chunks are replaced by a single one able to
+ *  hold the peak usage of the cycle, and if it stayed mostly empty for
+ *  shrink_cycles cycles in a row, its chunk is replaced by a smaller one. In
+ *  steady state the backing allocator is not called anymore.
+ *
+ *  Device arenas are tied to a stream: memory handed back is reused by later
+ *  work on that same stream, which stream ordering makes safe.
+ */
+struct scratch_arena {
+  // Same alignment as cudaMalloc, so vectorized accesses stay valid
+  static constexpr uint64_t alignment = 256;
+  static constexpr uint64_t min_chunk_size = 1 << 20;
+  // Number of consecutive cycles using less than half the capacity after
+  // which the arena shrinks to the largest peak of these cycles
+  static constexpr uint32_t shrink_cycles = 8;
+
+  struct chunk {
+    int8_t *ptr;
+    uint64_t size;
+    uint64_t offset;
+  };
+
+  struct allocation {
+    int8_t *ptr;
+    uint32_t chunk;
+    uint64_t size;
+    bool released;
+  };
+
+  scratch_allocator *allocator;
+  bool owns_allocator;
+
+  std::vector<chunk> chunks;
+  // Live allocations, in the order they were made
+  std::vector<allocation> live;
+
+  uint64_t current_usage = 0;
+  uint64_t peak_usage = 0;
+  uint64_t capacity = 0;
+
+  // Peak usage since the last reset, and the largest one over the cycles
+  // counted by underused_cycles
+  uint64_t cycle_peak_usage = 0;
+  uint64_t underused_peak_usage = 0;
+  uint32_t underused_cycles = 0;
+
+  scratch_arena(scratch_allocator *allocator, bool owns_allocator)
+      : allocator(allocator), owns_allocator(owns_allocator) {}
+
+  // Chunks still in use when the arena is destroyed are freed anyway
+  ~scratch_arena() {
+    live.clear();
+    trim();
+    if (owns_allocator)
+      delete allocator;
+  }
+
+  static uint64_t align(uint64_t size) {
+    return (size + alignment - 1) / alignment * alignment;
+  }
+
+  void *allocate(uint64_t size) {
+    if (size == 0)
+      return nullptr;
+    size = align(size);
+
+    uint32_t index = 0;
+    while (index < chunks.size() &&
+           chunks[index].size - chunks[index].offset < size)
+      index++;
+    if (index == chunks.size())
+      add_chunk(size > min_chunk_size ? size : min_chunk_size);
+
+    auto &c = chunks[index];
+    int8_t *ptr = c.ptr + c.offset;
+    c.offset += size;
+    live.push_back({ptr, index, size, false});
+
+    current_usage += size;
+    if (current_usage > peak_usage)
+      peak_usage = current_usage;
+    if (current_usage > cycle_peak_usage)
+      cycle_peak_usage = current_usage;
+    return ptr;
+  }
+
+  void release(void *ptr) {
+    if (ptr == nullptr)
+      return;
+    assert(("Error (scratch arena): allocations should be released in the "
+            "reverse order they were made",
+            !live.empty() && live.back().ptr == ptr));
+
+    // Without assertions, an allocation released out of order stays in place
+    // until the ones made after it are released
+    auto it = live.rbegin();
+    while (it != live.rend() && (it->ptr != ptr || it->released))
+      it++;
+    assert(("Error (scratch arena): pointer was not allocated by this arena",
+            it != live.rend()));
+    if (it == live.rend())
+      return;
+    it->released = true;
+    current_usage -= it->size;
+
+    while (!live.empty() && live.back().released) {
+      // The most recent live allocation is always at the top of its chunk
+      auto &c = chunks[live.back().chunk];
+      c.offset = live.back().ptr - c.ptr;
+      live.pop_back();
+    }
+
+    if (live.empty())
+      reset();
+  }
+
+  // Rewinds every chunk. If the arena had to grow, coalesce its chunks into a
+  // single one covering the peak usage of the cycle. If it has been using
+  // less than half of its capacity for shrink_cycles cycles, shrink it.
+  void reset() {
+    assert(("Error (scratch arena): reset with live allocations",
+            live.empty()));
+    uint64_t cycle_peak = cycle_peak_usage;
+    cycle_peak_usage = 0;
+    current_usage = 0;
+
+    if (chunks.size() > 1) {
+      underused_cycles = 0;
+      underused_peak_usage = 0;
+      trim();
+      add_chunk(chunk_size_for(cycle_peak));
+    } else if (capacity > min_chunk_size && 2 * cycle_peak < capacity) {
+      underused_cycles++;
+      underused_peak_usage = std::max(underused_peak_usage, cycle_peak);
+      if (underused_cycles == shrink_cycles) {
+        uint64_t size = chunk_size_for(underused_peak_usage);
+        underused_cycles = 0;
+        underused_peak_usage = 0;
+        trim();
+        add_chunk(size);
+      }
+    } else {
+      underused_cycles = 0;
+      underused_peak_usage = 0;
+    }
+
+    for (auto &c : chunks)
+      c.offset = 0;
+  }
+
+  // Gives every chunk back to the backing allocator
+  void trim() {
+    assert(("Error (scratch arena): trim with live allocations",
+            live.empty()));
+    for (auto &c : chunks)
+      allocator->deallocate(c.ptr);
+    chunks.clear();
+    capacity = 0;
+  }
+
+private:
+  static uint64_t chunk_size_for(uint64_t usage) {
+    return std::max(align(usage), min_chunk_size);
+  }
+
+  void add_chunk(uint64_t size) {
+    chunks.push_back({(int8_t *)allocator->allocate(size), size, 0});
+    capacity += size;
+  }
+};
+
+/*
+ *  Returns the arena attached to stream, creating it on first use
+ */
+inline scratch_arena *get_scratch_arena(cuda_stream_t *stream) {
+  if (stream->arena == nullptr && stream->measuring)
+    stream->arena = new scratch_arena(new placeholder_scratch_allocator, true);
+  else if (stream->arena == nullptr)
+    stream->arena =
+        new scratch_arena(new device_scratch_allocator(stream), true);
+  return stream->arena;
+}
+
+#endif // CUDA_SCRATCH_ARENA_H
@@ -0,0 +1,258 @@
+#ifndef CUDA_STAGING_POOL_H
+#define CUDA_STAGING_POOL_H
+
+#include "device.h"
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+/*
+ *  Operations the staging pool relies on. The device implementation works on
+ *  page-locked memory and CUDA events, the host one lets the pooling logic run
+ *  on a machine without a GPU.
+ */
+struct staging_backend {
+  // Returns nullptr if page-locked memory cannot be obtained
+  virtual void *allocate_pinned(uint64_t size) = 0;
+  virtual void free_pinned(void *ptr) = 0;
+  // Enqueues a copy from a staging slot to the device
+  virtual void copy_to_device(void *dest, const void *pinned,
+                              uint64_t size) = 0;
+  // Enqueues a copy straight from the caller's memory
+  virtual void copy_direct(void *dest, const void *src, uint64_t size) = 0;
+  // Marks the end of the copies enqueued from slot
+  virtual void record(uint32_t slot) = 0;
+  // Whether the copies enqueued from slot are done, without blocking
+  virtual bool is_done(uint32_t slot) = 0;
+  // Blocks the host until the copies enqueued from slot are done
+  virtual void wait(uint32_t slot) = 0;
+  virtual ~staging_backend() {}
+};
+
+struct device_staging_backend : staging_backend {
+  cuda_stream_t *stream;
+  // One event per slot, created with the slot
+  std::vector<cudaEvent_t> events;
+
+  device_staging_backend(cuda_stream_t *stream) : stream(stream) {}
+
+  ~device_staging_backend() {
+    cudaSetDevice(stream->gpu_index);
+    for (auto event : events)
+      cudaEventDestroy(event);
+  }
+
+  void *allocate_pinned(uint64_t size) override {
+    cudaSetDevice(stream->gpu_index);
+    void *ptr = nullptr;
+    if (cudaHostAlloc(&ptr, size, cudaHostAllocDefault) != cudaSuccess) {
+      // Clear the error so that it does not leak into later checks
+      cudaGetLastError();
+      return nullptr;
+    }
+    cudaEvent_t event;
+    check_cuda_error(cudaEventCreateWithFlags(&event, cudaEventDisableTiming));
+    events.push_back(event);
+    return ptr;
+  }
+  void free_pinned(void *ptr) override { cudaFreeHost(ptr); }
+  void copy_to_device(void *dest, const void *pinned, uint64_t size) override {
+    cudaSetDevice(stream->gpu_index);
+    check_cuda_error(cudaMemcpyAsync(dest, pinned, size,
+                                     cudaMemcpyHostToDevice, stream->stream));
+  }
+  void copy_direct(void *dest, const void *src, uint64_t size) override {
+    cuda_memcpy_async_to_gpu(dest, (void *)src, size, stream);
+  }
+  void record(uint32_t slot) override {
+    check_cuda_error(cudaEventRecord(events[slot], stream->stream));
+  }
+  bool is_done(uint32_t slot) override {
+    return cudaEventQuery(events[slot]) == cudaSuccess;
+  }
+  void wait(uint32_t slot) override {
+    check_cuda_error(cudaEventSynchronize(events[slot]));
+  }
+};
+
+// Host stand-in: "device" memory is plain host memory and copies are done
+// when enqueued. Copies can be held in flight until the host waits for them,
+// as if the stream were busy, and page-locked allocations can be made to fail
+// to exercise the fallback path.
+struct host_staging_backend : staging_backend {
+  bool fail_pinned_allocation = false;
+  bool hold_copies = false;
+  uint64_t num_pinned_allocations = 0;
+  uint64_t num_staged_copies = 0;
+  uint64_t num_direct_copies = 0;
+  uint64_t num_waits = 0;
+  std::vector<bool> held;
+
+  void *allocate_pinned(uint64_t size) override {
+    if (fail_pinned_allocation)
+      return nullptr;
+    num_pinned_allocations++;
+    held.push_back(false);
+    return malloc(size);
+  }
+  void free_pinned(void *ptr) override { free(ptr); }
+  void copy_to_device(void *dest, const void *pinned, uint64_t size) override {
+    num_staged_copies++;
+    memcpy(dest, pinned, size);
+  }
+  void copy_direct(void *dest, const void *src, uint64_t size) override {
+    num_direct_copies++;
+    memcpy(dest, src, size);
+  }
+  void record(uint32_t slot) override { held[slot] = hold_copies; }
+  bool is_done(uint32_t slot) override { return !held[slot]; }
+  void wait(uint32_t slot) override {
+    num_waits++;
+    held[slot] = false;
+  }
+};
+
+/*
+ *  Page-locked staging area for host to device copies.
+ *
+ *  The caller's data is copied chunk by chunk into page-locked slots, from
+ *  which asynchronous copies are enqueued. A slot is reused once the copy
+ *  enqueued from it is done. When every slot is still in flight, because the
+ *  stream is busy with earlier work or the copy is large, the pool grows by
+ *  one slot instead of waiting, up to max_slots. Past that point the host
+ *  waits for the oldest slot, which may mean waiting for the work enqueued
+ *  on the stream before it: a copy only blocks when more than
+ *  max_slots * slot_size bytes are pending on the stream. Such waits are
+ *  counted as stalls. On return the caller's buffer can be reused or freed.
+ *
+ *  If page-locked memory cannot be obtained the copy is enqueued directly
+ *  from the caller's buffer.
+ */
+struct staging_pool {
+  static constexpr uint64_t default_slot_size = 4 << 20;
+  static constexpr uint32_t default_max_slots = 16;
+
+  staging_backend *backend;
+  bool owns_backend;
+  uint64_t slot_size;
+  uint32_t max_slots;
+
+  std::vector<int8_t *> slots;
+  std::vector<bool> in_flight;
+  // Order in which the slots were last used, the oldest one is waited for
+  // when the pool can't grow
+  std::vector<uint64_t> last_use;
+  uint64_t use_counter = 0;
+  bool pinned_unavailable = false;
+
+  // Counters
+  uint64_t bytes_staged = 0;
+  uint64_t bytes_direct = 0;
+  uint64_t num_chunks = 0;
+  // Number of times and time (in microseconds) the host had to wait for a
+  // slot to be released by a previous transfer
+  uint64_t num_stalls = 0;
+  uint64_t stall_time_us = 0;
+  // Total time spent by the host in copy_to_device
+  uint64_t host_time_us = 0;
+
+  staging_pool(staging_backend *backend, bool owns_backend,
+               uint64_t slot_size = default_slot_size,
+               uint32_t max_slots = default_max_slots)
+      : backend(backend), owns_backend(owns_backend), slot_size(slot_size),
+        max_slots(max_slots) {}
+
+  ~staging_pool() {
+    for (uint32_t i = 0; i < slots.size(); i++) {
+      if (in_flight[i])
+        backend->wait(i);
+      backend->free_pinned(slots[i]);
+    }
+    if (owns_backend)
+      delete backend;
+  }
+
+  void copy_to_device(void *dest, const void *src, uint64_t size) {
+    auto start = std::chrono::steady_clock::now();
+
+    if (!pinned_unavailable && slots.empty() && !add_slot())
+      pinned_unavailable = true;
+
+    if (pinned_unavailable) {
+      backend->copy_direct(dest, src, size);
+      bytes_direct += size;
+    } else {
+      for (uint64_t offset = 0; offset < size; offset += slot_size) {
+        uint64_t chunk_size =
+            size - offset < slot_size ? size - offset : slot_size;
+        uint32_t slot = acquire_slot();
+
+        memcpy(slots[slot], (const int8_t *)src + offset, chunk_size);
+        backend->copy_to_device((int8_t *)dest + offset, slots[slot],
+                                chunk_size);
+        backend->record(slot);
+        in_flight[slot] = true;
+        last_use[slot] = use_counter++;
+        num_chunks++;
+      }
+      bytes_staged += size;
+    }
+
+    host_time_us += elapsed_us(start);
+  }
+
+private:
+  // A free slot, a new one if all of them are in flight, or the oldest one
+  // once it is done if the pool can't grow
+  uint32_t acquire_slot() {
+    for (uint32_t i = 0; i < slots.size(); i++) {
+      if (in_flight[i] && backend->is_done(i))
+        in_flight[i] = false;
+      if (!in_flight[i])
+        return i;
+    }
+    if (slots.size() < max_slots && add_slot())
+      return slots.size() - 1;
+
+    uint32_t oldest = 0;
+    for (uint32_t i = 1; i < slots.size(); i++)
+      if (last_use[i] < last_use[oldest])
+        oldest = i;
+    auto stall_start = std::chrono::steady_clock::now();
+    backend->wait(oldest);
+    in_flight[oldest] = false;
+    num_stalls++;
+    stall_time_us += elapsed_us(stall_start);
+    return oldest;
+  }
+
+  bool add_slot() {
+    auto slot = (int8_t *)backend->allocate_pinned(slot_size);
+    if (slot == nullptr)
+      return false;
+    slots.push_back(slot);
+    in_flight.push_back(false);
+    last_use.push_back(0);
+    return true;
+  }
+
+  static uint64_t
+  elapsed_us(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+               std::chrono::steady_clock::now() - start)
+        .count();
+  }
+};
+
+/*
+ *  Returns the staging pool attached to stream, creating it on first use
+ */
+inline staging_pool *get_staging_pool(cuda_stream_t *stream) {
+  if (stream->staging == nullptr)
+    stream->staging =
+        new staging_pool(new device_staging_backend(stream), true);
+  return stream->staging;
+}
+
+#endif // CUDA_STAGING_POOL_H
@@ -12,7 +12,7 @@ void cuda_convert_lwe_ciphertext_vector_to_gpu(T *dest, T *src,
                                                uint32_t lwe_dimension) {
   cudaSetDevice(stream->gpu_index);
   uint64_t size = number_of_cts * (lwe_dimension + 1) * sizeof(T);
-  cuda_memcpy_async_to_gpu(dest, src, size, stream);
+  cuda_memcpy_async_to_gpu_staged(dest, src, size, stream);
 }
 
 void cuda_convert_lwe_ciphertext_vector_to_gpu_64(void *dest, void *src,
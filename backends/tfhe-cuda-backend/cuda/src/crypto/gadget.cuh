@@ -149,7 +149,8 @@ public:
 };
 
 template <typename Torus>
-__device__ Torus decompose_one(Torus &state, Torus mask_mod_b, int base_log) {
+__host__ __device__ Torus decompose_one(Torus &state, Torus mask_mod_b,
+                                        int base_log) {
   Torus res = state & mask_mod_b;
   state >>= base_log;
   Torus carry = ((res - 1ll) | state) & res;
@@ -54,6 +54,7 @@ void batch_fft_ggsw_vector(cuda_stream_t *stream, double2 *dest, T *src,
                            uint32_t polynomial_size, uint32_t level_count,
                            uint32_t gpu_index, uint32_t max_shared_memory) {
   cudaSetDevice(stream->gpu_index);
+  cuda_initialize_twiddles(stream->gpu_index);
 
   int shared_memory_size = sizeof(double) * polynomial_size;
 
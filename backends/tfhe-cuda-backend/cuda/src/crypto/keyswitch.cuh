@@ -141,4 +141,192 @@ __host__ void cuda_keyswitch_lwe_ciphertext_vector(
   check_cuda_error(cudaGetLastError());
 }
 
+/*
+ * Keyswitches a single LWE ciphertext with all the threads of the block, with
+ * the same arithmetic as the keyswitch kernel. Each thread owns a strided
+ * subset of the output coefficients, so lwe_array_out can be in shared
+ * memory. The output coefficients can also be split between num_slices
+ * blocks, this one computing slice. The block is synchronized on return.
+ */
+template <typename Torus>
+__device__ void keyswitch_block(Torus *lwe_array_out, Torus *lwe_array_in,
+                                Torus *ksk, uint32_t lwe_dimension_in,
+                                uint32_t lwe_dimension_out, uint32_t base_log,
+                                uint32_t level_count, uint32_t slice = 0,
+                                uint32_t num_slices = 1) {
+  uint32_t first = slice * blockDim.x + threadIdx.x;
+  uint32_t stride = num_slices * blockDim.x;
+  for (int k = first; k <= lwe_dimension_out; k += stride)
+    lwe_array_out[k] =
+        (k == lwe_dimension_out) ? lwe_array_in[lwe_dimension_in] : 0;
+
+  Torus mask_mod_b = (1ll << base_log) - 1ll;
+  for (int i = 0; i < lwe_dimension_in; i++) {
+    Torus a_i =
+        round_to_closest_multiple(lwe_array_in[i], base_log, level_count);
+    Torus state = a_i >> (sizeof(Torus) * 8 - base_log * level_count);
+
+    for (int j = 0; j < level_count; j++) {
+      auto ksk_block = get_ith_block(ksk, i, j, lwe_dimension_out, level_count);
+      Torus decomposed = decompose_one<Torus>(state, mask_mod_b, base_log);
+      for (int k = first; k <= lwe_dimension_out; k += stride)
+        lwe_array_out[k] -= (Torus)ksk_block[k] * decomposed;
+    }
+  }
+  synchronize_threads_in_block();
+}
+
+/*
+ * Batched keyswitch kernel
+ * Same computation as the keyswitch kernel, written as the product of the
+ * decomposed input masks (num_samples x lwe_dimension_in * level_count) with
+ * the keyswitch key (lwe_dimension_in * level_count x lwe_dimension_out + 1).
+ * Each block computes blockDim.x output coefficients of samples_per_block
+ * ciphertexts. Each thread reads the key column of its output coefficient
+ * straight from global memory, coalesced with its neighbours, and applies
+ * every key element to the samples_per_block ciphertexts held in registers,
+ * so a key element is read once per block instead of once per ciphertext.
+ * The input masks are decomposed in tiles of inputs_per_tile coefficients,
+ * once per block, in shared memory read by all threads.
+ */
+template <typename Torus, int samples_per_block>
+__global__ void
+keyswitch_batched(Torus *lwe_array_out, Torus *lwe_output_indexes,
+                  Torus *lwe_array_in, Torus *lwe_input_indexes, Torus *ksk,
+                  uint32_t lwe_dimension_in, uint32_t lwe_dimension_out,
+                  uint32_t base_log, uint32_t level_count,
+                  uint32_t num_samples, uint32_t inputs_per_tile) {
+  int tid = threadIdx.x;
+  uint32_t lwe_size_out = lwe_dimension_out + 1;
+  uint32_t coefficient = blockIdx.y * blockDim.x + tid;
+  uint32_t first_sample = blockIdx.x * samples_per_block;
+  uint32_t rows_per_tile = inputs_per_tile * level_count;
+
+  extern __shared__ int8_t sharedmem[];
+  Torus *decomposed_tile = (Torus *)sharedmem;
+
+  Torus mask_mod_b = (1ll << base_log) - 1ll;
+
+  Torus accumulator[samples_per_block];
+  for (int s = 0; s < samples_per_block; s++) {
+    accumulator[s] = 0;
+    if (coefficient == lwe_dimension_out && first_sample + s < num_samples)
+      accumulator[s] = get_chunk(lwe_array_in,
+                                 lwe_input_indexes[first_sample + s],
+                                 lwe_dimension_in + 1)[lwe_dimension_in];
+  }
+
+  for (uint32_t tile_start = 0; tile_start < lwe_dimension_in;
+       tile_start += inputs_per_tile) {
+    uint32_t tile_inputs = min(inputs_per_tile, lwe_dimension_in - tile_start);
+
+    // Decompose the input masks of the tile
+    for (uint32_t idx = tid; idx < samples_per_block * inputs_per_tile;
+         idx += blockDim.x) {
+      uint32_t s = idx / inputs_per_tile;
+      uint32_t i = idx % inputs_per_tile;
+      Torus *decomposed = &decomposed_tile[s * rows_per_tile + i * level_count];
+      if (first_sample + s < num_samples && i < tile_inputs) {
+        Torus a_i = get_chunk(lwe_array_in,
+                              lwe_input_indexes[first_sample + s],
+                              lwe_dimension_in + 1)[tile_start + i];
+        a_i = round_to_closest_multiple(a_i, base_log, level_count);
+        Torus state = a_i >> (sizeof(Torus) * 8 - base_log * level_count);
+        for (int j = 0; j < level_count; j++)
+          decomposed[j] = decompose_one<Torus>(state, mask_mod_b, base_log);
+      } else {
+        for (int j = 0; j < level_count; j++)
+          decomposed[j] = 0;
+      }
+    }
+
+    synchronize_threads_in_block();
+
+    if (coefficient < lwe_size_out) {
+      Torus *ksk_rows = &ksk[tile_start * level_count * lwe_size_out];
+      for (uint32_t row = 0; row < tile_inputs * level_count; row++) {
+        Torus ksk_element = ksk_rows[row * lwe_size_out + coefficient];
+        for (int s = 0; s < samples_per_block; s++)
+          accumulator[s] -=
+              ksk_element * decomposed_tile[s * rows_per_tile + row];
+      }
+    }
+    synchronize_threads_in_block();
+  }
+
+  if (coefficient < lwe_size_out) {
+    for (int s = 0; s < samples_per_block; s++) {
+      if (first_sample + s < num_samples)
+        get_chunk(lwe_array_out, lwe_output_indexes[first_sample + s],
+                  lwe_size_out)[coefficient] = accumulator[s];
+    }
+  }
+}
+
+/// assume lwe_array_in in the gpu
+template <typename Torus>
+__host__ void cuda_keyswitch_lwe_ciphertext_vector_batched(
+    cuda_stream_t *stream, Torus *lwe_array_out, Torus *lwe_output_indexes,
+    Torus *lwe_array_in, Torus *lwe_input_indexes, Torus *ksk,
+    uint32_t lwe_dimension_in, uint32_t lwe_dimension_out, uint32_t base_log,
+    uint32_t level_count, uint32_t num_samples) {
+
+  cudaSetDevice(stream->gpu_index);
+  constexpr int ideal_threads = 128;
+  constexpr int samples_per_block = 8;
+  // Number of decomposed input mask coefficients (input coefficient, level)
+  // per sample held in shared memory at once
+  constexpr uint32_t ideal_rows_per_tile = 32;
+
+  uint32_t inputs_per_tile = std::max(ideal_rows_per_tile / level_count, 1u);
+  uint32_t rows_per_tile = inputs_per_tile * level_count;
+  uint64_t shared_mem = sizeof(Torus) * rows_per_tile * samples_per_block;
+
+  dim3 grid((num_samples + samples_per_block - 1) / samples_per_block,
+            (lwe_dimension_out + 1 + ideal_threads - 1) / ideal_threads, 1);
+  dim3 threads(ideal_threads, 1, 1);
+
+  keyswitch_batched<Torus, samples_per_block>
+      <<<grid, threads, shared_mem, stream->stream>>>(
+          lwe_array_out, lwe_output_indexes, lwe_array_in, lwe_input_indexes,
+          ksk, lwe_dimension_in, lwe_dimension_out, base_log, level_count,
+          num_samples, inputs_per_tile);
+  check_cuda_error(cudaGetLastError());
+}
+
+/*
+ * Host reference of the keyswitch, bit-exact with both kernels. All arrays are
+ * in host memory.
+ */
+template <typename Torus>
+__host__ void keyswitch_lwe_ciphertext_vector_reference(
+    Torus *lwe_array_out, Torus *lwe_output_indexes, Torus *lwe_array_in,
+    Torus *lwe_input_indexes, Torus *ksk, uint32_t lwe_dimension_in,
+    uint32_t lwe_dimension_out, uint32_t base_log, uint32_t level_count,
+    uint32_t num_samples) {
+  uint32_t lwe_size_out = lwe_dimension_out + 1;
+  Torus mask_mod_b = (1ll << base_log) - 1ll;
+
+  for (uint32_t s = 0; s < num_samples; s++) {
+    Torus *lwe_in =
+        &lwe_array_in[lwe_input_indexes[s] * (lwe_dimension_in + 1)];
+    Torus *lwe_out = &lwe_array_out[lwe_output_indexes[s] * lwe_size_out];
+
+    for (uint32_t k = 0; k < lwe_dimension_out; k++)
+      lwe_out[k] = 0;
+    lwe_out[lwe_dimension_out] = lwe_in[lwe_dimension_in];
+
+    for (uint32_t i = 0; i < lwe_dimension_in; i++) {
+      Torus a_i = round_to_closest_multiple(lwe_in[i], base_log, level_count);
+      Torus state = a_i >> (sizeof(Torus) * 8 - base_log * level_count);
+      for (uint32_t j = 0; j < level_count; j++) {
+        Torus *ksk_block = &ksk[(i * level_count + j) * lwe_size_out];
+        Torus decomposed = decompose_one<Torus>(state, mask_mod_b, base_log);
+        for (uint32_t k = 0; k < lwe_size_out; k++)
+          lwe_out[k] -= ksk_block[k] * decomposed;
+      }
+    }
+  }
+}
+
 #endif
@@ -1,6 +1,99 @@
 #include "device.h"
+#include "pbs_pipeline.h"
+#include "scratch_arena.h"
+#include "staging_pool.h"
+#include <atomic>
 #include <cstdint>
 #include <cuda_runtime.h>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+typedef std::vector<cuda_device_profile> device_registry_t;
+
+// The registry is published as an immutable snapshot: readers only load the
+// current pointer, writers build a new snapshot under the mutex. Snapshots are
+// kept until exit, so profile pointers handed out stay valid after a swap.
+static std::mutex device_registry_mutex;
+static std::vector<std::unique_ptr<device_registry_t>> device_registry_snapshots;
+static std::atomic<const device_registry_t *> device_registry(nullptr);
+
+/// Must be called with device_registry_mutex held
+static const device_registry_t *
+publish_device_registry(device_registry_t profiles) {
+  device_registry_snapshots.emplace_back(
+      new device_registry_t(std::move(profiles)));
+  const device_registry_t *registry = device_registry_snapshots.back().get();
+  device_registry.store(registry, std::memory_order_release);
+  return registry;
+}
+
+/// Queries every visible device, once per process
+static const device_registry_t &get_device_registry() {
+  const device_registry_t *registry =
+      device_registry.load(std::memory_order_acquire);
+  if (registry != nullptr)
+    return *registry;
+
+  std::lock_guard<std::mutex> lock(device_registry_mutex);
+  registry = device_registry.load(std::memory_order_acquire);
+  if (registry != nullptr)
+    return *registry;
+
+  int num_gpus = 0;
+  if (cudaGetDeviceCount(&num_gpus) != cudaSuccess) {
+    // No usable device: clear the error and expose an empty registry
+    cudaGetLastError();
+    num_gpus = 0;
+  }
+
+  device_registry_t profiles(num_gpus);
+  for (int i = 0; i < num_gpus; i++) {
+    cudaDeviceProp prop;
+    check_cuda_error(cudaGetDeviceProperties(&prop, i));
+    cuda_device_profile &profile = profiles[i];
+    strncpy(profile.name, prop.name, sizeof(profile.name) - 1);
+    profile.name[sizeof(profile.name) - 1] = '\0';
+    profile.major = prop.major;
+    profile.minor = prop.minor;
+    profile.sm_count = prop.multiProcessorCount;
+    profile.shared_memory_per_block = prop.sharedMemPerBlock;
+    profile.shared_memory_per_sm = prop.sharedMemPerMultiprocessor;
+    profile.cooperative_launch = prop.cooperativeLaunch > 0;
+
+    int memory_pools = 0;
+#if (CUDART_VERSION >= 11020)
+    check_cuda_error(cudaDeviceGetAttribute(
+        &memory_pools, cudaDevAttrMemoryPoolsSupported, i));
+#endif
+    profile.memory_pools = memory_pools > 0;
+  }
+  return *publish_device_registry(std::move(profiles));
+}
+
+const cuda_device_profile *cuda_get_device_profile(uint32_t gpu_index) {
+  const device_registry_t &registry = get_device_registry();
+  if (gpu_index >= registry.size())
+    return nullptr;
+  return &registry[gpu_index];
+}
+
+const cuda_device_profile *cuda_get_current_device_profile() {
+  int gpu_index = 0;
+  check_cuda_error(cudaGetDevice(&gpu_index));
+  return cuda_get_device_profile(gpu_index);
+}
+
+void cuda_set_device_profiles(const cuda_device_profile *profiles,
+                              uint32_t num_devices) {
+  std::lock_guard<std::mutex> lock(device_registry_mutex);
+  publish_device_registry(device_registry_t(profiles, profiles + num_devices));
+}
+
+void cuda_reset_device_profiles() {
+  std::lock_guard<std::mutex> lock(device_registry_mutex);
+  device_registry.store(nullptr, std::memory_order_release);
+}
 
 /// Unsafe function to create a CUDA stream, must check first that GPU exists
 cuda_stream_t *cuda_create_stream(uint32_t gpu_index) {
@@ -9,6 +102,16 @@ cuda_stream_t *cuda_create_stream(uint32_t gpu_index) {
   return stream;
 }
 
+/// Creates a stream used to measure the memory footprint of scratch
+/// functions. Device allocations made on it only return placeholder
+/// addresses and add their size to measured_bytes, while copies, memsets and
+/// kernels are skipped. Must be destroyed with cuda_destroy_stream.
+cuda_stream_t *cuda_create_measuring_stream(uint32_t gpu_index) {
+  cuda_stream_t *stream = cuda_create_stream(gpu_index);
+  stream->measuring = true;
+  return stream;
+}
+
 /// Unsafe function to destroy CUDA stream, must check first the GPU exists
 int cuda_destroy_stream(cuda_stream_t *stream) {
   stream->release();
@@ -30,18 +133,22 @@ void *cuda_malloc(uint64_t size, uint32_t gpu_index) {
 /// Allocates a size-byte array at the device memory. Tries to do it
 /// asynchronously.
 void *cuda_malloc_async(uint64_t size, cuda_stream_t *stream) {
+  if (stream->measuring) {
+    // Distinct non-null placeholder, never dereferenced
+    void *ptr = (void *)(scratch_arena::alignment + stream->measured_bytes);
+    stream->measured_bytes += size;
+    return ptr;
+  }
+
   cudaSetDevice(stream->gpu_index);
   void *ptr;
+  stream->allocated_bytes += size;
 
 #ifndef CUDART_VERSION
 #error CUDART_VERSION Undefined!
 #elif (CUDART_VERSION >= 11020)
-  int support_async_alloc;
-  check_cuda_error(cudaDeviceGetAttribute(&support_async_alloc,
-                                          cudaDevAttrMemoryPoolsSupported,
-                                          stream->gpu_index));
-
-  if (support_async_alloc) {
+  auto profile = cuda_get_device_profile(stream->gpu_index);
+  if (profile != nullptr && profile->memory_pools) {
     check_cuda_error(cudaMallocAsync((void **)&ptr, size, stream->stream));
   } else {
     check_cuda_error(cudaMalloc((void **)&ptr, size));
@@ -73,14 +180,11 @@ int cuda_check_valid_malloc(uint64_t size, uint32_t gpu_index) {
 }
 
 /// Returns
-///  -> 0 if Cooperative Groups is not supported.
+///  -> 0 if Cooperative Groups is not supported or gpu_index doesn't exist.
 ///  -> 1 otherwise
-int cuda_check_support_cooperative_groups() {
-  int cooperative_groups_supported = 0;
-  cudaDeviceGetAttribute(&cooperative_groups_supported,
-                         cudaDevAttrCooperativeLaunch, 0);
-
-  return cooperative_groups_supported > 0;
+int cuda_check_support_cooperative_groups(uint32_t gpu_index) {
+  auto profile = cuda_get_device_profile(gpu_index);
+  return profile != nullptr && profile->cooperative_launch;
 }
 
 /// Tries to copy memory to the GPU asynchronously
@@ -99,6 +203,8 @@ int cuda_memcpy_async_to_gpu(void *dest, void *src, uint64_t size,
     // error code: invalid gpu_index
     return -2;
   }
+  if (stream->measuring)
+    return 0;
   cudaPointerAttributes attr;
   cudaPointerGetAttributes(&attr, dest);
   if (attr.device != stream->gpu_index && attr.type != cudaMemoryTypeDevice) {
@@ -112,6 +218,32 @@ int cuda_memcpy_async_to_gpu(void *dest, void *src, uint64_t size,
   return 0;
 }
 
+/// Copies memory to the GPU asynchronously through the page-locked staging
+/// pool of the stream. Unlike cuda_memcpy_async_to_gpu with a pageable source,
+/// the copy does not wait for the work already enqueued in the stream unless
+/// more than the pool capacity (64 MB) is pending on it, see staging_pool.h.
+/// src can be freed as soon as the function returns.
+/// 0: success
+/// -2: error, gpu index doesn't exist
+/// -3: error, zero copy size
+int cuda_memcpy_async_to_gpu_staged(void *dest, void *src, uint64_t size,
+                                    cuda_stream_t *stream) {
+  if (size == 0) {
+    // error code: zero copy size
+    return -3;
+  }
+
+  if (stream->gpu_index >= cuda_get_number_of_gpus()) {
+    // error code: invalid gpu_index
+    return -2;
+  }
+  if (stream->measuring)
+    return 0;
+
+  get_staging_pool(stream)->copy_to_device(dest, src, size);
+  return 0;
+}
+
 /// Tries to copy memory to the GPU synchronously
 /// 0: success
 /// -1: error, invalid device pointer
@@ -172,6 +304,8 @@ int cuda_memcpy_async_gpu_to_gpu(void *dest, void *src, uint64_t size,
     // error code: invalid gpu_index
     return -2;
   }
+  if (stream->measuring)
+    return 0;
   cudaPointerAttributes attr_dest;
   cudaPointerGetAttributes(&attr_dest, dest);
   if (attr_dest.device != stream->gpu_index &&
@@ -221,6 +355,8 @@ int cuda_memset_async(void *dest, uint64_t val, uint64_t size,
     // error code: invalid gpu_index
     return -2;
   }
+  if (stream->measuring)
+    return 0;
   cudaPointerAttributes attr;
   cudaPointerGetAttributes(&attr, dest);
   if (attr.device != stream->gpu_index && attr.type != cudaMemoryTypeDevice) {
@@ -240,20 +376,23 @@ __global__ void cuda_set_value_kernel(Torus *array, Torus value, Torus n) {
 }
 
 template <typename Torus>
-void cuda_set_value_async(cudaStream_t *stream, Torus *d_array, Torus value,
+void cuda_set_value_async(cuda_stream_t *stream, Torus *d_array, Torus value,
                           Torus n) {
+  if (stream->measuring)
+    return;
+
   int block_size = 256;
   int num_blocks = (n + block_size - 1) / block_size;
 
   // Launch the kernel
-  cuda_set_value_kernel<<<num_blocks, block_size, 0, *stream>>>(d_array, value,
-                                                                n);
+  cuda_set_value_kernel<<<num_blocks, block_size, 0, stream->stream>>>(
+      d_array, value, n);
 }
 
 /// Explicitly instantiate cuda_set_value_async for 32 and 64 bits
-template void cuda_set_value_async(cudaStream_t *stream, uint64_t *d_array,
+template void cuda_set_value_async(cuda_stream_t *stream, uint64_t *d_array,
                                    uint64_t value, uint64_t n);
-template void cuda_set_value_async(cudaStream_t *stream, uint32_t *d_array,
+template void cuda_set_value_async(cuda_stream_t *stream, uint32_t *d_array,
                                    uint32_t value, uint32_t n);
 
 /// Tries to copy memory to the GPU asynchronously
@@ -272,6 +411,8 @@ int cuda_memcpy_async_to_cpu(void *dest, const void *src, uint64_t size,
     // error code: invalid gpu_index
     return -2;
   }
+  if (stream->measuring)
+    return 0;
   cudaPointerAttributes attr;
   cudaPointerGetAttributes(&attr, src);
   if (attr.device != stream->gpu_index && attr.type != cudaMemoryTypeDevice) {
@@ -286,11 +427,7 @@ int cuda_memcpy_async_to_cpu(void *dest, const void *src, uint64_t size,
 }
 
 /// Return number of GPUs available
-int cuda_get_number_of_gpus() {
-  int num_gpus;
-  cudaGetDeviceCount(&num_gpus);
-  return num_gpus;
-}
+int cuda_get_number_of_gpus() { return get_device_registry().size(); }
 
 /// Drop a cuda array
 int cuda_drop(void *ptr, uint32_t gpu_index) {
@@ -305,17 +442,15 @@ int cuda_drop(void *ptr, uint32_t gpu_index) {
 
 /// Drop a cuda array. Tries to do it asynchronously
 int cuda_drop_async(void *ptr, cuda_stream_t *stream) {
+  if (stream->measuring)
+    return 0;
 
   cudaSetDevice(stream->gpu_index);
 #ifndef CUDART_VERSION
 #error CUDART_VERSION Undefined!
 #elif (CUDART_VERSION >= 11020)
-  int support_async_alloc;
-  check_cuda_error(cudaDeviceGetAttribute(&support_async_alloc,
-                                          cudaDevAttrMemoryPoolsSupported,
-                                          stream->gpu_index));
-
-  if (support_async_alloc) {
+  auto profile = cuda_get_device_profile(stream->gpu_index);
+  if (profile != nullptr && profile->memory_pools) {
     check_cuda_error(cudaFreeAsync(ptr, stream->stream));
   } else {
     check_cuda_error(cudaFree(ptr));
@@ -328,23 +463,71 @@ int cuda_drop_async(void *ptr, cuda_stream_t *stream) {
 
 /// Get the maximum size for the shared memory
 int cuda_get_max_shared_memory(uint32_t gpu_index) {
-  if (gpu_index >= cuda_get_number_of_gpus()) {
+  auto profile = cuda_get_device_profile(gpu_index);
+  if (profile == nullptr) {
     // error code: invalid gpu_index
     return -2;
   }
-  cudaSetDevice(gpu_index);
-  cudaDeviceProp prop;
-  cudaGetDeviceProperties(&prop, gpu_index);
-  int max_shared_memory = 0;
-  if (prop.major >= 6) {
-    max_shared_memory = prop.sharedMemPerMultiprocessor;
-  } else {
-    max_shared_memory = prop.sharedMemPerBlock;
-  }
-  return max_shared_memory;
+  return profile->max_shared_memory();
 }
 
 int cuda_synchronize_stream(cuda_stream_t *stream) {
   stream->synchronize();
   return 0;
 }
+
+/// Frees the scratch arena attached to the stream, if any
+void cuda_release_scratch_arena(cuda_stream_t *stream) {
+  delete stream->arena;
+  stream->arena = nullptr;
+}
+
+/// Reports the usage of the scratch arena attached to the stream, in bytes
+/// 0: success
+/// -1: error, the stream has no scratch arena yet
+int cuda_get_scratch_arena_usage(cuda_stream_t *stream, uint64_t *current_usage,
+                                 uint64_t *peak_usage, uint64_t *capacity) {
+  if (stream->arena == nullptr) {
+    *current_usage = 0;
+    *peak_usage = 0;
+    *capacity = 0;
+    return -1;
+  }
+  *current_usage = stream->arena->current_usage;
+  *peak_usage = stream->arena->peak_usage;
+  *capacity = stream->arena->capacity;
+  return 0;
+}
+
+/// Frees the staging pool attached to the stream, if any
+void cuda_release_staging_pool(cuda_stream_t *stream) {
+  delete stream->staging;
+  stream->staging = nullptr;
+}
+
+/// Reports the bytes copied through the staging pool of the stream, the
+/// bytes copied directly because page-locked memory was unavailable, and the
+/// time the host spent waiting for a staging slot
+/// 0: success
+/// -1: error, the stream has no staging pool yet
+int cuda_get_staging_pool_stats(cuda_stream_t *stream, uint64_t *bytes_staged,
+                                uint64_t *bytes_direct,
+                                uint64_t *stall_time_us) {
+  if (stream->staging == nullptr) {
+    *bytes_staged = 0;
+    *bytes_direct = 0;
+    *stall_time_us = 0;
+    return -1;
+  }
+  *bytes_staged = stream->staging->bytes_staged;
+  *bytes_direct = stream->staging->bytes_direct;
+  *stall_time_us = stream->staging->stall_time_us;
+  return 0;
+}
+
+/// Destroys the side stream and events of the multi-bit PBS pipeline attached
+/// to the stream, if any
+void cuda_release_pbs_pipeline(cuda_stream_t *stream) {
+  delete stream->pipeline;
+  stream->pipeline = nullptr;
+}
@@ -1,621 +1,260 @@
 #ifndef GPU_BOOTSTRAP_FFT_CUH
 #define GPU_BOOTSTRAP_FFT_CUH
 
+#include "negacyclic_fft.h"
 #include "polynomial/functions.cuh"
 #include "polynomial/parameters.cuh"
 #include "twiddles.cuh"
 #include "types/complex/operations.cuh"
 
 /*
- * Direct negacyclic FFT:
- *   - before the FFT the N real coefficients are stored into a
- *     N/2 sized complex with the even coefficients in the real part
- *     and the odd coefficients in the imaginary part. This is referred to
- *     as the half-size FFT
- *   - when calling BNSMFFT_direct for the forward negacyclic FFT of PBS,
- *     opt is divided by 2 because the butterfly pattern is always applied
- *     between pairs of coefficients
- *   - instead of twisting each coefficient A_j before the FFT by
- *     multiplying by the w^j roots of unity (aka twiddles, w=exp(-i pi /N)),
- *     the FFT is modified, and for each level k of the FFT the twiddle:
- *     w_j,k = exp(-i pi j/2^k)
- *     is replaced with:
- *     \zeta_j,k = exp(-i pi (2j-1)/2^k)
+ * Radix-2^k stages of the negacyclic FFT.
+ *
+ * A stage merges `levels` consecutive levels of butterflies: each thread
+ * loads 2^levels coefficients, applies the butterflies of all those levels
+ * in registers and stores them back, so that a __syncthreads() is only
+ * needed between stages instead of between levels. The coefficients of a
+ * group are the ones the butterflies of the stage mix together: they are
+ * `stride` apart in a block of 2^levels * stride coefficients, block being
+ * the twiddle index of the first level of the stage.
+ *
+ * Each thread handles params::opt / 2^levels groups, so the number of merged
+ * levels is chosen from params::opt at compile time, up to 3 (radix-8).
+ * When params::opt is 2 a thread only ever holds one butterfly per level and
+ * each stage is a single radix-2 level.
  */
-template <class params> __device__ void NSMFFT_direct(double2 *A) {
-
-  /* We don't make bit reverse here, since twiddles are already reversed
-   *  Each thread is always in charge of "opt/2" pairs of coefficients,
-   *  which is why we always loop through N/2 by N/opt strides
-   *  The pragma unroll instruction tells the compiler to unroll the
-   *  full loop, which should increase performance
-   */
-
-  size_t tid = threadIdx.x;
-  size_t twid_id;
-  size_t i1, i2;
-  double2 u, v, w;
-  // level 1
-  // we don't make actual complex multiplication on level1 since we have only
-  // one twiddle, it's real and image parts are equal, so we can multiply
-  // it with simpler operations
-#pragma unroll
-  for (size_t i = 0; i < params::opt / 2; ++i) {
-    i1 = tid;
-    i2 = tid + params::degree / 2;
-
-    u = A[i1];
-    v = A[i2] * (double2){0.707106781186547461715008466854,
-                          0.707106781186547461715008466854};
-
-    A[i1] += v;
-    A[i2] = u - v;
+template <class params> constexpr int fft_stage_levels() {
+  return negacyclic_fft_stage_levels(params::opt);
+}
 
-    tid += params::degree / params::opt;
+// Twiddles of the device table, as taken by the functions of
+// include/negacyclic_fft.h that apply the butterflies
+struct device_negtwiddles {
+  __device__ double2 operator()(int level, uint32_t twid_id) const {
+    return negtwiddle(level, twid_id);
   }
-  __syncthreads();
-
-  // level 2
-  // from this level there are more than one twiddles and none of them has equal
-  // real and imag parts, so complete complex multiplication is needed
-  // for each level params::degree / 2^level represents number of coefficients
-  // inside divided chunk of specific level
-  //
-  tid = threadIdx.x;
-#pragma unroll
-  for (size_t i = 0; i < params::opt / 2; ++i) {
-    twid_id = tid / (params::degree / 4);
-    i1 = 2 * (params::degree / 4) * twid_id + (tid & (params::degree / 4 - 1));
-    i2 = i1 + params::degree / 4;
+};
 
-    w = negtwiddles[twid_id + 2];
-    u = A[i1];
-    v = A[i2] * w;
+template <class params, int first_level, int levels>
+__device__ __forceinline__ void NSMFFT_direct_stage(double2 *A) {
+  constexpr int radix = 1 << levels;
+  constexpr size_t stride = params::degree >> (first_level + levels - 1);
 
-    A[i1] += v;
-    A[i2] = u - v;
-
-    tid += params::degree / params::opt;
-  }
-  __syncthreads();
-
-  // level 3
-  tid = threadIdx.x;
+  size_t tid = threadIdx.x;
 #pragma unroll
-  for (size_t i = 0; i < params::opt / 2; ++i) {
-    twid_id = tid / (params::degree / 8);
-    i1 = 2 * (params::degree / 8) * twid_id + (tid & (params::degree / 8 - 1));
-    i2 = i1 + params::degree / 8;
+  for (size_t i = 0; i < params::opt / radix; ++i) {
+    size_t first = negacyclic_fft_group_first(tid, stride, levels);
 
-    w = negtwiddles[twid_id + 4];
-    u = A[i1];
-    v = A[i2] * w;
-
-    A[i1] += v;
-    A[i2] = u - v;
-
-    tid += params::degree / params::opt;
-  }
-  __syncthreads();
-
-  // level 4
-  tid = threadIdx.x;
+    double2 x[radix];
 #pragma unroll
-  for (size_t i = 0; i < params::opt / 2; ++i) {
-    twid_id = tid / (params::degree / 16);
-    i1 =
-        2 * (params::degree / 16) * twid_id + (tid & (params::degree / 16 - 1));
-    i2 = i1 + params::degree / 16;
+    for (int t = 0; t < radix; ++t)
+      x[t] = A[first + t * stride];
 
-    w = negtwiddles[twid_id + 8];
-    u = A[i1];
-    v = A[i2] * w;
+    negacyclic_fft_direct_group<first_level, levels>(x, tid / stride,
+                                                     device_negtwiddles());
 
-    A[i1] += v;
-    A[i2] = u - v;
-
-    tid += params::degree / params::opt;
-  }
-  __syncthreads();
-
-  // level 5
-  tid = threadIdx.x;
 #pragma unroll
-  for (size_t i = 0; i < params::opt / 2; ++i) {
-    twid_id = tid / (params::degree / 32);
-    i1 =
-        2 * (params::degree / 32) * twid_id + (tid & (params::degree / 32 - 1));
-    i2 = i1 + params::degree / 32;
-
-    w = negtwiddles[twid_id + 16];
-    u = A[i1];
-    v = A[i2] * w;
-
-    A[i1] += v;
-    A[i2] = u - v;
+    for (int t = 0; t < radix; ++t)
+      A[first + t * stride] = x[t];
 
     tid += params::degree / params::opt;
   }
-  __syncthreads();
-
-  // level 6
-  tid = threadIdx.x;
-#pragma unroll
-  for (size_t i = 0; i < params::opt / 2; ++i) {
-    twid_id = tid / (params::degree / 64);
-    i1 =
-        2 * (params::degree / 64) * twid_id + (tid & (params::degree / 64 - 1));
-    i2 = i1 + params::degree / 64;
-
-    w = negtwiddles[twid_id + 32];
-    u = A[i1];
-    v = A[i2] * w;
-
-    A[i1] += v;
-    A[i2] = u - v;
-
-    tid += params::degree / params::opt;
-  }
-  __syncthreads();
-
-  // level 7
-  tid = threadIdx.x;
-#pragma unroll
-  for (size_t i = 0; i < params::opt / 2; ++i) {
-    twid_id = tid / (params::degree / 128);
-    i1 = 2 * (params::degree / 128) * twid_id +
-         (tid & (params::degree / 128 - 1));
-    i2 = i1 + params::degree / 128;
-
-    w = negtwiddles[twid_id + 64];
-    u = A[i1];
-    v = A[i2] * w;
-
-    A[i1] += v;
-    A[i2] = u - v;
-
-    tid += params::degree / params::opt;
-  }
-  __syncthreads();
-
-  // from level 8, we need to check size of params degree, because we support
-  // minimum actual polynomial size = 256,  when compressed size is halfed and
-  // minimum supported compressed size is 128, so we always need first 7
-  // levels of butterfy operation, since butterfly levels are hardcoded
-  // we need to check if polynomial size is big enough to require specific level
-  // of butterfly.
-  if constexpr (params::degree >= 256) {
-    // level 8
-    tid = threadIdx.x;
-#pragma unroll
-    for (size_t i = 0; i < params::opt / 2; ++i) {
-      twid_id = tid / (params::degree / 256);
-      i1 = 2 * (params::degree / 256) * twid_id +
-           (tid & (params::degree / 256 - 1));
-      i2 = i1 + params::degree / 256;
-
-      w = negtwiddles[twid_id + 128];
-      u = A[i1];
-      v = A[i2] * w;
-
-      A[i1] += v;
-      A[i2] = u - v;
-
-      tid += params::degree / params::opt;
-    }
-    __syncthreads();
-  }
-
-  if constexpr (params::degree >= 512) {
-    // level 9
-    tid = threadIdx.x;
-#pragma unroll
-    for (size_t i = 0; i < params::opt / 2; ++i) {
-      twid_id = tid / (params::degree / 512);
-      i1 = 2 * (params::degree / 512) * twid_id +
-           (tid & (params::degree / 512 - 1));
-      i2 = i1 + params::degree / 512;
-
-      w = negtwiddles[twid_id + 256];
-      u = A[i1];
-      v = A[i2] * w;
-
-      A[i1] += v;
-      A[i2] = u - v;
-
-      tid += params::degree / params::opt;
-    }
-    __syncthreads();
-  }
-
-  if constexpr (params::degree >= 1024) {
-    // level 10
-    tid = threadIdx.x;
-#pragma unroll
-    for (size_t i = 0; i < params::opt / 2; ++i) {
-      twid_id = tid / (params::degree / 1024);
-      i1 = 2 * (params::degree / 1024) * twid_id +
-           (tid & (params::degree / 1024 - 1));
-      i2 = i1 + params::degree / 1024;
-
-      w = negtwiddles[twid_id + 512];
-      u = A[i1];
-      v = A[i2] * w;
-
-      A[i1] += v;
-      A[i2] = u - v;
+}
 
-      tid += params::degree / params::opt;
-    }
-    __syncthreads();
-  }
+// Levels are applied in reverse order
+template <class params, int first_level, int levels>
+__device__ __forceinline__ void NSMFFT_inverse_stage(double2 *A) {
+  constexpr int radix = 1 << levels;
+  constexpr size_t stride = params::degree >> (first_level + levels - 1);
 
-  if constexpr (params::degree >= 2048) {
-    // level 11
-    tid = threadIdx.x;
+  size_t tid = threadIdx.x;
 #pragma unroll
-    for (size_t i = 0; i < params::opt / 2; ++i) {
-      twid_id = tid / (params::degree / 2048);
-      i1 = 2 * (params::degree / 2048) * twid_id +
-           (tid & (params::degree / 2048 - 1));
-      i2 = i1 + params::degree / 2048;
-
-      w = negtwiddles[twid_id + 1024];
-      u = A[i1];
-      v = A[i2] * w;
-
-      A[i1] += v;
-      A[i2] = u - v;
+  for (size_t i = 0; i < params::opt / radix; ++i) {
+    size_t first = negacyclic_fft_group_first(tid, stride, levels);
 
-      tid += params::degree / params::opt;
-    }
-    __syncthreads();
-  }
-
-  if constexpr (params::degree >= 4096) {
-    // level 12
-    tid = threadIdx.x;
+    double2 x[radix];
 #pragma unroll
-    for (size_t i = 0; i < params::opt / 2; ++i) {
-      twid_id = tid / (params::degree / 4096);
-      i1 = 2 * (params::degree / 4096) * twid_id +
-           (tid & (params::degree / 4096 - 1));
-      i2 = i1 + params::degree / 4096;
-
-      w = negtwiddles[twid_id + 2048];
-      u = A[i1];
-      v = A[i2] * w;
+    for (int t = 0; t < radix; ++t)
+      x[t] = A[first + t * stride];
 
-      A[i1] += v;
-      A[i2] = u - v;
-
-      tid += params::degree / params::opt;
-    }
-    __syncthreads();
-  }
+    negacyclic_fft_inverse_group<first_level, levels>(x, tid / stride,
+                                                      device_negtwiddles());
 
-  // compressed size = 8192 is actual polynomial size = 16384.
-  // from this size, twiddles can't fit in constant memory,
-  // so from here, butterfly operation access device memory.
-  if constexpr (params::degree >= 8192) {
-    // level 13
-    tid = threadIdx.x;
 #pragma unroll
-    for (size_t i = 0; i < params::opt / 2; ++i) {
-      twid_id = tid / (params::degree / 8192);
-      i1 = 2 * (params::degree / 8192) * twid_id +
-           (tid & (params::degree / 8192 - 1));
-      i2 = i1 + params::degree / 8192;
+    for (int t = 0; t < radix; ++t)
+      A[first + t * stride] = x[t];
 
-      w = negtwiddles13[twid_id];
-      u = A[i1];
-      v = A[i2] * w;
-
-      A[i1] += v;
-      A[i2] = u - v;
-
-      tid += params::degree / params::opt;
-    }
-    __syncthreads();
+    tid += params::degree / params::opt;
   }
 }
 
 /*
- * negacyclic inverse fft
+ * Warp stage of the negacyclic FFT.
+ *
+ * The butterflies of the last fft_warp_levels levels only mix coefficients
+ * inside aligned chunks of 64. A warp loads a chunk in registers, two
+ * coefficients per lane (lane and lane + 32), applies the level of distance
+ * 32 inside each lane and the five following ones by exchanging values with
+ * its partner lane through __shfl_xor_sync. Those levels then go neither
+ * through shared memory nor through block-wide barriers.
+ *
+ * Both lanes of a pair compute the product by the twiddle and keep the half
+ * of the butterfly they own, which gives the same results as the radix-2
+ * butterflies. Blocks must be made of whole warps.
  */
-template <class params> __device__ void NSMFFT_inverse(double2 *A) {
+constexpr int fft_warp_levels = negacyclic_fft_warp_levels;
 
-  /* We don't make bit reverse here, since twiddles are already reversed
-   *  Each thread is always in charge of "opt/2" pairs of coefficients,
-   *  which is why we always loop through N/2 by N/opt strides
-   *  The pragma unroll instruction tells the compiler to unroll the
-   *  full loop, which should increase performance
-   */
-
-  size_t tid = threadIdx.x;
-  size_t twid_id;
-  size_t i1, i2;
-  double2 u, w;
-
-  // divide input by compressed polynomial size
-  tid = threadIdx.x;
-  for (size_t i = 0; i < params::opt; ++i) {
-    A[tid] /= params::degree;
-    tid += params::degree / params::opt;
-  }
-  __syncthreads();
-
-  // none of the twiddles have equal real and imag part, so
-  // complete complex multiplication has to be done
-  // here we have more than one twiddle
-  // mapping in backward fft is reversed
-  // butterfly operation is started from last level
-
-  // compressed size = 8192 is actual polynomial size = 16384.
-  // twiddles for this size can't fit in constant memory so
-  // butterfly operation for this level acess device memory to fetch
-  // twiddles
-  if constexpr (params::degree >= 8192) {
-    // level 13
-    tid = threadIdx.x;
-#pragma unroll
-    for (size_t i = 0; i < params::opt / 2; ++i) {
-      twid_id = tid / (params::degree / 8192);
-      i1 = 2 * (params::degree / 8192) * twid_id +
-           (tid & (params::degree / 8192 - 1));
-      i2 = i1 + params::degree / 8192;
-
-      w = negtwiddles13[twid_id];
-      u = A[i1] - A[i2];
-
-      A[i1] += A[i2];
-      A[i2] = u * conjugate(w);
-
-      tid += params::degree / params::opt;
-    }
-    __syncthreads();
-  }
-
-  if constexpr (params::degree >= 4096) {
-    // level 12
-    tid = threadIdx.x;
-#pragma unroll
-    for (size_t i = 0; i < params::opt / 2; ++i) {
-      twid_id = tid / (params::degree / 4096);
-      i1 = 2 * (params::degree / 4096) * twid_id +
-           (tid & (params::degree / 4096 - 1));
-      i2 = i1 + params::degree / 4096;
-
-      w = negtwiddles[twid_id + 2048];
-      u = A[i1] - A[i2];
-
-      A[i1] += A[i2];
-      A[i2] = u * conjugate(w);
-
-      tid += params::degree / params::opt;
-    }
-    __syncthreads();
-  }
-
-  if constexpr (params::degree >= 2048) {
-    // level 11
-    tid = threadIdx.x;
-#pragma unroll
-    for (size_t i = 0; i < params::opt / 2; ++i) {
-      twid_id = tid / (params::degree / 2048);
-      i1 = 2 * (params::degree / 2048) * twid_id +
-           (tid & (params::degree / 2048 - 1));
-      i2 = i1 + params::degree / 2048;
-
-      w = negtwiddles[twid_id + 1024];
-      u = A[i1] - A[i2];
-
-      A[i1] += A[i2];
-      A[i2] = u * conjugate(w);
-
-      tid += params::degree / params::opt;
-    }
-    __syncthreads();
-  }
-
-  if constexpr (params::degree >= 1024) {
-    // level 10
-    tid = threadIdx.x;
-#pragma unroll
-    for (size_t i = 0; i < params::opt / 2; ++i) {
-      twid_id = tid / (params::degree / 1024);
-      i1 = 2 * (params::degree / 1024) * twid_id +
-           (tid & (params::degree / 1024 - 1));
-      i2 = i1 + params::degree / 1024;
-
-      w = negtwiddles[twid_id + 512];
-      u = A[i1] - A[i2];
-
-      A[i1] += A[i2];
-      A[i2] = u * conjugate(w);
-
-      tid += params::degree / params::opt;
-    }
-    __syncthreads();
-  }
-
-  if constexpr (params::degree >= 512) {
-    // level 9
-    tid = threadIdx.x;
-#pragma unroll
-    for (size_t i = 0; i < params::opt / 2; ++i) {
-      twid_id = tid / (params::degree / 512);
-      i1 = 2 * (params::degree / 512) * twid_id +
-           (tid & (params::degree / 512 - 1));
-      i2 = i1 + params::degree / 512;
-
-      w = negtwiddles[twid_id + 256];
-      u = A[i1] - A[i2];
-
-      A[i1] += A[i2];
-      A[i2] = u * conjugate(w);
-
-      tid += params::degree / params::opt;
-    }
-    __syncthreads();
-  }
-
-  if constexpr (params::degree >= 256) {
-    // level 8
-    tid = threadIdx.x;
-#pragma unroll
-    for (size_t i = 0; i < params::opt / 2; ++i) {
-      twid_id = tid / (params::degree / 256);
-      i1 = 2 * (params::degree / 256) * twid_id +
-           (tid & (params::degree / 256 - 1));
-      i2 = i1 + params::degree / 256;
-
-      w = negtwiddles[twid_id + 128];
-      u = A[i1] - A[i2];
-
-      A[i1] += A[i2];
-      A[i2] = u * conjugate(w);
+__device__ __forceinline__ double2 shfl_xor_double2(double2 value,
+                                                    int lane_mask) {
+  return {__shfl_xor_sync(0xffffffff, value.x, lane_mask),
+          __shfl_xor_sync(0xffffffff, value.y, lane_mask)};
+}
 
-      tid += params::degree / params::opt;
-    }
-    __syncthreads();
-  }
+template <class params>
+__device__ __forceinline__ void NSMFFT_direct_warp_stage(double2 *A) {
+  constexpr int first_level = params::log2_degree - fft_warp_levels + 1;
+  constexpr size_t warps = params::degree / params::opt / 32;
+  size_t lane = threadIdx.x & 31;
+  size_t warp = threadIdx.x / 32;
 
-  // below level 8, we don't need to check size of params degree, because we
-  // support minimum actual polynomial size = 256,  when compressed size is
-  // halfed and minimum supported compressed size is 128, so we always need
-  // last 7 levels of butterfy operation, since butterfly levels are hardcoded
-  // we don't need to check if polynomial size is big enough to require
-  // specific level of butterfly.
-  // level 7
-  tid = threadIdx.x;
 #pragma unroll
   for (size_t i = 0; i < params::opt / 2; ++i) {
-    twid_id = tid / (params::degree / 128);
-    i1 = 2 * (params::degree / 128) * twid_id +
-         (tid & (params::degree / 128 - 1));
-    i2 = i1 + params::degree / 128;
-
-    w = negtwiddles[twid_id + 64];
-    u = A[i1] - A[i2];
-
-    A[i1] += A[i2];
-    A[i2] = u * conjugate(w);
+    size_t chunk = warp + i * warps;
+    double2 x0 = A[chunk * 64 + lane];
+    double2 x1 = A[chunk * 64 + lane + 32];
+
+    // distance 32, both coefficients are in the lane
+    negacyclic_fft_direct_butterfly(x0, x1, negtwiddle(first_level, chunk));
+
+#pragma unroll
+    for (int s = 1; s < fft_warp_levels; ++s) {
+      int distance = 32 >> s;
+      bool upper = lane & distance;
+      double2 w0 = negtwiddle(
+          first_level + s, negacyclic_fft_warp_twiddle_index(chunk, lane, s));
+      double2 w1 =
+          negtwiddle(first_level + s,
+                     negacyclic_fft_warp_twiddle_index(chunk, lane + 32, s));
+      double2 p0 = shfl_xor_double2(x0, distance);
+      double2 p1 = shfl_xor_double2(x1, distance);
+      x0 = negacyclic_fft_direct_lane(x0, p0, w0, upper);
+      x1 = negacyclic_fft_direct_lane(x1, p1, w1, upper);
+    }
 
-    tid += params::degree / params::opt;
+    A[chunk * 64 + lane] = x0;
+    A[chunk * 64 + lane + 32] = x1;
   }
-  __syncthreads();
-
-  // level 6
-  tid = threadIdx.x;
-#pragma unroll
-  for (size_t i = 0; i < params::opt / 2; ++i) {
-    twid_id = tid / (params::degree / 64);
-    i1 =
-        2 * (params::degree / 64) * twid_id + (tid & (params::degree / 64 - 1));
-    i2 = i1 + params::degree / 64;
-
-    w = negtwiddles[twid_id + 32];
-    u = A[i1] - A[i2];
-
-    A[i1] += A[i2];
-    A[i2] = u * conjugate(w);
+}
 
-    tid += params::degree / params::opt;
-  }
-  __syncthreads();
+// Levels are applied in reverse order, starting with the division by the
+// compressed polynomial size
+template <class params>
+__device__ __forceinline__ void NSMFFT_inverse_warp_stage(double2 *A) {
+  constexpr int first_level = params::log2_degree - fft_warp_levels + 1;
+  constexpr size_t warps = params::degree / params::opt / 32;
+  size_t lane = threadIdx.x & 31;
+  size_t warp = threadIdx.x / 32;
 
-  // level 5
-  tid = threadIdx.x;
 #pragma unroll
   for (size_t i = 0; i < params::opt / 2; ++i) {
-    twid_id = tid / (params::degree / 32);
-    i1 =
-        2 * (params::degree / 32) * twid_id + (tid & (params::degree / 32 - 1));
-    i2 = i1 + params::degree / 32;
-
-    w = negtwiddles[twid_id + 16];
-    u = A[i1] - A[i2];
+    size_t chunk = warp + i * warps;
+    double2 x0 = A[chunk * 64 + lane];
+    double2 x1 = A[chunk * 64 + lane + 32];
+    x0 /= params::degree;
+    x1 /= params::degree;
+
+#pragma unroll
+    for (int s = fft_warp_levels - 1; s >= 1; --s) {
+      int distance = 32 >> s;
+      bool upper = lane & distance;
+      double2 w0 = negtwiddle(
+          first_level + s, negacyclic_fft_warp_twiddle_index(chunk, lane, s));
+      double2 w1 =
+          negtwiddle(first_level + s,
+                     negacyclic_fft_warp_twiddle_index(chunk, lane + 32, s));
+      double2 p0 = shfl_xor_double2(x0, distance);
+      double2 p1 = shfl_xor_double2(x1, distance);
+      x0 = negacyclic_fft_inverse_lane(x0, p0, w0, upper);
+      x1 = negacyclic_fft_inverse_lane(x1, p1, w1, upper);
+    }
 
-    A[i1] += A[i2];
-    A[i2] = u * conjugate(w);
+    // distance 32, both coefficients are in the lane
+    negacyclic_fft_inverse_butterfly(x0, x1, negtwiddle(first_level, chunk));
 
-    tid += params::degree / params::opt;
+    A[chunk * 64 + lane] = x0;
+    A[chunk * 64 + lane + 32] = x1;
   }
-  __syncthreads();
-
-  // level 4
-  tid = threadIdx.x;
-#pragma unroll
-  for (size_t i = 0; i < params::opt / 2; ++i) {
-    twid_id = tid / (params::degree / 16);
-    i1 =
-        2 * (params::degree / 16) * twid_id + (tid & (params::degree / 16 - 1));
-    i2 = i1 + params::degree / 16;
-
-    w = negtwiddles[twid_id + 8];
-    u = A[i1] - A[i2];
-
-    A[i1] += A[i2];
-    A[i2] = u * conjugate(w);
+}
 
-    tid += params::degree / params::opt;
-  }
+// Direct FFT from first_level to last_level, through radix-2^k stages
+template <class params, int first_level, int last_level>
+__device__ __forceinline__ void NSMFFT_direct_stages(double2 *A) {
+  constexpr int remaining = last_level - first_level + 1;
+  constexpr int levels = fft_stage_levels<params>() < remaining
+                             ? fft_stage_levels<params>()
+                             : remaining;
+  NSMFFT_direct_stage<params, first_level, levels>(A);
   __syncthreads();
+  if constexpr (first_level + levels <= last_level)
+    NSMFFT_direct_stages<params, first_level + levels, last_level>(A);
+}
 
-  // level 3
-  tid = threadIdx.x;
-#pragma unroll
-  for (size_t i = 0; i < params::opt / 2; ++i) {
-    twid_id = tid / (params::degree / 8);
-    i1 = 2 * (params::degree / 8) * twid_id + (tid & (params::degree / 8 - 1));
-    i2 = i1 + params::degree / 8;
-
-    w = negtwiddles[twid_id + 4];
-    u = A[i1] - A[i2];
-
-    A[i1] += A[i2];
-    A[i2] = u * conjugate(w);
-
-    tid += params::degree / params::opt;
-  }
+// Inverse FFT from last_level down to level 1, through radix-2^k stages
+template <class params, int last_level>
+__device__ __forceinline__ void NSMFFT_inverse_stages(double2 *A) {
+  constexpr int levels = fft_stage_levels<params>() < last_level
+                             ? fft_stage_levels<params>()
+                             : last_level;
+  NSMFFT_inverse_stage<params, last_level - levels + 1, levels>(A);
   __syncthreads();
+  if constexpr (last_level - levels >= 1)
+    NSMFFT_inverse_stages<params, last_level - levels>(A);
+}
 
-  // level 2
-  tid = threadIdx.x;
-#pragma unroll
-  for (size_t i = 0; i < params::opt / 2; ++i) {
-    twid_id = tid / (params::degree / 4);
-    i1 = 2 * (params::degree / 4) * twid_id + (tid & (params::degree / 4 - 1));
-    i2 = i1 + params::degree / 4;
-
-    w = negtwiddles[twid_id + 2];
-    u = A[i1] - A[i2];
-
-    A[i1] += A[i2];
-    A[i2] = u * conjugate(w);
+/*
+ * Direct negacyclic FFT:
+ *   - before the FFT the N real coefficients are stored into a
+ *     N/2 sized complex with the even coefficients in the real part
+ *     and the odd coefficients in the imaginary part. This is referred to
+ *     as the half-size FFT
+ *   - when calling BNSMFFT_direct for the forward negacyclic FFT of PBS,
+ *     opt is divided by 2 because the butterfly pattern is always applied
+ *     between pairs of coefficients
+ *   - instead of twisting each coefficient A_j before the FFT by
+ *     multiplying by the w^j roots of unity (aka twiddles, w=exp(-i pi /N)),
+ *     the FFT is modified, and for each level k of the FFT the twiddle:
+ *     w_j,k = exp(-i pi j/2^k)
+ *     is replaced with:
+ *     \zeta_j,k = exp(-i pi (2j-1)/2^k)
+ */
+template <class params> __device__ void NSMFFT_direct(double2 *A) {
 
-    tid += params::degree / params::opt;
-  }
+  /* We don't make bit reverse here, since twiddles are already reversed
+   *  The first levels are done in radix-2^k stages separated by
+   *  __syncthreads(), the last fft_warp_levels ones by the warp stage
+   */
+  static_assert(params::log2_degree > fft_warp_levels,
+                "FFT too small for the warp stage");
+  NSMFFT_direct_stages<params, 1, params::log2_degree - fft_warp_levels>(A);
+  NSMFFT_direct_warp_stage<params>(A);
   __syncthreads();
+}
 
-  // level 1
-  tid = threadIdx.x;
-#pragma unroll
-  for (size_t i = 0; i < params::opt / 2; ++i) {
-    twid_id = tid / (params::degree / 2);
-    i1 = 2 * (params::degree / 2) * twid_id + (tid & (params::degree / 2 - 1));
-    i2 = i1 + params::degree / 2;
-
-    w = negtwiddles[twid_id + 1];
-    u = A[i1] - A[i2];
-
-    A[i1] += A[i2];
-    A[i2] = u * conjugate(w);
+/*
+ * negacyclic inverse fft
+ */
+template <class params> __device__ void NSMFFT_inverse(double2 *A) {
 
-    tid += params::degree / params::opt;
-  }
+  /* We don't make bit reverse here, since twiddles are already reversed
+   *  Mapping in backward fft is reversed, butterfly operation is started
+   *  from the last level: the warp stage first, which also divides the input
+   *  by the compressed polynomial size, then the radix-2^k stages
+   */
+  static_assert(params::log2_degree > fft_warp_levels,
+                "FFT too small for the warp stage");
+  NSMFFT_inverse_warp_stage<params>(A);
   __syncthreads();
+  NSMFFT_inverse_stages<params, params::log2_degree - fft_warp_levels>(A);
 }
 
 /*
@@ -1,13 +1,51 @@
 #ifndef GPU_BOOTSTRAP_TWIDDLES_CUH
 #define GPU_BOOTSTRAP_TWIDDLES_CUH
 
+#include "device.h"
+#include <cstdint>
+
+/*
+ * Twiddles of the negacyclic FFT, as defined in include/negacyclic_fft.h: the
+ * butterflies of level k use negtwiddles[2^(k-1) + j].
+ *
+ * 'negtwiddles' points to a table in device memory generated for each device
+ * by 'cuda_initialize_twiddles'. It holds the 'negtwiddles_table_size' first
+ * twiddles, enough for every level up to N = 32768: the levels after that
+ * compute theirs on the fly with 'compute_negtwiddle'.
+ */
+constexpr uint32_t negtwiddles_table_size = 16384;
+
+extern __constant__ const double2 *negtwiddles;
+
+/// Creates the twiddle table of gpu_index the first time it is called for
+/// that device, does nothing afterwards. Meant to be called at scratch time,
+/// before any FFT runs on the device.
+void cuda_initialize_twiddles(uint32_t gpu_index);
+
+/// Same, for the device of stream. Nothing runs on measuring streams, so
+/// their scratch functions leave the table untouched.
+void cuda_initialize_twiddles(cuda_stream_t *stream);
+
 /*
- * 'negtwiddles' are stored in constant memory for faster access times
- * because of it's limitied size, only twiddles for up to 2^12 polynomial size
- * can be stored there, twiddles for 2^13 are stored in device memory
- * 'negtwiddles13'
+ * Twiddle twid_id of the given level, computed from its definition
+ * exp(i pi (4 bitrev(twid_id) + 1) / 2^(level+1)). The argument of sincospi
+ * is exact, so the result is as accurate as sincospi itself. Only used from
+ * level 2 on, level is a compile-time constant once the callers are
+ * unrolled.
  */
+__device__ __forceinline__ double2 compute_negtwiddle(int level,
+                                                      uint32_t twid_id) {
+  uint32_t reversed = __brev(twid_id) >> (33 - level);
+  double angle = (double)(4 * reversed + 1) / (double)(1u << (level + 1));
+  double2 w;
+  sincospi(angle, &w.y, &w.x);
+  return w;
+}
 
-extern __constant__ double2 negtwiddles[4096];
-extern __device__ double2 negtwiddles13[4096];
+// Twiddle twid_id of the given level, from the table when it holds it
+__device__ __forceinline__ double2 negtwiddle(int level, uint32_t twid_id) {
+  if ((1u << level) <= negtwiddles_table_size)
+    return negtwiddles[(1u << (level - 1)) + twid_id];
+  return compute_negtwiddle(level, twid_id);
+}
 #endif
@@ -34,6 +34,25 @@ void scratch_cuda_integer_radix_comparison_kb_64(
   }
 }
 
+uint64_t get_buffer_size_integer_radix_comparison_kb_64(
+    uint32_t gpu_index, uint32_t glwe_dimension, uint32_t polynomial_size,
+    uint32_t big_lwe_dimension, uint32_t small_lwe_dimension, uint32_t ks_level,
+    uint32_t ks_base_log, uint32_t pbs_level, uint32_t pbs_base_log,
+    uint32_t grouping_factor, uint32_t lwe_ciphertext_count,
+    uint32_t message_modulus, uint32_t carry_modulus, PBS_TYPE pbs_type,
+    COMPARISON_TYPE op_type) {
+  return get_scratch_buffer_size<int_comparison_buffer<uint64_t>>(
+      gpu_index,
+      [&](cuda_stream_t *stream, int8_t **mem_ptr) {
+        scratch_cuda_integer_radix_comparison_kb_64(
+            stream, mem_ptr, glwe_dimension, polynomial_size, big_lwe_dimension,
+            small_lwe_dimension, ks_level, ks_base_log, pbs_level, pbs_base_log,
+            grouping_factor, lwe_ciphertext_count, message_modulus,
+            carry_modulus, pbs_type, op_type, true);
+      },
+      cleanup_cuda_integer_comparison);
+}
+
 void cuda_comparison_integer_radix_ciphertext_kb_64(
     cuda_stream_t *stream, void *lwe_array_out, void *lwe_array_1,
     void *lwe_array_2, int8_t *mem_ptr, void *bsk, void *ksk,
@@ -41,37 +60,46 @@ void cuda_comparison_integer_radix_ciphertext_kb_64(
 
   int_comparison_buffer<uint64_t> *buffer =
       (int_comparison_buffer<uint64_t> *)mem_ptr;
-  switch (buffer->op) {
-  case EQ:
-  case NE:
-    host_integer_radix_equality_check_kb<uint64_t>(
-        stream, static_cast<uint64_t *>(lwe_array_out),
-        static_cast<uint64_t *>(lwe_array_1),
-        static_cast<uint64_t *>(lwe_array_2), buffer, bsk,
-        static_cast<uint64_t *>(ksk), lwe_ciphertext_count);
-    break;
-  case GT:
-  case GE:
-  case LT:
-  case LE:
-    host_integer_radix_difference_check_kb<uint64_t>(
-        stream, static_cast<uint64_t *>(lwe_array_out),
-        static_cast<uint64_t *>(lwe_array_1),
-        static_cast<uint64_t *>(lwe_array_2), buffer,
-        buffer->diff_buffer->operator_f, bsk, static_cast<uint64_t *>(ksk),
-        lwe_ciphertext_count);
-    break;
-  case MAX:
-  case MIN:
-    host_integer_radix_maxmin_kb<uint64_t>(
-        stream, static_cast<uint64_t *>(lwe_array_out),
-        static_cast<uint64_t *>(lwe_array_1),
-        static_cast<uint64_t *>(lwe_array_2), buffer, bsk,
-        static_cast<uint64_t *>(ksk), lwe_ciphertext_count);
-    break;
-  default:
-    printf("Not implemented\n");
-  }
+  auto compare = [&]() {
+    switch (buffer->op) {
+    case EQ:
+    case NE:
+      host_integer_radix_equality_check_kb<uint64_t>(
+          stream, static_cast<uint64_t *>(lwe_array_out),
+          static_cast<uint64_t *>(lwe_array_1),
+          static_cast<uint64_t *>(lwe_array_2), buffer, bsk,
+          static_cast<uint64_t *>(ksk), lwe_ciphertext_count);
+      break;
+    case GT:
+    case GE:
+    case LT:
+    case LE:
+      host_integer_radix_difference_check_kb<uint64_t>(
+          stream, static_cast<uint64_t *>(lwe_array_out),
+          static_cast<uint64_t *>(lwe_array_1),
+          static_cast<uint64_t *>(lwe_array_2), buffer,
+          buffer->diff_buffer->operator_f, bsk, static_cast<uint64_t *>(ksk),
+          lwe_ciphertext_count);
+      break;
+    case MAX:
+    case MIN:
+      host_integer_radix_maxmin_kb<uint64_t>(
+          stream, static_cast<uint64_t *>(lwe_array_out),
+          static_cast<uint64_t *>(lwe_array_1),
+          static_cast<uint64_t *>(lwe_array_2), buffer, bsk,
+          static_cast<uint64_t *>(ksk), lwe_ciphertext_count);
+      break;
+    default:
+      printf("Not implemented\n");
+    }
+  };
+
+  if (buffer->graph != nullptr)
+    buffer->graph->run(stream, {lwe_ciphertext_count},
+                       {lwe_array_out, lwe_array_1, lwe_array_2, bsk, ksk},
+                       compare);
+  else
+    compare();
 }
 
 void cleanup_cuda_integer_comparison(cuda_stream_t *stream,
@@ -81,3 +109,24 @@ void cleanup_cuda_integer_comparison(cuda_stream_t *stream,
       (int_comparison_buffer<uint64_t> *)(*mem_ptr_void);
   mem_ptr->release(stream);
 }
+
+/*
+ * Makes the comparisons executed with 'mem_ptr' go through a CUDA graph, see
+ * enable_graph_cuda_integer_mult. MAX and MIN always run eagerly since their
+ * selection synchronizes its own streams.
+ */
+void enable_graph_cuda_integer_comparison(cuda_stream_t *stream,
+                                          int8_t *mem_ptr) {
+  auto buffer = (int_comparison_buffer<uint64_t> *)mem_ptr;
+  if (buffer->op == MAX || buffer->op == MIN)
+    return;
+  if (buffer->graph == nullptr && cuda_graph_capture_supported())
+    buffer->graph = new graph_cache(new device_graph_launcher, true);
+}
+
+void invalidate_graph_cuda_integer_comparison(cuda_stream_t *stream,
+                                              int8_t *mem_ptr) {
+  auto buffer = (int_comparison_buffer<uint64_t> *)mem_ptr;
+  if (buffer->graph != nullptr)
+    buffer->graph->invalidate(stream);
+}
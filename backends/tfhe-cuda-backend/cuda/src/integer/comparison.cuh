@@ -70,7 +70,6 @@ are_all_comparisons_block_true(cuda_stream_t *stream, Torus *lwe_array_out,
       lwe_array_out, lwe_array_in,
       num_radix_blocks * (big_lwe_dimension + 1) * sizeof(Torus), stream);
 
-  int lut_num_blocks = 0;
   uint32_t remaining_blocks = num_radix_blocks;
   while (remaining_blocks > 1) {
     // Split in max_value chunks
@@ -102,7 +101,8 @@ are_all_comparisons_block_true(cuda_stream_t *stream, Torus *lwe_array_out,
     } else {
       // is_equal_to_num_blocks LUT
       lut = are_all_block_true_buffer->is_equal_to_num_blocks_lut;
-      if (chunk_length != lut_num_blocks) {
+      if (chunk_length !=
+          are_all_block_true_buffer->is_equal_to_num_blocks_lut_blocks) {
         auto is_equal_to_num_blocks_lut_f = [max_value,
                                              chunk_length](Torus x) -> Torus {
           return (x & max_value) == chunk_length;
@@ -111,8 +111,10 @@ are_all_comparisons_block_true(cuda_stream_t *stream, Torus *lwe_array_out,
             stream, lut->lut, glwe_dimension, polynomial_size, message_modulus,
             carry_modulus, is_equal_to_num_blocks_lut_f);
 
-        // We don't have to generate this lut again
-        lut_num_blocks = chunk_length;
+        // We don't have to generate this lut again, in this call or the
+        // next ones
+        are_all_block_true_buffer->is_equal_to_num_blocks_lut_blocks =
+            chunk_length;
       }
     }
 
@@ -300,7 +302,8 @@ tree_sign_reduction(cuda_stream_t *stream, Torus *lwe_array_out,
                     Torus *lwe_block_comparisons,
                     int_tree_sign_reduction_buffer<Torus> *tree_buffer,
                     std::function<Torus(Torus)> sign_handler_f, void *bsk,
-                    Torus *ksk, uint32_t num_radix_blocks) {
+                    Torus *ksk, uint32_t num_radix_blocks,
+                    bool reuse_last_leaf_lut = false) {
 
   auto params = tree_buffer->params;
   auto big_lwe_dimension = params.big_lwe_dimension;
@@ -364,9 +367,17 @@ tree_sign_reduction(cuda_stream_t *stream, Torus *lwe_array_out,
     y = x;
     f = sign_handler_f;
   }
-  generate_device_accumulator<Torus>(stream, last_lut->lut, glwe_dimension,
-                                     polynomial_size, message_modulus,
-                                     carry_modulus, f);
+  // The last leaf LUT only depends on sign_handler_f and on the number of
+  // blocks left. Callers that always pass the same sign_handler_f for this
+  // tree_buffer can skip generating it again.
+  if (!reuse_last_leaf_lut ||
+      tree_buffer->tree_last_leaf_lut_blocks != partial_block_count) {
+    generate_device_accumulator<Torus>(stream, last_lut->lut, glwe_dimension,
+                                       polynomial_size, message_modulus,
+                                       carry_modulus, f);
+    tree_buffer->tree_last_leaf_lut_blocks =
+        reuse_last_leaf_lut ? partial_block_count : 0;
+  }
 
   // Last leaf
   integer_radix_apply_univariate_lookup_table_kb(stream, lwe_array_out, y, bsk,
@@ -426,9 +437,10 @@ __host__ void host_integer_radix_difference_check_kb(
   // Reduces a vec containing radix blocks that encrypts a sign
   // (inferior, equal, superior) to one single radix block containing the
   // final sign
+  // reduction_lut_f is fixed by the operation of the buffer
   tree_sign_reduction(stream, lwe_array_out, comparisons,
                       mem_ptr->diff_buffer->tree_buffer, reduction_lut_f, bsk,
-                      ksk, num_radix_blocks);
+                      ksk, num_radix_blocks, true);
 
   // The result will be in the first block. Everything else is garbage.
   size_t big_lwe_size = big_lwe_dimension + 1;
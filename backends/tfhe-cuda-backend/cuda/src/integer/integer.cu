@@ -1,5 +1,27 @@
 #include "integer/integer.cuh"
 #include <linear_algebra.h>
+#include <polynomial_size_dispatch.h>
+
+/*
+ * Full propagation for a given polynomial size, looked up through
+ * polynomial_size_dispatch
+ */
+template <typename Torus, typename STorus> struct full_propagation {
+  template <int N> struct launch {
+    static void run(cuda_stream_t *stream, void *input_blocks, int8_t *mem_ptr,
+                    void *ksk, void *bsk, uint32_t lwe_dimension,
+                    uint32_t glwe_dimension, uint32_t polynomial_size,
+                    uint32_t ks_base_log, uint32_t ks_level,
+                    uint32_t pbs_base_log, uint32_t pbs_level,
+                    uint32_t grouping_factor, uint32_t num_blocks) {
+      host_full_propagate_inplace<Torus, STorus, AmortizedDegree<N>>(
+          stream, static_cast<Torus *>(input_blocks),
+          (int_fullprop_buffer<Torus> *)mem_ptr, static_cast<Torus *>(ksk),
+          bsk, lwe_dimension, glwe_dimension, polynomial_size, ks_base_log,
+          ks_level, pbs_base_log, pbs_level, grouping_factor, num_blocks);
+    }
+  };
+};
 
 void cuda_full_propagation_64_inplace(
     cuda_stream_t *stream, void *input_blocks, int8_t *mem_ptr, void *ksk,
@@ -8,59 +30,10 @@ void cuda_full_propagation_64_inplace(
     uint32_t pbs_base_log, uint32_t pbs_level, uint32_t grouping_factor,
     uint32_t num_blocks) {
 
-  switch (polynomial_size) {
-  case 256:
-    host_full_propagate_inplace<uint64_t, int64_t, AmortizedDegree<256>>(
-        stream, static_cast<uint64_t *>(input_blocks),
-        (int_fullprop_buffer<uint64_t> *)mem_ptr, static_cast<uint64_t *>(ksk),
-        bsk, lwe_dimension, glwe_dimension, polynomial_size, ks_base_log,
-        ks_level, pbs_base_log, pbs_level, grouping_factor, num_blocks);
-    break;
-  case 512:
-    host_full_propagate_inplace<uint64_t, int64_t, AmortizedDegree<512>>(
-        stream, static_cast<uint64_t *>(input_blocks),
-        (int_fullprop_buffer<uint64_t> *)mem_ptr, static_cast<uint64_t *>(ksk),
-        bsk, lwe_dimension, glwe_dimension, polynomial_size, ks_base_log,
-        ks_level, pbs_base_log, pbs_level, grouping_factor, num_blocks);
-    break;
-  case 1024:
-    host_full_propagate_inplace<uint64_t, int64_t, AmortizedDegree<1024>>(
-        stream, static_cast<uint64_t *>(input_blocks),
-        (int_fullprop_buffer<uint64_t> *)mem_ptr, static_cast<uint64_t *>(ksk),
-        bsk, lwe_dimension, glwe_dimension, polynomial_size, ks_base_log,
-        ks_level, pbs_base_log, pbs_level, grouping_factor, num_blocks);
-    break;
-  case 2048:
-    host_full_propagate_inplace<uint64_t, int64_t, AmortizedDegree<2048>>(
-        stream, static_cast<uint64_t *>(input_blocks),
-        (int_fullprop_buffer<uint64_t> *)mem_ptr, static_cast<uint64_t *>(ksk),
-        bsk, lwe_dimension, glwe_dimension, polynomial_size, ks_base_log,
-        ks_level, pbs_base_log, pbs_level, grouping_factor, num_blocks);
-    break;
-  case 4096:
-    host_full_propagate_inplace<uint64_t, int64_t, AmortizedDegree<4096>>(
-        stream, static_cast<uint64_t *>(input_blocks),
-        (int_fullprop_buffer<uint64_t> *)mem_ptr, static_cast<uint64_t *>(ksk),
-        bsk, lwe_dimension, glwe_dimension, polynomial_size, ks_base_log,
-        ks_level, pbs_base_log, pbs_level, grouping_factor, num_blocks);
-    break;
-  case 8192:
-    host_full_propagate_inplace<uint64_t, int64_t, AmortizedDegree<8192>>(
-        stream, static_cast<uint64_t *>(input_blocks),
-        (int_fullprop_buffer<uint64_t> *)mem_ptr, static_cast<uint64_t *>(ksk),
-        bsk, lwe_dimension, glwe_dimension, polynomial_size, ks_base_log,
-        ks_level, pbs_base_log, pbs_level, grouping_factor, num_blocks);
-    break;
-  case 16384:
-    host_full_propagate_inplace<uint64_t, int64_t, AmortizedDegree<16384>>(
-        stream, static_cast<uint64_t *>(input_blocks),
-        (int_fullprop_buffer<uint64_t> *)mem_ptr, static_cast<uint64_t *>(ksk),
-        bsk, lwe_dimension, glwe_dimension, polynomial_size, ks_base_log,
-        ks_level, pbs_base_log, pbs_level, grouping_factor, num_blocks);
-    break;
-  default:
-    break;
-  }
+  polynomial_size_dispatch<full_propagation<uint64_t, int64_t>::launch>::run(
+      polynomial_size, stream, input_blocks, mem_ptr, ksk, bsk, lwe_dimension,
+      glwe_dimension, polynomial_size, ks_base_log, ks_level, pbs_base_log,
+      pbs_level, grouping_factor, num_blocks);
 }
 
 void scratch_cuda_full_propagation_64(
@@ -77,6 +50,22 @@ void scratch_cuda_full_propagation_64(
       allocate_gpu_memory);
 }
 
+uint64_t get_buffer_size_full_propagation_64(
+    uint32_t gpu_index, uint32_t lwe_dimension, uint32_t glwe_dimension,
+    uint32_t polynomial_size, uint32_t level_count, uint32_t grouping_factor,
+    uint32_t input_lwe_ciphertext_count, uint32_t message_modulus,
+    uint32_t carry_modulus, PBS_TYPE pbs_type) {
+  return get_scratch_buffer_size<int_fullprop_buffer<uint64_t>>(
+      gpu_index,
+      [&](cuda_stream_t *stream, int8_t **mem_ptr) {
+        scratch_cuda_full_propagation_64(
+            stream, mem_ptr, lwe_dimension, glwe_dimension, polynomial_size,
+            level_count, grouping_factor, input_lwe_ciphertext_count,
+            message_modulus, carry_modulus, pbs_type, true);
+      },
+      cleanup_cuda_full_propagation);
+}
+
 void cleanup_cuda_full_propagation(cuda_stream_t *stream,
                                    int8_t **mem_ptr_void) {
 
@@ -98,7 +87,7 @@ void scratch_cuda_propagate_single_carry_low_latency_kb_64_inplace(
     uint32_t small_lwe_dimension, uint32_t ks_level, uint32_t ks_base_log,
     uint32_t pbs_level, uint32_t pbs_base_log, uint32_t grouping_factor,
     uint32_t num_blocks, uint32_t message_modulus, uint32_t carry_modulus,
-    PBS_TYPE pbs_type, bool allocate_gpu_memory) {
+    PBS_TYPE pbs_type, CARRY_SCAN_TYPE scan_type, bool allocate_gpu_memory) {
 
   int_radix_params params(pbs_type, glwe_dimension, polynomial_size,
                           big_lwe_dimension, small_lwe_dimension, ks_level,
@@ -107,16 +96,41 @@ void scratch_cuda_propagate_single_carry_low_latency_kb_64_inplace(
 
   scratch_cuda_propagate_single_carry_low_latency_kb_inplace(
       stream, (int_sc_prop_memory<uint64_t> **)mem_ptr, num_blocks, params,
-      allocate_gpu_memory);
+      scan_type, allocate_gpu_memory);
+}
+
+uint64_t get_buffer_size_propagate_single_carry_low_latency_kb_64_inplace(
+    uint32_t gpu_index, uint32_t glwe_dimension, uint32_t polynomial_size,
+    uint32_t big_lwe_dimension, uint32_t small_lwe_dimension, uint32_t ks_level,
+    uint32_t ks_base_log, uint32_t pbs_level, uint32_t pbs_base_log,
+    uint32_t grouping_factor, uint32_t num_blocks, uint32_t message_modulus,
+    uint32_t carry_modulus, PBS_TYPE pbs_type, CARRY_SCAN_TYPE scan_type) {
+  return get_scratch_buffer_size<int_sc_prop_memory<uint64_t>>(
+      gpu_index,
+      [&](cuda_stream_t *stream, int8_t **mem_ptr) {
+        scratch_cuda_propagate_single_carry_low_latency_kb_64_inplace(
+            stream, mem_ptr, glwe_dimension, polynomial_size, big_lwe_dimension,
+            small_lwe_dimension, ks_level, ks_base_log, pbs_level, pbs_base_log,
+            grouping_factor, num_blocks, message_modulus, carry_modulus,
+            pbs_type, scan_type, true);
+      },
+      cleanup_cuda_propagate_single_carry_low_latency);
 }
 
 void cuda_propagate_single_carry_low_latency_kb_64_inplace(
     cuda_stream_t *stream, void *lwe_array, int8_t *mem_ptr, void *bsk,
     void *ksk, uint32_t num_blocks) {
-  host_propagate_single_carry_low_latency<uint64_t>(
-      stream, static_cast<uint64_t *>(lwe_array),
-      (int_sc_prop_memory<uint64_t> *)mem_ptr, bsk,
-      static_cast<uint64_t *>(ksk), num_blocks);
+  auto mem = (int_sc_prop_memory<uint64_t> *)mem_ptr;
+  auto propagate = [&]() {
+    host_propagate_single_carry_low_latency<uint64_t>(
+        stream, static_cast<uint64_t *>(lwe_array), mem, bsk,
+        static_cast<uint64_t *>(ksk), num_blocks);
+  };
+
+  if (mem->graph != nullptr)
+    mem->graph->run(stream, {num_blocks}, {lwe_array, bsk, ksk}, propagate);
+  else
+    propagate();
 }
 
 void cleanup_cuda_propagate_single_carry_low_latency(cuda_stream_t *stream,
@@ -125,3 +139,74 @@ void cleanup_cuda_propagate_single_carry_low_latency(cuda_stream_t *stream,
       (int_sc_prop_memory<uint64_t> *)(*mem_ptr_void);
   mem_ptr->release(stream);
 }
+
+/*
+ * Makes the carry propagations executed with 'mem_ptr' go through a CUDA
+ * graph, see enable_graph_cuda_integer_mult
+ */
+void enable_graph_cuda_propagate_single_carry_low_latency(
+    cuda_stream_t *stream, int8_t *mem_ptr) {
+  auto mem = (int_sc_prop_memory<uint64_t> *)mem_ptr;
+  if (mem->graph == nullptr && cuda_graph_capture_supported())
+    mem->graph = new graph_cache(new device_graph_launcher, true);
+}
+
+void invalidate_graph_cuda_propagate_single_carry_low_latency(
+    cuda_stream_t *stream, int8_t *mem_ptr) {
+  auto mem = (int_sc_prop_memory<uint64_t> *)mem_ptr;
+  if (mem->graph != nullptr)
+    mem->graph->invalidate(stream);
+}
+
+void scratch_cuda_full_propagation_tree_kb_64_inplace(
+    cuda_stream_t *stream, int8_t **mem_ptr, uint32_t glwe_dimension,
+    uint32_t polynomial_size, uint32_t big_lwe_dimension,
+    uint32_t small_lwe_dimension, uint32_t ks_level, uint32_t ks_base_log,
+    uint32_t pbs_level, uint32_t pbs_base_log, uint32_t grouping_factor,
+    uint32_t num_blocks, uint32_t message_modulus, uint32_t carry_modulus,
+    PBS_TYPE pbs_type, bool allocate_gpu_memory) {
+
+  int_radix_params params(pbs_type, glwe_dimension, polynomial_size,
+                          big_lwe_dimension, small_lwe_dimension, ks_level,
+                          ks_base_log, pbs_level, pbs_base_log, grouping_factor,
+                          message_modulus, carry_modulus);
+
+  scratch_cuda_full_propagation_tree_kb_inplace(
+      stream, (int_fullprop_tree_memory<uint64_t> **)mem_ptr, num_blocks,
+      params, allocate_gpu_memory);
+}
+
+uint64_t get_buffer_size_full_propagation_tree_kb_64_inplace(
+    uint32_t gpu_index, uint32_t glwe_dimension, uint32_t polynomial_size,
+    uint32_t big_lwe_dimension, uint32_t small_lwe_dimension, uint32_t ks_level,
+    uint32_t ks_base_log, uint32_t pbs_level, uint32_t pbs_base_log,
+    uint32_t grouping_factor, uint32_t num_blocks, uint32_t message_modulus,
+    uint32_t carry_modulus, PBS_TYPE pbs_type) {
+  return get_scratch_buffer_size<int_fullprop_tree_memory<uint64_t>>(
+      gpu_index,
+      [&](cuda_stream_t *stream, int8_t **mem_ptr) {
+        scratch_cuda_full_propagation_tree_kb_64_inplace(
+            stream, mem_ptr, glwe_dimension, polynomial_size, big_lwe_dimension,
+            small_lwe_dimension, ks_level, ks_base_log, pbs_level, pbs_base_log,
+            grouping_factor, num_blocks, message_modulus, carry_modulus,
+            pbs_type, true);
+      },
+      cleanup_cuda_full_propagation_tree);
+}
+
+void cuda_full_propagation_tree_kb_64_inplace(cuda_stream_t *stream,
+                                              void *lwe_array, int8_t *mem_ptr,
+                                              void *bsk, void *ksk,
+                                              uint32_t num_blocks) {
+  host_full_propagate_tree_inplace<uint64_t>(
+      stream, static_cast<uint64_t *>(lwe_array),
+      (int_fullprop_tree_memory<uint64_t> *)mem_ptr, bsk,
+      static_cast<uint64_t *>(ksk), num_blocks);
+}
+
+void cleanup_cuda_full_propagation_tree(cuda_stream_t *stream,
+                                        int8_t **mem_ptr_void) {
+  int_fullprop_tree_memory<uint64_t> *mem_ptr =
+      (int_fullprop_tree_memory<uint64_t> *)(*mem_ptr_void);
+  mem_ptr->release(stream);
+}
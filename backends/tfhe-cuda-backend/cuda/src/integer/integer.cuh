@@ -7,12 +7,19 @@
 #include "integer/scalar_addition.cuh"
 #include "linear_algebra.h"
 #include "linearalgebra/addition.cuh"
+#include "many_lut.h"
 #include "pbs/bootstrap_low_latency.cuh"
 #include "pbs/bootstrap_multibit.cuh"
 #include "polynomial/functions.cuh"
 #include "utils/kernel_dimensions.cuh"
 #include <functional>
 
+// Samples come in runs of num_samples_per_input consecutive samples reading
+// the same input LWE, which the multi-bit PBS bootstraps with a single
+// keybundle computation per run. The other PBS types ignore it.
+// With num_many_lut > 1, each LUT packs num_many_lut functions lut_stride
+// coefficients apart (see many_lut.h) and lwe_array_out receives
+// num_many_lut * input_lwe_ciphertext_count LWEs.
 template <typename Torus>
 void execute_pbs(cuda_stream_t *stream, Torus *lwe_array_out,
                  Torus *lwe_output_indexes, Torus *lut_vector,
@@ -23,15 +30,48 @@ void execute_pbs(cuda_stream_t *stream, Torus *lwe_array_out,
                  uint32_t base_log, uint32_t level_count,
                  uint32_t grouping_factor, uint32_t input_lwe_ciphertext_count,
                  uint32_t num_lut_vectors, uint32_t lwe_idx,
-                 uint32_t max_shared_memory, PBS_TYPE pbs_type) {
+                 uint32_t max_shared_memory, PBS_TYPE pbs_type,
+                 uint32_t num_samples_per_input = 1,
+                 uint32_t num_many_lut = 1, uint32_t lut_stride = 0) {
+  assert(("Error (GPU PBS): many-LUT accumulators are not supported by the "
+          "amortized PBS",
+          num_many_lut == 1 || pbs_type != AMORTIZED));
+  assert(("Error (GPU PBS): many-LUT accumulators can't be combined with "
+          "shared inputs",
+          num_many_lut == 1 || num_samples_per_input == 1));
   if (sizeof(Torus) == sizeof(uint32_t)) {
     // 32 bits
     switch (pbs_type) {
     case MULTI_BIT:
-      printf("multibit\n");
-      printf("Error: 32-bit multibit PBS is not supported.\n");
+      if (num_many_lut > 1) {
+        cuda_multi_bit_pbs_many_lut_lwe_ciphertext_vector_32(
+            stream, lwe_array_out, lwe_output_indexes, lut_vector,
+            lut_vector_indexes, lwe_array_in, lwe_input_indexes,
+            bootstrapping_key, pbs_buffer, lwe_dimension, glwe_dimension,
+            polynomial_size, grouping_factor, base_log, level_count,
+            input_lwe_ciphertext_count, num_lut_vectors, lwe_idx,
+            max_shared_memory, num_many_lut, lut_stride);
+        break;
+      }
+      cuda_multi_bit_pbs_shared_input_lwe_ciphertext_vector_32(
+          stream, lwe_array_out, lwe_output_indexes, lut_vector,
+          lut_vector_indexes, lwe_array_in, lwe_input_indexes,
+          bootstrapping_key, pbs_buffer, lwe_dimension, glwe_dimension,
+          polynomial_size, grouping_factor, base_log, level_count,
+          input_lwe_ciphertext_count, num_samples_per_input, num_lut_vectors,
+          lwe_idx, max_shared_memory);
       break;
     case LOW_LAT:
+      if (num_many_lut > 1) {
+        cuda_bootstrap_low_latency_many_lut_lwe_ciphertext_vector_32(
+            stream, lwe_array_out, lwe_output_indexes, lut_vector,
+            lut_vector_indexes, lwe_array_in, lwe_input_indexes,
+            bootstrapping_key, pbs_buffer, lwe_dimension, glwe_dimension,
+            polynomial_size, base_log, level_count, input_lwe_ciphertext_count,
+            num_lut_vectors, lwe_idx, max_shared_memory, num_many_lut,
+            lut_stride);
+        break;
+      }
       cuda_bootstrap_low_latency_lwe_ciphertext_vector_32(
           stream, lwe_array_out, lwe_output_indexes, lut_vector,
           lut_vector_indexes, lwe_array_in, lwe_input_indexes,
@@ -54,15 +94,35 @@ void execute_pbs(cuda_stream_t *stream, Torus *lwe_array_out,
     // 64 bits
     switch (pbs_type) {
     case MULTI_BIT:
-      cuda_multi_bit_pbs_lwe_ciphertext_vector_64(
+      if (num_many_lut > 1) {
+        cuda_multi_bit_pbs_many_lut_lwe_ciphertext_vector_64(
+            stream, lwe_array_out, lwe_output_indexes, lut_vector,
+            lut_vector_indexes, lwe_array_in, lwe_input_indexes,
+            bootstrapping_key, pbs_buffer, lwe_dimension, glwe_dimension,
+            polynomial_size, grouping_factor, base_log, level_count,
+            input_lwe_ciphertext_count, num_lut_vectors, lwe_idx,
+            max_shared_memory, num_many_lut, lut_stride);
+        break;
+      }
+      cuda_multi_bit_pbs_shared_input_lwe_ciphertext_vector_64(
           stream, lwe_array_out, lwe_output_indexes, lut_vector,
           lut_vector_indexes, lwe_array_in, lwe_input_indexes,
           bootstrapping_key, pbs_buffer, lwe_dimension, glwe_dimension,
           polynomial_size, grouping_factor, base_log, level_count,
-          input_lwe_ciphertext_count, num_lut_vectors, lwe_idx,
-          max_shared_memory);
+          input_lwe_ciphertext_count, num_samples_per_input, num_lut_vectors,
+          lwe_idx, max_shared_memory);
       break;
     case LOW_LAT:
+      if (num_many_lut > 1) {
+        cuda_bootstrap_low_latency_many_lut_lwe_ciphertext_vector_64(
+            stream, lwe_array_out, lwe_output_indexes, lut_vector,
+            lut_vector_indexes, lwe_array_in, lwe_input_indexes,
+            bootstrapping_key, pbs_buffer, lwe_dimension, glwe_dimension,
+            polynomial_size, base_log, level_count, input_lwe_ciphertext_count,
+            num_lut_vectors, lwe_idx, max_shared_memory, num_many_lut,
+            lut_stride);
+        break;
+      }
       cuda_bootstrap_low_latency_lwe_ciphertext_vector_64(
           stream, lwe_array_out, lwe_output_indexes, lut_vector,
           lut_vector_indexes, lwe_array_in, lwe_input_indexes,
@@ -148,6 +208,60 @@ device_pack_bivariate_blocks(Torus *lwe_array_out, Torus *lwe_array_1,
   }
 }
 
+// Packs the (dst, src) pairs of a carry scan round as bivariate blocks,
+// lwe_array_out[k] = flags[dst_indexes[k]] * message_modulus +
+// flags[src_indexes[k]]
+template <typename Torus>
+__global__ void
+device_pack_carry_scan_pairs(Torus *lwe_array_out, Torus *flags,
+                             Torus *dst_indexes, Torus *src_indexes,
+                             uint32_t lwe_dimension, uint32_t message_modulus,
+                             uint32_t num_pairs) {
+  int tid = threadIdx.x + blockIdx.x * blockDim.x;
+
+  if (tid < num_pairs * (lwe_dimension + 1)) {
+    int pair_id = tid / (lwe_dimension + 1);
+    int coeff_id = tid % (lwe_dimension + 1);
+
+    auto msb = &flags[dst_indexes[pair_id] * (lwe_dimension + 1)];
+    auto lsb = &flags[src_indexes[pair_id] * (lwe_dimension + 1)];
+    lwe_array_out[tid] = msb[coeff_id] * message_modulus + lsb[coeff_id];
+  }
+}
+
+// lwe_array_out[indexes[k]] = lwe_array_in[k]
+template <typename Torus>
+__global__ void device_scatter_blocks(Torus *lwe_array_out,
+                                      Torus *lwe_array_in, Torus *indexes,
+                                      uint32_t lwe_dimension,
+                                      uint32_t num_blocks) {
+  int tid = threadIdx.x + blockIdx.x * blockDim.x;
+
+  if (tid < num_blocks * (lwe_dimension + 1)) {
+    int block_id = tid / (lwe_dimension + 1);
+    int coeff_id = tid % (lwe_dimension + 1);
+
+    lwe_array_out[indexes[block_id] * (lwe_dimension + 1) + coeff_id] =
+        lwe_array_in[tid];
+  }
+}
+
+// lwe_array_out[k] = lwe_array_in[indexes[k]]
+template <typename Torus>
+__global__ void device_gather_blocks(Torus *lwe_array_out, Torus *lwe_array_in,
+                                     Torus *indexes, uint32_t lwe_dimension,
+                                     uint32_t num_blocks) {
+  int tid = threadIdx.x + blockIdx.x * blockDim.x;
+
+  if (tid < num_blocks * (lwe_dimension + 1)) {
+    int block_id = tid / (lwe_dimension + 1);
+    int coeff_id = tid % (lwe_dimension + 1);
+
+    lwe_array_out[tid] =
+        lwe_array_in[indexes[block_id] * (lwe_dimension + 1) + coeff_id];
+  }
+}
+
 template <typename Torus>
 __host__ void pack_bivariate_blocks(cuda_stream_t *stream, Torus *lwe_array_out,
                                     Torus *lwe_array_1, Torus *lwe_array_2,
@@ -183,6 +297,18 @@ __host__ void integer_radix_apply_univariate_lookup_table_kb(
   auto grouping_factor = params.grouping_factor;
 
   // Compute Keyswitch-PBS
+  if (pbs_type == LOW_LAT && sizeof(Torus) == sizeof(uint64_t)) {
+    // Fused into a single kernel when possible
+    cuda_keyswitch_bootstrap_low_latency_lwe_ciphertext_vector_64(
+        stream, lwe_array_out, lut->lwe_indexes, lut->lut, lut->lut_indexes,
+        lwe_array_in, lut->lwe_indexes, ksk, bsk, lut->pbs_buffer,
+        lut->tmp_lwe_after_ks, big_lwe_dimension, small_lwe_dimension,
+        glwe_dimension, polynomial_size, ks_base_log, ks_level, pbs_base_log,
+        pbs_level, num_radix_blocks, 1, 0,
+        cuda_get_max_shared_memory(stream->gpu_index));
+    return;
+  }
+
   cuda_keyswitch_lwe_ciphertext_vector(
       stream, lut->tmp_lwe_after_ks, lut->lwe_indexes, lwe_array_in,
       lut->lwe_indexes, ksk, big_lwe_dimension, small_lwe_dimension,
@@ -196,6 +322,37 @@ __host__ void integer_radix_apply_univariate_lookup_table_kb(
               cuda_get_max_shared_memory(stream->gpu_index), pbs_type);
 }
 
+// Evaluates the num_many_lut functions packed in each LUT of lut (see
+// generate_device_many_lut_accumulator) with one PBS per block. Inputs must be
+// smaller than get_many_lut_input_modulus. lwe_array_out receives
+// num_many_lut * num_radix_blocks blocks, function i of block j being at
+// index i * num_radix_blocks + j.
+template <typename Torus>
+__host__ void integer_radix_apply_many_univariate_lookup_table_kb(
+    cuda_stream_t *stream, Torus *lwe_array_out, Torus *lwe_array_in, void *bsk,
+    Torus *ksk, uint32_t num_radix_blocks, int_radix_lut<Torus> *lut,
+    uint32_t num_many_lut, uint32_t lut_stride) {
+  auto params = lut->params;
+  auto big_lwe_dimension = params.big_lwe_dimension;
+  auto small_lwe_dimension = params.small_lwe_dimension;
+  auto glwe_dimension = params.glwe_dimension;
+  auto polynomial_size = params.polynomial_size;
+
+  // The fused keyswitch-PBS kernel extracts a single function
+  cuda_keyswitch_lwe_ciphertext_vector(
+      stream, lut->tmp_lwe_after_ks, lut->lwe_indexes, lwe_array_in,
+      lut->lwe_indexes, ksk, big_lwe_dimension, small_lwe_dimension,
+      params.ks_base_log, params.ks_level, num_radix_blocks);
+
+  execute_pbs(stream, lwe_array_out, lut->lwe_indexes, lut->lut,
+              lut->lut_indexes, lut->tmp_lwe_after_ks, lut->lwe_indexes, bsk,
+              lut->pbs_buffer, glwe_dimension, small_lwe_dimension,
+              polynomial_size, params.pbs_base_log, params.pbs_level,
+              params.grouping_factor, num_radix_blocks, 1, 0,
+              cuda_get_max_shared_memory(stream->gpu_index), params.pbs_type,
+              1, num_many_lut, lut_stride);
+}
+
 template <typename Torus>
 __host__ void integer_radix_apply_bivariate_lookup_table_kb(
     cuda_stream_t *stream, Torus *lwe_array_out, Torus *lwe_array_1,
@@ -219,48 +376,13 @@ __host__ void integer_radix_apply_bivariate_lookup_table_kb(
                                                  ksk, num_radix_blocks, lut);
 }
 
-// Rotates the slice in-place such that the first mid elements of the slice move
-// to the end while the last array_length elements move to the front. After
-// calling rotate_left, the element previously at index mid will become the
-// first element in the slice.
-template <typename Torus>
-void rotate_left(Torus *buffer, int mid, uint32_t array_length) {
-  mid = mid % array_length;
-
-  std::rotate(buffer, buffer + mid, buffer + array_length);
-}
-
 template <typename Torus>
 void generate_lookup_table(Torus *acc, uint32_t glwe_dimension,
                            uint32_t polynomial_size, uint32_t message_modulus,
                            uint32_t carry_modulus,
                            std::function<Torus(Torus)> f) {
-
-  uint32_t modulus_sup = message_modulus * carry_modulus;
-  uint32_t box_size = polynomial_size / modulus_sup;
-  Torus delta = (1ul << 63) / modulus_sup;
-
-  memset(acc, 0, glwe_dimension * polynomial_size * sizeof(Torus));
-
-  auto body = &acc[glwe_dimension * polynomial_size];
-
-  // This accumulator extracts the carry bits
-  for (int i = 0; i < modulus_sup; i++) {
-    int index = i * box_size;
-    for (int j = index; j < index + box_size; j++) {
-      auto f_eval = f(i);
-      body[j] = f_eval * delta;
-    }
-  }
-
-  int half_box_size = box_size / 2;
-
-  // Negate the first half_box_size coefficients
-  for (int i = 0; i < half_box_size; i++) {
-    body[i] = -body[i];
-  }
-
-  rotate_left(body, half_box_size, polynomial_size);
+  generate_many_lookup_table<Torus>(acc, glwe_dimension, polynomial_size,
+                                    message_modulus, carry_modulus, {f});
 }
 
 template <typename Torus>
@@ -304,11 +426,11 @@ void generate_device_accumulator_bivariate(
                                          message_modulus, carry_modulus, f);
 
   // copy host lut and tvi to device
-  cuda_memcpy_async_to_gpu(
+  // h_lut can be freed right away since the copy goes through the staging pool
+  cuda_memcpy_async_to_gpu_staged(
       acc_bivariate, h_lut,
       (glwe_dimension + 1) * polynomial_size * sizeof(Torus), stream);
 
-  cuda_synchronize_stream(stream);
   free(h_lut);
 }
 
@@ -336,11 +458,41 @@ void generate_device_accumulator(cuda_stream_t *stream, Torus *acc,
                                message_modulus, carry_modulus, f);
 
   // copy host lut and tvi to device
-  cuda_memcpy_async_to_gpu(
+  // h_lut can be freed right away since the copy goes through the staging pool
+  cuda_memcpy_async_to_gpu_staged(
+      acc, h_lut, (glwe_dimension + 1) * polynomial_size * sizeof(Torus),
+      stream);
+
+  free(h_lut);
+}
+
+/*
+ *  generate many-LUT accumulator for device pointer
+ *    v_stream - cuda stream
+ *    acc - device pointer for accumulator
+ *    ...
+ *    functions - evaluating functions with one Torus input, packed in the
+ *    accumulator as described in many_lut.h
+ */
+template <typename Torus>
+void generate_device_many_lut_accumulator(
+    cuda_stream_t *stream, Torus *acc, uint32_t glwe_dimension,
+    uint32_t polynomial_size, uint32_t message_modulus, uint32_t carry_modulus,
+    const std::vector<std::function<Torus(Torus)>> &functions) {
+
+  // host lut
+  Torus *h_lut =
+      (Torus *)malloc((glwe_dimension + 1) * polynomial_size * sizeof(Torus));
+
+  // fill accumulator
+  generate_many_lookup_table<Torus>(h_lut, glwe_dimension, polynomial_size,
+                                    message_modulus, carry_modulus, functions);
+
+  // h_lut can be freed right away since the copy goes through the staging pool
+  cuda_memcpy_async_to_gpu_staged(
       acc, h_lut, (glwe_dimension + 1) * polynomial_size * sizeof(Torus),
       stream);
 
-  cuda_synchronize_stream(stream);
   free(h_lut);
 }
 
@@ -348,10 +500,10 @@ template <typename Torus>
 void scratch_cuda_propagate_single_carry_low_latency_kb_inplace(
     cuda_stream_t *stream, int_sc_prop_memory<Torus> **mem_ptr,
     uint32_t num_radix_blocks, int_radix_params params,
-    bool allocate_gpu_memory) {
+    CARRY_SCAN_TYPE scan_type, bool allocate_gpu_memory) {
 
   *mem_ptr = new int_sc_prop_memory<Torus>(stream, params, num_radix_blocks,
-                                           allocate_gpu_memory);
+                                           allocate_gpu_memory, scan_type);
 }
 
 template <typename Torus>
@@ -378,26 +530,56 @@ void host_propagate_single_carry_low_latency(cuda_stream_t *stream,
       stream, generates_or_propagates, lwe_array, bsk, ksk, num_blocks,
       test_vector_array);
 
-  // compute prefix sum with hillis&steele
+  if (mem->scan_type == CARRY_SCAN_HILLIS_STEELE) {
+    // compute prefix sum with hillis&steele
 
-  int num_steps = ceil(log2((double)num_blocks));
-  int space = 1;
-  cuda_memcpy_async_gpu_to_gpu(step_output, generates_or_propagates,
-                               big_lwe_size_bytes * num_blocks, stream);
+    int num_steps = ceil(log2((double)num_blocks));
+    int space = 1;
+    cuda_memcpy_async_gpu_to_gpu(step_output, generates_or_propagates,
+                                 big_lwe_size_bytes * num_blocks, stream);
 
-  for (int step = 0; step < num_steps; step++) {
-    auto cur_blocks = &step_output[space * big_lwe_size];
-    auto prev_blocks = generates_or_propagates;
-    int cur_total_blocks = num_blocks - space;
+    for (int step = 0; step < num_steps; step++) {
+      auto cur_blocks = &step_output[space * big_lwe_size];
+      auto prev_blocks = generates_or_propagates;
+      int cur_total_blocks = num_blocks - space;
 
-    integer_radix_apply_bivariate_lookup_table_kb<Torus>(
-        stream, cur_blocks, cur_blocks, prev_blocks, bsk, ksk, cur_total_blocks,
-        lut_carry_propagation_sum);
+      integer_radix_apply_bivariate_lookup_table_kb<Torus>(
+          stream, cur_blocks, cur_blocks, prev_blocks, bsk, ksk,
+          cur_total_blocks, lut_carry_propagation_sum);
 
-    cuda_memcpy_async_gpu_to_gpu(&generates_or_propagates[space * big_lwe_size],
-                                 cur_blocks,
-                                 big_lwe_size_bytes * cur_total_blocks, stream);
-    space *= 2;
+      cuda_memcpy_async_gpu_to_gpu(
+          &generates_or_propagates[space * big_lwe_size], cur_blocks,
+          big_lwe_size_bytes * cur_total_blocks, stream);
+      space *= 2;
+    }
+  } else {
+    // compute prefix sum following the precomputed scan rounds, each round
+    // gathers its pairs, evaluates them as one batch and scatters the results
+    for (auto &round : mem->scan_rounds) {
+      auto dst_indexes = &mem->scan_indexes[round.first];
+      auto src_indexes = &mem->scan_indexes[round.first + round.second];
+      uint32_t num_pairs = round.second;
+
+      int num_cuda_blocks = 0, num_threads = 0;
+      int num_entries = num_pairs * big_lwe_size;
+      getNumBlocksAndThreads(num_entries, 512, num_cuda_blocks, num_threads);
+      device_pack_carry_scan_pairs<<<num_cuda_blocks, num_threads, 0,
+                                     stream->stream>>>(
+          lut_carry_propagation_sum->tmp_lwe_before_ks,
+          generates_or_propagates, dst_indexes, src_indexes,
+          big_lwe_size - 1, message_modulus, num_pairs);
+      check_cuda_error(cudaGetLastError());
+
+      integer_radix_apply_univariate_lookup_table_kb<Torus>(
+          stream, step_output, lut_carry_propagation_sum->tmp_lwe_before_ks,
+          bsk, ksk, num_pairs, lut_carry_propagation_sum);
+
+      device_scatter_blocks<<<num_cuda_blocks, num_threads, 0,
+                              stream->stream>>>(
+          generates_or_propagates, step_output, dst_indexes, big_lwe_size - 1,
+          num_pairs);
+      check_cuda_error(cudaGetLastError());
+    }
   }
 
   radix_blocks_rotate_right<<<num_blocks, 256, 0, stream->stream>>>(
@@ -411,6 +593,67 @@ void host_propagate_single_carry_low_latency(cuda_stream_t *stream,
       stream, lwe_array, lwe_array, bsk, ksk, num_blocks, message_acc);
 }
 
+template <typename Torus>
+void scratch_cuda_full_propagation_tree_kb_inplace(
+    cuda_stream_t *stream, int_fullprop_tree_memory<Torus> **mem_ptr,
+    uint32_t num_radix_blocks, int_radix_params params,
+    bool allocate_gpu_memory) {
+
+  *mem_ptr = new int_fullprop_tree_memory<Torus>(
+      stream, params, num_radix_blocks, allocate_gpu_memory);
+}
+
+/*
+ * Same result as host_full_propagate_inplace, in O(log(num_blocks)) PBS rounds
+ * instead of num_blocks.
+ * Every split round extracts the message and the carry of all blocks in a
+ * single batch of 2 * num_blocks PBS and adds each carry to the next block,
+ * the carry of the last block being dropped. Once every block holds at most
+ * 2 * message_modulus - 2, it outputs at most one carry and the remaining
+ * propagation is done by host_propagate_single_carry_low_latency.
+ * simulate_full_propagation_tree models this on cleartext blocks.
+ */
+template <typename Torus>
+void host_full_propagate_tree_inplace(cuda_stream_t *stream, Torus *lwe_array,
+                                      int_fullprop_tree_memory<Torus> *mem,
+                                      void *bsk, Torus *ksk,
+                                      uint32_t num_blocks) {
+  auto params = mem->params;
+  auto glwe_dimension = params.glwe_dimension;
+  auto polynomial_size = params.polynomial_size;
+  auto big_lwe_size = glwe_dimension * polynomial_size + 1;
+  auto big_lwe_size_bytes = big_lwe_size * sizeof(Torus);
+
+  auto messages = mem->messages_and_carries;
+  auto carries = &mem->messages_and_carries[num_blocks * big_lwe_size];
+
+  for (int round = 0; round < mem->num_split_rounds; round++) {
+    cuda_memcpy_async_gpu_to_gpu(messages, lwe_array,
+                                 big_lwe_size_bytes * num_blocks, stream);
+    cuda_memcpy_async_gpu_to_gpu(carries, lwe_array,
+                                 big_lwe_size_bytes * num_blocks, stream);
+
+    integer_radix_apply_univariate_lookup_table_kb<Torus>(
+        stream, messages, messages, bsk, ksk, 2 * num_blocks,
+        mem->message_carry_lut);
+
+    // The messages are no longer needed once copied back, so their slot
+    // receives the carries shifted by one block
+    cuda_memcpy_async_gpu_to_gpu(lwe_array, messages,
+                                 big_lwe_size_bytes * num_blocks, stream);
+    radix_blocks_rotate_right<<<num_blocks, 256, 0, stream->stream>>>(
+        messages, carries, 1, num_blocks, big_lwe_size);
+    cuda_memset_async(messages, 0, big_lwe_size_bytes, stream);
+
+    host_addition(stream, lwe_array, lwe_array, messages,
+                  glwe_dimension * polynomial_size, num_blocks);
+  }
+
+  host_propagate_single_carry_low_latency<Torus>(stream, lwe_array,
+                                                 mem->sc_prop_mem, bsk, ksk,
+                                                 num_blocks);
+}
+
 /*
  * input_blocks: input radix ciphertext propagation will happen inplace
  * acc_message_carry: list of two lut s, [(message_acc), (carry_acc)]
@@ -446,13 +689,14 @@ void host_full_propagate_inplace(cuda_stream_t *stream, Torus *input_blocks,
                                  mem_ptr->tmp_small_lwe_vector,
                                  small_lwe_size * sizeof(Torus), stream);
 
+    // Both samples hold the same small LWE, only the LUT differs
     execute_pbs<Torus>(
         stream, mem_ptr->tmp_big_lwe_vector, mem_ptr->lwe_indexes,
         mem_ptr->lut_buffer, mem_ptr->lut_indexes,
         mem_ptr->tmp_small_lwe_vector, mem_ptr->lwe_indexes, bsk,
         mem_ptr->pbs_buffer, glwe_dimension, lwe_dimension, polynomial_size,
         pbs_base_log, pbs_level, grouping_factor, 2, 2, 0,
-        cuda_get_max_shared_memory(stream->gpu_index), mem_ptr->pbs_type);
+        cuda_get_max_shared_memory(stream->gpu_index), mem_ptr->pbs_type, 2);
 
     cuda_memcpy_async_gpu_to_gpu(cur_input_block, mem_ptr->tmp_big_lwe_vector,
                                  big_lwe_size * sizeof(Torus), stream);
@@ -477,14 +721,16 @@ void scratch_cuda_full_propagation(
   // PBS
   int8_t *pbs_buffer;
   if (pbs_type == MULTI_BIT) {
-    uint32_t lwe_chunk_size = get_average_lwe_chunk_size(
-        lwe_dimension, pbs_level, glwe_dimension, num_radix_blocks);
-    // Only 64 bits is supported
-    scratch_cuda_multi_bit_pbs_64(stream, &pbs_buffer, lwe_dimension,
-                                  glwe_dimension, polynomial_size, pbs_level,
-                                  grouping_factor, num_radix_blocks,
-                                  cuda_get_max_shared_memory(stream->gpu_index),
-                                  allocate_gpu_memory, lwe_chunk_size);
+    if (sizeof(Torus) == sizeof(uint32_t))
+      scratch_cuda_multi_bit_pbs_32(
+          stream, &pbs_buffer, lwe_dimension, glwe_dimension, polynomial_size,
+          pbs_level, grouping_factor, num_radix_blocks,
+          cuda_get_max_shared_memory(stream->gpu_index), allocate_gpu_memory);
+    else
+      scratch_cuda_multi_bit_pbs_64(
+          stream, &pbs_buffer, lwe_dimension, glwe_dimension, polynomial_size,
+          pbs_level, grouping_factor, num_radix_blocks,
+          cuda_get_max_shared_memory(stream->gpu_index), allocate_gpu_memory);
   } else {
     // Classic
     // We only use low latency for classic mode
@@ -549,9 +795,8 @@ void scratch_cuda_full_propagation(
     Torus *h_lwe_indexes = (Torus *)malloc(lwe_indexes_size);
     for (int i = 0; i < num_radix_blocks; i++)
       h_lwe_indexes[i] = i;
-    cuda_memcpy_async_to_gpu(lwe_indexes, h_lwe_indexes, lwe_indexes_size,
-                             stream);
-    cuda_synchronize_stream(stream);
+    cuda_memcpy_async_to_gpu_staged(lwe_indexes, h_lwe_indexes,
+                                    lwe_indexes_size, stream);
     free(h_lwe_indexes);
   }
 
@@ -3,6 +3,10 @@
 /*
  * This scratch function allocates the necessary amount of data on the GPU for
  * the integer radix multiplication in keyswitch->bootstrap order.
+ * - 'karatsuba_threshold' 0 selects the schoolbook multiplication, which
+ * computes all num_radix_blocks^2 block products at once. Otherwise operands
+ * of more than 'karatsuba_threshold' blocks are split recursively with
+ * Karatsuba, which needs fewer PBS and much less memory but more PBS rounds.
  */
 void scratch_cuda_integer_mult_radix_ciphertext_kb_64(
     cuda_stream_t *stream, int8_t **mem_ptr, uint32_t message_modulus,
@@ -10,7 +14,7 @@ void scratch_cuda_integer_mult_radix_ciphertext_kb_64(
     uint32_t polynomial_size, uint32_t pbs_base_log, uint32_t pbs_level,
     uint32_t ks_base_log, uint32_t ks_level, uint32_t grouping_factor,
     uint32_t num_radix_blocks, PBS_TYPE pbs_type, uint32_t max_shared_memory,
-    bool allocate_gpu_memory) {
+    bool allocate_gpu_memory, uint32_t karatsuba_threshold) {
 
   int_radix_params params(pbs_type, glwe_dimension, polynomial_size,
                           polynomial_size, lwe_dimension, ks_level, ks_base_log,
@@ -21,13 +25,32 @@ void scratch_cuda_integer_mult_radix_ciphertext_kb_64(
   case 2048:
     scratch_cuda_integer_mult_radix_ciphertext_kb<uint64_t>(
         stream, (int_mul_memory<uint64_t> **)mem_ptr, num_radix_blocks, params,
-        allocate_gpu_memory);
+        allocate_gpu_memory, karatsuba_threshold);
     break;
   default:
     break;
   }
 }
 
+uint64_t get_buffer_size_integer_mult_radix_ciphertext_kb_64(
+    uint32_t gpu_index, uint32_t message_modulus, uint32_t carry_modulus,
+    uint32_t glwe_dimension, uint32_t lwe_dimension, uint32_t polynomial_size,
+    uint32_t pbs_base_log, uint32_t pbs_level, uint32_t ks_base_log,
+    uint32_t ks_level, uint32_t grouping_factor, uint32_t num_blocks,
+    PBS_TYPE pbs_type, uint32_t max_shared_memory,
+    uint32_t karatsuba_threshold) {
+  return get_scratch_buffer_size<int_mul_memory<uint64_t>>(
+      gpu_index,
+      [&](cuda_stream_t *stream, int8_t **mem_ptr) {
+        scratch_cuda_integer_mult_radix_ciphertext_kb_64(
+            stream, mem_ptr, message_modulus, carry_modulus, glwe_dimension,
+            lwe_dimension, polynomial_size, pbs_base_log, pbs_level,
+            ks_base_log, ks_level, grouping_factor, num_blocks, pbs_type,
+            max_shared_memory, true, karatsuba_threshold);
+      },
+      cleanup_cuda_integer_mult);
+}
+
 /*
  * Computes a multiplication between two 64 bit radix lwe ciphertexts
  * encrypting integer values. keyswitch -> bootstrap pattern is used, function
@@ -65,18 +88,27 @@ void cuda_integer_mult_radix_ciphertext_kb_64(
     uint32_t grouping_factor, uint32_t num_blocks, PBS_TYPE pbs_type,
     uint32_t max_shared_memory) {
 
-  switch (polynomial_size) {
-  case 2048:
-    host_integer_mult_radix_kb<uint64_t, int64_t, AmortizedDegree<2048>>(
-        stream, static_cast<uint64_t *>(radix_lwe_out),
-        static_cast<uint64_t *>(radix_lwe_left),
-        static_cast<uint64_t *>(radix_lwe_right), bsk,
-        static_cast<uint64_t *>(ksk), (int_mul_memory<uint64_t> *)mem_ptr,
-        num_blocks);
-    break;
-  default:
-    break;
-  }
+  auto mem = (int_mul_memory<uint64_t> *)mem_ptr;
+  auto mult = [&]() {
+    switch (polynomial_size) {
+    case 2048:
+      host_integer_mult_radix_kb<uint64_t, int64_t, AmortizedDegree<2048>>(
+          stream, static_cast<uint64_t *>(radix_lwe_out),
+          static_cast<uint64_t *>(radix_lwe_left),
+          static_cast<uint64_t *>(radix_lwe_right), bsk,
+          static_cast<uint64_t *>(ksk), mem, num_blocks);
+      break;
+    default:
+      break;
+    }
+  };
+
+  if (mem->graph != nullptr)
+    mem->graph->run(stream, {num_blocks},
+                    {radix_lwe_out, radix_lwe_left, radix_lwe_right, bsk, ksk},
+                    mult);
+  else
+    mult();
 }
 
 void cleanup_cuda_integer_mult(cuda_stream_t *stream, int8_t **mem_ptr_void) {
@@ -87,6 +119,31 @@ void cleanup_cuda_integer_mult(cuda_stream_t *stream, int8_t **mem_ptr_void) {
   mem_ptr->release(stream);
 }
 
+/*
+ * Makes the multiplications executed with 'mem_ptr' go through a CUDA graph:
+ * the second call with the same number of blocks captures the kernels it
+ * enqueues, later ones replay them in a single launch, after updating the
+ * graph in place when they get other ciphertexts or keys.
+ * Does nothing before CUDA 12, which cannot capture the cooperative PBS.
+ */
+void enable_graph_cuda_integer_mult(cuda_stream_t *stream, int8_t *mem_ptr) {
+  auto mem = (int_mul_memory<uint64_t> *)mem_ptr;
+  if (mem->graph == nullptr && cuda_graph_capture_supported())
+    mem->graph = new graph_cache(new device_graph_launcher, true);
+}
+
+/*
+ * Drops the graph captured for 'mem_ptr', to be called when a host side choice
+ * of the multiplication changes for the same number of blocks, e.g. the
+ * multi-bit PBS chunk size after tuning
+ */
+void invalidate_graph_cuda_integer_mult(cuda_stream_t *stream,
+                                        int8_t *mem_ptr) {
+  auto mem = (int_mul_memory<uint64_t> *)mem_ptr;
+  if (mem->graph != nullptr)
+    mem->graph->invalidate(stream);
+}
+
 void cuda_small_scalar_multiplication_integer_radix_ciphertext_64_inplace(
     cuda_stream_t *stream, void *lwe_array, uint64_t scalar,
     uint32_t lwe_dimension, uint32_t lwe_ciphertext_count) {
@@ -221,12 +221,161 @@ __global__ void fill_radix_from_lsb_msb(Torus *result_blocks, Torus *lsb_blocks,
   }
 }
 
+// Packs the inputs of a plan LUT step, lhs * message_modulus + rhs for
+// bivariate LUTs and lhs for univariate ones
+template <typename Torus>
+__global__ void device_pack_plan_lut_inputs(Torus *lwe_array_out, Torus *slots,
+                                            Torus *lhs_indexes,
+                                            Torus *rhs_indexes,
+                                            uint32_t lwe_dimension,
+                                            uint32_t message_modulus,
+                                            uint32_t num_items) {
+  int tid = threadIdx.x + blockIdx.x * blockDim.x;
+
+  if (tid < num_items * (lwe_dimension + 1)) {
+    int item_id = tid / (lwe_dimension + 1);
+    int coeff_id = tid % (lwe_dimension + 1);
+
+    Torus lhs = slots[lhs_indexes[item_id] * (lwe_dimension + 1) + coeff_id];
+    Torus rhs_index = rhs_indexes[item_id];
+    if (rhs_index == (Torus)RADIX_PLAN_NO_SLOT)
+      lwe_array_out[tid] = lhs;
+    else
+      lwe_array_out[tid] =
+          lhs * message_modulus +
+          slots[rhs_index * (lwe_dimension + 1) + coeff_id];
+  }
+}
+
+// Linear combinations of a plan SUM step, the encoded constants only go to
+// the bodies
+template <typename Torus>
+__global__ void device_plan_linear_sums(
+    Torus *lwe_array_out, Torus *slots, Torus *constants, Torus *first_terms,
+    Torus *num_terms, Torus *term_slots, Torus *term_signs,
+    uint32_t lwe_dimension, uint32_t num_items) {
+  int tid = threadIdx.x + blockIdx.x * blockDim.x;
+
+  if (tid < num_items * (lwe_dimension + 1)) {
+    int item_id = tid / (lwe_dimension + 1);
+    int coeff_id = tid % (lwe_dimension + 1);
+
+    Torus value = coeff_id == lwe_dimension ? constants[item_id] : 0;
+    auto first_term = first_terms[item_id];
+    for (Torus t = first_term; t < first_term + num_terms[item_id]; t++)
+      value += term_signs[t] *
+               slots[term_slots[t] * (lwe_dimension + 1) + coeff_id];
+    lwe_array_out[tid] = value;
+  }
+}
+
+/*
+ *  Executes the steps of a radix_mult_plan. Every step writes its results
+ *  to step_output before scattering them to their slots, so that it reads
+ *  all its inputs first.
+ */
+template <typename Torus>
+__host__ void host_integer_mult_radix_plan_kb(
+    cuda_stream_t *stream, Torus *radix_lwe_out, Torus *radix_lwe_left,
+    Torus *radix_lwe_right, void *bsk, Torus *ksk,
+    int_mul_plan_memory<Torus> *mem_ptr, uint32_t num_blocks) {
+
+  auto &plan = mem_ptr->plan;
+  auto big_lwe_dimension = mem_ptr->params.big_lwe_dimension;
+  auto big_lwe_size = big_lwe_dimension + 1;
+  auto big_lwe_size_bytes = big_lwe_size * sizeof(Torus);
+  auto slots = mem_ptr->slots;
+  auto step_output = mem_ptr->step_output;
+  auto plan_luts = mem_ptr->plan_luts;
+
+  assert(("Error (GPU radix mult plan): the plan was generated for another "
+          "number of blocks",
+          plan.num_blocks == num_blocks));
+
+  cuda_memcpy_async_gpu_to_gpu(slots, radix_lwe_left,
+                               num_blocks * big_lwe_size_bytes, stream);
+  cuda_memcpy_async_gpu_to_gpu(&slots[num_blocks * big_lwe_size],
+                               radix_lwe_right, num_blocks * big_lwe_size_bytes,
+                               stream);
+
+  for (size_t s = 0; s < plan.steps.size(); s++) {
+    auto &step = plan.steps[s];
+    auto indexes = &mem_ptr->step_indexes[mem_ptr->step_offsets[s]];
+    uint32_t num_items = step.is_lut ? step.luts.size() : step.sums.size();
+    auto out_indexes = &indexes[(step.is_lut ? 2 : 0) * num_items];
+
+    int num_cuda_blocks = 0, num_threads = 0;
+    getNumBlocksAndThreads(num_items * big_lwe_size, 512, num_cuda_blocks,
+                           num_threads);
+
+    if (step.is_lut) {
+      device_pack_plan_lut_inputs<<<num_cuda_blocks, num_threads, 0,
+                                    stream->stream>>>(
+          plan_luts->tmp_lwe_before_ks, slots, indexes, &indexes[num_items],
+          big_lwe_dimension, plan.message_modulus, num_items);
+      check_cuda_error(cudaGetLastError());
+
+      cuda_memcpy_async_gpu_to_gpu(plan_luts->lut_indexes,
+                                   &indexes[3 * num_items],
+                                   num_items * sizeof(Torus), stream);
+      // Items without a many-LUT accumulator also get a second output, from
+      // their regular accumulator, that is never read
+      uint32_t num_many_lut_items = step.num_many_lut_items();
+      if (num_many_lut_items > 0) {
+        integer_radix_apply_many_univariate_lookup_table_kb<Torus>(
+            stream, step_output, plan_luts->tmp_lwe_before_ks, bsk, ksk,
+            num_items, plan_luts, 2, mem_ptr->many_lut_stride);
+
+        int num_carry_blocks = 0, num_carry_threads = 0;
+        getNumBlocksAndThreads(num_many_lut_items * big_lwe_size, 512,
+                               num_carry_blocks, num_carry_threads);
+        device_scatter_blocks<<<num_carry_blocks, num_carry_threads, 0,
+                                stream->stream>>>(
+            slots, &step_output[num_items * big_lwe_size],
+            &indexes[4 * num_items], big_lwe_dimension, num_many_lut_items);
+        check_cuda_error(cudaGetLastError());
+      } else {
+        integer_radix_apply_univariate_lookup_table_kb<Torus>(
+            stream, step_output, plan_luts->tmp_lwe_before_ks, bsk, ksk,
+            num_items, plan_luts);
+      }
+    } else {
+      auto terms = &indexes[4 * num_items];
+      device_plan_linear_sums<<<num_cuda_blocks, num_threads, 0,
+                                stream->stream>>>(
+          step_output, slots, &indexes[num_items], &indexes[2 * num_items],
+          &indexes[3 * num_items], terms, &terms[step.terms.size()],
+          big_lwe_dimension, num_items);
+      check_cuda_error(cudaGetLastError());
+    }
+
+    device_scatter_blocks<<<num_cuda_blocks, num_threads, 0, stream->stream>>>(
+        slots, step_output, out_indexes, big_lwe_dimension, num_items);
+    check_cuda_error(cudaGetLastError());
+  }
+
+  int num_cuda_blocks = 0, num_threads = 0;
+  getNumBlocksAndThreads(num_blocks * big_lwe_size, 512, num_cuda_blocks,
+                         num_threads);
+  device_gather_blocks<<<num_cuda_blocks, num_threads, 0, stream->stream>>>(
+      radix_lwe_out, slots, &mem_ptr->step_indexes[mem_ptr->output_offset],
+      big_lwe_dimension, num_blocks);
+  check_cuda_error(cudaGetLastError());
+}
+
 template <typename Torus, typename STorus, class params>
 __host__ void host_integer_mult_radix_kb(
     cuda_stream_t *stream, uint64_t *radix_lwe_out, uint64_t *radix_lwe_left,
     uint64_t *radix_lwe_right, void *bsk, uint64_t *ksk,
     int_mul_memory<Torus> *mem_ptr, uint32_t num_blocks) {
 
+  if (mem_ptr->plan_mem != nullptr) {
+    host_integer_mult_radix_plan_kb<Torus>(stream, radix_lwe_out,
+                                           radix_lwe_left, radix_lwe_right, bsk,
+                                           ksk, mem_ptr->plan_mem, num_blocks);
+    return;
+  }
+
   auto glwe_dimension = mem_ptr->params.glwe_dimension;
   auto polynomial_size = mem_ptr->params.polynomial_size;
   auto lwe_dimension = mem_ptr->params.small_lwe_dimension;
@@ -473,9 +622,10 @@ template <typename Torus>
 __host__ void scratch_cuda_integer_mult_radix_ciphertext_kb(
     cuda_stream_t *stream, int_mul_memory<Torus> **mem_ptr,
     uint32_t num_radix_blocks, int_radix_params params,
-    bool allocate_gpu_memory) {
+    bool allocate_gpu_memory, uint32_t karatsuba_threshold) {
   *mem_ptr = new int_mul_memory<Torus>(stream, params, num_radix_blocks,
-                                       allocate_gpu_memory);
+                                       allocate_gpu_memory,
+                                       karatsuba_threshold);
 }
 
 // Function to apply lookup table,
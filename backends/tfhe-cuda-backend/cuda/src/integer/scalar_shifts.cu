@@ -18,6 +18,24 @@ void scratch_cuda_integer_radix_scalar_shift_kb_64(
       shift_type, allocate_gpu_memory);
 }
 
+uint64_t get_buffer_size_integer_radix_scalar_shift_kb_64(
+    uint32_t gpu_index, uint32_t glwe_dimension, uint32_t polynomial_size,
+    uint32_t big_lwe_dimension, uint32_t small_lwe_dimension, uint32_t ks_level,
+    uint32_t ks_base_log, uint32_t pbs_level, uint32_t pbs_base_log,
+    uint32_t grouping_factor, uint32_t num_blocks, uint32_t message_modulus,
+    uint32_t carry_modulus, PBS_TYPE pbs_type, SHIFT_TYPE shift_type) {
+  return get_scratch_buffer_size<int_shift_buffer<uint64_t>>(
+      gpu_index,
+      [&](cuda_stream_t *stream, int8_t **mem_ptr) {
+        scratch_cuda_integer_radix_scalar_shift_kb_64(
+            stream, mem_ptr, glwe_dimension, polynomial_size, big_lwe_dimension,
+            small_lwe_dimension, ks_level, ks_base_log, pbs_level, pbs_base_log,
+            grouping_factor, num_blocks, message_modulus, carry_modulus,
+            pbs_type, shift_type, true);
+      },
+      cleanup_cuda_integer_radix_scalar_shift);
+}
+
 void cuda_integer_radix_scalar_shift_kb_64_inplace(
     cuda_stream_t *stream, void *lwe_array, uint32_t shift, int8_t *mem_ptr,
     void *bsk, void *ksk, uint32_t num_blocks) {
@@ -1,4 +1,42 @@
 #include "bootstrap_amortized.cuh"
+#include "polynomial_size_dispatch.h"
+
+/*
+ * Entry points of the amortized PBS for a given polynomial size, looked up
+ * through polynomial_size_dispatch
+ */
+template <typename Torus, typename STorus> struct amortized_pbs {
+  template <int N> struct scratch {
+    static void run(cuda_stream_t *stream, int8_t **pbs_buffer,
+                    uint32_t glwe_dimension, uint32_t polynomial_size,
+                    uint32_t input_lwe_ciphertext_count,
+                    uint32_t max_shared_memory, bool allocate_gpu_memory) {
+      scratch_bootstrap_amortized<Torus, STorus, AmortizedDegree<N>>(
+          stream, pbs_buffer, glwe_dimension, polynomial_size,
+          input_lwe_ciphertext_count, max_shared_memory, allocate_gpu_memory);
+    }
+  };
+
+  template <int N> struct bootstrap {
+    static void run(cuda_stream_t *stream, void *lwe_array_out,
+                    void *lwe_output_indexes, void *lut_vector,
+                    void *lut_vector_indexes, void *lwe_array_in,
+                    void *lwe_input_indexes, void *bootstrapping_key,
+                    int8_t *pbs_buffer, uint32_t lwe_dimension,
+                    uint32_t glwe_dimension, uint32_t polynomial_size,
+                    uint32_t base_log, uint32_t level_count,
+                    uint32_t num_samples, uint32_t num_lut_vectors,
+                    uint32_t lwe_idx, uint32_t max_shared_memory) {
+      host_bootstrap_amortized<Torus, AmortizedDegree<N>>(
+          stream, (Torus *)lwe_array_out, (Torus *)lwe_output_indexes,
+          (Torus *)lut_vector, (Torus *)lut_vector_indexes,
+          (Torus *)lwe_array_in, (Torus *)lwe_input_indexes,
+          (double2 *)bootstrapping_key, pbs_buffer, glwe_dimension,
+          lwe_dimension, polynomial_size, base_log, level_count, num_samples,
+          num_lut_vectors, lwe_idx, max_shared_memory);
+    }
+  };
+};
 
 /*
  * Returns the buffer size for 64 bits executions
@@ -45,45 +83,9 @@ void scratch_cuda_bootstrap_amortized_32(
     uint32_t max_shared_memory, bool allocate_gpu_memory) {
   checks_fast_bootstrap_amortized(polynomial_size);
 
-  switch (polynomial_size) {
-  case 256:
-    scratch_bootstrap_amortized<uint32_t, int32_t, AmortizedDegree<256>>(
-        stream, pbs_buffer, glwe_dimension, polynomial_size,
-        input_lwe_ciphertext_count, max_shared_memory, allocate_gpu_memory);
-    break;
-  case 512:
-    scratch_bootstrap_amortized<uint32_t, int32_t, AmortizedDegree<512>>(
-        stream, pbs_buffer, glwe_dimension, polynomial_size,
-        input_lwe_ciphertext_count, max_shared_memory, allocate_gpu_memory);
-    break;
-  case 1024:
-    scratch_bootstrap_amortized<uint32_t, int32_t, AmortizedDegree<1024>>(
-        stream, pbs_buffer, glwe_dimension, polynomial_size,
-        input_lwe_ciphertext_count, max_shared_memory, allocate_gpu_memory);
-    break;
-  case 2048:
-    scratch_bootstrap_amortized<uint32_t, int32_t, AmortizedDegree<2048>>(
-        stream, pbs_buffer, glwe_dimension, polynomial_size,
-        input_lwe_ciphertext_count, max_shared_memory, allocate_gpu_memory);
-    break;
-  case 4096:
-    scratch_bootstrap_amortized<uint32_t, int32_t, AmortizedDegree<4096>>(
-        stream, pbs_buffer, glwe_dimension, polynomial_size,
-        input_lwe_ciphertext_count, max_shared_memory, allocate_gpu_memory);
-    break;
-  case 8192:
-    scratch_bootstrap_amortized<uint32_t, int32_t, AmortizedDegree<8192>>(
-        stream, pbs_buffer, glwe_dimension, polynomial_size,
-        input_lwe_ciphertext_count, max_shared_memory, allocate_gpu_memory);
-    break;
-  case 16384:
-    scratch_bootstrap_amortized<uint32_t, int32_t, AmortizedDegree<16384>>(
-        stream, pbs_buffer, glwe_dimension, polynomial_size,
-        input_lwe_ciphertext_count, max_shared_memory, allocate_gpu_memory);
-    break;
-  default:
-    break;
-  }
+  polynomial_size_dispatch<amortized_pbs<uint32_t, int32_t>::scratch>::run(
+      polynomial_size, stream, pbs_buffer, glwe_dimension, polynomial_size,
+      input_lwe_ciphertext_count, max_shared_memory, allocate_gpu_memory);
 }
 
 /*
@@ -98,45 +100,9 @@ void scratch_cuda_bootstrap_amortized_64(
     uint32_t max_shared_memory, bool allocate_gpu_memory) {
   checks_fast_bootstrap_amortized(polynomial_size);
 
-  switch (polynomial_size) {
-  case 256:
-    scratch_bootstrap_amortized<uint64_t, int64_t, AmortizedDegree<256>>(
-        stream, pbs_buffer, glwe_dimension, polynomial_size,
-        input_lwe_ciphertext_count, max_shared_memory, allocate_gpu_memory);
-    break;
-  case 512:
-    scratch_bootstrap_amortized<uint64_t, int64_t, AmortizedDegree<512>>(
-        stream, pbs_buffer, glwe_dimension, polynomial_size,
-        input_lwe_ciphertext_count, max_shared_memory, allocate_gpu_memory);
-    break;
-  case 1024:
-    scratch_bootstrap_amortized<uint64_t, int64_t, AmortizedDegree<1024>>(
-        stream, pbs_buffer, glwe_dimension, polynomial_size,
-        input_lwe_ciphertext_count, max_shared_memory, allocate_gpu_memory);
-    break;
-  case 2048:
-    scratch_bootstrap_amortized<uint64_t, int64_t, AmortizedDegree<2048>>(
-        stream, pbs_buffer, glwe_dimension, polynomial_size,
-        input_lwe_ciphertext_count, max_shared_memory, allocate_gpu_memory);
-    break;
-  case 4096:
-    scratch_bootstrap_amortized<uint64_t, int64_t, AmortizedDegree<4096>>(
-        stream, pbs_buffer, glwe_dimension, polynomial_size,
-        input_lwe_ciphertext_count, max_shared_memory, allocate_gpu_memory);
-    break;
-  case 8192:
-    scratch_bootstrap_amortized<uint64_t, int64_t, AmortizedDegree<8192>>(
-        stream, pbs_buffer, glwe_dimension, polynomial_size,
-        input_lwe_ciphertext_count, max_shared_memory, allocate_gpu_memory);
-    break;
-  case 16384:
-    scratch_bootstrap_amortized<uint64_t, int64_t, AmortizedDegree<16384>>(
-        stream, pbs_buffer, glwe_dimension, polynomial_size,
-        input_lwe_ciphertext_count, max_shared_memory, allocate_gpu_memory);
-    break;
-  default:
-    break;
-  }
+  polynomial_size_dispatch<amortized_pbs<uint64_t, int64_t>::scratch>::run(
+      polynomial_size, stream, pbs_buffer, glwe_dimension, polynomial_size,
+      input_lwe_ciphertext_count, max_shared_memory, allocate_gpu_memory);
 }
 
 /* Perform the programmable bootstrapping on a batch of input u32 LWE
@@ -152,73 +118,11 @@ void cuda_bootstrap_amortized_lwe_ciphertext_vector_32(
 
   checks_bootstrap_amortized(32, base_log, polynomial_size);
 
-  switch (polynomial_size) {
-  case 256:
-    host_bootstrap_amortized<uint32_t, AmortizedDegree<256>>(
-        stream, (uint32_t *)lwe_array_out, (uint32_t *)lwe_output_indexes,
-        (uint32_t *)lut_vector, (uint32_t *)lut_vector_indexes,
-        (uint32_t *)lwe_array_in, (uint32_t *)lwe_input_indexes,
-        (double2 *)bootstrapping_key, pbs_buffer, glwe_dimension, lwe_dimension,
-        polynomial_size, base_log, level_count, num_samples, num_lut_vectors,
-        lwe_idx, max_shared_memory);
-    break;
-  case 512:
-    host_bootstrap_amortized<uint32_t, AmortizedDegree<512>>(
-        stream, (uint32_t *)lwe_array_out, (uint32_t *)lwe_output_indexes,
-        (uint32_t *)lut_vector, (uint32_t *)lut_vector_indexes,
-        (uint32_t *)lwe_array_in, (uint32_t *)lwe_input_indexes,
-        (double2 *)bootstrapping_key, pbs_buffer, glwe_dimension, lwe_dimension,
-        polynomial_size, base_log, level_count, num_samples, num_lut_vectors,
-        lwe_idx, max_shared_memory);
-    break;
-  case 1024:
-    host_bootstrap_amortized<uint32_t, AmortizedDegree<1024>>(
-        stream, (uint32_t *)lwe_array_out, (uint32_t *)lwe_output_indexes,
-        (uint32_t *)lut_vector, (uint32_t *)lut_vector_indexes,
-        (uint32_t *)lwe_array_in, (uint32_t *)lwe_input_indexes,
-        (double2 *)bootstrapping_key, pbs_buffer, glwe_dimension, lwe_dimension,
-        polynomial_size, base_log, level_count, num_samples, num_lut_vectors,
-        lwe_idx, max_shared_memory);
-    break;
-  case 2048:
-    host_bootstrap_amortized<uint32_t, AmortizedDegree<2048>>(
-        stream, (uint32_t *)lwe_array_out, (uint32_t *)lwe_output_indexes,
-        (uint32_t *)lut_vector, (uint32_t *)lut_vector_indexes,
-        (uint32_t *)lwe_array_in, (uint32_t *)lwe_input_indexes,
-        (double2 *)bootstrapping_key, pbs_buffer, glwe_dimension, lwe_dimension,
-        polynomial_size, base_log, level_count, num_samples, num_lut_vectors,
-        lwe_idx, max_shared_memory);
-    break;
-  case 4096:
-    host_bootstrap_amortized<uint32_t, AmortizedDegree<4096>>(
-        stream, (uint32_t *)lwe_array_out, (uint32_t *)lwe_output_indexes,
-        (uint32_t *)lut_vector, (uint32_t *)lut_vector_indexes,
-        (uint32_t *)lwe_array_in, (uint32_t *)lwe_input_indexes,
-        (double2 *)bootstrapping_key, pbs_buffer, glwe_dimension, lwe_dimension,
-        polynomial_size, base_log, level_count, num_samples, num_lut_vectors,
-        lwe_idx, max_shared_memory);
-    break;
-  case 8192:
-    host_bootstrap_amortized<uint32_t, AmortizedDegree<8192>>(
-        stream, (uint32_t *)lwe_array_out, (uint32_t *)lwe_output_indexes,
-        (uint32_t *)lut_vector, (uint32_t *)lut_vector_indexes,
-        (uint32_t *)lwe_array_in, (uint32_t *)lwe_input_indexes,
-        (double2 *)bootstrapping_key, pbs_buffer, glwe_dimension, lwe_dimension,
-        polynomial_size, base_log, level_count, num_samples, num_lut_vectors,
-        lwe_idx, max_shared_memory);
-    break;
-  case 16384:
-    host_bootstrap_amortized<uint32_t, AmortizedDegree<16384>>(
-        stream, (uint32_t *)lwe_array_out, (uint32_t *)lwe_output_indexes,
-        (uint32_t *)lut_vector, (uint32_t *)lut_vector_indexes,
-        (uint32_t *)lwe_array_in, (uint32_t *)lwe_input_indexes,
-        (double2 *)bootstrapping_key, pbs_buffer, glwe_dimension, lwe_dimension,
-        polynomial_size, base_log, level_count, num_samples, num_lut_vectors,
-        lwe_idx, max_shared_memory);
-    break;
-  default:
-    break;
-  }
+  polynomial_size_dispatch<amortized_pbs<uint32_t, int32_t>::bootstrap>::run(
+      polynomial_size, stream, lwe_array_out, lwe_output_indexes, lut_vector,
+      lut_vector_indexes, lwe_array_in, lwe_input_indexes, bootstrapping_key,
+      pbs_buffer, lwe_dimension, glwe_dimension, polynomial_size, base_log,
+      level_count, num_samples, num_lut_vectors, lwe_idx, max_shared_memory);
 }
 
 /* Perform the programmable bootstrapping on a batch of input u64 LWE
@@ -296,73 +200,11 @@ void cuda_bootstrap_amortized_lwe_ciphertext_vector_64(
 
   checks_bootstrap_amortized(64, base_log, polynomial_size);
 
-  switch (polynomial_size) {
-  case 256:
-    host_bootstrap_amortized<uint64_t, AmortizedDegree<256>>(
-        stream, (uint64_t *)lwe_array_out, (uint64_t *)lwe_output_indexes,
-        (uint64_t *)lut_vector, (uint64_t *)lut_vector_indexes,
-        (uint64_t *)lwe_array_in, (uint64_t *)lwe_input_indexes,
-        (double2 *)bootstrapping_key, pbs_buffer, glwe_dimension, lwe_dimension,
-        polynomial_size, base_log, level_count, num_samples, num_lut_vectors,
-        lwe_idx, max_shared_memory);
-    break;
-  case 512:
-    host_bootstrap_amortized<uint64_t, AmortizedDegree<512>>(
-        stream, (uint64_t *)lwe_array_out, (uint64_t *)lwe_output_indexes,
-        (uint64_t *)lut_vector, (uint64_t *)lut_vector_indexes,
-        (uint64_t *)lwe_array_in, (uint64_t *)lwe_input_indexes,
-        (double2 *)bootstrapping_key, pbs_buffer, glwe_dimension, lwe_dimension,
-        polynomial_size, base_log, level_count, num_samples, num_lut_vectors,
-        lwe_idx, max_shared_memory);
-    break;
-  case 1024:
-    host_bootstrap_amortized<uint64_t, AmortizedDegree<1024>>(
-        stream, (uint64_t *)lwe_array_out, (uint64_t *)lwe_output_indexes,
-        (uint64_t *)lut_vector, (uint64_t *)lut_vector_indexes,
-        (uint64_t *)lwe_array_in, (uint64_t *)lwe_input_indexes,
-        (double2 *)bootstrapping_key, pbs_buffer, glwe_dimension, lwe_dimension,
-        polynomial_size, base_log, level_count, num_samples, num_lut_vectors,
-        lwe_idx, max_shared_memory);
-    break;
-  case 2048:
-    host_bootstrap_amortized<uint64_t, AmortizedDegree<2048>>(
-        stream, (uint64_t *)lwe_array_out, (uint64_t *)lwe_output_indexes,
-        (uint64_t *)lut_vector, (uint64_t *)lut_vector_indexes,
-        (uint64_t *)lwe_array_in, (uint64_t *)lwe_input_indexes,
-        (double2 *)bootstrapping_key, pbs_buffer, glwe_dimension, lwe_dimension,
-        polynomial_size, base_log, level_count, num_samples, num_lut_vectors,
-        lwe_idx, max_shared_memory);
-    break;
-  case 4096:
-    host_bootstrap_amortized<uint64_t, AmortizedDegree<4096>>(
-        stream, (uint64_t *)lwe_array_out, (uint64_t *)lwe_output_indexes,
-        (uint64_t *)lut_vector, (uint64_t *)lut_vector_indexes,
-        (uint64_t *)lwe_array_in, (uint64_t *)lwe_input_indexes,
-        (double2 *)bootstrapping_key, pbs_buffer, glwe_dimension, lwe_dimension,
-        polynomial_size, base_log, level_count, num_samples, num_lut_vectors,
-        lwe_idx, max_shared_memory);
-    break;
-  case 8192:
-    host_bootstrap_amortized<uint64_t, AmortizedDegree<8192>>(
-        stream, (uint64_t *)lwe_array_out, (uint64_t *)lwe_output_indexes,
-        (uint64_t *)lut_vector, (uint64_t *)lut_vector_indexes,
-        (uint64_t *)lwe_array_in, (uint64_t *)lwe_input_indexes,
-        (double2 *)bootstrapping_key, pbs_buffer, glwe_dimension, lwe_dimension,
-        polynomial_size, base_log, level_count, num_samples, num_lut_vectors,
-        lwe_idx, max_shared_memory);
-    break;
-  case 16384:
-    host_bootstrap_amortized<uint64_t, AmortizedDegree<16384>>(
-        stream, (uint64_t *)lwe_array_out, (uint64_t *)lwe_output_indexes,
-        (uint64_t *)lut_vector, (uint64_t *)lut_vector_indexes,
-        (uint64_t *)lwe_array_in, (uint64_t *)lwe_input_indexes,
-        (double2 *)bootstrapping_key, pbs_buffer, glwe_dimension, lwe_dimension,
-        polynomial_size, base_log, level_count, num_samples, num_lut_vectors,
-        lwe_idx, max_shared_memory);
-    break;
-  default:
-    break;
-  }
+  polynomial_size_dispatch<amortized_pbs<uint64_t, int64_t>::bootstrap>::run(
+      polynomial_size, stream, lwe_array_out, lwe_output_indexes, lut_vector,
+      lut_vector_indexes, lwe_array_in, lwe_input_indexes, bootstrapping_key,
+      pbs_buffer, lwe_dimension, glwe_dimension, polynomial_size, base_log,
+      level_count, num_samples, num_lut_vectors, lwe_idx, max_shared_memory);
 }
 
 /*
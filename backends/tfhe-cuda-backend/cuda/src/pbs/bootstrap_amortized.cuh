@@ -16,6 +16,7 @@
 #include "polynomial/parameters.cuh"
 #include "polynomial/polynomial_math.cuh"
 #include "types/complex/operations.cuh"
+#include "utils/kernel_dimensions.cuh"
 
 template <typename Torus, class params, sharedMemDegree SMD>
 /*
@@ -253,6 +254,7 @@ __host__ void scratch_bootstrap_amortized(
     uint32_t polynomial_size, uint32_t input_lwe_ciphertext_count,
     uint32_t max_shared_memory, bool allocate_gpu_memory) {
   cudaSetDevice(stream->gpu_index);
+  cuda_initialize_twiddles(stream);
 
   uint64_t full_sm = get_buffer_size_full_sm_bootstrap_amortized<Torus>(
       polynomial_size, glwe_dimension);
@@ -346,18 +348,20 @@ __host__ void host_bootstrap_amortized(
 }
 
 template <typename Torus, class params>
-int cuda_get_pbs_per_gpu(int polynomial_size) {
+int cuda_get_pbs_per_gpu(uint32_t gpu_index, int polynomial_size) {
 
-  int blocks_per_sm = 0;
+  auto device = cuda_get_device_profile(gpu_index);
+  if (device == nullptr)
+    return 0;
+
+  // The occupancy query is answered for the currently selected device
+  cudaSetDevice(gpu_index);
   int num_threads = polynomial_size / params::opt;
-  cudaGetDeviceCount(0);
-  cudaDeviceProp device_properties;
-  cudaGetDeviceProperties(&device_properties, 0);
-  cudaOccupancyMaxActiveBlocksPerMultiprocessor(
-      &blocks_per_sm, device_bootstrap_amortized<Torus, params>, num_threads,
-      0);
-
-  return device_properties.multiProcessorCount * blocks_per_sm;
+  int blocks_per_sm =
+      get_max_active_blocks_per_sm<device_bootstrap_amortized<Torus, params>>(
+          gpu_index, num_threads, 0);
+
+  return device->sm_count * blocks_per_sm;
 }
 
 #endif // CNCRT_PBS_H
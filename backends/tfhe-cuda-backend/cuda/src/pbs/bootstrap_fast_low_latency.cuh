@@ -17,6 +17,7 @@
 #include "polynomial/parameters.cuh"
 #include "polynomial/polynomial_math.cuh"
 #include "types/complex/operations.cuh"
+#include "utils/kernel_dimensions.cuh"
 
 // Cooperative groups are used in the low latency PBS
 using namespace cooperative_groups;
@@ -113,6 +114,88 @@ __device__ void mul_ggsw_glwe(Torus *accumulator, double2 *fft,
   __syncthreads();
 }
 
+/*
+ * Blind rotation of the accumulator initialized with the LUT, followed by the
+ * sample extraction of the num_many_lut functions it packs, for the ciphertext
+ * handled by this block in the low latency PBS that uses cooperative groups.
+ * block_lwe_array_in may point to global or shared memory.
+ */
+template <typename Torus, class params>
+__device__ void blind_rotate_and_sample_extract_fast_low_latency(
+    Torus *block_lwe_array_out, Torus *block_lwe_array_in,
+    Torus *block_lut_vector, double2 *block_join_buffer,
+    double2 *bootstrapping_key, Torus *accumulator, Torus *accumulator_rotated,
+    double2 *accumulator_fft, uint32_t lwe_dimension, uint32_t polynomial_size,
+    uint32_t glwe_dimension, uint32_t base_log, uint32_t level_count,
+    grid_group &grid, uint32_t num_many_lut = 1, uint32_t lut_stride = 0) {
+
+  // Put "b" in [0, 2N[
+  Torus b_hat = 0;
+  rescale_torus_element(block_lwe_array_in[lwe_dimension], b_hat,
+                        2 * params::degree);
+
+  divide_by_monomial_negacyclic_inplace<Torus, params::opt,
+                                        params::degree / params::opt>(
+      accumulator, &block_lut_vector[blockIdx.y * params::degree], b_hat,
+      false);
+
+  for (int i = 0; i < lwe_dimension; i++) {
+    synchronize_threads_in_block();
+
+    // Put "a" in [0, 2N[
+    Torus a_hat = 0;
+    rescale_torus_element(block_lwe_array_in[i], a_hat,
+                          2 * params::degree); // 2 * params::log2_degree + 1);
+
+    // Perform ACC * (X^ä - 1)
+    multiply_by_monomial_negacyclic_and_sub_polynomial<
+        Torus, params::opt, params::degree / params::opt>(
+        accumulator, accumulator_rotated, a_hat);
+
+    // Perform a rounding to increase the accuracy of the
+    // bootstrapped ciphertext
+    round_to_closest_multiple_inplace<Torus, params::opt,
+                                      params::degree / params::opt>(
+        accumulator_rotated, base_log, level_count);
+
+    synchronize_threads_in_block();
+
+    // Decompose the accumulator. Each block gets one level of the
+    // decomposition, for the mask and the body (so block 0 will have the
+    // accumulator decomposed at level 0, 1 at 1, etc.)
+    GadgetMatrix<Torus, params> gadget_acc(base_log, level_count,
+                                           accumulator_rotated);
+    gadget_acc.decompose_and_compress_level(accumulator_fft, blockIdx.x);
+
+    // We are using the same memory space for accumulator_fft and
+    // accumulator_rotated, so we need to synchronize here to make sure they
+    // don't modify the same memory space at the same time
+    synchronize_threads_in_block();
+
+    // Perform G^-1(ACC) * GGSW -> GLWE
+    mul_ggsw_glwe<Torus, params>(
+        accumulator, accumulator_fft, block_join_buffer, bootstrapping_key,
+        polynomial_size, glwe_dimension, level_count, i, grid);
+
+    synchronize_threads_in_block();
+  }
+
+  if (blockIdx.x == 0 && num_many_lut > 1)
+    sample_extract_many_lut<Torus, params>(
+        block_lwe_array_out, accumulator, blockIdx.y == glwe_dimension,
+        num_many_lut, lut_stride,
+        (uint64_t)gridDim.z * (glwe_dimension * polynomial_size + 1));
+
+  if (blockIdx.x == 0 && blockIdx.y < glwe_dimension) {
+    // Perform a sample extract. At this point, all blocks have the result, but
+    // we do the computation at block 0 to avoid waiting for extra blocks, in
+    // case they're not synchronized
+    sample_extract_mask<Torus, params>(block_lwe_array_out, accumulator);
+  } else if (blockIdx.x == 0 && blockIdx.y == glwe_dimension) {
+    sample_extract_body<Torus, params>(block_lwe_array_out, accumulator, 0);
+  }
+}
+
 /*
  * Kernel launched by the low latency version of the
  * bootstrapping, that uses cooperative groups
@@ -133,7 +216,8 @@ __global__ void device_bootstrap_fast_low_latency(
     Torus *lut_vector_indexes, Torus *lwe_array_in, Torus *lwe_input_indexes,
     double2 *bootstrapping_key, double2 *join_buffer, uint32_t lwe_dimension,
     uint32_t polynomial_size, uint32_t base_log, uint32_t level_count,
-    int8_t *device_mem, uint64_t device_memory_size_per_block) {
+    int8_t *device_mem, uint64_t device_memory_size_per_block,
+    uint32_t num_many_lut, uint32_t lut_stride) {
 
   grid_group grid = this_grid();
 
@@ -179,70 +263,16 @@ __global__ void device_bootstrap_fast_low_latency(
   // the rotated accumulator and the fft accumulator, since we know that the
   // rotated array is not in use anymore by the time we perform the fft
 
-  // Put "b" in [0, 2N[
-  Torus b_hat = 0;
-  rescale_torus_element(block_lwe_array_in[lwe_dimension], b_hat,
-                        2 * params::degree);
-
-  divide_by_monomial_negacyclic_inplace<Torus, params::opt,
-                                        params::degree / params::opt>(
-      accumulator, &block_lut_vector[blockIdx.y * params::degree], b_hat,
-      false);
-
-  for (int i = 0; i < lwe_dimension; i++) {
-    synchronize_threads_in_block();
-
-    // Put "a" in [0, 2N[
-    Torus a_hat = 0;
-    rescale_torus_element(block_lwe_array_in[i], a_hat,
-                          2 * params::degree); // 2 * params::log2_degree + 1);
-
-    // Perform ACC * (X^ä - 1)
-    multiply_by_monomial_negacyclic_and_sub_polynomial<
-        Torus, params::opt, params::degree / params::opt>(
-        accumulator, accumulator_rotated, a_hat);
-
-    // Perform a rounding to increase the accuracy of the
-    // bootstrapped ciphertext
-    round_to_closest_multiple_inplace<Torus, params::opt,
-                                      params::degree / params::opt>(
-        accumulator_rotated, base_log, level_count);
-
-    synchronize_threads_in_block();
-
-    // Decompose the accumulator. Each block gets one level of the
-    // decomposition, for the mask and the body (so block 0 will have the
-    // accumulator decomposed at level 0, 1 at 1, etc.)
-    GadgetMatrix<Torus, params> gadget_acc(base_log, level_count,
-                                           accumulator_rotated);
-    gadget_acc.decompose_and_compress_level(accumulator_fft, blockIdx.x);
-
-    // We are using the same memory space for accumulator_fft and
-    // accumulator_rotated, so we need to synchronize here to make sure they
-    // don't modify the same memory space at the same time
-    synchronize_threads_in_block();
-
-    // Perform G^-1(ACC) * GGSW -> GLWE
-    mul_ggsw_glwe<Torus, params>(
-        accumulator, accumulator_fft, block_join_buffer, bootstrapping_key,
-        polynomial_size, glwe_dimension, level_count, i, grid);
-
-    synchronize_threads_in_block();
-  }
-
   auto block_lwe_array_out =
       &lwe_array_out[lwe_output_indexes[blockIdx.z] *
                          (glwe_dimension * polynomial_size + 1) +
                      blockIdx.y * polynomial_size];
 
-  if (blockIdx.x == 0 && blockIdx.y < glwe_dimension) {
-    // Perform a sample extract. At this point, all blocks have the result, but
-    // we do the computation at block 0 to avoid waiting for extra blocks, in
-    // case they're not synchronized
-    sample_extract_mask<Torus, params>(block_lwe_array_out, accumulator);
-  } else if (blockIdx.x == 0 && blockIdx.y == glwe_dimension) {
-    sample_extract_body<Torus, params>(block_lwe_array_out, accumulator, 0);
-  }
+  blind_rotate_and_sample_extract_fast_low_latency<Torus, params>(
+      block_lwe_array_out, block_lwe_array_in, block_lut_vector,
+      block_join_buffer, bootstrapping_key, accumulator, accumulator_rotated,
+      accumulator_fft, lwe_dimension, polynomial_size, glwe_dimension, base_log,
+      level_count, grid, num_many_lut, lut_stride);
 }
 
 template <typename Torus>
@@ -293,6 +323,7 @@ __host__ void scratch_bootstrap_fast_low_latency(
     uint32_t input_lwe_ciphertext_count, uint32_t max_shared_memory,
     bool allocate_gpu_memory) {
   cudaSetDevice(stream->gpu_index);
+  cuda_initialize_twiddles(stream);
 
   uint64_t full_sm = get_buffer_size_full_sm_bootstrap_fast_low_latency<Torus>(
       polynomial_size);
@@ -337,7 +368,8 @@ __host__ void host_bootstrap_fast_low_latency(
     uint32_t glwe_dimension, uint32_t lwe_dimension, uint32_t polynomial_size,
     uint32_t base_log, uint32_t level_count,
     uint32_t input_lwe_ciphertext_count, uint32_t num_lut_vectors,
-    uint32_t max_shared_memory) {
+    uint32_t max_shared_memory, uint32_t num_many_lut = 1,
+    uint32_t lut_stride = 0) {
   cudaSetDevice(stream->gpu_index);
 
   // With SM each block corresponds to either the mask or body, no need to
@@ -366,7 +398,7 @@ __host__ void host_bootstrap_fast_low_latency(
   int thds = polynomial_size / params::opt;
   dim3 grid(level_count, glwe_dimension + 1, input_lwe_ciphertext_count);
 
-  void *kernel_args[14];
+  void *kernel_args[16];
   kernel_args[0] = &lwe_array_out;
   kernel_args[1] = &lwe_output_indexes;
   kernel_args[2] = &lut_vector;
@@ -380,6 +412,8 @@ __host__ void host_bootstrap_fast_low_latency(
   kernel_args[10] = &base_log;
   kernel_args[11] = &level_count;
   kernel_args[12] = &d_mem;
+  kernel_args[14] = &num_many_lut;
+  kernel_args[15] = &lut_stride;
 
   if (max_shared_memory < partial_sm) {
     kernel_args[13] = &full_dm;
@@ -409,8 +443,14 @@ __host__ bool verify_cuda_bootstrap_fast_low_latency_grid_size(
     int glwe_dimension, int level_count, int num_samples,
     uint32_t max_shared_memory) {
 
+  // Checked against the currently selected device, i.e. the stream's one
+  // when called from the dispatch functions
+  int gpu_index = 0;
+  check_cuda_error(cudaGetDevice(&gpu_index));
+  auto device = cuda_get_device_profile(gpu_index);
+
   // If Cooperative Groups is not supported, no need to check anything else
-  if (!cuda_check_support_cooperative_groups())
+  if (device == nullptr || !device->cooperative_launch)
     return false;
 
   // Calculate the dimension of the kernel
@@ -428,26 +468,20 @@ __host__ bool verify_cuda_bootstrap_fast_low_latency_grid_size(
   int max_active_blocks_per_sm;
 
   if (max_shared_memory < partial_sm) {
-    cudaOccupancyMaxActiveBlocksPerMultiprocessor(
-        &max_active_blocks_per_sm,
-        (void *)device_bootstrap_fast_low_latency<Torus, params, NOSM>, thds,
-        0);
+    max_active_blocks_per_sm = get_max_active_blocks_per_sm<
+        device_bootstrap_fast_low_latency<Torus, params, NOSM>>(gpu_index,
+                                                                 thds, 0);
   } else if (max_shared_memory < full_sm) {
-    cudaOccupancyMaxActiveBlocksPerMultiprocessor(
-        &max_active_blocks_per_sm,
-        (void *)device_bootstrap_fast_low_latency<Torus, params, PARTIALSM>,
-        thds, 0);
+    max_active_blocks_per_sm = get_max_active_blocks_per_sm<
+        device_bootstrap_fast_low_latency<Torus, params, PARTIALSM>>(
+        gpu_index, thds, 0);
   } else {
-    cudaOccupancyMaxActiveBlocksPerMultiprocessor(
-        &max_active_blocks_per_sm,
-        (void *)device_bootstrap_fast_low_latency<Torus, params, FULLSM>, thds,
-        0);
+    max_active_blocks_per_sm = get_max_active_blocks_per_sm<
+        device_bootstrap_fast_low_latency<Torus, params, FULLSM>>(gpu_index,
+                                                                   thds, 0);
   }
 
-  // Get the number of streaming multiprocessors
-  int number_of_sm = 0;
-  cudaDeviceGetAttribute(&number_of_sm, cudaDevAttrMultiProcessorCount, 0);
-  return number_of_blocks <= max_active_blocks_per_sm * number_of_sm;
+  return number_of_blocks <= max_active_blocks_per_sm * device->sm_count;
 }
 
 #endif // LOWLAT_FAST_PBS_H
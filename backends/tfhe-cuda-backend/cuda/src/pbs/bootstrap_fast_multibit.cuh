@@ -11,10 +11,12 @@
 #include "device.h"
 #include "fft/bnsmfft.cuh"
 #include "fft/twiddles.cuh"
+#include "pbs_pipeline.h"
 #include "polynomial/functions.cuh"
 #include "polynomial/parameters.cuh"
 #include "polynomial/polynomial_math.cuh"
 #include "types/complex/operations.cuh"
+#include "utils/kernel_dimensions.cuh"
 #include <vector>
 
 template <typename Torus, class params>
@@ -25,7 +27,8 @@ __global__ void device_multi_bit_bootstrap_fast_accumulate(
     uint32_t lwe_dimension, uint32_t glwe_dimension, uint32_t polynomial_size,
     uint32_t base_log, uint32_t level_count, uint32_t grouping_factor,
     uint32_t lwe_offset, uint32_t lwe_chunk_size,
-    uint32_t keybundle_size_per_input) {
+    uint32_t keybundle_size_per_input, uint32_t num_samples_per_input,
+    uint32_t num_many_lut, uint32_t lut_stride) {
 
   grid_group grid = this_grid();
 
@@ -62,7 +65,8 @@ __global__ void device_multi_bit_bootstrap_fast_accumulate(
 
   double2 *keybundle = keybundle_array +
                        // select the input
-                       blockIdx.z * keybundle_size_per_input;
+                       (blockIdx.z / num_samples_per_input) *
+                           keybundle_size_per_input;
 
   if (lwe_offset == 0) {
     // Put "b" in [0, 2N[
@@ -112,6 +116,12 @@ __global__ void device_multi_bit_bootstrap_fast_accumulate(
                            (glwe_dimension * polynomial_size + 1) +
                        blockIdx.y * polynomial_size];
 
+    if (blockIdx.x == 0 && num_many_lut > 1)
+      sample_extract_many_lut<Torus, params>(
+          block_lwe_array_out, accumulator, blockIdx.y == glwe_dimension,
+          num_many_lut, lut_stride,
+          (uint64_t)gridDim.z * (glwe_dimension * polynomial_size + 1));
+
     if (blockIdx.x == 0 && blockIdx.y < glwe_dimension) {
       // Perform a sample extract. At this point, all blocks have the result,
       // but we do the computation at block 0 to avoid waiting for extra blocks,
@@ -130,7 +140,8 @@ __global__ void device_multi_bit_bootstrap_fast_accumulate(
 template <typename Torus>
 __host__ __device__ uint64_t
 get_buffer_size_full_sm_fast_multibit_bootstrap(uint32_t polynomial_size) {
-  return sizeof(Torus) * polynomial_size * 2; // accumulator
+  return sizeof(double2) * polynomial_size / 2 + // accumulator fft
+         sizeof(Torus) * polynomial_size;        // accumulator
 }
 
 template <typename Torus>
@@ -141,9 +152,11 @@ __host__ __device__ uint64_t get_buffer_size_fast_multibit_bootstrap(
     uint32_t max_shared_memory) {
 
   uint64_t buffer_size = 0;
-  buffer_size += input_lwe_ciphertext_count * lwe_chunk_size * level_count *
-                 (glwe_dimension + 1) * (glwe_dimension + 1) *
-                 (polynomial_size / 2) * sizeof(double2); // keybundle fft
+  // One keybundle buffer per pipeline slot, see multi_bit_pipeline.h
+  buffer_size += multi_bit_pipeline_num_slots * input_lwe_ciphertext_count *
+                 lwe_chunk_size * level_count * (glwe_dimension + 1) *
+                 (glwe_dimension + 1) * (polynomial_size / 2) *
+                 sizeof(double2); // keybundle fft
   buffer_size += input_lwe_ciphertext_count * (glwe_dimension + 1) *
                  level_count * (polynomial_size / 2) *
                  sizeof(double2); // join buffer
@@ -162,6 +175,7 @@ __host__ void scratch_fast_multi_bit_pbs(
     uint32_t lwe_chunk_size = 0) {
 
   cudaSetDevice(stream->gpu_index);
+  cuda_initialize_twiddles(stream);
 
   uint64_t full_sm_keybundle =
       get_buffer_size_full_sm_multibit_bootstrap_keybundle<Torus>(
@@ -169,12 +183,7 @@ __host__ void scratch_fast_multi_bit_pbs(
   uint64_t full_sm_accumulate =
       get_buffer_size_full_sm_fast_multibit_bootstrap<Torus>(polynomial_size);
 
-  check_cuda_error(cudaFuncSetAttribute(
-      device_multi_bit_bootstrap_keybundle<Torus, params>,
-      cudaFuncAttributeMaxDynamicSharedMemorySize, full_sm_keybundle));
-  cudaFuncSetCacheConfig(device_multi_bit_bootstrap_keybundle<Torus, params>,
-                         cudaFuncCachePreferShared);
-  check_cuda_error(cudaGetLastError());
+  configure_multi_bit_keybundle<Torus, params>(full_sm_keybundle);
 
   check_cuda_error(cudaFuncSetAttribute(
       device_multi_bit_bootstrap_fast_accumulate<Torus, params>,
@@ -186,9 +195,9 @@ __host__ void scratch_fast_multi_bit_pbs(
 
   if (allocate_gpu_memory) {
     if (!lwe_chunk_size)
-      lwe_chunk_size =
-          get_average_lwe_chunk_size(lwe_dimension, level_count, glwe_dimension,
-                                     input_lwe_ciphertext_count);
+      lwe_chunk_size = get_scratch_lwe_chunk_size(
+          stream->gpu_index, lwe_dimension, glwe_dimension, polynomial_size,
+          level_count, grouping_factor, input_lwe_ciphertext_count);
 
     uint64_t buffer_size = get_buffer_size_fast_multibit_bootstrap<Torus>(
         lwe_dimension, glwe_dimension, polynomial_size, level_count,
@@ -196,6 +205,8 @@ __host__ void scratch_fast_multi_bit_pbs(
         max_shared_memory);
     *pbs_buffer = (int8_t *)cuda_malloc_async(buffer_size, stream);
     check_cuda_error(cudaGetLastError());
+    register_multi_bit_pbs_buffer(*pbs_buffer, lwe_chunk_size,
+                                  input_lwe_ciphertext_count);
   }
 }
 
@@ -203,23 +214,39 @@ template <typename Torus, typename STorus, class params>
 __host__ void host_fast_multi_bit_pbs(
     cuda_stream_t *stream, Torus *lwe_array_out, Torus *lwe_output_indexes,
     Torus *lut_vector, Torus *lut_vector_indexes, Torus *lwe_array_in,
-    Torus *lwe_input_indexes, uint64_t *bootstrapping_key, int8_t *pbs_buffer,
+    Torus *lwe_input_indexes, Torus *bootstrapping_key, int8_t *pbs_buffer,
     uint32_t glwe_dimension, uint32_t lwe_dimension, uint32_t polynomial_size,
     uint32_t grouping_factor, uint32_t base_log, uint32_t level_count,
     uint32_t num_samples, uint32_t num_lut_vectors, uint32_t lwe_idx,
-    uint32_t max_shared_memory, uint32_t lwe_chunk_size = 0) {
+    uint32_t max_shared_memory, uint32_t lwe_chunk_size = 0,
+    uint32_t num_samples_per_input = 1, uint32_t num_many_lut = 1,
+    uint32_t lut_stride = 0) {
   cudaSetDevice(stream->gpu_index);
+  assert(("Error (GPU multi-bit PBS): the number of samples should be a "
+          "multiple of the number of samples per input",
+          num_samples % num_samples_per_input == 0));
+  uint32_t num_inputs = num_samples / num_samples_per_input;
 
-  if (!lwe_chunk_size)
-    lwe_chunk_size = get_average_lwe_chunk_size(lwe_dimension, level_count,
-                                                glwe_dimension, num_samples);
+  // Chunk size the buffer was scratched for, or a tuned one that fits in it
+  lwe_chunk_size = get_execution_lwe_chunk_size(
+      pbs_buffer, stream->gpu_index, lwe_dimension, glwe_dimension,
+      polynomial_size, level_count, grouping_factor, num_samples,
+      lwe_chunk_size);
 
   //
+  uint32_t keybundle_size_per_input =
+      lwe_chunk_size * level_count * (glwe_dimension + 1) *
+      (glwe_dimension + 1) * (polynomial_size / 2);
+  // The slots are sized for the chunk size and number of samples the buffer
+  // was scratched with, the execution chunk size may differ
+  uint64_t keybundle_slot_size =
+      get_multi_bit_pbs_buffer_layout(pbs_buffer, lwe_chunk_size, num_samples)
+          .keybundle_slot_size(level_count * (glwe_dimension + 1) *
+                               (glwe_dimension + 1) * (polynomial_size / 2));
+
   double2 *keybundle_fft = (double2 *)pbs_buffer;
-  double2 *buffer_fft = (double2 *)keybundle_fft +
-                        num_samples * lwe_chunk_size * level_count *
-                            (glwe_dimension + 1) * (glwe_dimension + 1) *
-                            (polynomial_size / 2);
+  double2 *buffer_fft =
+      keybundle_fft + multi_bit_pipeline_num_slots * keybundle_slot_size;
   Torus *global_accumulator =
       (Torus *)buffer_fft +
       (ptrdiff_t)(sizeof(double2) * num_samples * (glwe_dimension + 1) *
@@ -232,19 +259,18 @@ __host__ void host_fast_multi_bit_pbs(
   uint64_t full_sm_accumulate =
       get_buffer_size_full_sm_fast_multibit_bootstrap<Torus>(polynomial_size);
 
-  uint32_t keybundle_size_per_input =
-      lwe_chunk_size * level_count * (glwe_dimension + 1) *
-      (glwe_dimension + 1) * (polynomial_size / 2);
-
   //
-  void *kernel_args[18];
+  double2 *keybundle_slot;
+  uint32_t lwe_offset;
+  uint32_t chunk_size;
+  void *kernel_args[21];
   kernel_args[0] = &lwe_array_out;
   kernel_args[1] = &lwe_output_indexes;
   kernel_args[2] = &lut_vector;
   kernel_args[3] = &lut_vector_indexes;
   kernel_args[4] = &lwe_array_in;
   kernel_args[5] = &lwe_input_indexes;
-  kernel_args[6] = &keybundle_fft;
+  kernel_args[6] = &keybundle_slot;
   kernel_args[7] = &buffer_fft;
   kernel_args[8] = &global_accumulator;
   kernel_args[9] = &lwe_dimension;
@@ -253,37 +279,64 @@ __host__ void host_fast_multi_bit_pbs(
   kernel_args[12] = &base_log;
   kernel_args[13] = &level_count;
   kernel_args[14] = &grouping_factor;
+  kernel_args[15] = &lwe_offset;
+  kernel_args[16] = &chunk_size;
   kernel_args[17] = &keybundle_size_per_input;
+  kernel_args[18] = &num_samples_per_input;
+  kernel_args[19] = &num_many_lut;
+  kernel_args[20] = &lut_stride;
 
   //
   dim3 grid_accumulate(level_count, glwe_dimension + 1, num_samples);
   dim3 thds(polynomial_size / params::opt, 1, 1);
 
-  for (uint32_t lwe_offset = 0; lwe_offset < (lwe_dimension / grouping_factor);
-       lwe_offset += lwe_chunk_size) {
-
-    uint32_t chunk_size = std::min(
-        lwe_chunk_size, (lwe_dimension / grouping_factor) - lwe_offset);
-
-    // Compute a keybundle
-    dim3 grid_keybundle(num_samples * chunk_size,
-                        (glwe_dimension + 1) * (glwe_dimension + 1),
-                        level_count);
-    device_multi_bit_bootstrap_keybundle<Torus, params>
-        <<<grid_keybundle, thds, full_sm_keybundle, stream->stream>>>(
-            lwe_array_in, lwe_input_indexes, keybundle_fft, bootstrapping_key,
-            lwe_dimension, glwe_dimension, polynomial_size, grouping_factor,
-            base_log, level_count, lwe_offset, chunk_size,
-            keybundle_size_per_input);
-    check_cuda_error(cudaGetLastError());
-
-    kernel_args[15] = &lwe_offset;
-    kernel_args[16] = &chunk_size;
-
-    check_cuda_error(cudaLaunchCooperativeKernel(
-        (void *)device_multi_bit_bootstrap_fast_accumulate<Torus, params>,
-        grid_accumulate, thds, (void **)kernel_args, full_sm_accumulate,
-        stream->stream));
+  // As in host_multi_bit_pbs, the keybundles of the next chunk are computed
+  // on a side stream while the cooperative kernel accumulates the current one
+  uint32_t num_iterations = lwe_dimension / grouping_factor;
+  uint32_t num_chunks = (num_iterations + lwe_chunk_size - 1) / lwe_chunk_size;
+  auto schedule = make_multi_bit_pipeline_schedule(num_chunks);
+  pbs_pipeline *pipeline = num_chunks > 1 ? get_pbs_pipeline(stream) : nullptr;
+
+  for (auto &op : schedule) {
+    cudaStream_t op_stream =
+        pipeline == nullptr ? stream->stream
+                            : pipeline->get_stream(stream, op.stream);
+    // Chunk and keybundle slot, only meaningful for the kernels
+    lwe_offset = op.chunk * lwe_chunk_size;
+    chunk_size = std::min(lwe_chunk_size, num_iterations - lwe_offset);
+    keybundle_slot = keybundle_fft;
+    if (op.type == PIPELINE_KEYBUNDLE || op.type == PIPELINE_ACCUMULATE)
+      keybundle_slot += op.index * keybundle_slot_size;
+
+    switch (op.type) {
+    case PIPELINE_RECORD:
+      check_cuda_error(cudaEventRecord(pipeline->events[op.index], op_stream));
+      break;
+    case PIPELINE_WAIT:
+      check_cuda_error(
+          cudaStreamWaitEvent(op_stream, pipeline->events[op.index], 0));
+      break;
+    case PIPELINE_KEYBUNDLE: {
+      // Compute a keybundle per distinct input
+      dim3 grid_keybundle(num_inputs * chunk_size,
+                          (glwe_dimension + 1) * (glwe_dimension + 1),
+                          level_count);
+      execute_multi_bit_keybundle<Torus, params>(
+          op_stream, grid_keybundle, thds, full_sm_keybundle, lwe_array_in,
+          lwe_input_indexes, keybundle_slot, bootstrapping_key, lwe_dimension,
+          glwe_dimension, polynomial_size, grouping_factor, base_log,
+          level_count, lwe_offset, chunk_size, keybundle_size_per_input,
+          num_samples_per_input);
+      break;
+    }
+    case PIPELINE_ACCUMULATE:
+      // The kernel arguments are read at launch time
+      check_cuda_error(cudaLaunchCooperativeKernel(
+          (void *)device_multi_bit_bootstrap_fast_accumulate<Torus, params>,
+          grid_accumulate, thds, (void **)kernel_args, full_sm_accumulate,
+          op_stream));
+      break;
+    }
   }
 }
 
@@ -295,8 +348,14 @@ verify_cuda_bootstrap_fast_multi_bit_grid_size(int glwe_dimension,
                                                int level_count, int num_samples,
                                                uint32_t max_shared_memory) {
 
+  // Checked against the currently selected device, i.e. the stream's one
+  // when called from the dispatch functions
+  int gpu_index = 0;
+  check_cuda_error(cudaGetDevice(&gpu_index));
+  auto device = cuda_get_device_profile(gpu_index);
+
   // If Cooperative Groups is not supported, no need to check anything else
-  if (!cuda_check_support_cooperative_groups())
+  if (device == nullptr || !device->cooperative_launch)
     return false;
 
   // Calculate the dimension of the kernel
@@ -307,16 +366,10 @@ verify_cuda_bootstrap_fast_multi_bit_grid_size(int glwe_dimension,
 
   // Get the maximum number of active blocks per streaming multiprocessors
   int number_of_blocks = level_count * (glwe_dimension + 1) * num_samples;
-  int max_active_blocks_per_sm;
-
-  cudaOccupancyMaxActiveBlocksPerMultiprocessor(
-      &max_active_blocks_per_sm,
-      (void *)device_multi_bit_bootstrap_fast_accumulate<Torus, params>, thds,
-      full_sm);
+  int max_active_blocks_per_sm = get_max_active_blocks_per_sm<
+      device_multi_bit_bootstrap_fast_accumulate<Torus, params>>(
+      gpu_index, thds, full_sm);
 
-  // Get the number of streaming multiprocessors
-  int number_of_sm = 0;
-  cudaDeviceGetAttribute(&number_of_sm, cudaDevAttrMultiProcessorCount, 0);
-  return number_of_blocks <= max_active_blocks_per_sm * number_of_sm;
+  return number_of_blocks <= max_active_blocks_per_sm * device->sm_count;
 }
 #endif // FASTMULTIBIT_PBS_H
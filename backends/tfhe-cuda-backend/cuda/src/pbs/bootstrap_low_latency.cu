@@ -1,5 +1,138 @@
 #include "bootstrap_fast_low_latency.cuh"
 #include "bootstrap_low_latency.cuh"
+#include "keyswitch_bootstrap.cuh"
+#include "many_lut.h"
+#include "polynomial_size_dispatch.h"
+#include <map>
+#include <mutex>
+
+/*
+ * Entry points of the low latency PBS for a given polynomial size, looked up
+ * through polynomial_size_dispatch. The fast variant, relying on cooperative
+ * groups, is used whenever its grid fits on the device. Otherwise the two
+ * steps of the classic variant run as two kernels per iteration, or in a
+ * single persistent kernel for the buffers scratched with
+ * scratch_cuda_bootstrap_low_latency_persistent_64 on devices supporting
+ * cooperative launches.
+ */
+template <typename Torus, typename STorus> struct low_latency_pbs {
+  template <int N> struct buffer_size {
+    static uint64_t run(uint32_t glwe_dimension, uint32_t polynomial_size,
+                        uint32_t level_count,
+                        uint32_t input_lwe_ciphertext_count,
+                        uint32_t max_shared_memory) {
+      if (verify_cuda_bootstrap_fast_low_latency_grid_size<Torus,
+                                                           AmortizedDegree<N>>(
+              glwe_dimension, level_count, input_lwe_ciphertext_count,
+              max_shared_memory))
+        return get_buffer_size_bootstrap_fast_low_latency<Torus>(
+            glwe_dimension, polynomial_size, level_count,
+            input_lwe_ciphertext_count, max_shared_memory);
+      return get_buffer_size_bootstrap_low_latency<Torus>(
+          glwe_dimension, polynomial_size, level_count,
+          input_lwe_ciphertext_count, max_shared_memory);
+    }
+  };
+
+  template <int N> struct scratch {
+    static void run(cuda_stream_t *stream, int8_t **pbs_buffer,
+                    uint32_t glwe_dimension, uint32_t polynomial_size,
+                    uint32_t level_count, uint32_t input_lwe_ciphertext_count,
+                    uint32_t max_shared_memory, bool allocate_gpu_memory,
+                    bool persistent) {
+      // The persistent kernel only replaces the classic variant
+      if (verify_cuda_bootstrap_fast_low_latency_grid_size<Torus,
+                                                           AmortizedDegree<N>>(
+              glwe_dimension, level_count, input_lwe_ciphertext_count,
+              max_shared_memory))
+        scratch_bootstrap_fast_low_latency<Torus, STorus, AmortizedDegree<N>>(
+            stream, pbs_buffer, glwe_dimension, polynomial_size, level_count,
+            input_lwe_ciphertext_count, max_shared_memory,
+            allocate_gpu_memory);
+      else
+        scratch_bootstrap_low_latency<Torus, STorus, Degree<N>>(
+            stream, pbs_buffer, glwe_dimension, polynomial_size, level_count,
+            input_lwe_ciphertext_count, max_shared_memory,
+            allocate_gpu_memory, persistent);
+    }
+  };
+
+  template <int N> struct bootstrap {
+    static void run(cuda_stream_t *stream, void *lwe_array_out,
+                    void *lwe_output_indexes, void *lut_vector,
+                    void *lut_vector_indexes, void *lwe_array_in,
+                    void *lwe_input_indexes, void *bootstrapping_key,
+                    int8_t *pbs_buffer, uint32_t lwe_dimension,
+                    uint32_t glwe_dimension, uint32_t polynomial_size,
+                    uint32_t base_log, uint32_t level_count,
+                    uint32_t num_samples, uint32_t num_lut_vectors,
+                    uint32_t max_shared_memory, uint32_t num_many_lut,
+                    uint32_t lut_stride) {
+      if (verify_cuda_bootstrap_fast_low_latency_grid_size<Torus,
+                                                           AmortizedDegree<N>>(
+              glwe_dimension, level_count, num_samples, max_shared_memory))
+        host_bootstrap_fast_low_latency<Torus, AmortizedDegree<N>>(
+            stream, static_cast<Torus *>(lwe_array_out),
+            static_cast<Torus *>(lwe_output_indexes),
+            static_cast<Torus *>(lut_vector),
+            static_cast<Torus *>(lut_vector_indexes),
+            static_cast<Torus *>(lwe_array_in),
+            static_cast<Torus *>(lwe_input_indexes),
+            static_cast<double2 *>(bootstrapping_key), pbs_buffer,
+            glwe_dimension, lwe_dimension, polynomial_size, base_log,
+            level_count, num_samples, num_lut_vectors, max_shared_memory,
+            num_many_lut, lut_stride);
+      else
+        host_bootstrap_low_latency<Torus, Degree<N>>(
+            stream, static_cast<Torus *>(lwe_array_out),
+            static_cast<Torus *>(lwe_output_indexes),
+            static_cast<Torus *>(lut_vector),
+            static_cast<Torus *>(lut_vector_indexes),
+            static_cast<Torus *>(lwe_array_in),
+            static_cast<Torus *>(lwe_input_indexes),
+            static_cast<double2 *>(bootstrapping_key), pbs_buffer,
+            glwe_dimension, lwe_dimension, polynomial_size, base_log,
+            level_count, num_samples, num_lut_vectors, max_shared_memory,
+            num_many_lut, lut_stride);
+    }
+  };
+
+  template <int N> struct keyswitch_bootstrap_scratch {
+    static void run(cuda_stream_t *stream, uint32_t lwe_dimension,
+                    uint32_t max_shared_memory) {
+      scratch_keyswitch_bootstrap_fast_low_latency<Torus, AmortizedDegree<N>>(
+          stream, lwe_dimension, max_shared_memory);
+    }
+  };
+
+  // Returns false when the fused kernel cannot be used
+  template <int N> struct keyswitch_bootstrap {
+    static bool run(cuda_stream_t *stream, void *lwe_array_out,
+                    void *lwe_output_indexes, void *lut_vector,
+                    void *lut_vector_indexes, void *lwe_array_in,
+                    void *lwe_input_indexes, void *lwe_array_after_ks,
+                    void *ksk, void *bootstrapping_key, int8_t *pbs_buffer,
+                    uint32_t lwe_dimension_in, uint32_t lwe_dimension,
+                    uint32_t glwe_dimension, uint32_t polynomial_size,
+                    uint32_t ks_base_log, uint32_t ks_level_count,
+                    uint32_t base_log, uint32_t level_count,
+                    uint32_t num_samples, uint32_t max_shared_memory) {
+      return execute_keyswitch_bootstrap_fast_low_latency<Torus,
+                                                          AmortizedDegree<N>>(
+          stream, static_cast<Torus *>(lwe_array_out),
+          static_cast<Torus *>(lwe_output_indexes),
+          static_cast<Torus *>(lut_vector),
+          static_cast<Torus *>(lut_vector_indexes),
+          static_cast<Torus *>(lwe_array_in),
+          static_cast<Torus *>(lwe_input_indexes),
+          static_cast<Torus *>(lwe_array_after_ks), static_cast<Torus *>(ksk),
+          static_cast<double2 *>(bootstrapping_key), pbs_buffer,
+          lwe_dimension_in, lwe_dimension, glwe_dimension, polynomial_size,
+          ks_base_log, ks_level_count, base_log, level_count, num_samples,
+          max_shared_memory);
+    }
+  };
+};
 /*
  * Returns the buffer size for 64 bits executions
  */
@@ -7,102 +140,11 @@ uint64_t get_buffer_size_bootstrap_low_latency_64(
     uint32_t glwe_dimension, uint32_t polynomial_size, uint32_t level_count,
     uint32_t input_lwe_ciphertext_count, uint32_t max_shared_memory) {
 
-  switch (polynomial_size) {
-  case 256:
-    if (verify_cuda_bootstrap_fast_low_latency_grid_size<uint64_t,
-                                                         AmortizedDegree<256>>(
-            glwe_dimension, level_count, input_lwe_ciphertext_count,
-            max_shared_memory))
-      return get_buffer_size_bootstrap_fast_low_latency<uint64_t>(
-          glwe_dimension, polynomial_size, level_count,
-          input_lwe_ciphertext_count, max_shared_memory);
-    else
-      return get_buffer_size_bootstrap_low_latency<uint64_t>(
-          glwe_dimension, polynomial_size, level_count,
-          input_lwe_ciphertext_count, max_shared_memory);
-    break;
-  case 512:
-    if (verify_cuda_bootstrap_fast_low_latency_grid_size<uint64_t,
-                                                         AmortizedDegree<512>>(
-            glwe_dimension, level_count, input_lwe_ciphertext_count,
-            max_shared_memory))
-      return get_buffer_size_bootstrap_fast_low_latency<uint64_t>(
-          glwe_dimension, polynomial_size, level_count,
-          input_lwe_ciphertext_count, max_shared_memory);
-    else
-      return get_buffer_size_bootstrap_low_latency<uint64_t>(
-          glwe_dimension, polynomial_size, level_count,
-          input_lwe_ciphertext_count, max_shared_memory);
-    break;
-  case 1024:
-    if (verify_cuda_bootstrap_fast_low_latency_grid_size<uint64_t,
-                                                         AmortizedDegree<1024>>(
-            glwe_dimension, level_count, input_lwe_ciphertext_count,
-            max_shared_memory))
-      return get_buffer_size_bootstrap_fast_low_latency<uint64_t>(
-          glwe_dimension, polynomial_size, level_count,
-          input_lwe_ciphertext_count, max_shared_memory);
-    else
-      return get_buffer_size_bootstrap_low_latency<uint64_t>(
-          glwe_dimension, polynomial_size, level_count,
-          input_lwe_ciphertext_count, max_shared_memory);
-    break;
-  case 2048:
-    if (verify_cuda_bootstrap_fast_low_latency_grid_size<uint64_t,
-                                                         AmortizedDegree<2048>>(
-            glwe_dimension, level_count, input_lwe_ciphertext_count,
-            max_shared_memory))
-      return get_buffer_size_bootstrap_fast_low_latency<uint64_t>(
-          glwe_dimension, polynomial_size, level_count,
-          input_lwe_ciphertext_count, max_shared_memory);
-    else
-      return get_buffer_size_bootstrap_low_latency<uint64_t>(
-          glwe_dimension, polynomial_size, level_count,
-          input_lwe_ciphertext_count, max_shared_memory);
-    break;
-  case 4096:
-    if (verify_cuda_bootstrap_fast_low_latency_grid_size<uint64_t,
-                                                         AmortizedDegree<4096>>(
-            glwe_dimension, level_count, input_lwe_ciphertext_count,
-            max_shared_memory))
-      return get_buffer_size_bootstrap_fast_low_latency<uint64_t>(
-          glwe_dimension, polynomial_size, level_count,
-          input_lwe_ciphertext_count, max_shared_memory);
-    else
-      return get_buffer_size_bootstrap_low_latency<uint64_t>(
-          glwe_dimension, polynomial_size, level_count,
-          input_lwe_ciphertext_count, max_shared_memory);
-    break;
-  case 8192:
-    if (verify_cuda_bootstrap_fast_low_latency_grid_size<uint64_t,
-                                                         AmortizedDegree<8192>>(
-            glwe_dimension, level_count, input_lwe_ciphertext_count,
-            max_shared_memory))
-      return get_buffer_size_bootstrap_fast_low_latency<uint64_t>(
-          glwe_dimension, polynomial_size, level_count,
-          input_lwe_ciphertext_count, max_shared_memory);
-    else
-      return get_buffer_size_bootstrap_low_latency<uint64_t>(
-          glwe_dimension, polynomial_size, level_count,
-          input_lwe_ciphertext_count, max_shared_memory);
-    break;
-  case 16384:
-    if (verify_cuda_bootstrap_fast_low_latency_grid_size<
-            uint64_t, AmortizedDegree<16384>>(glwe_dimension, level_count,
-                                              input_lwe_ciphertext_count,
-                                              max_shared_memory))
-      return get_buffer_size_bootstrap_fast_low_latency<uint64_t>(
-          glwe_dimension, polynomial_size, level_count,
-          input_lwe_ciphertext_count, max_shared_memory);
-    else
-      return get_buffer_size_bootstrap_low_latency<uint64_t>(
-          glwe_dimension, polynomial_size, level_count,
-          input_lwe_ciphertext_count, max_shared_memory);
-    break;
-  default:
-    return 0;
-    break;
-  }
+  return polynomial_size_dispatch<
+      low_latency_pbs<uint64_t, int64_t>::buffer_size,
+      large_polynomial_sizes>::run(
+      polynomial_size, glwe_dimension, polynomial_size, level_count,
+      input_lwe_ciphertext_count, max_shared_memory);
 }
 
 /*
@@ -113,11 +155,12 @@ void checks_fast_bootstrap_low_latency(int glwe_dimension, int level_count,
 
   assert((
       "Error (GPU low latency PBS): polynomial size should be one of 256, 512, "
-      "1024, 2048, 4096, 8192, 16384",
+      "1024, 2048, 4096, 8192, 16384, 32768, 65536",
       polynomial_size == 256 || polynomial_size == 512 ||
           polynomial_size == 1024 || polynomial_size == 2048 ||
           polynomial_size == 4096 || polynomial_size == 8192 ||
-          polynomial_size == 16384));
+          polynomial_size == 16384 || polynomial_size == 32768 ||
+          polynomial_size == 65536));
 }
 
 /*
@@ -146,94 +189,11 @@ void scratch_cuda_bootstrap_low_latency_32(
   checks_fast_bootstrap_low_latency(
       glwe_dimension, level_count, polynomial_size, input_lwe_ciphertext_count);
 
-  switch (polynomial_size) {
-  case 256:
-    if (verify_cuda_bootstrap_fast_low_latency_grid_size<uint32_t,
-                                                         AmortizedDegree<256>>(
-            glwe_dimension, level_count, input_lwe_ciphertext_count,
-            max_shared_memory))
-      scratch_bootstrap_fast_low_latency<uint32_t, int32_t,
-                                         AmortizedDegree<256>>(
-          stream, pbs_buffer, glwe_dimension, polynomial_size, level_count,
-          input_lwe_ciphertext_count, max_shared_memory, allocate_gpu_memory);
-    else
-      scratch_bootstrap_low_latency<uint32_t, int32_t, Degree<256>>(
-          stream, pbs_buffer, glwe_dimension, polynomial_size, level_count,
-          input_lwe_ciphertext_count, max_shared_memory, allocate_gpu_memory);
-    break;
-  case 512:
-    if (verify_cuda_bootstrap_fast_low_latency_grid_size<uint32_t,
-                                                         AmortizedDegree<512>>(
-            glwe_dimension, level_count, input_lwe_ciphertext_count,
-            max_shared_memory))
-      scratch_bootstrap_fast_low_latency<uint32_t, int32_t,
-                                         AmortizedDegree<512>>(
-          stream, pbs_buffer, glwe_dimension, polynomial_size, level_count,
-          input_lwe_ciphertext_count, max_shared_memory, allocate_gpu_memory);
-    else
-      scratch_bootstrap_low_latency<uint32_t, int32_t, Degree<512>>(
-          stream, pbs_buffer, glwe_dimension, polynomial_size, level_count,
-          input_lwe_ciphertext_count, max_shared_memory, allocate_gpu_memory);
-    break;
-  case 2048:
-    if (verify_cuda_bootstrap_fast_low_latency_grid_size<uint32_t,
-                                                         AmortizedDegree<2048>>(
-            glwe_dimension, level_count, input_lwe_ciphertext_count,
-            max_shared_memory))
-      scratch_bootstrap_fast_low_latency<uint32_t, int32_t,
-                                         AmortizedDegree<2048>>(
-          stream, pbs_buffer, glwe_dimension, polynomial_size, level_count,
-          input_lwe_ciphertext_count, max_shared_memory, allocate_gpu_memory);
-    else
-      scratch_bootstrap_low_latency<uint32_t, int32_t, Degree<2048>>(
-          stream, pbs_buffer, glwe_dimension, polynomial_size, level_count,
-          input_lwe_ciphertext_count, max_shared_memory, allocate_gpu_memory);
-    break;
-  case 4096:
-    if (verify_cuda_bootstrap_fast_low_latency_grid_size<uint32_t,
-                                                         AmortizedDegree<4096>>(
-            glwe_dimension, level_count, input_lwe_ciphertext_count,
-            max_shared_memory))
-      scratch_bootstrap_fast_low_latency<uint32_t, int32_t,
-                                         AmortizedDegree<4096>>(
-          stream, pbs_buffer, glwe_dimension, polynomial_size, level_count,
-          input_lwe_ciphertext_count, max_shared_memory, allocate_gpu_memory);
-    else
-      scratch_bootstrap_low_latency<uint32_t, int32_t, Degree<4096>>(
-          stream, pbs_buffer, glwe_dimension, polynomial_size, level_count,
-          input_lwe_ciphertext_count, max_shared_memory, allocate_gpu_memory);
-    break;
-  case 8192:
-    if (verify_cuda_bootstrap_fast_low_latency_grid_size<uint32_t,
-                                                         AmortizedDegree<8192>>(
-            glwe_dimension, level_count, input_lwe_ciphertext_count,
-            max_shared_memory))
-      scratch_bootstrap_fast_low_latency<uint32_t, int32_t,
-                                         AmortizedDegree<8192>>(
-          stream, pbs_buffer, glwe_dimension, polynomial_size, level_count,
-          input_lwe_ciphertext_count, max_shared_memory, allocate_gpu_memory);
-    else
-      scratch_bootstrap_low_latency<uint32_t, int32_t, Degree<8192>>(
-          stream, pbs_buffer, glwe_dimension, polynomial_size, level_count,
-          input_lwe_ciphertext_count, max_shared_memory, allocate_gpu_memory);
-    break;
-  case 16384:
-    if (verify_cuda_bootstrap_fast_low_latency_grid_size<
-            uint32_t, AmortizedDegree<16384>>(glwe_dimension, level_count,
-                                              input_lwe_ciphertext_count,
-                                              max_shared_memory))
-      scratch_bootstrap_fast_low_latency<uint32_t, int32_t,
-                                         AmortizedDegree<16384>>(
-          stream, pbs_buffer, glwe_dimension, polynomial_size, level_count,
-          input_lwe_ciphertext_count, max_shared_memory, allocate_gpu_memory);
-    else
-      scratch_bootstrap_low_latency<uint32_t, int32_t, Degree<16384>>(
-          stream, pbs_buffer, glwe_dimension, polynomial_size, level_count,
-          input_lwe_ciphertext_count, max_shared_memory, allocate_gpu_memory);
-    break;
-  default:
-    break;
-  }
+  polynomial_size_dispatch<low_latency_pbs<uint32_t, int32_t>::scratch,
+                         large_polynomial_sizes>::run(
+      polynomial_size, stream, pbs_buffer, glwe_dimension, polynomial_size,
+      level_count, input_lwe_ciphertext_count, max_shared_memory,
+      allocate_gpu_memory, false);
 }
 
 /*
@@ -251,108 +211,36 @@ void scratch_cuda_bootstrap_low_latency_64(
   checks_fast_bootstrap_low_latency(
       glwe_dimension, level_count, polynomial_size, input_lwe_ciphertext_count);
 
-  switch (polynomial_size) {
-  case 256:
-    if (verify_cuda_bootstrap_fast_low_latency_grid_size<uint64_t,
-                                                         AmortizedDegree<256>>(
-            glwe_dimension, level_count, input_lwe_ciphertext_count,
-            max_shared_memory))
-      scratch_bootstrap_fast_low_latency<uint64_t, int64_t,
-                                         AmortizedDegree<256>>(
-          stream, pbs_buffer, glwe_dimension, polynomial_size, level_count,
-          input_lwe_ciphertext_count, max_shared_memory, allocate_gpu_memory);
-    else
-      scratch_bootstrap_low_latency<uint64_t, int64_t, Degree<256>>(
-          stream, pbs_buffer, glwe_dimension, polynomial_size, level_count,
-          input_lwe_ciphertext_count, max_shared_memory, allocate_gpu_memory);
-    break;
-  case 512:
-    if (verify_cuda_bootstrap_fast_low_latency_grid_size<uint64_t,
-                                                         AmortizedDegree<512>>(
-            glwe_dimension, level_count, input_lwe_ciphertext_count,
-            max_shared_memory))
-      scratch_bootstrap_fast_low_latency<uint64_t, int64_t,
-                                         AmortizedDegree<512>>(
-          stream, pbs_buffer, glwe_dimension, polynomial_size, level_count,
-          input_lwe_ciphertext_count, max_shared_memory, allocate_gpu_memory);
-    else
-      scratch_bootstrap_low_latency<uint64_t, int64_t, Degree<512>>(
-          stream, pbs_buffer, glwe_dimension, polynomial_size, level_count,
-          input_lwe_ciphertext_count, max_shared_memory, allocate_gpu_memory);
-    break;
-  case 1024:
-    if (verify_cuda_bootstrap_fast_low_latency_grid_size<uint64_t,
-                                                         AmortizedDegree<1024>>(
-            glwe_dimension, level_count, input_lwe_ciphertext_count,
-            max_shared_memory))
-      scratch_bootstrap_fast_low_latency<uint64_t, int64_t,
-                                         AmortizedDegree<1024>>(
-          stream, pbs_buffer, glwe_dimension, polynomial_size, level_count,
-          input_lwe_ciphertext_count, max_shared_memory, allocate_gpu_memory);
-    else
-      scratch_bootstrap_low_latency<uint64_t, int64_t, Degree<1024>>(
-          stream, pbs_buffer, glwe_dimension, polynomial_size, level_count,
-          input_lwe_ciphertext_count, max_shared_memory, allocate_gpu_memory);
-    break;
-  case 2048:
-    if (verify_cuda_bootstrap_fast_low_latency_grid_size<uint64_t,
-                                                         AmortizedDegree<2048>>(
-            glwe_dimension, level_count, input_lwe_ciphertext_count,
-            max_shared_memory))
-      scratch_bootstrap_fast_low_latency<uint64_t, int64_t,
-                                         AmortizedDegree<2048>>(
-          stream, pbs_buffer, glwe_dimension, polynomial_size, level_count,
-          input_lwe_ciphertext_count, max_shared_memory, allocate_gpu_memory);
-    else
-      scratch_bootstrap_low_latency<uint64_t, int64_t, Degree<2048>>(
-          stream, pbs_buffer, glwe_dimension, polynomial_size, level_count,
-          input_lwe_ciphertext_count, max_shared_memory, allocate_gpu_memory);
-    break;
-  case 4096:
-    if (verify_cuda_bootstrap_fast_low_latency_grid_size<uint64_t,
-                                                         AmortizedDegree<4096>>(
-            glwe_dimension, level_count, input_lwe_ciphertext_count,
-            max_shared_memory))
-      scratch_bootstrap_fast_low_latency<uint64_t, int64_t,
-                                         AmortizedDegree<4096>>(
-          stream, pbs_buffer, glwe_dimension, polynomial_size, level_count,
-          input_lwe_ciphertext_count, max_shared_memory, allocate_gpu_memory);
-    else
-      scratch_bootstrap_low_latency<uint64_t, int64_t, Degree<4096>>(
-          stream, pbs_buffer, glwe_dimension, polynomial_size, level_count,
-          input_lwe_ciphertext_count, max_shared_memory, allocate_gpu_memory);
-    break;
-  case 8192:
-    if (verify_cuda_bootstrap_fast_low_latency_grid_size<uint64_t,
-                                                         AmortizedDegree<8192>>(
-            glwe_dimension, level_count, input_lwe_ciphertext_count,
-            max_shared_memory))
-      scratch_bootstrap_fast_low_latency<uint64_t, int64_t,
-                                         AmortizedDegree<8192>>(
-          stream, pbs_buffer, glwe_dimension, polynomial_size, level_count,
-          input_lwe_ciphertext_count, max_shared_memory, allocate_gpu_memory);
-    else
-      scratch_bootstrap_low_latency<uint64_t, int64_t, Degree<8192>>(
-          stream, pbs_buffer, glwe_dimension, polynomial_size, level_count,
-          input_lwe_ciphertext_count, max_shared_memory, allocate_gpu_memory);
-    break;
-  case 16384:
-    if (verify_cuda_bootstrap_fast_low_latency_grid_size<
-            uint64_t, AmortizedDegree<16384>>(glwe_dimension, level_count,
-                                              input_lwe_ciphertext_count,
-                                              max_shared_memory))
-      scratch_bootstrap_fast_low_latency<uint64_t, int64_t,
-                                         AmortizedDegree<16384>>(
-          stream, pbs_buffer, glwe_dimension, polynomial_size, level_count,
-          input_lwe_ciphertext_count, max_shared_memory, allocate_gpu_memory);
-    else
-      scratch_bootstrap_low_latency<uint64_t, int64_t, Degree<16384>>(
-          stream, pbs_buffer, glwe_dimension, polynomial_size, level_count,
-          input_lwe_ciphertext_count, max_shared_memory, allocate_gpu_memory);
-    break;
-  default:
-    break;
-  }
+  polynomial_size_dispatch<low_latency_pbs<uint64_t, int64_t>::scratch,
+                         large_polynomial_sizes>::run(
+      polynomial_size, stream, pbs_buffer, glwe_dimension, polynomial_size,
+      level_count, input_lwe_ciphertext_count, max_shared_memory,
+      allocate_gpu_memory, false);
+}
+
+/*
+ * Same as scratch_cuda_bootstrap_low_latency_64, and also opts the buffer into
+ * running the classic low latency PBS as a single persistent kernel instead of
+ * two kernels per LWE coefficient. It only makes a difference when the fast
+ * variant can't be used and the device supports cooperative launches, the
+ * grid size of the persistent kernel is computed here for the whole life of
+ * the buffer. The buffer must be released with
+ * cleanup_cuda_bootstrap_low_latency.
+ */
+void scratch_cuda_bootstrap_low_latency_persistent_64(
+    cuda_stream_t *stream, int8_t **pbs_buffer, uint32_t glwe_dimension,
+    uint32_t polynomial_size, uint32_t level_count,
+    uint32_t input_lwe_ciphertext_count, uint32_t max_shared_memory,
+    bool allocate_gpu_memory) {
+
+  checks_fast_bootstrap_low_latency(
+      glwe_dimension, level_count, polynomial_size, input_lwe_ciphertext_count);
+
+  polynomial_size_dispatch<low_latency_pbs<uint64_t, int64_t>::scratch,
+                         large_polynomial_sizes>::run(
+      polynomial_size, stream, pbs_buffer, glwe_dimension, polynomial_size,
+      level_count, input_lwe_ciphertext_count, max_shared_memory,
+      allocate_gpu_memory, true);
 }
 
 /* Perform bootstrapping on a batch of input u32 LWE ciphertexts.
@@ -373,192 +261,43 @@ void cuda_bootstrap_low_latency_lwe_ciphertext_vector_32(
   checks_bootstrap_low_latency(32, glwe_dimension, level_count, base_log,
                                polynomial_size, num_samples);
 
-  switch (polynomial_size) {
-  case 256:
-    if (verify_cuda_bootstrap_fast_low_latency_grid_size<uint32_t,
-                                                         AmortizedDegree<256>>(
-            glwe_dimension, level_count, num_samples, max_shared_memory))
-      host_bootstrap_fast_low_latency<uint32_t, AmortizedDegree<256>>(
-          stream, static_cast<uint32_t *>(lwe_array_out),
-          static_cast<uint32_t *>(lwe_output_indexes),
-          static_cast<uint32_t *>(lut_vector),
-          static_cast<uint32_t *>(lut_vector_indexes),
-          static_cast<uint32_t *>(lwe_array_in),
-          static_cast<uint32_t *>(lwe_input_indexes),
-          static_cast<double2 *>(bootstrapping_key), pbs_buffer, glwe_dimension,
-          lwe_dimension, polynomial_size, base_log, level_count, num_samples,
-          num_lut_vectors, max_shared_memory);
-    else
-      host_bootstrap_low_latency<uint32_t, Degree<256>>(
-          stream, static_cast<uint32_t *>(lwe_array_out),
-          static_cast<uint32_t *>(lwe_output_indexes),
-          static_cast<uint32_t *>(lut_vector),
-          static_cast<uint32_t *>(lut_vector_indexes),
-          static_cast<uint32_t *>(lwe_array_in),
-          static_cast<uint32_t *>(lwe_input_indexes),
-          static_cast<double2 *>(bootstrapping_key), pbs_buffer, glwe_dimension,
-          lwe_dimension, polynomial_size, base_log, level_count, num_samples,
-          num_lut_vectors, max_shared_memory);
-    break;
-  case 512:
-    if (verify_cuda_bootstrap_fast_low_latency_grid_size<uint32_t,
-                                                         AmortizedDegree<512>>(
-            glwe_dimension, level_count, num_samples, max_shared_memory))
-      host_bootstrap_fast_low_latency<uint32_t, AmortizedDegree<512>>(
-          stream, static_cast<uint32_t *>(lwe_array_out),
-          static_cast<uint32_t *>(lwe_output_indexes),
-          static_cast<uint32_t *>(lut_vector),
-          static_cast<uint32_t *>(lut_vector_indexes),
-          static_cast<uint32_t *>(lwe_array_in),
-          static_cast<uint32_t *>(lwe_input_indexes),
-          static_cast<double2 *>(bootstrapping_key), pbs_buffer, glwe_dimension,
-          lwe_dimension, polynomial_size, base_log, level_count, num_samples,
-          num_lut_vectors, max_shared_memory);
-    else
-      host_bootstrap_low_latency<uint32_t, Degree<512>>(
-          stream, static_cast<uint32_t *>(lwe_array_out),
-          static_cast<uint32_t *>(lwe_output_indexes),
-          static_cast<uint32_t *>(lut_vector),
-          static_cast<uint32_t *>(lut_vector_indexes),
-          static_cast<uint32_t *>(lwe_array_in),
-          static_cast<uint32_t *>(lwe_input_indexes),
-          static_cast<double2 *>(bootstrapping_key), pbs_buffer, glwe_dimension,
-          lwe_dimension, polynomial_size, base_log, level_count, num_samples,
-          num_lut_vectors, max_shared_memory);
-    break;
-  case 1024:
-    if (verify_cuda_bootstrap_fast_low_latency_grid_size<uint32_t,
-                                                         AmortizedDegree<1024>>(
-            glwe_dimension, level_count, num_samples, max_shared_memory))
-      host_bootstrap_fast_low_latency<uint32_t, AmortizedDegree<1024>>(
-          stream, static_cast<uint32_t *>(lwe_array_out),
-          static_cast<uint32_t *>(lwe_output_indexes),
-          static_cast<uint32_t *>(lut_vector),
-          static_cast<uint32_t *>(lut_vector_indexes),
-          static_cast<uint32_t *>(lwe_array_in),
-          static_cast<uint32_t *>(lwe_input_indexes),
-          static_cast<double2 *>(bootstrapping_key), pbs_buffer, glwe_dimension,
-          lwe_dimension, polynomial_size, base_log, level_count, num_samples,
-          num_lut_vectors, max_shared_memory);
-    else
-      host_bootstrap_low_latency<uint32_t, Degree<1024>>(
-          stream, static_cast<uint32_t *>(lwe_array_out),
-          static_cast<uint32_t *>(lwe_output_indexes),
-          static_cast<uint32_t *>(lut_vector),
-          static_cast<uint32_t *>(lut_vector_indexes),
-          static_cast<uint32_t *>(lwe_array_in),
-          static_cast<uint32_t *>(lwe_input_indexes),
-          static_cast<double2 *>(bootstrapping_key), pbs_buffer, glwe_dimension,
-          lwe_dimension, polynomial_size, base_log, level_count, num_samples,
-          num_lut_vectors, max_shared_memory);
-    break;
-  case 2048:
-    if (verify_cuda_bootstrap_fast_low_latency_grid_size<uint32_t,
-                                                         AmortizedDegree<2048>>(
-            glwe_dimension, level_count, num_samples, max_shared_memory))
-      host_bootstrap_fast_low_latency<uint32_t, AmortizedDegree<2048>>(
-          stream, static_cast<uint32_t *>(lwe_array_out),
-          static_cast<uint32_t *>(lwe_output_indexes),
-          static_cast<uint32_t *>(lut_vector),
-          static_cast<uint32_t *>(lut_vector_indexes),
-          static_cast<uint32_t *>(lwe_array_in),
-          static_cast<uint32_t *>(lwe_input_indexes),
-          static_cast<double2 *>(bootstrapping_key), pbs_buffer, glwe_dimension,
-          lwe_dimension, polynomial_size, base_log, level_count, num_samples,
-          num_lut_vectors, max_shared_memory);
-    else
-      host_bootstrap_low_latency<uint32_t, Degree<2048>>(
-          stream, static_cast<uint32_t *>(lwe_array_out),
-          static_cast<uint32_t *>(lwe_output_indexes),
-          static_cast<uint32_t *>(lut_vector),
-          static_cast<uint32_t *>(lut_vector_indexes),
-          static_cast<uint32_t *>(lwe_array_in),
-          static_cast<uint32_t *>(lwe_input_indexes),
-          static_cast<double2 *>(bootstrapping_key), pbs_buffer, glwe_dimension,
-          lwe_dimension, polynomial_size, base_log, level_count, num_samples,
-          num_lut_vectors, max_shared_memory);
-    break;
-  case 4096:
-    if (verify_cuda_bootstrap_fast_low_latency_grid_size<uint32_t,
-                                                         AmortizedDegree<4096>>(
-            glwe_dimension, level_count, num_samples, max_shared_memory))
-      host_bootstrap_fast_low_latency<uint32_t, AmortizedDegree<4096>>(
-          stream, static_cast<uint32_t *>(lwe_array_out),
-          static_cast<uint32_t *>(lwe_output_indexes),
-          static_cast<uint32_t *>(lut_vector),
-          static_cast<uint32_t *>(lut_vector_indexes),
-          static_cast<uint32_t *>(lwe_array_in),
-          static_cast<uint32_t *>(lwe_input_indexes),
-          static_cast<double2 *>(bootstrapping_key), pbs_buffer, glwe_dimension,
-          lwe_dimension, polynomial_size, base_log, level_count, num_samples,
-          num_lut_vectors, max_shared_memory);
-    else
-      host_bootstrap_low_latency<uint32_t, Degree<4096>>(
-          stream, static_cast<uint32_t *>(lwe_array_out),
-          static_cast<uint32_t *>(lwe_output_indexes),
-          static_cast<uint32_t *>(lut_vector),
-          static_cast<uint32_t *>(lut_vector_indexes),
-          static_cast<uint32_t *>(lwe_array_in),
-          static_cast<uint32_t *>(lwe_input_indexes),
-          static_cast<double2 *>(bootstrapping_key), pbs_buffer, glwe_dimension,
-          lwe_dimension, polynomial_size, base_log, level_count, num_samples,
-          num_lut_vectors, max_shared_memory);
-    break;
-  case 8192:
-    if (verify_cuda_bootstrap_fast_low_latency_grid_size<uint32_t,
-                                                         AmortizedDegree<8192>>(
-            glwe_dimension, level_count, num_samples, max_shared_memory))
-      host_bootstrap_fast_low_latency<uint32_t, AmortizedDegree<8192>>(
-          stream, static_cast<uint32_t *>(lwe_array_out),
-          static_cast<uint32_t *>(lwe_output_indexes),
-          static_cast<uint32_t *>(lut_vector),
-          static_cast<uint32_t *>(lut_vector_indexes),
-          static_cast<uint32_t *>(lwe_array_in),
-          static_cast<uint32_t *>(lwe_input_indexes),
-          static_cast<double2 *>(bootstrapping_key), pbs_buffer, glwe_dimension,
-          lwe_dimension, polynomial_size, base_log, level_count, num_samples,
-          num_lut_vectors, max_shared_memory);
-    else
-      host_bootstrap_low_latency<uint32_t, Degree<8192>>(
-          stream, static_cast<uint32_t *>(lwe_array_out),
-          static_cast<uint32_t *>(lwe_output_indexes),
-          static_cast<uint32_t *>(lut_vector),
-          static_cast<uint32_t *>(lut_vector_indexes),
-          static_cast<uint32_t *>(lwe_array_in),
-          static_cast<uint32_t *>(lwe_input_indexes),
-          static_cast<double2 *>(bootstrapping_key), pbs_buffer, glwe_dimension,
-          lwe_dimension, polynomial_size, base_log, level_count, num_samples,
-          num_lut_vectors, max_shared_memory);
-    break;
-  case 16384:
-    if (verify_cuda_bootstrap_fast_low_latency_grid_size<
-            uint32_t, AmortizedDegree<16384>>(glwe_dimension, level_count,
-                                              num_samples, max_shared_memory))
-      host_bootstrap_fast_low_latency<uint32_t, AmortizedDegree<16384>>(
-          stream, static_cast<uint32_t *>(lwe_array_out),
-          static_cast<uint32_t *>(lwe_output_indexes),
-          static_cast<uint32_t *>(lut_vector),
-          static_cast<uint32_t *>(lut_vector_indexes),
-          static_cast<uint32_t *>(lwe_array_in),
-          static_cast<uint32_t *>(lwe_input_indexes),
-          static_cast<double2 *>(bootstrapping_key), pbs_buffer, glwe_dimension,
-          lwe_dimension, polynomial_size, base_log, level_count, num_samples,
-          num_lut_vectors, max_shared_memory);
-    else
-      host_bootstrap_low_latency<uint32_t, Degree<16384>>(
-          stream, static_cast<uint32_t *>(lwe_array_out),
-          static_cast<uint32_t *>(lwe_output_indexes),
-          static_cast<uint32_t *>(lut_vector),
-          static_cast<uint32_t *>(lut_vector_indexes),
-          static_cast<uint32_t *>(lwe_array_in),
-          static_cast<uint32_t *>(lwe_input_indexes),
-          static_cast<double2 *>(bootstrapping_key), pbs_buffer, glwe_dimension,
-          lwe_dimension, polynomial_size, base_log, level_count, num_samples,
-          num_lut_vectors, max_shared_memory);
-    break;
-  default:
-    break;
-  }
+  polynomial_size_dispatch<low_latency_pbs<uint32_t, int32_t>::bootstrap,
+                         large_polynomial_sizes>::run(
+      polynomial_size, stream, lwe_array_out, lwe_output_indexes, lut_vector,
+      lut_vector_indexes, lwe_array_in, lwe_input_indexes, bootstrapping_key,
+      pbs_buffer, lwe_dimension, glwe_dimension, polynomial_size, base_log,
+      level_count, num_samples, num_lut_vectors, max_shared_memory, 1, 0);
+}
+
+/*
+ * Same as cuda_bootstrap_low_latency_lwe_ciphertext_vector_32, evaluating the
+ * num_many_lut functions packed lut_stride coefficients apart in each LUT, see
+ * include/many_lut.h. lwe_array_out holds num_many_lut * num_samples LWEs, the
+ * output of function i for sample s being at index
+ * i * num_samples + lwe_output_indexes[s].
+ */
+void cuda_bootstrap_low_latency_many_lut_lwe_ciphertext_vector_32(
+    cuda_stream_t *stream, void *lwe_array_out, void *lwe_output_indexes,
+    void *lut_vector, void *lut_vector_indexes, void *lwe_array_in,
+    void *lwe_input_indexes, void *bootstrapping_key, int8_t *pbs_buffer,
+    uint32_t lwe_dimension, uint32_t glwe_dimension, uint32_t polynomial_size,
+    uint32_t base_log, uint32_t level_count, uint32_t num_samples,
+    uint32_t num_lut_vectors, uint32_t lwe_idx, uint32_t max_shared_memory,
+    uint32_t num_many_lut, uint32_t lut_stride) {
+
+  checks_bootstrap_low_latency(32, glwe_dimension, level_count, base_log,
+                               polynomial_size, num_samples);
+  assert(("Error (GPU low latency PBS): the functions of a many-LUT "
+          "accumulator should fit in the polynomial",
+          is_valid_many_lut(polynomial_size, num_many_lut, lut_stride)));
+
+  polynomial_size_dispatch<low_latency_pbs<uint32_t, int32_t>::bootstrap,
+                         large_polynomial_sizes>::run(
+      polynomial_size, stream, lwe_array_out, lwe_output_indexes, lut_vector,
+      lut_vector_indexes, lwe_array_in, lwe_input_indexes, bootstrapping_key,
+      pbs_buffer, lwe_dimension, glwe_dimension, polynomial_size, base_log,
+      level_count, num_samples, num_lut_vectors, max_shared_memory,
+      num_many_lut, lut_stride);
 }
 
 /* Perform bootstrapping on a batch of input u64 LWE ciphertexts.
@@ -647,191 +386,40 @@ void cuda_bootstrap_low_latency_lwe_ciphertext_vector_64(
   checks_bootstrap_low_latency(64, glwe_dimension, level_count, base_log,
                                polynomial_size, num_samples);
 
-  switch (polynomial_size) {
-  case 256:
-    if (verify_cuda_bootstrap_fast_low_latency_grid_size<uint64_t,
-                                                         AmortizedDegree<256>>(
-            glwe_dimension, level_count, num_samples, max_shared_memory))
-      host_bootstrap_fast_low_latency<uint64_t, AmortizedDegree<256>>(
-          stream, static_cast<uint64_t *>(lwe_array_out),
-          static_cast<uint64_t *>(lwe_output_indexes),
-          static_cast<uint64_t *>(lut_vector),
-          static_cast<uint64_t *>(lut_vector_indexes),
-          static_cast<uint64_t *>(lwe_array_in),
-          static_cast<uint64_t *>(lwe_input_indexes),
-          static_cast<double2 *>(bootstrapping_key), pbs_buffer, glwe_dimension,
-          lwe_dimension, polynomial_size, base_log, level_count, num_samples,
-          num_lut_vectors, max_shared_memory);
-    else
-      host_bootstrap_low_latency<uint64_t, Degree<256>>(
-          stream, static_cast<uint64_t *>(lwe_array_out),
-          static_cast<uint64_t *>(lwe_output_indexes),
-          static_cast<uint64_t *>(lut_vector),
-          static_cast<uint64_t *>(lut_vector_indexes),
-          static_cast<uint64_t *>(lwe_array_in),
-          static_cast<uint64_t *>(lwe_input_indexes),
-          static_cast<double2 *>(bootstrapping_key), pbs_buffer, glwe_dimension,
-          lwe_dimension, polynomial_size, base_log, level_count, num_samples,
-          num_lut_vectors, max_shared_memory);
-    break;
-  case 512:
-    if (verify_cuda_bootstrap_fast_low_latency_grid_size<uint64_t,
-                                                         AmortizedDegree<512>>(
-            glwe_dimension, level_count, num_samples, max_shared_memory))
-      host_bootstrap_fast_low_latency<uint64_t, AmortizedDegree<512>>(
-          stream, static_cast<uint64_t *>(lwe_array_out),
-          static_cast<uint64_t *>(lwe_output_indexes),
-          static_cast<uint64_t *>(lut_vector),
-          static_cast<uint64_t *>(lut_vector_indexes),
-          static_cast<uint64_t *>(lwe_array_in),
-          static_cast<uint64_t *>(lwe_input_indexes),
-          static_cast<double2 *>(bootstrapping_key), pbs_buffer, glwe_dimension,
-          lwe_dimension, polynomial_size, base_log, level_count, num_samples,
-          num_lut_vectors, max_shared_memory);
-    else
-      host_bootstrap_low_latency<uint64_t, Degree<512>>(
-          stream, static_cast<uint64_t *>(lwe_array_out),
-          static_cast<uint64_t *>(lwe_output_indexes),
-          static_cast<uint64_t *>(lut_vector),
-          static_cast<uint64_t *>(lut_vector_indexes),
-          static_cast<uint64_t *>(lwe_array_in),
-          static_cast<uint64_t *>(lwe_input_indexes),
-          static_cast<double2 *>(bootstrapping_key), pbs_buffer, glwe_dimension,
-          lwe_dimension, polynomial_size, base_log, level_count, num_samples,
-          num_lut_vectors, max_shared_memory);
-    break;
-  case 1024:
-    if (verify_cuda_bootstrap_fast_low_latency_grid_size<uint32_t,
-                                                         AmortizedDegree<1024>>(
-            glwe_dimension, level_count, num_samples, max_shared_memory))
-      host_bootstrap_fast_low_latency<uint64_t, AmortizedDegree<1024>>(
-          stream, static_cast<uint64_t *>(lwe_array_out),
-          static_cast<uint64_t *>(lwe_output_indexes),
-          static_cast<uint64_t *>(lut_vector),
-          static_cast<uint64_t *>(lut_vector_indexes),
-          static_cast<uint64_t *>(lwe_array_in),
-          static_cast<uint64_t *>(lwe_input_indexes),
-          static_cast<double2 *>(bootstrapping_key), pbs_buffer, glwe_dimension,
-          lwe_dimension, polynomial_size, base_log, level_count, num_samples,
-          num_lut_vectors, max_shared_memory);
-    else
-      host_bootstrap_low_latency<uint64_t, Degree<1024>>(
-          stream, static_cast<uint64_t *>(lwe_array_out),
-          static_cast<uint64_t *>(lwe_output_indexes),
-          static_cast<uint64_t *>(lut_vector),
-          static_cast<uint64_t *>(lut_vector_indexes),
-          static_cast<uint64_t *>(lwe_array_in),
-          static_cast<uint64_t *>(lwe_input_indexes),
-          static_cast<double2 *>(bootstrapping_key), pbs_buffer, glwe_dimension,
-          lwe_dimension, polynomial_size, base_log, level_count, num_samples,
-          num_lut_vectors, max_shared_memory);
-    break;
-  case 2048:
-    if (verify_cuda_bootstrap_fast_low_latency_grid_size<uint32_t,
-                                                         AmortizedDegree<2048>>(
-            glwe_dimension, level_count, num_samples, max_shared_memory))
-      host_bootstrap_fast_low_latency<uint64_t, AmortizedDegree<2048>>(
-          stream, static_cast<uint64_t *>(lwe_array_out),
-          static_cast<uint64_t *>(lwe_output_indexes),
-          static_cast<uint64_t *>(lut_vector),
-          static_cast<uint64_t *>(lut_vector_indexes),
-          static_cast<uint64_t *>(lwe_array_in),
-          static_cast<uint64_t *>(lwe_input_indexes),
-          static_cast<double2 *>(bootstrapping_key), pbs_buffer, glwe_dimension,
-          lwe_dimension, polynomial_size, base_log, level_count, num_samples,
-          num_lut_vectors, max_shared_memory);
-    else
-      host_bootstrap_low_latency<uint64_t, Degree<2048>>(
-          stream, static_cast<uint64_t *>(lwe_array_out),
-          static_cast<uint64_t *>(lwe_output_indexes),
-          static_cast<uint64_t *>(lut_vector),
-          static_cast<uint64_t *>(lut_vector_indexes),
-          static_cast<uint64_t *>(lwe_array_in),
-          static_cast<uint64_t *>(lwe_input_indexes),
-          static_cast<double2 *>(bootstrapping_key), pbs_buffer, glwe_dimension,
-          lwe_dimension, polynomial_size, base_log, level_count, num_samples,
-          num_lut_vectors, max_shared_memory);
-    break;
-  case 4096:
-    if (verify_cuda_bootstrap_fast_low_latency_grid_size<uint32_t,
-                                                         AmortizedDegree<4096>>(
-            glwe_dimension, level_count, num_samples, max_shared_memory))
-      host_bootstrap_fast_low_latency<uint64_t, AmortizedDegree<4096>>(
-          stream, static_cast<uint64_t *>(lwe_array_out),
-          static_cast<uint64_t *>(lwe_output_indexes),
-          static_cast<uint64_t *>(lut_vector),
-          static_cast<uint64_t *>(lut_vector_indexes),
-          static_cast<uint64_t *>(lwe_array_in),
-          static_cast<uint64_t *>(lwe_input_indexes),
-          static_cast<double2 *>(bootstrapping_key), pbs_buffer, glwe_dimension,
-          lwe_dimension, polynomial_size, base_log, level_count, num_samples,
-          num_lut_vectors, max_shared_memory);
-    else
-      host_bootstrap_low_latency<uint64_t, Degree<4096>>(
-          stream, static_cast<uint64_t *>(lwe_array_out),
-          static_cast<uint64_t *>(lwe_output_indexes),
-          static_cast<uint64_t *>(lut_vector),
-          static_cast<uint64_t *>(lut_vector_indexes),
-          static_cast<uint64_t *>(lwe_array_in),
-          static_cast<uint64_t *>(lwe_input_indexes),
-          static_cast<double2 *>(bootstrapping_key), pbs_buffer, glwe_dimension,
-          lwe_dimension, polynomial_size, base_log, level_count, num_samples,
-          num_lut_vectors, max_shared_memory);
-    break;
-  case 8192:
-    if (verify_cuda_bootstrap_fast_low_latency_grid_size<uint32_t,
-                                                         AmortizedDegree<8192>>(
-            glwe_dimension, level_count, num_samples, max_shared_memory))
-      host_bootstrap_fast_low_latency<uint64_t, AmortizedDegree<8192>>(
-          stream, static_cast<uint64_t *>(lwe_array_out),
-          static_cast<uint64_t *>(lwe_output_indexes),
-          static_cast<uint64_t *>(lut_vector),
-          static_cast<uint64_t *>(lut_vector_indexes),
-          static_cast<uint64_t *>(lwe_array_in),
-          static_cast<uint64_t *>(lwe_input_indexes),
-          static_cast<double2 *>(bootstrapping_key), pbs_buffer, glwe_dimension,
-          lwe_dimension, polynomial_size, base_log, level_count, num_samples,
-          num_lut_vectors, max_shared_memory);
-    else
-      host_bootstrap_low_latency<uint64_t, Degree<8192>>(
-          stream, static_cast<uint64_t *>(lwe_array_out),
-          static_cast<uint64_t *>(lwe_output_indexes),
-          static_cast<uint64_t *>(lut_vector),
-          static_cast<uint64_t *>(lut_vector_indexes),
-          static_cast<uint64_t *>(lwe_array_in),
-          static_cast<uint64_t *>(lwe_input_indexes),
-          static_cast<double2 *>(bootstrapping_key), pbs_buffer, glwe_dimension,
-          lwe_dimension, polynomial_size, base_log, level_count, num_samples,
-          num_lut_vectors, max_shared_memory);
-    break;
-  case 16384:
-    if (verify_cuda_bootstrap_fast_low_latency_grid_size<
-            uint64_t, AmortizedDegree<16384>>(glwe_dimension, level_count,
-                                              num_samples, max_shared_memory))
-      host_bootstrap_fast_low_latency<uint64_t, AmortizedDegree<16384>>(
-          stream, static_cast<uint64_t *>(lwe_array_out),
-          static_cast<uint64_t *>(lwe_output_indexes),
-          static_cast<uint64_t *>(lut_vector),
-          static_cast<uint64_t *>(lut_vector_indexes),
-          static_cast<uint64_t *>(lwe_array_in),
-          static_cast<uint64_t *>(lwe_input_indexes),
-          static_cast<double2 *>(bootstrapping_key), pbs_buffer, glwe_dimension,
-          lwe_dimension, polynomial_size, base_log, level_count, num_samples,
-          num_lut_vectors, max_shared_memory);
-    else
-      host_bootstrap_low_latency<uint64_t, Degree<16384>>(
-          stream, static_cast<uint64_t *>(lwe_array_out),
-          static_cast<uint64_t *>(lwe_output_indexes),
-          static_cast<uint64_t *>(lut_vector),
-          static_cast<uint64_t *>(lut_vector_indexes),
-          static_cast<uint64_t *>(lwe_array_in),
-          static_cast<uint64_t *>(lwe_input_indexes),
-          static_cast<double2 *>(bootstrapping_key), pbs_buffer, glwe_dimension,
-          lwe_dimension, polynomial_size, base_log, level_count, num_samples,
-          num_lut_vectors, max_shared_memory);
-  default:
-    break;
-  }
+  polynomial_size_dispatch<low_latency_pbs<uint64_t, int64_t>::bootstrap,
+                         large_polynomial_sizes>::run(
+      polynomial_size, stream, lwe_array_out, lwe_output_indexes, lut_vector,
+      lut_vector_indexes, lwe_array_in, lwe_input_indexes, bootstrapping_key,
+      pbs_buffer, lwe_dimension, glwe_dimension, polynomial_size, base_log,
+      level_count, num_samples, num_lut_vectors, max_shared_memory, 1, 0);
+}
+
+/*
+ * 64-bit version of
+ * cuda_bootstrap_low_latency_many_lut_lwe_ciphertext_vector_32
+ */
+void cuda_bootstrap_low_latency_many_lut_lwe_ciphertext_vector_64(
+    cuda_stream_t *stream, void *lwe_array_out, void *lwe_output_indexes,
+    void *lut_vector, void *lut_vector_indexes, void *lwe_array_in,
+    void *lwe_input_indexes, void *bootstrapping_key, int8_t *pbs_buffer,
+    uint32_t lwe_dimension, uint32_t glwe_dimension, uint32_t polynomial_size,
+    uint32_t base_log, uint32_t level_count, uint32_t num_samples,
+    uint32_t num_lut_vectors, uint32_t lwe_idx, uint32_t max_shared_memory,
+    uint32_t num_many_lut, uint32_t lut_stride) {
+
+  checks_bootstrap_low_latency(64, glwe_dimension, level_count, base_log,
+                               polynomial_size, num_samples);
+  assert(("Error (GPU low latency PBS): the functions of a many-LUT "
+          "accumulator should fit in the polynomial",
+          is_valid_many_lut(polynomial_size, num_many_lut, lut_stride)));
+
+  polynomial_size_dispatch<low_latency_pbs<uint64_t, int64_t>::bootstrap,
+                         large_polynomial_sizes>::run(
+      polynomial_size, stream, lwe_array_out, lwe_output_indexes, lut_vector,
+      lut_vector_indexes, lwe_array_in, lwe_input_indexes, bootstrapping_key,
+      pbs_buffer, lwe_dimension, glwe_dimension, polynomial_size, base_log,
+      level_count, num_samples, num_lut_vectors, max_shared_memory,
+      num_many_lut, lut_stride);
 }
 
 /*
@@ -840,6 +428,119 @@ void cuda_bootstrap_low_latency_lwe_ciphertext_vector_64(
  */
 void cleanup_cuda_bootstrap_low_latency(cuda_stream_t *stream,
                                         int8_t **pbs_buffer) {
+  unregister_low_latency_persistent_pbs_buffer(*pbs_buffer);
   // Free memory
   cuda_drop_async(*pbs_buffer, stream);
 }
+
+// Maximum grid sizes of the persistent kernel, for the buffers scratched with
+// scratch_cuda_bootstrap_low_latency_persistent_64, keyed by address
+static std::mutex persistent_buffers_mutex;
+static std::map<const int8_t *, uint32_t> persistent_buffers;
+
+__host__ void register_low_latency_persistent_pbs_buffer(
+    const int8_t *pbs_buffer, uint32_t max_grid_size) {
+  std::lock_guard<std::mutex> lock(persistent_buffers_mutex);
+  persistent_buffers[pbs_buffer] = max_grid_size;
+}
+
+__host__ void
+unregister_low_latency_persistent_pbs_buffer(const int8_t *pbs_buffer) {
+  std::lock_guard<std::mutex> lock(persistent_buffers_mutex);
+  persistent_buffers.erase(pbs_buffer);
+}
+
+// Returns 0 when pbs_buffer runs the two kernels per iteration
+__host__ uint32_t
+get_low_latency_persistent_max_grid_size(const int8_t *pbs_buffer) {
+  std::lock_guard<std::mutex> lock(persistent_buffers_mutex);
+  auto it = persistent_buffers.find(pbs_buffer);
+  return it == persistent_buffers.end() ? 0 : it->second;
+}
+
+/*
+ * Same as scratch_cuda_bootstrap_low_latency_64, and also configures the
+ * kernel fusing the keyswitch from LWEs of any dimension to lwe_dimension with
+ * the PBS, used by cuda_keyswitch_bootstrap_low_latency_lwe_ciphertext_vector_64
+ */
+void scratch_cuda_keyswitch_bootstrap_low_latency_64(
+    cuda_stream_t *stream, int8_t **pbs_buffer, uint32_t lwe_dimension,
+    uint32_t glwe_dimension, uint32_t polynomial_size, uint32_t level_count,
+    uint32_t input_lwe_ciphertext_count, uint32_t max_shared_memory,
+    bool allocate_gpu_memory) {
+
+  scratch_cuda_bootstrap_low_latency_64(
+      stream, pbs_buffer, glwe_dimension, polynomial_size, level_count,
+      input_lwe_ciphertext_count, max_shared_memory, allocate_gpu_memory);
+
+  // The fused kernel is not instantiated for the sizes above 16384
+  auto keyswitch_bootstrap_scratch = polynomial_size_dispatch<
+      low_latency_pbs<uint64_t, int64_t>::keyswitch_bootstrap_scratch>::
+      lookup(polynomial_size);
+  if (keyswitch_bootstrap_scratch != nullptr)
+    keyswitch_bootstrap_scratch(stream, lwe_dimension, max_shared_memory);
+}
+
+/* Perform keyswitch followed by the low latency PBS on a batch of 64 bits
+ * input LWE ciphertexts.
+ *
+ * When the buffer was scratched with
+ * scratch_cuda_keyswitch_bootstrap_low_latency_64 and the fast (cooperative
+ * groups) variant of the low latency PBS can be used, both are done in a
+ * single kernel. Otherwise a keyswitch kernel is followed by a regular PBS.
+ *
+ * - lwe_array_in: big LWE inputs, with lwe_dimension_in mask values + 1 body
+ * value each
+ * - ksk: keyswitch key from lwe_dimension_in to lwe_dimension
+ * - lwe_array_after_ks: temporary array holding as many LWE ciphertexts of
+ * dimension lwe_dimension as lwe_array_in holds inputs, receives the
+ * keyswitched ciphertexts
+ * - pbs_buffer: buffer allocated with
+ * scratch_cuda_keyswitch_bootstrap_low_latency_64 or
+ * scratch_cuda_bootstrap_low_latency_64
+ * The other arguments are the ones of
+ * cuda_bootstrap_low_latency_lwe_ciphertext_vector_64.
+ */
+void cuda_keyswitch_bootstrap_low_latency_lwe_ciphertext_vector_64(
+    cuda_stream_t *stream, void *lwe_array_out, void *lwe_output_indexes,
+    void *lut_vector, void *lut_vector_indexes, void *lwe_array_in,
+    void *lwe_input_indexes, void *ksk, void *bootstrapping_key,
+    int8_t *pbs_buffer, void *lwe_array_after_ks, uint32_t lwe_dimension_in,
+    uint32_t lwe_dimension, uint32_t glwe_dimension, uint32_t polynomial_size,
+    uint32_t ks_base_log, uint32_t ks_level_count, uint32_t base_log,
+    uint32_t level_count, uint32_t num_samples, uint32_t num_lut_vectors,
+    uint32_t lwe_idx, uint32_t max_shared_memory) {
+  checks_bootstrap_low_latency(64, glwe_dimension, level_count, base_log,
+                               polynomial_size, num_samples);
+
+  // The fused kernel is not instantiated for the sizes above 16384, which
+  // always go through the regular PBS
+  auto keyswitch_bootstrap = polynomial_size_dispatch<
+      low_latency_pbs<uint64_t, int64_t>::keyswitch_bootstrap>::
+      lookup(polynomial_size);
+  bool fused =
+      keyswitch_bootstrap != nullptr &&
+      keyswitch_bootstrap(
+          stream, lwe_array_out, lwe_output_indexes, lut_vector,
+          lut_vector_indexes, lwe_array_in, lwe_input_indexes,
+          lwe_array_after_ks, ksk, bootstrapping_key, pbs_buffer,
+          lwe_dimension_in, lwe_dimension, glwe_dimension, polynomial_size,
+          ks_base_log, ks_level_count, base_log, level_count, num_samples,
+          max_shared_memory);
+
+  if (!fused) {
+    cuda_keyswitch_lwe_ciphertext_vector<uint64_t>(
+        stream, static_cast<uint64_t *>(lwe_array_after_ks),
+        static_cast<uint64_t *>(lwe_input_indexes),
+        static_cast<uint64_t *>(lwe_array_in),
+        static_cast<uint64_t *>(lwe_input_indexes),
+        static_cast<uint64_t *>(ksk), lwe_dimension_in, lwe_dimension,
+        ks_base_log, ks_level_count, num_samples);
+    cuda_bootstrap_low_latency_lwe_ciphertext_vector_64(
+        stream, lwe_array_out, lwe_output_indexes, lut_vector,
+        lut_vector_indexes, lwe_array_after_ks, lwe_input_indexes,
+        bootstrapping_key, pbs_buffer, lwe_dimension, glwe_dimension,
+        polynomial_size, base_log, level_count, num_samples, num_lut_vectors,
+        lwe_idx, max_shared_memory);
+  }
+}
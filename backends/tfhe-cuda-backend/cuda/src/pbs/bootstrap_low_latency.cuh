@@ -15,55 +15,41 @@
 #include "polynomial/parameters.cuh"
 #include "polynomial/polynomial_math.cuh"
 #include "types/complex/operations.cuh"
+#include "utils/kernel_dimensions.cuh"
 
-template <typename Torus, class params, sharedMemDegree SMD>
-__global__ void device_bootstrap_low_latency_step_one(
+/*
+ * First step of a low latency PBS iteration for one block, i.e. one level of
+ * the decomposition (level_id) of one GLWE polynomial (glwe_id) of one sample
+ * (sample_id): rotate the accumulator, decompose it and move the selected
+ * level to the Fourier domain. accumulator holds polynomial_size elements and
+ * accumulator_fft polynomial_size / 2.
+ */
+template <typename Torus, class params>
+__device__ void compute_low_latency_step_one(
     Torus *lut_vector, Torus *lut_vector_indexes, Torus *lwe_array_in,
-    Torus *lwe_input_indexes, double2 *bootstrapping_key,
-    Torus *global_accumulator, double2 *global_accumulator_fft,
-    uint32_t lwe_iteration, uint32_t lwe_dimension, uint32_t polynomial_size,
-    uint32_t base_log, uint32_t level_count, int8_t *device_mem,
-    uint64_t device_memory_size_per_block) {
-
-  // We use shared memory for the polynomials that are used often during the
-  // bootstrap, since shared memory is kept in L1 cache and accessing it is
-  // much faster than global memory
-  extern __shared__ int8_t sharedmem[];
-  int8_t *selected_memory;
-  uint32_t glwe_dimension = gridDim.y - 1;
-
-  if constexpr (SMD == FULLSM) {
-    selected_memory = sharedmem;
-  } else {
-    int block_index = blockIdx.x + blockIdx.y * gridDim.x +
-                      blockIdx.z * gridDim.x * gridDim.y;
-    selected_memory = &device_mem[block_index * device_memory_size_per_block];
-  }
-
-  Torus *accumulator = (Torus *)selected_memory;
-  double2 *accumulator_fft =
-      (double2 *)accumulator +
-      (ptrdiff_t)(sizeof(Torus) * polynomial_size / sizeof(double2));
-
-  if constexpr (SMD == PARTIALSM)
-    accumulator_fft = (double2 *)sharedmem;
+    Torus *lwe_input_indexes, Torus *global_accumulator,
+    double2 *global_accumulator_fft, Torus *accumulator,
+    double2 *accumulator_fft, uint32_t level_id, uint32_t glwe_id,
+    uint32_t sample_id, uint32_t lwe_iteration, uint32_t lwe_dimension,
+    uint32_t glwe_dimension, uint32_t polynomial_size, uint32_t base_log,
+    uint32_t level_count) {
 
-  // The third dimension of the block is used to determine on which ciphertext
-  // this block is operating, in the case of batch bootstraps
+  // The sample selects on which ciphertext this block is operating, in the
+  // case of batch bootstraps
   Torus *block_lwe_array_in =
-      &lwe_array_in[lwe_input_indexes[blockIdx.z] * (lwe_dimension + 1)];
+      &lwe_array_in[lwe_input_indexes[sample_id] * (lwe_dimension + 1)];
 
-  Torus *block_lut_vector = &lut_vector[lut_vector_indexes[blockIdx.z] *
+  Torus *block_lut_vector = &lut_vector[lut_vector_indexes[sample_id] *
                                         params::degree * (glwe_dimension + 1)];
 
   Torus *global_slice =
       global_accumulator +
-      (blockIdx.y + blockIdx.z * (glwe_dimension + 1)) * params::degree;
+      (glwe_id + sample_id * (glwe_dimension + 1)) * params::degree;
 
   double2 *global_fft_slice =
       global_accumulator_fft +
-      (blockIdx.y + blockIdx.x * (glwe_dimension + 1) +
-       blockIdx.z * level_count * (glwe_dimension + 1)) *
+      (glwe_id + level_id * (glwe_dimension + 1) +
+       sample_id * level_count * (glwe_dimension + 1)) *
           (polynomial_size / 2);
 
   if (lwe_iteration == 0) {
@@ -72,11 +58,10 @@ __global__ void device_bootstrap_low_latency_step_one(
     Torus b_hat = 0;
     rescale_torus_element(block_lwe_array_in[lwe_dimension], b_hat,
                           2 * params::degree);
-    // The y-dimension is used to select the element of the GLWE this block will
-    // compute
+    // glwe_id selects the element of the GLWE this block will compute
     divide_by_monomial_negacyclic_inplace<Torus, params::opt,
                                           params::degree / params::opt>(
-        accumulator, &block_lut_vector[blockIdx.y * params::degree], b_hat,
+        accumulator, &block_lut_vector[glwe_id * params::degree], b_hat,
         false);
 
     // Persist
@@ -111,7 +96,7 @@ __global__ void device_bootstrap_low_latency_step_one(
   // decomposition, for the mask and the body (so block 0 will have the
   // accumulator decomposed at level 0, 1 at 1, etc.)
   GadgetMatrix<Torus, params> gadget_acc(base_log, level_count, accumulator);
-  gadget_acc.decompose_and_compress_level(accumulator_fft, blockIdx.x);
+  gadget_acc.decompose_and_compress_level(accumulator_fft, level_id);
 
   // We are using the same memory space for accumulator_fft and
   // accumulator_rotated, so we need to synchronize here to make sure they
@@ -126,43 +111,25 @@ __global__ void device_bootstrap_low_latency_step_one(
   }
 }
 
-template <typename Torus, class params, sharedMemDegree SMD>
-__global__ void device_bootstrap_low_latency_step_two(
-    Torus *lwe_array_out, Torus *lwe_output_indexes, Torus *lut_vector,
-    Torus *lut_vector_indexes, double2 *bootstrapping_key,
+/*
+ * Second step of a low latency PBS iteration for one block, i.e. one GLWE
+ * polynomial (glwe_id) of one sample (sample_id): accumulate the products of
+ * the decomposed levels with the bootstrapping key, go back to the torus and
+ * either persist the accumulator or, on the last iteration, sample extract the
+ * num_many_lut functions it packs.
+ */
+template <typename Torus, class params>
+__device__ void compute_low_latency_step_two(
+    Torus *lwe_array_out, Torus *lwe_output_indexes, double2 *bootstrapping_key,
     Torus *global_accumulator, double2 *global_accumulator_fft,
-    uint32_t lwe_iteration, uint32_t lwe_dimension, uint32_t polynomial_size,
-    uint32_t base_log, uint32_t level_count, int8_t *device_mem,
-    uint64_t device_memory_size_per_block) {
-
-  // We use shared memory for the polynomials that are used often during the
-  // bootstrap, since shared memory is kept in L1 cache and accessing it is
-  // much faster than global memory
-  extern __shared__ int8_t sharedmem[];
-  int8_t *selected_memory;
-  uint32_t glwe_dimension = gridDim.y - 1;
-
-  if constexpr (SMD == FULLSM) {
-    selected_memory = sharedmem;
-  } else {
-    int block_index = blockIdx.x + blockIdx.y * gridDim.x +
-                      blockIdx.z * gridDim.x * gridDim.y;
-    selected_memory = &device_mem[block_index * device_memory_size_per_block];
-  }
-
-  // We always compute the pointer with most restrictive alignment to avoid
-  // alignment issues
-  double2 *accumulator_fft = (double2 *)selected_memory;
-  Torus *accumulator =
-      (Torus *)accumulator_fft +
-      (ptrdiff_t)(sizeof(double2) * params::degree / 2 / sizeof(Torus));
-
-  if constexpr (SMD == PARTIALSM)
-    accumulator_fft = (double2 *)sharedmem;
+    Torus *accumulator, double2 *accumulator_fft, uint32_t glwe_id,
+    uint32_t sample_id, uint32_t lwe_iteration, uint32_t lwe_dimension,
+    uint32_t glwe_dimension, uint32_t polynomial_size, uint32_t level_count,
+    uint32_t num_samples, uint32_t num_many_lut, uint32_t lut_stride) {
 
   for (int level = 0; level < level_count; level++) {
     double2 *global_fft_slice = global_accumulator_fft +
-                                (level + blockIdx.x * level_count) *
+                                (level + sample_id * level_count) *
                                     (glwe_dimension + 1) * (params::degree / 2);
 
     for (int j = 0; j < (glwe_dimension + 1); j++) {
@@ -173,7 +140,7 @@ __global__ void device_bootstrap_low_latency_step_two(
       auto bsk_slice =
           get_ith_mask_kth_block(bootstrapping_key, lwe_iteration, j, level,
                                  polynomial_size, glwe_dimension, level_count);
-      auto bsk_poly = bsk_slice + blockIdx.y * params::degree / 2;
+      auto bsk_poly = bsk_slice + glwe_id * params::degree / 2;
 
       polynomial_product_accumulate_in_fourier_domain<params, double2>(
           accumulator_fft, fft, bsk_poly, !level && !j);
@@ -182,7 +149,7 @@ __global__ void device_bootstrap_low_latency_step_two(
 
   Torus *global_slice =
       global_accumulator +
-      (blockIdx.y + blockIdx.x * (glwe_dimension + 1)) * params::degree;
+      (glwe_id + sample_id * (glwe_dimension + 1)) * params::degree;
 
   // Load the persisted accumulator
   int tid = threadIdx.x;
@@ -199,16 +166,23 @@ __global__ void device_bootstrap_low_latency_step_two(
   if (lwe_iteration + 1 == lwe_dimension) {
     // Last iteration
     auto block_lwe_array_out =
-        &lwe_array_out[lwe_output_indexes[blockIdx.x] *
+        &lwe_array_out[lwe_output_indexes[sample_id] *
                            (glwe_dimension * polynomial_size + 1) +
-                       blockIdx.y * polynomial_size];
+                       glwe_id * polynomial_size];
+    uint64_t lwe_stride =
+        (uint64_t)num_samples * (glwe_dimension * polynomial_size + 1);
+
+    if (num_many_lut > 1)
+      sample_extract_many_lut<Torus, params>(
+          block_lwe_array_out, accumulator, glwe_id == glwe_dimension,
+          num_many_lut, lut_stride, lwe_stride);
 
-    if (blockIdx.y < glwe_dimension) {
+    if (glwe_id < glwe_dimension) {
       // Perform a sample extract. At this point, all blocks have the result,
       // but we do the computation at block 0 to avoid waiting for extra blocks,
       // in case they're not synchronized
       sample_extract_mask<Torus, params>(block_lwe_array_out, accumulator);
-    } else if (blockIdx.y == glwe_dimension) {
+    } else if (glwe_id == glwe_dimension) {
       sample_extract_body<Torus, params>(block_lwe_array_out, accumulator, 0);
     }
   } else {
@@ -221,6 +195,186 @@ __global__ void device_bootstrap_low_latency_step_two(
   }
 }
 
+template <typename Torus, class params, sharedMemDegree SMD>
+__global__ void device_bootstrap_low_latency_step_one(
+    Torus *lut_vector, Torus *lut_vector_indexes, Torus *lwe_array_in,
+    Torus *lwe_input_indexes, double2 *bootstrapping_key,
+    Torus *global_accumulator, double2 *global_accumulator_fft,
+    uint32_t lwe_iteration, uint32_t lwe_dimension, uint32_t polynomial_size,
+    uint32_t base_log, uint32_t level_count, int8_t *device_mem,
+    uint64_t device_memory_size_per_block) {
+
+  // We use shared memory for the polynomials that are used often during the
+  // bootstrap, since shared memory is kept in L1 cache and accessing it is
+  // much faster than global memory
+  extern __shared__ int8_t sharedmem[];
+  int8_t *selected_memory;
+  uint32_t glwe_dimension = gridDim.y - 1;
+
+  if constexpr (SMD == FULLSM) {
+    selected_memory = sharedmem;
+  } else {
+    int block_index = blockIdx.x + blockIdx.y * gridDim.x +
+                      blockIdx.z * gridDim.x * gridDim.y;
+    selected_memory = &device_mem[block_index * device_memory_size_per_block];
+  }
+
+  Torus *accumulator = (Torus *)selected_memory;
+  double2 *accumulator_fft =
+      (double2 *)accumulator +
+      (ptrdiff_t)(sizeof(Torus) * polynomial_size / sizeof(double2));
+
+  if constexpr (SMD == PARTIALSM)
+    accumulator_fft = (double2 *)sharedmem;
+
+  compute_low_latency_step_one<Torus, params>(
+      lut_vector, lut_vector_indexes, lwe_array_in, lwe_input_indexes,
+      global_accumulator, global_accumulator_fft, accumulator, accumulator_fft,
+      blockIdx.x, blockIdx.y, blockIdx.z, lwe_iteration, lwe_dimension,
+      glwe_dimension, polynomial_size, base_log, level_count);
+}
+
+template <typename Torus, class params, sharedMemDegree SMD>
+__global__ void device_bootstrap_low_latency_step_two(
+    Torus *lwe_array_out, Torus *lwe_output_indexes, Torus *lut_vector,
+    Torus *lut_vector_indexes, double2 *bootstrapping_key,
+    Torus *global_accumulator, double2 *global_accumulator_fft,
+    uint32_t lwe_iteration, uint32_t lwe_dimension, uint32_t polynomial_size,
+    uint32_t base_log, uint32_t level_count, int8_t *device_mem,
+    uint64_t device_memory_size_per_block, uint32_t num_many_lut,
+    uint32_t lut_stride) {
+
+  // We use shared memory for the polynomials that are used often during the
+  // bootstrap, since shared memory is kept in L1 cache and accessing it is
+  // much faster than global memory
+  extern __shared__ int8_t sharedmem[];
+  int8_t *selected_memory;
+  uint32_t glwe_dimension = gridDim.y - 1;
+
+  if constexpr (SMD == FULLSM) {
+    selected_memory = sharedmem;
+  } else {
+    int block_index = blockIdx.x + blockIdx.y * gridDim.x +
+                      blockIdx.z * gridDim.x * gridDim.y;
+    selected_memory = &device_mem[block_index * device_memory_size_per_block];
+  }
+
+  // We always compute the pointer with most restrictive alignment to avoid
+  // alignment issues
+  double2 *accumulator_fft = (double2 *)selected_memory;
+  Torus *accumulator =
+      (Torus *)accumulator_fft +
+      (ptrdiff_t)(sizeof(double2) * params::degree / 2 / sizeof(Torus));
+
+  if constexpr (SMD == PARTIALSM)
+    accumulator_fft = (double2 *)sharedmem;
+
+  compute_low_latency_step_two<Torus, params>(
+      lwe_array_out, lwe_output_indexes, bootstrapping_key, global_accumulator,
+      global_accumulator_fft, accumulator, accumulator_fft, blockIdx.y,
+      blockIdx.x, lwe_iteration, lwe_dimension, glwe_dimension,
+      polynomial_size, level_count, gridDim.x, num_many_lut, lut_stride);
+}
+
+/*
+ * Barrier between all the blocks of a persistent kernel, which must all be
+ * resident. The counter is zeroed before the launch and never reset: each
+ * block increments it once per barrier, and the generation-th barrier is
+ * passed when it reaches generation * gridDim.x.
+ */
+__device__ __forceinline__ void persistent_grid_barrier(uint32_t *counter,
+                                                        uint32_t generation) {
+  synchronize_threads_in_block();
+  if (threadIdx.x == 0) {
+    // Publish this block's global writes before arriving, and observe the
+    // other blocks' ones after leaving
+    __threadfence();
+    atomicAdd(counter, 1);
+    uint32_t target = generation * gridDim.x;
+    while (*(volatile uint32_t *)counter < target)
+      ;
+    __threadfence();
+  }
+  synchronize_threads_in_block();
+}
+
+/*
+ * Both steps of all the iterations of the low latency PBS in a single launch.
+ * The grid is one-dimensional and sized to be fully resident on the device:
+ * each block loops over the step one tasks (level, GLWE polynomial, sample)
+ * and then over the step two tasks (GLWE polynomial, sample), a grid barrier
+ * separating the two steps and the iterations. The accumulators go through
+ * global memory exactly as with the two kernels, so the results are
+ * identical.
+ *
+ * accumulator and accumulator_fft are laid out the same way for both steps,
+ * device_memory_size_per_block is the size of the part that isn't in shared
+ * memory.
+ */
+template <typename Torus, class params, sharedMemDegree SMD>
+__global__ void device_bootstrap_low_latency_persistent(
+    Torus *lwe_array_out, Torus *lwe_output_indexes, Torus *lut_vector,
+    Torus *lut_vector_indexes, Torus *lwe_array_in, Torus *lwe_input_indexes,
+    double2 *bootstrapping_key, Torus *global_accumulator,
+    double2 *global_accumulator_fft, uint32_t *barrier_counter,
+    uint32_t lwe_dimension, uint32_t glwe_dimension, uint32_t polynomial_size,
+    uint32_t base_log, uint32_t level_count, uint32_t num_samples,
+    int8_t *device_mem, uint64_t device_memory_size_per_block,
+    uint32_t num_many_lut, uint32_t lut_stride) {
+
+  extern __shared__ int8_t sharedmem[];
+  int8_t *selected_memory;
+
+  if constexpr (SMD == FULLSM)
+    selected_memory = sharedmem;
+  else
+    selected_memory = &device_mem[blockIdx.x * device_memory_size_per_block];
+
+  Torus *accumulator = (Torus *)selected_memory;
+  double2 *accumulator_fft =
+      (double2 *)accumulator +
+      (ptrdiff_t)(sizeof(Torus) * polynomial_size / sizeof(double2));
+
+  if constexpr (SMD == PARTIALSM)
+    accumulator_fft = (double2 *)sharedmem;
+
+  uint32_t step_two_tasks = (glwe_dimension + 1) * num_samples;
+  uint32_t step_one_tasks = level_count * step_two_tasks;
+  uint32_t generation = 0;
+
+  for (uint32_t i = 0; i < lwe_dimension; i++) {
+    for (uint32_t task = blockIdx.x; task < step_one_tasks;
+         task += gridDim.x) {
+      compute_low_latency_step_one<Torus, params>(
+          lut_vector, lut_vector_indexes, lwe_array_in, lwe_input_indexes,
+          global_accumulator, global_accumulator_fft, accumulator,
+          accumulator_fft, task % level_count,
+          (task / level_count) % (glwe_dimension + 1),
+          task / (level_count * (glwe_dimension + 1)), i, lwe_dimension,
+          glwe_dimension, polynomial_size, base_log, level_count);
+      // The next task reuses accumulator and accumulator_fft
+      synchronize_threads_in_block();
+    }
+
+    persistent_grid_barrier(barrier_counter, ++generation);
+
+    for (uint32_t task = blockIdx.x; task < step_two_tasks;
+         task += gridDim.x) {
+      compute_low_latency_step_two<Torus, params>(
+          lwe_array_out, lwe_output_indexes, bootstrapping_key,
+          global_accumulator, global_accumulator_fft, accumulator,
+          accumulator_fft, task % (glwe_dimension + 1),
+          task / (glwe_dimension + 1), i, lwe_dimension, glwe_dimension,
+          polynomial_size, level_count, num_samples, num_many_lut, lut_stride);
+      synchronize_threads_in_block();
+    }
+
+    // The next iteration reads the accumulators persisted by step two
+    if (i + 1 < lwe_dimension)
+      persistent_grid_barrier(barrier_counter, ++generation);
+  }
+}
+
 template <typename Torus>
 __host__ __device__ uint64_t
 get_buffer_size_full_sm_bootstrap_low_latency_step_one(
@@ -271,8 +425,13 @@ __host__ __device__ uint64_t get_buffer_size_bootstrap_low_latency(
     device_mem = partial_dm_step_one * input_lwe_ciphertext_count *
                  level_count * (glwe_dimension + 1);
   }
-  // Otherwise, both kernels run all in shared memory
+  // Otherwise, both kernels run all in shared memory. The persistent kernel
+  // has at most as many blocks as step one and needs at most as much memory
+  // per block, device_mem covers it as well.
   uint64_t buffer_size = device_mem +
+                         // barrier counter of the persistent kernel, padded
+                         // to keep d_mem aligned
+                         sizeof(double2) +
                          // global_accumulator_fft
                          (glwe_dimension + 1) * level_count *
                              input_lwe_ciphertext_count *
@@ -283,13 +442,57 @@ __host__ __device__ uint64_t get_buffer_size_bootstrap_low_latency(
   return buffer_size + buffer_size % sizeof(double2);
 }
 
+/*
+ * Number of blocks of the persistent kernel the device keeps resident at once.
+ * The blocks wait on each other, so the kernel can only be used when the
+ * cooperative launch guarantees that they are all scheduled together:
+ * returns 0 when it can't.
+ */
+template <typename Torus, class params>
+__host__ uint32_t get_max_grid_size_bootstrap_low_latency_persistent(
+    uint32_t gpu_index, uint32_t max_shared_memory) {
+
+  auto device = cuda_get_device_profile(gpu_index);
+  if (device == nullptr || !device->cooperative_launch)
+    return 0;
+
+  uint64_t full_sm =
+      get_buffer_size_full_sm_bootstrap_low_latency_step_one<Torus>(
+          params::degree);
+  uint64_t partial_sm =
+      get_buffer_size_partial_sm_bootstrap_low_latency<Torus>(params::degree);
+
+  int thds = params::degree / params::opt;
+  int max_active_blocks_per_sm = 0;
+  if (max_shared_memory < partial_sm) {
+    max_active_blocks_per_sm = get_max_active_blocks_per_sm<
+        device_bootstrap_low_latency_persistent<Torus, params, NOSM>>(
+        gpu_index, thds, 0);
+  } else if (max_shared_memory < full_sm) {
+    max_active_blocks_per_sm = get_max_active_blocks_per_sm<
+        device_bootstrap_low_latency_persistent<Torus, params, PARTIALSM>>(
+        gpu_index, thds, partial_sm);
+  } else {
+    max_active_blocks_per_sm = get_max_active_blocks_per_sm<
+        device_bootstrap_low_latency_persistent<Torus, params, FULLSM>>(
+        gpu_index, thds, full_sm);
+  }
+  return (uint32_t)max_active_blocks_per_sm * device->sm_count;
+}
+
+/*
+ * With persistent set, the buffer is also registered to run as a single
+ * persistent kernel, whose grid size is computed here once and for all. The
+ * two kernels per iteration are the default.
+ */
 template <typename Torus, typename STorus, typename params>
 __host__ void scratch_bootstrap_low_latency(
     cuda_stream_t *stream, int8_t **pbs_buffer, uint32_t glwe_dimension,
     uint32_t polynomial_size, uint32_t level_count,
     uint32_t input_lwe_ciphertext_count, uint32_t max_shared_memory,
-    bool allocate_gpu_memory) {
+    bool allocate_gpu_memory, bool persistent = false) {
   cudaSetDevice(stream->gpu_index);
+  cuda_initialize_twiddles(stream);
 
   uint64_t full_sm_step_one =
       get_buffer_size_full_sm_bootstrap_low_latency_step_one<Torus>(
@@ -338,12 +541,44 @@ __host__ void scratch_bootstrap_low_latency(
     check_cuda_error(cudaGetLastError());
   }
 
+  // Configure the persistent kernel, which runs both steps
+  if (persistent && max_shared_memory >= partial_sm &&
+      max_shared_memory < full_sm_step_one) {
+    check_cuda_error(cudaFuncSetAttribute(
+        device_bootstrap_low_latency_persistent<Torus, params, PARTIALSM>,
+        cudaFuncAttributeMaxDynamicSharedMemorySize, partial_sm));
+    cudaFuncSetCacheConfig(
+        device_bootstrap_low_latency_persistent<Torus, params, PARTIALSM>,
+        cudaFuncCachePreferShared);
+    check_cuda_error(cudaGetLastError());
+  } else if (persistent && max_shared_memory >= partial_sm) {
+    check_cuda_error(cudaFuncSetAttribute(
+        device_bootstrap_low_latency_persistent<Torus, params, FULLSM>,
+        cudaFuncAttributeMaxDynamicSharedMemorySize, full_sm_step_one));
+    cudaFuncSetCacheConfig(
+        device_bootstrap_low_latency_persistent<Torus, params, FULLSM>,
+        cudaFuncCachePreferShared);
+    check_cuda_error(cudaGetLastError());
+  }
+
   if (allocate_gpu_memory) {
     uint64_t buffer_size = get_buffer_size_bootstrap_low_latency<Torus>(
         glwe_dimension, polynomial_size, level_count,
         input_lwe_ciphertext_count, max_shared_memory);
     *pbs_buffer = (int8_t *)cuda_malloc_async(buffer_size, stream);
     check_cuda_error(cudaGetLastError());
+
+    // A buffer reusing the address of a persistent one released without
+    // cleanup must not run as persistent
+    uint32_t max_grid_size = 0;
+    if (persistent && !stream->measuring)
+      max_grid_size =
+          get_max_grid_size_bootstrap_low_latency_persistent<Torus, params>(
+              stream->gpu_index, max_shared_memory);
+    if (max_grid_size > 0)
+      register_low_latency_persistent_pbs_buffer(*pbs_buffer, max_grid_size);
+    else
+      unregister_low_latency_persistent_pbs_buffer(*pbs_buffer);
   }
 }
 
@@ -395,7 +630,8 @@ __host__ void execute_low_latency_step_two(
     uint32_t glwe_dimension, uint32_t polynomial_size, uint32_t base_log,
     uint32_t level_count, int8_t *d_mem, uint32_t max_shared_memory,
     int lwe_iteration, uint64_t partial_sm, uint64_t partial_dm,
-    uint64_t full_sm, uint64_t full_dm) {
+    uint64_t full_sm, uint64_t full_dm, uint32_t num_many_lut,
+    uint32_t lut_stride) {
 
   int thds = polynomial_size / params::opt;
   dim3 grid(input_lwe_ciphertext_count, glwe_dimension + 1);
@@ -406,24 +642,83 @@ __host__ void execute_low_latency_step_two(
             lwe_array_out, lwe_output_indexes, lut_vector, lut_vector_indexes,
             bootstrapping_key, global_accumulator, global_accumulator_fft,
             lwe_iteration, lwe_dimension, polynomial_size, base_log,
-            level_count, d_mem, full_dm);
+            level_count, d_mem, full_dm, num_many_lut, lut_stride);
   } else if (max_shared_memory < full_sm) {
     device_bootstrap_low_latency_step_two<Torus, params, PARTIALSM>
         <<<grid, thds, partial_sm, stream->stream>>>(
             lwe_array_out, lwe_output_indexes, lut_vector, lut_vector_indexes,
             bootstrapping_key, global_accumulator, global_accumulator_fft,
             lwe_iteration, lwe_dimension, polynomial_size, base_log,
-            level_count, d_mem, partial_dm);
+            level_count, d_mem, partial_dm, num_many_lut, lut_stride);
   } else {
     device_bootstrap_low_latency_step_two<Torus, params, FULLSM>
         <<<grid, thds, full_sm, stream->stream>>>(
             lwe_array_out, lwe_output_indexes, lut_vector, lut_vector_indexes,
             bootstrapping_key, global_accumulator, global_accumulator_fft,
             lwe_iteration, lwe_dimension, polynomial_size, base_log,
-            level_count, d_mem, 0);
+            level_count, d_mem, 0, num_many_lut, lut_stride);
+  }
+  check_cuda_error(cudaGetLastError());
+}
+template <typename Torus, class params>
+__host__ void execute_low_latency_persistent(
+    cuda_stream_t *stream, Torus *lwe_array_out, Torus *lwe_output_indexes,
+    Torus *lut_vector, Torus *lut_vector_indexes, Torus *lwe_array_in,
+    Torus *lwe_input_indexes, double2 *bootstrapping_key,
+    Torus *global_accumulator, double2 *global_accumulator_fft,
+    uint32_t *barrier_counter, uint32_t input_lwe_ciphertext_count,
+    uint32_t lwe_dimension, uint32_t glwe_dimension, uint32_t polynomial_size,
+    uint32_t base_log, uint32_t level_count, int8_t *d_mem,
+    uint32_t max_shared_memory, uint32_t grid_size, uint64_t partial_sm,
+    uint64_t partial_dm, uint64_t full_sm, uint64_t full_dm,
+    uint32_t num_many_lut, uint32_t lut_stride) {
+
+  cuda_memset_async(barrier_counter, 0, sizeof(uint32_t), stream);
+
+  int thds = polynomial_size / params::opt;
+
+  void *kernel_args[20];
+  kernel_args[0] = &lwe_array_out;
+  kernel_args[1] = &lwe_output_indexes;
+  kernel_args[2] = &lut_vector;
+  kernel_args[3] = &lut_vector_indexes;
+  kernel_args[4] = &lwe_array_in;
+  kernel_args[5] = &lwe_input_indexes;
+  kernel_args[6] = &bootstrapping_key;
+  kernel_args[7] = &global_accumulator;
+  kernel_args[8] = &global_accumulator_fft;
+  kernel_args[9] = &barrier_counter;
+  kernel_args[10] = &lwe_dimension;
+  kernel_args[11] = &glwe_dimension;
+  kernel_args[12] = &polynomial_size;
+  kernel_args[13] = &base_log;
+  kernel_args[14] = &level_count;
+  kernel_args[15] = &input_lwe_ciphertext_count;
+  kernel_args[16] = &d_mem;
+  kernel_args[18] = &num_many_lut;
+  kernel_args[19] = &lut_stride;
+
+  if (max_shared_memory < partial_sm) {
+    kernel_args[17] = &full_dm;
+    check_cuda_error(cudaLaunchCooperativeKernel(
+        (void *)device_bootstrap_low_latency_persistent<Torus, params, NOSM>,
+        grid_size, thds, (void **)kernel_args, 0, stream->stream));
+  } else if (max_shared_memory < full_sm) {
+    kernel_args[17] = &partial_dm;
+    check_cuda_error(cudaLaunchCooperativeKernel(
+        (void *)device_bootstrap_low_latency_persistent<Torus, params,
+                                                        PARTIALSM>,
+        grid_size, thds, (void **)kernel_args, partial_sm, stream->stream));
+  } else {
+    uint64_t no_dm = 0;
+    kernel_args[17] = &no_dm;
+    check_cuda_error(cudaLaunchCooperativeKernel(
+        (void *)device_bootstrap_low_latency_persistent<Torus, params, FULLSM>,
+        grid_size, thds, (void **)kernel_args, full_sm, stream->stream));
   }
   check_cuda_error(cudaGetLastError());
 }
+
 /*
  * Host wrapper to the low latency version
  * of bootstrapping
@@ -436,7 +731,8 @@ __host__ void host_bootstrap_low_latency(
     uint32_t glwe_dimension, uint32_t lwe_dimension, uint32_t polynomial_size,
     uint32_t base_log, uint32_t level_count,
     uint32_t input_lwe_ciphertext_count, uint32_t num_lut_vectors,
-    uint32_t max_shared_memory) {
+    uint32_t max_shared_memory, uint32_t num_many_lut = 1,
+    uint32_t lut_stride = 0) {
   cudaSetDevice(stream->gpu_index);
 
   // With SM each block corresponds to either the mask or body, no need to
@@ -462,10 +758,33 @@ __host__ void host_bootstrap_low_latency(
       (ptrdiff_t)(sizeof(double2) * (glwe_dimension + 1) * level_count *
                   input_lwe_ciphertext_count * (polynomial_size / 2) /
                   sizeof(Torus));
-  int8_t *d_mem = (int8_t *)global_accumulator +
-                  (ptrdiff_t)(sizeof(Torus) * (glwe_dimension + 1) *
-                              input_lwe_ciphertext_count * polynomial_size /
-                              sizeof(int8_t));
+  uint32_t *barrier_counter =
+      (uint32_t *)((int8_t *)global_accumulator +
+                   (ptrdiff_t)(sizeof(Torus) * (glwe_dimension + 1) *
+                               input_lwe_ciphertext_count * polynomial_size /
+                               sizeof(int8_t)));
+  int8_t *d_mem = (int8_t *)barrier_counter + sizeof(double2);
+
+  // A single launch instead of two per iteration when the buffer was
+  // scratched for the persistent kernel: as many blocks as there are step one
+  // tasks, capped by what the device keeps resident
+  uint64_t persistent_grid_size =
+      get_low_latency_persistent_max_grid_size(pbs_buffer);
+  uint64_t step_one_tasks =
+      (uint64_t)level_count * (glwe_dimension + 1) * input_lwe_ciphertext_count;
+  if (step_one_tasks < persistent_grid_size)
+    persistent_grid_size = step_one_tasks;
+  if (persistent_grid_size > 0) {
+    execute_low_latency_persistent<Torus, params>(
+        stream, lwe_array_out, lwe_output_indexes, lut_vector,
+        lut_vector_indexes, lwe_array_in, lwe_input_indexes, bootstrapping_key,
+        global_accumulator, global_accumulator_fft, barrier_counter,
+        input_lwe_ciphertext_count, lwe_dimension, glwe_dimension,
+        polynomial_size, base_log, level_count, d_mem, max_shared_memory,
+        persistent_grid_size, partial_sm, partial_dm_step_one,
+        full_sm_step_one, full_dm_step_one, num_many_lut, lut_stride);
+    return;
+  }
 
   for (int i = 0; i < lwe_dimension; i++) {
     execute_low_latency_step_one<Torus, params>(
@@ -480,7 +799,7 @@ __host__ void host_bootstrap_low_latency(
         global_accumulator_fft, input_lwe_ciphertext_count, lwe_dimension,
         glwe_dimension, polynomial_size, base_log, level_count, d_mem,
         max_shared_memory, i, partial_sm, partial_dm_step_two, full_sm_step_two,
-        full_dm_step_two);
+        full_dm_step_two, num_many_lut, lut_stride);
   }
 }
 
@@ -2,8 +2,87 @@
 #include "bootstrap_fast_multibit.cuh"
 #include "bootstrap_multibit.cuh"
 #include "bootstrap_multibit.h"
+#include "many_lut.h"
+#include "multi_bit_tuning.h"
+#include "polynomial_size_dispatch.h"
+#include <map>
+#include <mutex>
 
-void checks_multi_bit_pbs(int polynomial_size) {
+/*
+ * Entry points of the multi-bit PBS for a given polynomial size, looked up
+ * through polynomial_size_dispatch. The fast variant, relying on cooperative
+ * groups, is used whenever its grid fits on the device.
+ */
+template <typename Torus, typename STorus> struct multi_bit_pbs {
+  template <int N> struct scratch {
+    static void run(cuda_stream_t *stream, int8_t **pbs_buffer,
+                    uint32_t lwe_dimension, uint32_t glwe_dimension,
+                    uint32_t polynomial_size, uint32_t level_count,
+                    uint32_t input_lwe_ciphertext_count,
+                    uint32_t grouping_factor, uint32_t max_shared_memory,
+                    bool allocate_gpu_memory, uint32_t lwe_chunk_size) {
+      if (verify_cuda_bootstrap_fast_multi_bit_grid_size<Torus,
+                                                         AmortizedDegree<N>>(
+              glwe_dimension, level_count, input_lwe_ciphertext_count,
+              max_shared_memory)) {
+        scratch_fast_multi_bit_pbs<Torus, STorus, AmortizedDegree<N>>(
+            stream, pbs_buffer, lwe_dimension, glwe_dimension, polynomial_size,
+            level_count, input_lwe_ciphertext_count, grouping_factor,
+            max_shared_memory, allocate_gpu_memory, lwe_chunk_size);
+      } else {
+        scratch_multi_bit_pbs<Torus, STorus, AmortizedDegree<N>>(
+            stream, pbs_buffer, lwe_dimension, glwe_dimension, polynomial_size,
+            level_count, input_lwe_ciphertext_count, grouping_factor,
+            max_shared_memory, allocate_gpu_memory, lwe_chunk_size);
+      }
+    }
+  };
+
+  template <int N> struct bootstrap {
+    static void
+    run(cuda_stream_t *stream, void *lwe_array_out, void *lwe_output_indexes,
+        void *lut_vector, void *lut_vector_indexes, void *lwe_array_in,
+        void *lwe_input_indexes, void *bootstrapping_key, int8_t *pbs_buffer,
+        uint32_t lwe_dimension, uint32_t glwe_dimension,
+        uint32_t polynomial_size, uint32_t grouping_factor, uint32_t base_log,
+        uint32_t level_count, uint32_t num_samples, uint32_t num_lut_vectors,
+        uint32_t lwe_idx, uint32_t max_shared_memory, uint32_t lwe_chunk_size,
+        uint32_t num_samples_per_input, uint32_t num_many_lut,
+        uint32_t lut_stride) {
+      if (verify_cuda_bootstrap_fast_multi_bit_grid_size<Torus,
+                                                         AmortizedDegree<N>>(
+              glwe_dimension, level_count, num_samples, max_shared_memory)) {
+        host_fast_multi_bit_pbs<Torus, STorus, AmortizedDegree<N>>(
+            stream, static_cast<Torus *>(lwe_array_out),
+            static_cast<Torus *>(lwe_output_indexes),
+            static_cast<Torus *>(lut_vector),
+            static_cast<Torus *>(lut_vector_indexes),
+            static_cast<Torus *>(lwe_array_in),
+            static_cast<Torus *>(lwe_input_indexes),
+            static_cast<Torus *>(bootstrapping_key), pbs_buffer,
+            glwe_dimension, lwe_dimension, polynomial_size, grouping_factor,
+            base_log, level_count, num_samples, num_lut_vectors, lwe_idx,
+            max_shared_memory, lwe_chunk_size, num_samples_per_input,
+            num_many_lut, lut_stride);
+      } else {
+        host_multi_bit_pbs<Torus, STorus, AmortizedDegree<N>>(
+            stream, static_cast<Torus *>(lwe_array_out),
+            static_cast<Torus *>(lwe_output_indexes),
+            static_cast<Torus *>(lut_vector),
+            static_cast<Torus *>(lut_vector_indexes),
+            static_cast<Torus *>(lwe_array_in),
+            static_cast<Torus *>(lwe_input_indexes),
+            static_cast<Torus *>(bootstrapping_key), pbs_buffer,
+            glwe_dimension, lwe_dimension, polynomial_size, grouping_factor,
+            base_log, level_count, num_samples, num_lut_vectors, lwe_idx,
+            max_shared_memory, lwe_chunk_size, num_samples_per_input,
+            num_many_lut, lut_stride);
+      }
+    }
+  };
+};
+
+void checks_multi_bit_pbs(int polynomial_size, int grouping_factor) {
   assert(
       ("Error (GPU multi-bit PBS): polynomial size should be one of 256, 512, "
        "1024, 2048, 4096, 8192, 16384",
@@ -11,6 +90,89 @@ void checks_multi_bit_pbs(int polynomial_size) {
            polynomial_size == 1024 || polynomial_size == 2048 ||
            polynomial_size == 4096 || polynomial_size == 8192 ||
            polynomial_size == 16384));
+  assert(("Error (GPU multi-bit PBS): grouping factor should be 2, 3 or 4",
+          grouping_factor >= 2 && grouping_factor <= 4));
+}
+
+void cuda_multi_bit_pbs_lwe_ciphertext_vector_32(
+    cuda_stream_t *stream, void *lwe_array_out, void *lwe_output_indexes,
+    void *lut_vector, void *lut_vector_indexes, void *lwe_array_in,
+    void *lwe_input_indexes, void *bootstrapping_key, int8_t *pbs_buffer,
+    uint32_t lwe_dimension, uint32_t glwe_dimension, uint32_t polynomial_size,
+    uint32_t grouping_factor, uint32_t base_log, uint32_t level_count,
+    uint32_t num_samples, uint32_t num_lut_vectors, uint32_t lwe_idx,
+    uint32_t max_shared_memory, uint32_t lwe_chunk_size) {
+
+  checks_multi_bit_pbs(polynomial_size, grouping_factor);
+
+  polynomial_size_dispatch<multi_bit_pbs<uint32_t, int32_t>::bootstrap>::run(
+      polynomial_size, stream, lwe_array_out, lwe_output_indexes, lut_vector,
+      lut_vector_indexes, lwe_array_in, lwe_input_indexes, bootstrapping_key,
+      pbs_buffer, lwe_dimension, glwe_dimension, polynomial_size,
+      grouping_factor, base_log, level_count, num_samples, num_lut_vectors,
+      lwe_idx, max_shared_memory, lwe_chunk_size, 1, 1, 0);
+}
+
+void cuda_multi_bit_pbs_shared_input_lwe_ciphertext_vector_32(
+    cuda_stream_t *stream, void *lwe_array_out, void *lwe_output_indexes,
+    void *lut_vector, void *lut_vector_indexes, void *lwe_array_in,
+    void *lwe_input_indexes, void *bootstrapping_key, int8_t *pbs_buffer,
+    uint32_t lwe_dimension, uint32_t glwe_dimension, uint32_t polynomial_size,
+    uint32_t grouping_factor, uint32_t base_log, uint32_t level_count,
+    uint32_t num_samples, uint32_t num_samples_per_input,
+    uint32_t num_lut_vectors, uint32_t lwe_idx, uint32_t max_shared_memory,
+    uint32_t lwe_chunk_size) {
+
+  checks_multi_bit_pbs(polynomial_size, grouping_factor);
+  assert(("Error (GPU multi-bit PBS): the number of samples should be a "
+          "multiple of the number of samples per input",
+          num_samples_per_input > 0 &&
+              num_samples % num_samples_per_input == 0));
+
+  polynomial_size_dispatch<multi_bit_pbs<uint32_t, int32_t>::bootstrap>::run(
+      polynomial_size, stream, lwe_array_out, lwe_output_indexes, lut_vector,
+      lut_vector_indexes, lwe_array_in, lwe_input_indexes, bootstrapping_key,
+      pbs_buffer, lwe_dimension, glwe_dimension, polynomial_size,
+      grouping_factor, base_log, level_count, num_samples, num_lut_vectors,
+      lwe_idx, max_shared_memory, lwe_chunk_size, num_samples_per_input, 1,
+      0);
+}
+
+void cuda_multi_bit_pbs_many_lut_lwe_ciphertext_vector_32(
+    cuda_stream_t *stream, void *lwe_array_out, void *lwe_output_indexes,
+    void *lut_vector, void *lut_vector_indexes, void *lwe_array_in,
+    void *lwe_input_indexes, void *bootstrapping_key, int8_t *pbs_buffer,
+    uint32_t lwe_dimension, uint32_t glwe_dimension, uint32_t polynomial_size,
+    uint32_t grouping_factor, uint32_t base_log, uint32_t level_count,
+    uint32_t num_samples, uint32_t num_lut_vectors, uint32_t lwe_idx,
+    uint32_t max_shared_memory, uint32_t num_many_lut, uint32_t lut_stride,
+    uint32_t lwe_chunk_size) {
+
+  checks_multi_bit_pbs(polynomial_size, grouping_factor);
+  assert(("Error (GPU multi-bit PBS): the functions of a many-LUT "
+          "accumulator should fit in the polynomial",
+          is_valid_many_lut(polynomial_size, num_many_lut, lut_stride)));
+
+  polynomial_size_dispatch<multi_bit_pbs<uint32_t, int32_t>::bootstrap>::run(
+      polynomial_size, stream, lwe_array_out, lwe_output_indexes, lut_vector,
+      lut_vector_indexes, lwe_array_in, lwe_input_indexes, bootstrapping_key,
+      pbs_buffer, lwe_dimension, glwe_dimension, polynomial_size,
+      grouping_factor, base_log, level_count, num_samples, num_lut_vectors,
+      lwe_idx, max_shared_memory, lwe_chunk_size, 1, num_many_lut,
+      lut_stride);
+}
+
+void scratch_cuda_multi_bit_pbs_32(
+    cuda_stream_t *stream, int8_t **pbs_buffer, uint32_t lwe_dimension,
+    uint32_t glwe_dimension, uint32_t polynomial_size, uint32_t level_count,
+    uint32_t grouping_factor, uint32_t input_lwe_ciphertext_count,
+    uint32_t max_shared_memory, bool allocate_gpu_memory,
+    uint32_t lwe_chunk_size) {
+
+  polynomial_size_dispatch<multi_bit_pbs<uint32_t, int32_t>::scratch>::run(
+      polynomial_size, stream, pbs_buffer, lwe_dimension, glwe_dimension,
+      polynomial_size, level_count, input_lwe_ciphertext_count,
+      grouping_factor, max_shared_memory, allocate_gpu_memory, lwe_chunk_size);
 }
 
 void cuda_multi_bit_pbs_lwe_ciphertext_vector_64(
@@ -22,215 +184,63 @@ void cuda_multi_bit_pbs_lwe_ciphertext_vector_64(
     uint32_t num_samples, uint32_t num_lut_vectors, uint32_t lwe_idx,
     uint32_t max_shared_memory, uint32_t lwe_chunk_size) {
 
-  checks_multi_bit_pbs(polynomial_size);
-
-  switch (polynomial_size) {
-  case 256:
-    if (verify_cuda_bootstrap_fast_multi_bit_grid_size<uint64_t,
-                                                       AmortizedDegree<256>>(
-            glwe_dimension, level_count, num_samples, max_shared_memory)) {
-      host_fast_multi_bit_pbs<uint64_t, int64_t, AmortizedDegree<256>>(
-          stream, static_cast<uint64_t *>(lwe_array_out),
-          static_cast<uint64_t *>(lwe_output_indexes),
-          static_cast<uint64_t *>(lut_vector),
-          static_cast<uint64_t *>(lut_vector_indexes),
-          static_cast<uint64_t *>(lwe_array_in),
-          static_cast<uint64_t *>(lwe_input_indexes),
-          static_cast<uint64_t *>(bootstrapping_key), pbs_buffer,
-          glwe_dimension, lwe_dimension, polynomial_size, grouping_factor,
-          base_log, level_count, num_samples, num_lut_vectors, lwe_idx,
-          max_shared_memory, lwe_chunk_size);
-    } else {
-      host_multi_bit_pbs<uint64_t, int64_t, AmortizedDegree<256>>(
-          stream, static_cast<uint64_t *>(lwe_array_out),
-          static_cast<uint64_t *>(lwe_output_indexes),
-          static_cast<uint64_t *>(lut_vector),
-          static_cast<uint64_t *>(lut_vector_indexes),
-          static_cast<uint64_t *>(lwe_array_in),
-          static_cast<uint64_t *>(lwe_input_indexes),
-          static_cast<uint64_t *>(bootstrapping_key), pbs_buffer,
-          glwe_dimension, lwe_dimension, polynomial_size, grouping_factor,
-          base_log, level_count, num_samples, num_lut_vectors, lwe_idx,
-          max_shared_memory, lwe_chunk_size);
-    }
-    break;
-  case 512:
-    if (verify_cuda_bootstrap_fast_multi_bit_grid_size<uint64_t,
-                                                       AmortizedDegree<512>>(
-            glwe_dimension, level_count, num_samples, max_shared_memory)) {
-      host_fast_multi_bit_pbs<uint64_t, int64_t, AmortizedDegree<512>>(
-          stream, static_cast<uint64_t *>(lwe_array_out),
-          static_cast<uint64_t *>(lwe_output_indexes),
-          static_cast<uint64_t *>(lut_vector),
-          static_cast<uint64_t *>(lut_vector_indexes),
-          static_cast<uint64_t *>(lwe_array_in),
-          static_cast<uint64_t *>(lwe_input_indexes),
-          static_cast<uint64_t *>(bootstrapping_key), pbs_buffer,
-          glwe_dimension, lwe_dimension, polynomial_size, grouping_factor,
-          base_log, level_count, num_samples, num_lut_vectors, lwe_idx,
-          max_shared_memory, lwe_chunk_size);
-    } else {
-      host_multi_bit_pbs<uint64_t, int64_t, AmortizedDegree<512>>(
-          stream, static_cast<uint64_t *>(lwe_array_out),
-          static_cast<uint64_t *>(lwe_output_indexes),
-          static_cast<uint64_t *>(lut_vector),
-          static_cast<uint64_t *>(lut_vector_indexes),
-          static_cast<uint64_t *>(lwe_array_in),
-          static_cast<uint64_t *>(lwe_input_indexes),
-          static_cast<uint64_t *>(bootstrapping_key), pbs_buffer,
-          glwe_dimension, lwe_dimension, polynomial_size, grouping_factor,
-          base_log, level_count, num_samples, num_lut_vectors, lwe_idx,
-          max_shared_memory, lwe_chunk_size);
-    }
-    break;
-  case 1024:
-    if (verify_cuda_bootstrap_fast_multi_bit_grid_size<uint64_t,
-                                                       AmortizedDegree<1024>>(
-            glwe_dimension, level_count, num_samples, max_shared_memory)) {
-      host_fast_multi_bit_pbs<uint64_t, int64_t, AmortizedDegree<1024>>(
-          stream, static_cast<uint64_t *>(lwe_array_out),
-          static_cast<uint64_t *>(lwe_output_indexes),
-          static_cast<uint64_t *>(lut_vector),
-          static_cast<uint64_t *>(lut_vector_indexes),
-          static_cast<uint64_t *>(lwe_array_in),
-          static_cast<uint64_t *>(lwe_input_indexes),
-          static_cast<uint64_t *>(bootstrapping_key), pbs_buffer,
-          glwe_dimension, lwe_dimension, polynomial_size, grouping_factor,
-          base_log, level_count, num_samples, num_lut_vectors, lwe_idx,
-          max_shared_memory, lwe_chunk_size);
-    } else {
-      host_multi_bit_pbs<uint64_t, int64_t, AmortizedDegree<1024>>(
-          stream, static_cast<uint64_t *>(lwe_array_out),
-          static_cast<uint64_t *>(lwe_output_indexes),
-          static_cast<uint64_t *>(lut_vector),
-          static_cast<uint64_t *>(lut_vector_indexes),
-          static_cast<uint64_t *>(lwe_array_in),
-          static_cast<uint64_t *>(lwe_input_indexes),
-          static_cast<uint64_t *>(bootstrapping_key), pbs_buffer,
-          glwe_dimension, lwe_dimension, polynomial_size, grouping_factor,
-          base_log, level_count, num_samples, num_lut_vectors, lwe_idx,
-          max_shared_memory, lwe_chunk_size);
-    }
-    break;
-  case 2048:
-    if (verify_cuda_bootstrap_fast_multi_bit_grid_size<uint64_t,
-                                                       AmortizedDegree<2048>>(
-            glwe_dimension, level_count, num_samples, max_shared_memory)) {
-      host_fast_multi_bit_pbs<uint64_t, int64_t, AmortizedDegree<2048>>(
-          stream, static_cast<uint64_t *>(lwe_array_out),
-          static_cast<uint64_t *>(lwe_output_indexes),
-          static_cast<uint64_t *>(lut_vector),
-          static_cast<uint64_t *>(lut_vector_indexes),
-          static_cast<uint64_t *>(lwe_array_in),
-          static_cast<uint64_t *>(lwe_input_indexes),
-          static_cast<uint64_t *>(bootstrapping_key), pbs_buffer,
-          glwe_dimension, lwe_dimension, polynomial_size, grouping_factor,
-          base_log, level_count, num_samples, num_lut_vectors, lwe_idx,
-          max_shared_memory, lwe_chunk_size);
-    } else {
-      host_multi_bit_pbs<uint64_t, int64_t, AmortizedDegree<2048>>(
-          stream, static_cast<uint64_t *>(lwe_array_out),
-          static_cast<uint64_t *>(lwe_output_indexes),
-          static_cast<uint64_t *>(lut_vector),
-          static_cast<uint64_t *>(lut_vector_indexes),
-          static_cast<uint64_t *>(lwe_array_in),
-          static_cast<uint64_t *>(lwe_input_indexes),
-          static_cast<uint64_t *>(bootstrapping_key), pbs_buffer,
-          glwe_dimension, lwe_dimension, polynomial_size, grouping_factor,
-          base_log, level_count, num_samples, num_lut_vectors, lwe_idx,
-          max_shared_memory, lwe_chunk_size);
-    }
-    break;
-  case 4096:
-    if (verify_cuda_bootstrap_fast_multi_bit_grid_size<uint64_t,
-                                                       AmortizedDegree<4096>>(
-            glwe_dimension, level_count, num_samples, max_shared_memory)) {
-      host_fast_multi_bit_pbs<uint64_t, int64_t, AmortizedDegree<4096>>(
-          stream, static_cast<uint64_t *>(lwe_array_out),
-          static_cast<uint64_t *>(lwe_output_indexes),
-          static_cast<uint64_t *>(lut_vector),
-          static_cast<uint64_t *>(lut_vector_indexes),
-          static_cast<uint64_t *>(lwe_array_in),
-          static_cast<uint64_t *>(lwe_input_indexes),
-          static_cast<uint64_t *>(bootstrapping_key), pbs_buffer,
-          glwe_dimension, lwe_dimension, polynomial_size, grouping_factor,
-          base_log, level_count, num_samples, num_lut_vectors, lwe_idx,
-          max_shared_memory, lwe_chunk_size);
-    } else {
-      host_multi_bit_pbs<uint64_t, int64_t, AmortizedDegree<4096>>(
-          stream, static_cast<uint64_t *>(lwe_array_out),
-          static_cast<uint64_t *>(lwe_output_indexes),
-          static_cast<uint64_t *>(lut_vector),
-          static_cast<uint64_t *>(lut_vector_indexes),
-          static_cast<uint64_t *>(lwe_array_in),
-          static_cast<uint64_t *>(lwe_input_indexes),
-          static_cast<uint64_t *>(bootstrapping_key), pbs_buffer,
-          glwe_dimension, lwe_dimension, polynomial_size, grouping_factor,
-          base_log, level_count, num_samples, num_lut_vectors, lwe_idx,
-          max_shared_memory, lwe_chunk_size);
-    }
-    break;
-  case 8192:
-    if (verify_cuda_bootstrap_fast_multi_bit_grid_size<uint64_t,
-                                                       AmortizedDegree<8192>>(
-            glwe_dimension, level_count, num_samples, max_shared_memory)) {
-      host_fast_multi_bit_pbs<uint64_t, int64_t, AmortizedDegree<8192>>(
-          stream, static_cast<uint64_t *>(lwe_array_out),
-          static_cast<uint64_t *>(lwe_output_indexes),
-          static_cast<uint64_t *>(lut_vector),
-          static_cast<uint64_t *>(lut_vector_indexes),
-          static_cast<uint64_t *>(lwe_array_in),
-          static_cast<uint64_t *>(lwe_input_indexes),
-          static_cast<uint64_t *>(bootstrapping_key), pbs_buffer,
-          glwe_dimension, lwe_dimension, polynomial_size, grouping_factor,
-          base_log, level_count, num_samples, num_lut_vectors, lwe_idx,
-          max_shared_memory, lwe_chunk_size);
-    } else {
-      host_multi_bit_pbs<uint64_t, int64_t, AmortizedDegree<8192>>(
-          stream, static_cast<uint64_t *>(lwe_array_out),
-          static_cast<uint64_t *>(lwe_output_indexes),
-          static_cast<uint64_t *>(lut_vector),
-          static_cast<uint64_t *>(lut_vector_indexes),
-          static_cast<uint64_t *>(lwe_array_in),
-          static_cast<uint64_t *>(lwe_input_indexes),
-          static_cast<uint64_t *>(bootstrapping_key), pbs_buffer,
-          glwe_dimension, lwe_dimension, polynomial_size, grouping_factor,
-          base_log, level_count, num_samples, num_lut_vectors, lwe_idx,
-          max_shared_memory, lwe_chunk_size);
-    }
-    break;
-  case 16384:
-    if (verify_cuda_bootstrap_fast_multi_bit_grid_size<uint64_t,
-                                                       AmortizedDegree<16384>>(
-            glwe_dimension, level_count, num_samples, max_shared_memory)) {
-      host_fast_multi_bit_pbs<uint64_t, int64_t, AmortizedDegree<16384>>(
-          stream, static_cast<uint64_t *>(lwe_array_out),
-          static_cast<uint64_t *>(lwe_output_indexes),
-          static_cast<uint64_t *>(lut_vector),
-          static_cast<uint64_t *>(lut_vector_indexes),
-          static_cast<uint64_t *>(lwe_array_in),
-          static_cast<uint64_t *>(lwe_input_indexes),
-          static_cast<uint64_t *>(bootstrapping_key), pbs_buffer,
-          glwe_dimension, lwe_dimension, polynomial_size, grouping_factor,
-          base_log, level_count, num_samples, num_lut_vectors, lwe_idx,
-          max_shared_memory, lwe_chunk_size);
-    } else {
-      host_multi_bit_pbs<uint64_t, int64_t, AmortizedDegree<16384>>(
-          stream, static_cast<uint64_t *>(lwe_array_out),
-          static_cast<uint64_t *>(lwe_output_indexes),
-          static_cast<uint64_t *>(lut_vector),
-          static_cast<uint64_t *>(lut_vector_indexes),
-          static_cast<uint64_t *>(lwe_array_in),
-          static_cast<uint64_t *>(lwe_input_indexes),
-          static_cast<uint64_t *>(bootstrapping_key), pbs_buffer,
-          glwe_dimension, lwe_dimension, polynomial_size, grouping_factor,
-          base_log, level_count, num_samples, num_lut_vectors, lwe_idx,
-          max_shared_memory, lwe_chunk_size);
-    }
-    break;
-  default:
-    break;
-  }
+  checks_multi_bit_pbs(polynomial_size, grouping_factor);
+
+  polynomial_size_dispatch<multi_bit_pbs<uint64_t, int64_t>::bootstrap>::run(
+      polynomial_size, stream, lwe_array_out, lwe_output_indexes, lut_vector,
+      lut_vector_indexes, lwe_array_in, lwe_input_indexes, bootstrapping_key,
+      pbs_buffer, lwe_dimension, glwe_dimension, polynomial_size,
+      grouping_factor, base_log, level_count, num_samples, num_lut_vectors,
+      lwe_idx, max_shared_memory, lwe_chunk_size, 1, 1, 0);
+}
+
+void cuda_multi_bit_pbs_shared_input_lwe_ciphertext_vector_64(
+    cuda_stream_t *stream, void *lwe_array_out, void *lwe_output_indexes,
+    void *lut_vector, void *lut_vector_indexes, void *lwe_array_in,
+    void *lwe_input_indexes, void *bootstrapping_key, int8_t *pbs_buffer,
+    uint32_t lwe_dimension, uint32_t glwe_dimension, uint32_t polynomial_size,
+    uint32_t grouping_factor, uint32_t base_log, uint32_t level_count,
+    uint32_t num_samples, uint32_t num_samples_per_input,
+    uint32_t num_lut_vectors, uint32_t lwe_idx, uint32_t max_shared_memory,
+    uint32_t lwe_chunk_size) {
+
+  checks_multi_bit_pbs(polynomial_size, grouping_factor);
+  assert(("Error (GPU multi-bit PBS): the number of samples should be a "
+          "multiple of the number of samples per input",
+          num_samples_per_input > 0 &&
+              num_samples % num_samples_per_input == 0));
+
+  polynomial_size_dispatch<multi_bit_pbs<uint64_t, int64_t>::bootstrap>::run(
+      polynomial_size, stream, lwe_array_out, lwe_output_indexes, lut_vector,
+      lut_vector_indexes, lwe_array_in, lwe_input_indexes, bootstrapping_key,
+      pbs_buffer, lwe_dimension, glwe_dimension, polynomial_size,
+      grouping_factor, base_log, level_count, num_samples, num_lut_vectors,
+      lwe_idx, max_shared_memory, lwe_chunk_size, num_samples_per_input, 1,
+      0);
+}
+
+void cuda_multi_bit_pbs_many_lut_lwe_ciphertext_vector_64(
+    cuda_stream_t *stream, void *lwe_array_out, void *lwe_output_indexes,
+    void *lut_vector, void *lut_vector_indexes, void *lwe_array_in,
+    void *lwe_input_indexes, void *bootstrapping_key, int8_t *pbs_buffer,
+    uint32_t lwe_dimension, uint32_t glwe_dimension, uint32_t polynomial_size,
+    uint32_t grouping_factor, uint32_t base_log, uint32_t level_count,
+    uint32_t num_samples, uint32_t num_lut_vectors, uint32_t lwe_idx,
+    uint32_t max_shared_memory, uint32_t num_many_lut, uint32_t lut_stride,
+    uint32_t lwe_chunk_size) {
+
+  checks_multi_bit_pbs(polynomial_size, grouping_factor);
+  assert(("Error (GPU multi-bit PBS): the functions of a many-LUT "
+          "accumulator should fit in the polynomial",
+          is_valid_many_lut(polynomial_size, num_many_lut, lut_stride)));
+
+  polynomial_size_dispatch<multi_bit_pbs<uint64_t, int64_t>::bootstrap>::run(
+      polynomial_size, stream, lwe_array_out, lwe_output_indexes, lut_vector,
+      lut_vector_indexes, lwe_array_in, lwe_input_indexes, bootstrapping_key,
+      pbs_buffer, lwe_dimension, glwe_dimension, polynomial_size,
+      grouping_factor, base_log, level_count, num_samples, num_lut_vectors,
+      lwe_idx, max_shared_memory, lwe_chunk_size, 1, num_many_lut,
+      lut_stride);
 }
 
 void scratch_cuda_multi_bit_pbs_64(
@@ -240,144 +250,35 @@ void scratch_cuda_multi_bit_pbs_64(
     uint32_t max_shared_memory, bool allocate_gpu_memory,
     uint32_t lwe_chunk_size) {
 
-  switch (polynomial_size) {
-  case 256:
-    if (verify_cuda_bootstrap_fast_multi_bit_grid_size<uint64_t,
-                                                       AmortizedDegree<256>>(
-            glwe_dimension, level_count, input_lwe_ciphertext_count,
-            max_shared_memory)) {
-      scratch_fast_multi_bit_pbs<uint64_t, int64_t, AmortizedDegree<256>>(
-          stream, pbs_buffer, lwe_dimension, glwe_dimension, polynomial_size,
-          level_count, input_lwe_ciphertext_count, grouping_factor,
-          max_shared_memory, allocate_gpu_memory, lwe_chunk_size);
-    } else {
-      scratch_multi_bit_pbs<uint64_t, int64_t, AmortizedDegree<256>>(
-          stream, pbs_buffer, lwe_dimension, glwe_dimension, polynomial_size,
-          level_count, input_lwe_ciphertext_count, grouping_factor,
-          max_shared_memory, allocate_gpu_memory, lwe_chunk_size);
-    }
-    break;
-  case 512:
-    if (verify_cuda_bootstrap_fast_multi_bit_grid_size<uint64_t,
-                                                       AmortizedDegree<512>>(
-            glwe_dimension, level_count, input_lwe_ciphertext_count,
-            max_shared_memory)) {
-      scratch_fast_multi_bit_pbs<uint64_t, int64_t, AmortizedDegree<512>>(
-          stream, pbs_buffer, lwe_dimension, glwe_dimension, polynomial_size,
-          level_count, input_lwe_ciphertext_count, grouping_factor,
-          max_shared_memory, allocate_gpu_memory, lwe_chunk_size);
-    } else {
-      scratch_multi_bit_pbs<uint64_t, int64_t, AmortizedDegree<512>>(
-          stream, pbs_buffer, lwe_dimension, glwe_dimension, polynomial_size,
-          level_count, input_lwe_ciphertext_count, grouping_factor,
-          max_shared_memory, allocate_gpu_memory, lwe_chunk_size);
-    }
-    break;
-  case 1024:
-    if (verify_cuda_bootstrap_fast_multi_bit_grid_size<uint64_t,
-                                                       AmortizedDegree<1024>>(
-            glwe_dimension, level_count, input_lwe_ciphertext_count,
-            max_shared_memory)) {
-      scratch_fast_multi_bit_pbs<uint64_t, int64_t, AmortizedDegree<1024>>(
-          stream, pbs_buffer, lwe_dimension, glwe_dimension, polynomial_size,
-          level_count, input_lwe_ciphertext_count, grouping_factor,
-          max_shared_memory, allocate_gpu_memory, lwe_chunk_size);
-    } else {
-      scratch_multi_bit_pbs<uint64_t, int64_t, AmortizedDegree<1024>>(
-          stream, pbs_buffer, lwe_dimension, glwe_dimension, polynomial_size,
-          level_count, input_lwe_ciphertext_count, grouping_factor,
-          max_shared_memory, allocate_gpu_memory, lwe_chunk_size);
-    }
-    break;
-  case 2048:
-    if (verify_cuda_bootstrap_fast_multi_bit_grid_size<uint64_t,
-                                                       AmortizedDegree<2048>>(
-            glwe_dimension, level_count, input_lwe_ciphertext_count,
-            max_shared_memory)) {
-      scratch_fast_multi_bit_pbs<uint64_t, int64_t, AmortizedDegree<2048>>(
-          stream, pbs_buffer, lwe_dimension, glwe_dimension, polynomial_size,
-          level_count, input_lwe_ciphertext_count, grouping_factor,
-          max_shared_memory, allocate_gpu_memory, lwe_chunk_size);
-    } else {
-      scratch_multi_bit_pbs<uint64_t, int64_t, AmortizedDegree<2048>>(
-          stream, pbs_buffer, lwe_dimension, glwe_dimension, polynomial_size,
-          level_count, input_lwe_ciphertext_count, grouping_factor,
-          max_shared_memory, allocate_gpu_memory, lwe_chunk_size);
-    }
-    break;
-  case 4096:
-    if (verify_cuda_bootstrap_fast_multi_bit_grid_size<uint64_t,
-                                                       AmortizedDegree<4096>>(
-            glwe_dimension, level_count, input_lwe_ciphertext_count,
-            max_shared_memory)) {
-      scratch_fast_multi_bit_pbs<uint64_t, int64_t, AmortizedDegree<4096>>(
-          stream, pbs_buffer, lwe_dimension, glwe_dimension, polynomial_size,
-          level_count, input_lwe_ciphertext_count, grouping_factor,
-          max_shared_memory, allocate_gpu_memory, lwe_chunk_size);
-    } else {
-      scratch_multi_bit_pbs<uint64_t, int64_t, AmortizedDegree<4096>>(
-          stream, pbs_buffer, lwe_dimension, glwe_dimension, polynomial_size,
-          level_count, input_lwe_ciphertext_count, grouping_factor,
-          max_shared_memory, allocate_gpu_memory, lwe_chunk_size);
-    }
-    break;
-  case 8192:
-    if (verify_cuda_bootstrap_fast_multi_bit_grid_size<uint64_t,
-                                                       AmortizedDegree<8192>>(
-            glwe_dimension, level_count, input_lwe_ciphertext_count,
-            max_shared_memory)) {
-      scratch_fast_multi_bit_pbs<uint64_t, int64_t, AmortizedDegree<8192>>(
-          stream, pbs_buffer, lwe_dimension, glwe_dimension, polynomial_size,
-          level_count, input_lwe_ciphertext_count, grouping_factor,
-          max_shared_memory, allocate_gpu_memory, lwe_chunk_size);
-    } else {
-      scratch_multi_bit_pbs<uint64_t, int64_t, AmortizedDegree<8192>>(
-          stream, pbs_buffer, lwe_dimension, glwe_dimension, polynomial_size,
-          level_count, input_lwe_ciphertext_count, grouping_factor,
-          max_shared_memory, allocate_gpu_memory, lwe_chunk_size);
-    }
-    break;
-  case 16384:
-    if (verify_cuda_bootstrap_fast_multi_bit_grid_size<uint64_t,
-                                                       AmortizedDegree<16384>>(
-            glwe_dimension, level_count, input_lwe_ciphertext_count,
-            max_shared_memory)) {
-      scratch_fast_multi_bit_pbs<uint64_t, int64_t, AmortizedDegree<16384>>(
-          stream, pbs_buffer, lwe_dimension, glwe_dimension, polynomial_size,
-          level_count, input_lwe_ciphertext_count, grouping_factor,
-          max_shared_memory, allocate_gpu_memory, lwe_chunk_size);
-    } else {
-      scratch_multi_bit_pbs<uint64_t, int64_t, AmortizedDegree<16384>>(
-          stream, pbs_buffer, lwe_dimension, glwe_dimension, polynomial_size,
-          level_count, input_lwe_ciphertext_count, grouping_factor,
-          max_shared_memory, allocate_gpu_memory, lwe_chunk_size);
-    }
-    break;
-  default:
-    break;
-  }
+  polynomial_size_dispatch<multi_bit_pbs<uint64_t, int64_t>::scratch>::run(
+      polynomial_size, stream, pbs_buffer, lwe_dimension, glwe_dimension,
+      polynomial_size, level_count, input_lwe_ciphertext_count,
+      grouping_factor, max_shared_memory, allocate_gpu_memory, lwe_chunk_size);
 }
 
 void cleanup_cuda_multi_bit_pbs(cuda_stream_t *stream, int8_t **pbs_buffer) {
 
+  unregister_multi_bit_pbs_buffer(*pbs_buffer);
   // Free memory
   cuda_drop_async(*pbs_buffer, stream);
 }
 
 // Pick the best possible chunk size for each GPU
-__host__ uint32_t get_lwe_chunk_size(uint32_t lwe_dimension,
+__host__ uint32_t get_lwe_chunk_size(uint32_t gpu_index,
+                                     uint32_t lwe_dimension,
                                      uint32_t level_count,
                                      uint32_t glwe_dimension,
                                      uint32_t num_samples) {
 
-  cudaDeviceProp deviceProp;
-  cudaGetDeviceProperties(&deviceProp, 0); // Assuming device 0
+  auto device = cuda_get_device_profile(gpu_index);
+  if (device == nullptr)
+    return 1;
 
   const char *v100Name = "V100"; // Known name of V100 GPU
   const char *a100Name = "A100"; // Known name of A100 GPU
   const char *h100Name = "H100"; // Known name of H100 GPU
 
-  if (std::strstr(deviceProp.name, v100Name) != nullptr) {
+  if (std::strstr(device->name, v100Name) != nullptr) {
     // Tesla V100
     if (num_samples == 1)
       return 60;
@@ -403,7 +304,7 @@ __host__ uint32_t get_lwe_chunk_size(uint32_t lwe_dimension,
       return 15;
     else
       return 12;
-  } else if (std::strstr(deviceProp.name, a100Name) != nullptr) {
+  } else if (std::strstr(device->name, a100Name) != nullptr) {
     // Tesla A100
     if (num_samples < 4)
       return 11;
@@ -425,7 +326,7 @@ __host__ uint32_t get_lwe_chunk_size(uint32_t lwe_dimension,
       return 12;
     else
       return 9;
-  } else if (std::strstr(deviceProp.name, h100Name) != nullptr) {
+  } else if (std::strstr(device->name, h100Name) != nullptr) {
     // Tesla H100
     return 45;
   }
@@ -435,25 +336,27 @@ __host__ uint32_t get_lwe_chunk_size(uint32_t lwe_dimension,
 }
 
 // Returns a chunk size that is not optimal but close to
-__host__ uint32_t get_average_lwe_chunk_size(uint32_t lwe_dimension,
+__host__ uint32_t get_average_lwe_chunk_size(uint32_t gpu_index,
+                                             uint32_t lwe_dimension,
                                              uint32_t level_count,
                                              uint32_t glwe_dimension,
                                              uint32_t ct_count) {
 
-  cudaDeviceProp deviceProp;
-  cudaGetDeviceProperties(&deviceProp, 0); // Assuming device 0
+  auto device = cuda_get_device_profile(gpu_index);
+  if (device == nullptr)
+    return (ct_count > 10000) ? 2 : 10;
 
   const char *v100Name = "V100"; // Known name of V100 GPU
   const char *a100Name = "A100"; // Known name of A100 GPU
   const char *h100Name = "H100"; // Known name of H100 GPU
 
-  if (std::strstr(deviceProp.name, v100Name) != nullptr) {
+  if (std::strstr(device->name, v100Name) != nullptr) {
     // Tesla V100
     return (ct_count > 10000) ? 12 : 18;
-  } else if (std::strstr(deviceProp.name, a100Name) != nullptr) {
+  } else if (std::strstr(device->name, a100Name) != nullptr) {
     // Tesla A100
     return (ct_count > 10000) ? 30 : 45;
-  } else if (std::strstr(deviceProp.name, h100Name) != nullptr) {
+  } else if (std::strstr(device->name, h100Name) != nullptr) {
     // Tesla H100
     return (ct_count > 10000) ? 30 : 45;
   }
@@ -466,8 +369,9 @@ __host__ uint32_t get_average_lwe_chunk_size(uint32_t lwe_dimension,
 // max_input_lwe_ciphertext_count
 // todo: Deprecate this function
 __host__ uint64_t get_max_buffer_size_multibit_bootstrap(
-    uint32_t lwe_dimension, uint32_t glwe_dimension, uint32_t polynomial_size,
-    uint32_t level_count, uint32_t max_input_lwe_ciphertext_count) {
+    uint32_t gpu_index, uint32_t lwe_dimension, uint32_t glwe_dimension,
+    uint32_t polynomial_size, uint32_t level_count,
+    uint32_t max_input_lwe_ciphertext_count) {
 
   uint64_t max_buffer_size = 0;
   for (uint32_t input_lwe_ciphertext_count = 1;
@@ -478,9 +382,284 @@ __host__ uint64_t get_max_buffer_size_multibit_bootstrap(
         get_buffer_size_multibit_bootstrap<uint64_t>(
             glwe_dimension, polynomial_size, level_count,
             input_lwe_ciphertext_count,
-            get_lwe_chunk_size(lwe_dimension, level_count, glwe_dimension,
-                               input_lwe_ciphertext_count)));
+            get_lwe_chunk_size(gpu_index, lwe_dimension, level_count,
+                               glwe_dimension, input_lwe_ciphertext_count)));
   }
 
   return max_buffer_size;
 }
+
+static std::mutex tuning_cache_mutex;
+static multi_bit_tuning_cache tuning_cache;
+static bool tuning_cache_loaded = false;
+
+// The tuning cache is stored in the file pointed by TFHE_CUDA_TUNING_CACHE,
+// or in the home directory. Returns an empty path if neither is set, in which
+// case tuning results only last for the process.
+static std::string get_tuning_cache_path() {
+  const char *path = std::getenv("TFHE_CUDA_TUNING_CACHE");
+  if (path != nullptr)
+    return path;
+  const char *home = std::getenv("HOME");
+  if (home != nullptr)
+    return std::string(home) + "/.tfhe_cuda_backend_tuning_cache";
+  return "";
+}
+
+// Must be called with tuning_cache_mutex held
+static multi_bit_tuning_cache &get_tuning_cache() {
+  if (!tuning_cache_loaded) {
+    auto path = get_tuning_cache_path();
+    if (!path.empty())
+      tuning_cache.load_file(path);
+    tuning_cache_loaded = true;
+  }
+  return tuning_cache;
+}
+
+static std::string get_device_fingerprint(const cuda_device_profile *device) {
+  return make_device_fingerprint(device->name, device->major, device->minor,
+                                 device->sm_count);
+}
+
+// Returns the chunk size tuned for this device and shape, or the average one
+// if it was never tuned
+__host__ uint32_t get_tuned_lwe_chunk_size(
+    uint32_t gpu_index, uint32_t lwe_dimension, uint32_t glwe_dimension,
+    uint32_t polynomial_size, uint32_t level_count, uint32_t grouping_factor,
+    uint32_t num_samples) {
+
+  auto device = cuda_get_device_profile(gpu_index);
+  if (device != nullptr) {
+    multi_bit_pbs_shape shape = {lwe_dimension, glwe_dimension,
+                                 polynomial_size, level_count,
+                                 grouping_factor};
+    std::lock_guard<std::mutex> lock(tuning_cache_mutex);
+    uint32_t lwe_chunk_size = get_tuning_cache().lookup(
+        get_device_fingerprint(device), shape, num_samples);
+    if (lwe_chunk_size)
+      return lwe_chunk_size;
+  }
+
+  return get_average_lwe_chunk_size(gpu_index, lwe_dimension, level_count,
+                                    glwe_dimension, num_samples);
+}
+
+// Returns the chunk size a buffer for max_num_samples has to be sized with,
+// so that it can also hold the keybundle of any smaller batch, which may be
+// executed with a larger chunk size
+__host__ uint32_t get_scratch_lwe_chunk_size(
+    uint32_t gpu_index, uint32_t lwe_dimension, uint32_t glwe_dimension,
+    uint32_t polynomial_size, uint32_t level_count, uint32_t grouping_factor,
+    uint32_t max_num_samples) {
+
+  if (max_num_samples == 0)
+    return get_tuned_lwe_chunk_size(gpu_index, lwe_dimension, glwe_dimension,
+                                    polynomial_size, level_count,
+                                    grouping_factor, max_num_samples);
+
+  uint64_t max_product = 0;
+  auto device = cuda_get_device_profile(gpu_index);
+  if (device != nullptr) {
+    multi_bit_pbs_shape shape = {lwe_dimension, glwe_dimension,
+                                 polynomial_size, level_count,
+                                 grouping_factor};
+    std::lock_guard<std::mutex> lock(tuning_cache_mutex);
+    max_product = get_tuning_cache().max_chunk_product(
+        get_device_fingerprint(device), shape, max_num_samples);
+  }
+
+  if (max_product == 0) {
+    // get_average_lwe_chunk_size only changes its choice above 10000 samples
+    uint32_t breakpoint = std::min(max_num_samples, (uint32_t)10000);
+    max_product =
+        std::max((uint64_t)max_num_samples *
+                     get_average_lwe_chunk_size(gpu_index, lwe_dimension,
+                                                level_count, glwe_dimension,
+                                                max_num_samples),
+                 (uint64_t)breakpoint *
+                     get_average_lwe_chunk_size(gpu_index, lwe_dimension,
+                                                level_count, glwe_dimension,
+                                                breakpoint));
+  }
+
+  return (max_product + max_num_samples - 1) / max_num_samples;
+}
+
+// Keybundle layouts of the scratched multi-bit PBS buffers, keyed by address
+static std::mutex buffer_layouts_mutex;
+static std::map<const int8_t *, multi_bit_pbs_buffer_layout> buffer_layouts;
+
+__host__ void register_multi_bit_pbs_buffer(const int8_t *pbs_buffer,
+                                            uint32_t lwe_chunk_size,
+                                            uint32_t max_num_samples) {
+  std::lock_guard<std::mutex> lock(buffer_layouts_mutex);
+  buffer_layouts[pbs_buffer] = {lwe_chunk_size, max_num_samples};
+}
+
+__host__ void unregister_multi_bit_pbs_buffer(const int8_t *pbs_buffer) {
+  std::lock_guard<std::mutex> lock(buffer_layouts_mutex);
+  buffer_layouts.erase(pbs_buffer);
+}
+
+// Returns the layout pbs_buffer was scratched with. Buffers that were not
+// registered are assumed to hold exactly num_samples samples of lwe_chunk_size
+__host__ multi_bit_pbs_buffer_layout
+get_multi_bit_pbs_buffer_layout(const int8_t *pbs_buffer,
+                                uint32_t lwe_chunk_size, uint32_t num_samples) {
+  std::lock_guard<std::mutex> lock(buffer_layouts_mutex);
+  auto it = buffer_layouts.find(pbs_buffer);
+  if (it == buffer_layouts.end())
+    return {lwe_chunk_size, num_samples};
+  return it->second;
+}
+
+// Returns the chunk size to execute a batch with in pbs_buffer: the one passed
+// by the caller, or else the tuned one, as long as its keybundle fits in what
+// the buffer was scratched for. The tuning cache may have changed since then.
+__host__ uint32_t get_execution_lwe_chunk_size(
+    const int8_t *pbs_buffer, uint32_t gpu_index, uint32_t lwe_dimension,
+    uint32_t glwe_dimension, uint32_t polynomial_size, uint32_t level_count,
+    uint32_t grouping_factor, uint32_t num_samples, uint32_t lwe_chunk_size) {
+
+  multi_bit_pbs_buffer_layout layout;
+  bool found;
+  {
+    std::lock_guard<std::mutex> lock(buffer_layouts_mutex);
+    auto it = buffer_layouts.find(pbs_buffer);
+    found = it != buffer_layouts.end();
+    if (found)
+      layout = it->second;
+  }
+
+  if (!lwe_chunk_size)
+    lwe_chunk_size = get_tuned_lwe_chunk_size(
+        gpu_index, lwe_dimension, glwe_dimension, polynomial_size,
+        level_count, grouping_factor, num_samples);
+  if (!found)
+    return lwe_chunk_size;
+
+  assert(("Error (GPU multi-bit PBS): the number of samples should not exceed "
+          "the one the buffer was scratched for",
+          num_samples <= layout.max_num_samples));
+  return layout.execution_chunk_size(lwe_chunk_size, num_samples);
+}
+
+/*
+ *  Benchmarks the multi-bit PBS over a range of chunk sizes for the given
+ *  parameters and batch size, and records the fastest one in the tuning
+ *  cache, which is saved to disk. PBS buffers scratched afterwards for this
+ *  device and shape use the tuned chunk sizes. Returns the selected chunk
+ *  size, or 0 if no candidate could be run.
+ *
+ *  The ciphertexts and LUT are zeroed, only the timings are meaningful.
+ */
+uint32_t cuda_tune_multi_bit_pbs_chunk_size_64(
+    cuda_stream_t *stream, void *bootstrapping_key, uint32_t lwe_dimension,
+    uint32_t glwe_dimension, uint32_t polynomial_size, uint32_t grouping_factor,
+    uint32_t base_log, uint32_t level_count, uint32_t num_samples,
+    uint32_t max_shared_memory) {
+
+  checks_multi_bit_pbs(polynomial_size, grouping_factor);
+  auto device = cuda_get_device_profile(stream->gpu_index);
+  if (device == nullptr || num_samples == 0)
+    return 0;
+
+  cudaSetDevice(stream->gpu_index);
+  const uint32_t candidates[] = {1,  2,  3,  4,  6,  8,  10, 12, 15, 18, 20,
+                                 24, 27, 30, 36, 40, 45, 50, 60, 80, 100};
+  const int num_warmup = 1;
+  const int num_runs = 5;
+
+  uint64_t lwe_in_size = (uint64_t)num_samples * (lwe_dimension + 1);
+  uint64_t lwe_out_size =
+      (uint64_t)num_samples * (glwe_dimension * polynomial_size + 1);
+  uint64_t lut_size = (uint64_t)(glwe_dimension + 1) * polynomial_size;
+  auto d_lwe_in = (uint64_t *)cuda_malloc_async(
+      lwe_in_size * sizeof(uint64_t), stream);
+  auto d_lwe_out = (uint64_t *)cuda_malloc_async(
+      lwe_out_size * sizeof(uint64_t), stream);
+  auto d_lut =
+      (uint64_t *)cuda_malloc_async(lut_size * sizeof(uint64_t), stream);
+  auto d_lut_indexes = (uint64_t *)cuda_malloc_async(
+      num_samples * sizeof(uint64_t), stream);
+  auto d_lwe_indexes = (uint64_t *)cuda_malloc_async(
+      num_samples * sizeof(uint64_t), stream);
+  cuda_memset_async(d_lwe_in, 0, lwe_in_size * sizeof(uint64_t), stream);
+  cuda_memset_async(d_lut, 0, lut_size * sizeof(uint64_t), stream);
+  cuda_memset_async(d_lut_indexes, 0, num_samples * sizeof(uint64_t), stream);
+  std::vector<uint64_t> h_lwe_indexes(num_samples);
+  for (uint32_t i = 0; i < num_samples; i++)
+    h_lwe_indexes[i] = i;
+  cuda_memcpy_async_to_gpu_staged(d_lwe_indexes, h_lwe_indexes.data(),
+                                  num_samples * sizeof(uint64_t), stream);
+
+  cudaEvent_t start, stop;
+  check_cuda_error(cudaEventCreate(&start));
+  check_cuda_error(cudaEventCreate(&stop));
+
+  std::vector<std::pair<uint32_t, double>> timings;
+  for (uint32_t lwe_chunk_size : candidates) {
+    if (lwe_chunk_size > lwe_dimension / grouping_factor)
+      break;
+    // Both PBS variants need the same order of magnitude of memory
+    uint64_t buffer_size = get_buffer_size_multibit_bootstrap<uint64_t>(
+        glwe_dimension, polynomial_size, level_count, num_samples,
+        lwe_chunk_size);
+    if (cuda_check_valid_malloc(buffer_size, stream->gpu_index) != 0)
+      break;
+
+    int8_t *pbs_buffer;
+    scratch_cuda_multi_bit_pbs_64(stream, &pbs_buffer, lwe_dimension,
+                                  glwe_dimension, polynomial_size, level_count,
+                                  grouping_factor, num_samples,
+                                  max_shared_memory, true, lwe_chunk_size);
+    for (int run = 0; run < num_warmup + num_runs; run++) {
+      if (run == num_warmup)
+        check_cuda_error(cudaEventRecord(start, stream->stream));
+      cuda_multi_bit_pbs_lwe_ciphertext_vector_64(
+          stream, d_lwe_out, d_lwe_indexes, d_lut, d_lut_indexes, d_lwe_in,
+          d_lwe_indexes, bootstrapping_key, pbs_buffer, lwe_dimension,
+          glwe_dimension, polynomial_size, grouping_factor, base_log,
+          level_count, num_samples, 1, 0, max_shared_memory, lwe_chunk_size);
+    }
+    check_cuda_error(cudaEventRecord(stop, stream->stream));
+    check_cuda_error(cudaEventSynchronize(stop));
+    float elapsed_ms;
+    check_cuda_error(cudaEventElapsedTime(&elapsed_ms, start, stop));
+    timings.push_back({lwe_chunk_size, 1000. * elapsed_ms / num_runs});
+
+    cleanup_cuda_multi_bit_pbs(stream, &pbs_buffer);
+  }
+
+  cudaEventDestroy(start);
+  cudaEventDestroy(stop);
+  cuda_drop_async(d_lwe_in, stream);
+  cuda_drop_async(d_lwe_out, stream);
+  cuda_drop_async(d_lut, stream);
+  cuda_drop_async(d_lut_indexes, stream);
+  cuda_drop_async(d_lwe_indexes, stream);
+  stream->synchronize();
+
+  uint32_t lwe_chunk_size = select_lwe_chunk_size(timings);
+  if (lwe_chunk_size) {
+    double time_us = 0;
+    for (auto &timing : timings)
+      if (timing.first == lwe_chunk_size)
+        time_us = timing.second;
+
+    multi_bit_pbs_shape shape = {lwe_dimension, glwe_dimension,
+                                 polynomial_size, level_count,
+                                 grouping_factor};
+    std::lock_guard<std::mutex> lock(tuning_cache_mutex);
+    auto &cache = get_tuning_cache();
+    cache.record(get_device_fingerprint(device), shape, num_samples,
+                 {lwe_chunk_size, time_us});
+    auto path = get_tuning_cache_path();
+    if (!path.empty() && !cache.save_file(path))
+      fprintf(stderr, "Warning: could not save the tuning cache to %s\n",
+              path.c_str());
+  }
+
+  return lwe_chunk_size;
+}
@@ -11,17 +11,21 @@
 #include "device.h"
 #include "fft/bnsmfft.cuh"
 #include "fft/twiddles.cuh"
+#include "pbs_pipeline.h"
 #include "polynomial/functions.cuh"
 #include "polynomial/parameters.cuh"
 #include "polynomial/polynomial_math.cuh"
 #include "types/complex/operations.cuh"
+#include <cassert>
+#include <type_traits>
 #include <vector>
 
-template <typename Torus, class params>
+// grouping_factor is a template parameter so that the selection loop unrolls
+template <typename Torus, class params, uint32_t grouping_factor>
 __device__ Torus calculates_monomial_degree(Torus *lwe_array_group,
-                                            uint32_t ggsw_idx,
-                                            uint32_t grouping_factor) {
+                                            uint32_t ggsw_idx) {
   Torus x = 0;
+#pragma unroll
   for (int i = 0; i < grouping_factor; i++) {
     uint32_t mask_position = grouping_factor - (i + 1);
     int selection_bit = (ggsw_idx >> mask_position) & 1;
@@ -32,13 +36,13 @@ __device__ Torus calculates_monomial_degree(Torus *lwe_array_group,
       x, 2 * params::degree); // 2 * params::log2_degree + 1);
 }
 
-template <typename Torus, class params>
+template <typename Torus, class params, uint32_t grouping_factor>
 __global__ void device_multi_bit_bootstrap_keybundle(
     Torus *lwe_array_in, Torus *lwe_input_indexes, double2 *keybundle_array,
     Torus *bootstrapping_key, uint32_t lwe_dimension, uint32_t glwe_dimension,
-    uint32_t polynomial_size, uint32_t grouping_factor, uint32_t base_log,
-    uint32_t level_count, uint32_t lwe_offset, uint32_t lwe_chunk_size,
-    uint32_t keybundle_size_per_input) {
+    uint32_t polynomial_size, uint32_t base_log, uint32_t level_count,
+    uint32_t lwe_offset, uint32_t lwe_chunk_size,
+    uint32_t keybundle_size_per_input, uint32_t num_samples_per_input) {
 
   extern __shared__ int8_t sharedmem[];
   int8_t *selected_memory = sharedmem;
@@ -48,6 +52,8 @@ __global__ void device_multi_bit_bootstrap_keybundle(
   uint32_t glwe_id = blockIdx.y / (glwe_dimension + 1);
   uint32_t poly_id = blockIdx.y % (glwe_dimension + 1);
   uint32_t lwe_iteration = (blockIdx.x % lwe_chunk_size + lwe_offset);
+  // Keybundles only depend on the input mask, they are computed once for the
+  // num_samples_per_input consecutive samples sharing an input
   uint32_t input_idx = blockIdx.x / lwe_chunk_size;
 
   if (lwe_iteration < (lwe_dimension / grouping_factor)) {
@@ -55,7 +61,8 @@ __global__ void device_multi_bit_bootstrap_keybundle(
     Torus *accumulator = (Torus *)selected_memory;
 
     Torus *block_lwe_array_in =
-        &lwe_array_in[lwe_input_indexes[input_idx] * (lwe_dimension + 1)];
+        &lwe_array_in[lwe_input_indexes[input_idx * num_samples_per_input] *
+                      (lwe_dimension + 1)];
 
     double2 *keybundle = keybundle_array +
                          // select the input
@@ -78,6 +85,7 @@ __global__ void device_multi_bit_bootstrap_keybundle(
         bsk_poly, accumulator);
 
     // Accumulate the other terms
+#pragma unroll
     for (int g = 1; g < (1 << grouping_factor); g++) {
 
       Torus *bsk_slice = get_multi_bit_ith_lwe_gth_group_kth_block(
@@ -88,8 +96,9 @@ __global__ void device_multi_bit_bootstrap_keybundle(
       // Calculates the monomial degree
       Torus *lwe_array_group =
           block_lwe_array_in + rev_lwe_iteration * grouping_factor;
-      uint32_t monomial_degree = calculates_monomial_degree<Torus, params>(
-          lwe_array_group, g, grouping_factor);
+      uint32_t monomial_degree =
+          calculates_monomial_degree<Torus, params, grouping_factor>(
+              lwe_array_group, g);
 
       synchronize_threads_in_block();
       // Multiply by the bsk element
@@ -101,14 +110,16 @@ __global__ void device_multi_bit_bootstrap_keybundle(
 
     double2 *fft = (double2 *)sharedmem;
 
-    // Move accumulator to local memory
+    // Move accumulator to local memory. The coefficients are read as signed
+    // values of the Torus width before being widened.
+    using STorus = typename std::make_signed<Torus>::type;
     double2 temp[params::opt / 2];
     int tid = threadIdx.x;
 #pragma unroll
     for (int i = 0; i < params::opt / 2; i++) {
-      temp[i].x = __ll2double_rn((int64_t)accumulator[tid]);
-      temp[i].y =
-          __ll2double_rn((int64_t)accumulator[tid + params::degree / 2]);
+      temp[i].x = __ll2double_rn((int64_t)(STorus)accumulator[tid]);
+      temp[i].y = __ll2double_rn(
+          (int64_t)(STorus)accumulator[tid + params::degree / 2]);
       temp[i].x /= (double)std::numeric_limits<Torus>::max();
       temp[i].y /= (double)std::numeric_limits<Torus>::max();
       tid += params::degree / params::opt;
@@ -225,7 +236,9 @@ __global__ void device_multi_bit_bootstrap_accumulate_step_two(
     Torus *global_accumulator, double2 *global_accumulator_fft,
     uint32_t lwe_dimension, uint32_t glwe_dimension, uint32_t polynomial_size,
     uint32_t level_count, uint32_t grouping_factor, uint32_t iteration,
-    uint32_t lwe_offset, uint32_t lwe_chunk_size) {
+    uint32_t lwe_offset, uint32_t lwe_chunk_size,
+    uint32_t num_samples_per_input, uint32_t num_many_lut,
+    uint32_t lut_stride) {
   // We use shared memory for the polynomials that are used often during the
   // bootstrap, since shared memory is kept in L1 cache and accessing it is
   // much faster than global memory
@@ -237,9 +250,9 @@ __global__ void device_multi_bit_bootstrap_accumulate_step_two(
 
   double2 *keybundle = keybundle_array +
                        // select the input
-                       blockIdx.x * lwe_chunk_size * level_count *
-                           (glwe_dimension + 1) * (glwe_dimension + 1) *
-                           (polynomial_size / 2);
+                       (blockIdx.x / num_samples_per_input) * lwe_chunk_size *
+                           level_count * (glwe_dimension + 1) *
+                           (glwe_dimension + 1) * (polynomial_size / 2);
 
   double2 *global_accumulator_fft_input =
       global_accumulator_fft +
@@ -283,6 +296,12 @@ __global__ void device_multi_bit_bootstrap_accumulate_step_two(
                            (glwe_dimension * polynomial_size + 1) +
                        blockIdx.y * polynomial_size];
 
+    if (num_many_lut > 1)
+      sample_extract_many_lut<Torus, params>(
+          block_lwe_array_out, global_slice, blockIdx.y == glwe_dimension,
+          num_many_lut, lut_stride,
+          (uint64_t)gridDim.x * (glwe_dimension * polynomial_size + 1));
+
     if (blockIdx.y < glwe_dimension) {
       // Perform a sample extract. At this point, all blocks have the result,
       // but we do the computation at block 0 to avoid waiting for extra blocks,
@@ -293,21 +312,86 @@ __global__ void device_multi_bit_bootstrap_accumulate_step_two(
     }
   }
 }
+// The FFT buffers take N / 2 double2, i.e. as much memory as the accumulator
+// for a 64-bit Torus but twice as much for a 32-bit one
 template <typename Torus>
 __host__ __device__ uint64_t
 get_buffer_size_full_sm_multibit_bootstrap_keybundle(uint32_t polynomial_size) {
-  return sizeof(Torus) * polynomial_size; // accumulator
+  uint64_t accumulator = sizeof(Torus) * polynomial_size;
+  uint64_t fft = sizeof(double2) * polynomial_size / 2;
+  return accumulator > fft ? accumulator : fft; // accumulator, then its fft
 }
 
 template <typename Torus>
 __host__ __device__ uint64_t
 get_buffer_size_full_sm_multibit_bootstrap_step_one(uint32_t polynomial_size) {
-  return sizeof(Torus) * polynomial_size * 2; // accumulator
+  return sizeof(Torus) * polynomial_size +        // accumulator
+         sizeof(double2) * polynomial_size / 2;   // accumulator fft
 }
 template <typename Torus>
 __host__ __device__ uint64_t
 get_buffer_size_full_sm_multibit_bootstrap_step_two(uint32_t polynomial_size) {
-  return sizeof(Torus) * polynomial_size; // accumulator
+  return sizeof(double2) * polynomial_size / 2; // accumulator fft
+}
+
+/*
+ *  The keybundle kernel is instantiated for each supported grouping factor,
+ *  so that the 2^grouping_factor terms of a keybundle are accumulated in
+ *  fully unrolled loops. These two functions map the runtime grouping factor
+ *  to its instantiation.
+ */
+template <typename Torus, class params>
+__host__ void configure_multi_bit_keybundle(uint64_t full_sm_keybundle) {
+  auto configure = [&](auto kernel) {
+    check_cuda_error(cudaFuncSetAttribute(
+        kernel, cudaFuncAttributeMaxDynamicSharedMemorySize,
+        full_sm_keybundle));
+    cudaFuncSetCacheConfig(kernel, cudaFuncCachePreferShared);
+    check_cuda_error(cudaGetLastError());
+  };
+  configure(device_multi_bit_bootstrap_keybundle<Torus, params, 2>);
+  configure(device_multi_bit_bootstrap_keybundle<Torus, params, 3>);
+  configure(device_multi_bit_bootstrap_keybundle<Torus, params, 4>);
+}
+
+template <typename Torus, class params>
+__host__ void execute_multi_bit_keybundle(
+    cudaStream_t stream, dim3 grid, dim3 thds, uint64_t full_sm_keybundle,
+    Torus *lwe_array_in, Torus *lwe_input_indexes, double2 *keybundle_array,
+    Torus *bootstrapping_key, uint32_t lwe_dimension, uint32_t glwe_dimension,
+    uint32_t polynomial_size, uint32_t grouping_factor, uint32_t base_log,
+    uint32_t level_count, uint32_t lwe_offset, uint32_t lwe_chunk_size,
+    uint32_t keybundle_size_per_input, uint32_t num_samples_per_input) {
+  switch (grouping_factor) {
+  case 2:
+    device_multi_bit_bootstrap_keybundle<Torus, params, 2>
+        <<<grid, thds, full_sm_keybundle, stream>>>(
+            lwe_array_in, lwe_input_indexes, keybundle_array,
+            bootstrapping_key, lwe_dimension, glwe_dimension, polynomial_size,
+            base_log, level_count, lwe_offset, lwe_chunk_size,
+            keybundle_size_per_input, num_samples_per_input);
+    break;
+  case 3:
+    device_multi_bit_bootstrap_keybundle<Torus, params, 3>
+        <<<grid, thds, full_sm_keybundle, stream>>>(
+            lwe_array_in, lwe_input_indexes, keybundle_array,
+            bootstrapping_key, lwe_dimension, glwe_dimension, polynomial_size,
+            base_log, level_count, lwe_offset, lwe_chunk_size,
+            keybundle_size_per_input, num_samples_per_input);
+    break;
+  case 4:
+    device_multi_bit_bootstrap_keybundle<Torus, params, 4>
+        <<<grid, thds, full_sm_keybundle, stream>>>(
+            lwe_array_in, lwe_input_indexes, keybundle_array,
+            bootstrapping_key, lwe_dimension, glwe_dimension, polynomial_size,
+            base_log, level_count, lwe_offset, lwe_chunk_size,
+            keybundle_size_per_input, num_samples_per_input);
+    break;
+  default:
+    assert(("Error (GPU multi-bit PBS): grouping factor should be 2, 3 or 4",
+            false));
+  }
+  check_cuda_error(cudaGetLastError());
 }
 
 template <typename Torus>
@@ -316,9 +400,11 @@ __host__ __device__ uint64_t get_buffer_size_multibit_bootstrap(
     uint32_t input_lwe_ciphertext_count, uint32_t lwe_chunk_size) {
 
   uint64_t buffer_size = 0;
-  buffer_size += input_lwe_ciphertext_count * lwe_chunk_size * level_count *
-                 (glwe_dimension + 1) * (glwe_dimension + 1) *
-                 (polynomial_size / 2) * sizeof(double2); // keybundle fft
+  // One keybundle buffer per pipeline slot, see multi_bit_pipeline.h
+  buffer_size += multi_bit_pipeline_num_slots * input_lwe_ciphertext_count *
+                 lwe_chunk_size * level_count * (glwe_dimension + 1) *
+                 (glwe_dimension + 1) * (polynomial_size / 2) *
+                 sizeof(double2); // keybundle fft
   buffer_size += input_lwe_ciphertext_count * (glwe_dimension + 1) *
                  level_count * (polynomial_size / 2) *
                  sizeof(double2); // global_accumulator_fft
@@ -338,6 +424,7 @@ scratch_multi_bit_pbs(cuda_stream_t *stream, int8_t **pbs_buffer,
                       bool allocate_gpu_memory, uint32_t lwe_chunk_size = 0) {
 
   cudaSetDevice(stream->gpu_index);
+  cuda_initialize_twiddles(stream);
 
   uint64_t full_sm_keybundle =
       get_buffer_size_full_sm_multibit_bootstrap_keybundle<Torus>(
@@ -349,12 +436,7 @@ scratch_multi_bit_pbs(cuda_stream_t *stream, int8_t **pbs_buffer,
       get_buffer_size_full_sm_multibit_bootstrap_step_two<Torus>(
           polynomial_size);
 
-  check_cuda_error(cudaFuncSetAttribute(
-      device_multi_bit_bootstrap_keybundle<Torus, params>,
-      cudaFuncAttributeMaxDynamicSharedMemorySize, full_sm_keybundle));
-  cudaFuncSetCacheConfig(device_multi_bit_bootstrap_keybundle<Torus, params>,
-                         cudaFuncCachePreferShared);
-  check_cuda_error(cudaGetLastError());
+  configure_multi_bit_keybundle<Torus, params>(full_sm_keybundle);
 
   check_cuda_error(cudaFuncSetAttribute(
       device_multi_bit_bootstrap_accumulate_step_one<Torus, params>,
@@ -376,15 +458,17 @@ scratch_multi_bit_pbs(cuda_stream_t *stream, int8_t **pbs_buffer,
 
   if (allocate_gpu_memory) {
     if (!lwe_chunk_size)
-      lwe_chunk_size =
-          get_average_lwe_chunk_size(lwe_dimension, level_count, glwe_dimension,
-                                     input_lwe_ciphertext_count);
+      lwe_chunk_size = get_scratch_lwe_chunk_size(
+          stream->gpu_index, lwe_dimension, glwe_dimension, polynomial_size,
+          level_count, grouping_factor, input_lwe_ciphertext_count);
 
     uint64_t buffer_size = get_buffer_size_multibit_bootstrap<Torus>(
         glwe_dimension, polynomial_size, level_count,
         input_lwe_ciphertext_count, lwe_chunk_size);
     *pbs_buffer = (int8_t *)cuda_malloc_async(buffer_size, stream);
     check_cuda_error(cudaGetLastError());
+    register_multi_bit_pbs_buffer(*pbs_buffer, lwe_chunk_size,
+                                  input_lwe_ciphertext_count);
   }
 }
 
@@ -392,23 +476,38 @@ template <typename Torus, typename STorus, class params>
 __host__ void host_multi_bit_pbs(
     cuda_stream_t *stream, Torus *lwe_array_out, Torus *lwe_output_indexes,
     Torus *lut_vector, Torus *lut_vector_indexes, Torus *lwe_array_in,
-    Torus *lwe_input_indexes, uint64_t *bootstrapping_key, int8_t *pbs_buffer,
+    Torus *lwe_input_indexes, Torus *bootstrapping_key, int8_t *pbs_buffer,
     uint32_t glwe_dimension, uint32_t lwe_dimension, uint32_t polynomial_size,
     uint32_t grouping_factor, uint32_t base_log, uint32_t level_count,
     uint32_t num_samples, uint32_t num_lut_vectors, uint32_t lwe_idx,
-    uint32_t max_shared_memory, uint32_t lwe_chunk_size = 0) {
+    uint32_t max_shared_memory, uint32_t lwe_chunk_size = 0,
+    uint32_t num_samples_per_input = 1, uint32_t num_many_lut = 1,
+    uint32_t lut_stride = 0) {
   cudaSetDevice(stream->gpu_index);
-
-  // If a chunk size is not passed to this function, select one.
-  if (!lwe_chunk_size)
-    lwe_chunk_size = get_average_lwe_chunk_size(lwe_dimension, level_count,
-                                                glwe_dimension, num_samples);
+  assert(("Error (GPU multi-bit PBS): the number of samples should be a "
+          "multiple of the number of samples per input",
+          num_samples % num_samples_per_input == 0));
+  uint32_t num_inputs = num_samples / num_samples_per_input;
+
+  // Chunk size the buffer was scratched for, or a tuned one that fits in it
+  lwe_chunk_size = get_execution_lwe_chunk_size(
+      pbs_buffer, stream->gpu_index, lwe_dimension, glwe_dimension,
+      polynomial_size, level_count, grouping_factor, num_samples,
+      lwe_chunk_size);
   //
+  uint32_t keybundle_size_per_input =
+      lwe_chunk_size * level_count * (glwe_dimension + 1) *
+      (glwe_dimension + 1) * (polynomial_size / 2);
+  // The slots are sized for the chunk size and number of samples the buffer
+  // was scratched with, the execution chunk size may differ
+  uint64_t keybundle_slot_size =
+      get_multi_bit_pbs_buffer_layout(pbs_buffer, lwe_chunk_size, num_samples)
+          .keybundle_slot_size(level_count * (glwe_dimension + 1) *
+                               (glwe_dimension + 1) * (polynomial_size / 2));
+
   double2 *keybundle_fft = (double2 *)pbs_buffer;
   double2 *global_accumulator_fft =
-      (double2 *)keybundle_fft +
-      num_samples * lwe_chunk_size * level_count * (glwe_dimension + 1) *
-          (glwe_dimension + 1) * (polynomial_size / 2);
+      keybundle_fft + multi_bit_pipeline_num_slots * keybundle_slot_size;
   Torus *global_accumulator =
       (Torus *)global_accumulator_fft +
       (ptrdiff_t)(sizeof(double2) * num_samples * (glwe_dimension + 1) *
@@ -425,52 +524,74 @@ __host__ void host_multi_bit_pbs(
       get_buffer_size_full_sm_multibit_bootstrap_step_two<Torus>(
           polynomial_size);
 
-  uint32_t keybundle_size_per_input =
-      lwe_chunk_size * level_count * (glwe_dimension + 1) *
-      (glwe_dimension + 1) * (polynomial_size / 2);
-
   //
   dim3 grid_accumulate_step_one(level_count, glwe_dimension + 1, num_samples);
   dim3 grid_accumulate_step_two(num_samples, glwe_dimension + 1);
   dim3 thds(polynomial_size / params::opt, 1, 1);
 
-  for (uint32_t lwe_offset = 0; lwe_offset < (lwe_dimension / grouping_factor);
-       lwe_offset += lwe_chunk_size) {
-
-    uint32_t chunk_size = std::min(
-        lwe_chunk_size, (lwe_dimension / grouping_factor) - lwe_offset);
-
-    // Compute a keybundle
-    dim3 grid_keybundle(num_samples * chunk_size,
-                        (glwe_dimension + 1) * (glwe_dimension + 1),
-                        level_count);
-    device_multi_bit_bootstrap_keybundle<Torus, params>
-        <<<grid_keybundle, thds, full_sm_keybundle, stream->stream>>>(
-            lwe_array_in, lwe_input_indexes, keybundle_fft, bootstrapping_key,
-            lwe_dimension, glwe_dimension, polynomial_size, grouping_factor,
-            base_log, level_count, lwe_offset, chunk_size,
-            keybundle_size_per_input);
-    check_cuda_error(cudaGetLastError());
-
-    // Accumulate
-    for (int j = 0; j < chunk_size; j++) {
-      device_multi_bit_bootstrap_accumulate_step_one<Torus, params>
-          <<<grid_accumulate_step_one, thds, full_sm_accumulate_step_one,
-             stream->stream>>>(lwe_array_in, lwe_input_indexes, lut_vector,
-                               lut_vector_indexes, global_accumulator,
-                               global_accumulator_fft, lwe_dimension,
-                               glwe_dimension, polynomial_size, base_log,
-                               level_count, j + lwe_offset);
-      check_cuda_error(cudaGetLastError());
-
-      device_multi_bit_bootstrap_accumulate_step_two<Torus, params>
-          <<<grid_accumulate_step_two, thds, full_sm_accumulate_step_two,
-             stream->stream>>>(lwe_array_out, lwe_output_indexes, keybundle_fft,
-                               global_accumulator, global_accumulator_fft,
-                               lwe_dimension, glwe_dimension, polynomial_size,
-                               level_count, grouping_factor, j, lwe_offset,
-                               lwe_chunk_size);
-      check_cuda_error(cudaGetLastError());
+  // The keybundles of the next chunk are computed on a side stream while the
+  // current chunk is accumulated, the schedule is described in
+  // multi_bit_pipeline.h
+  uint32_t num_iterations = lwe_dimension / grouping_factor;
+  uint32_t num_chunks = (num_iterations + lwe_chunk_size - 1) / lwe_chunk_size;
+  auto schedule = make_multi_bit_pipeline_schedule(num_chunks);
+  pbs_pipeline *pipeline = num_chunks > 1 ? get_pbs_pipeline(stream) : nullptr;
+
+  for (auto &op : schedule) {
+    cudaStream_t op_stream =
+        pipeline == nullptr ? stream->stream
+                            : pipeline->get_stream(stream, op.stream);
+    // Chunk and keybundle slot, only meaningful for the kernels
+    uint32_t lwe_offset = op.chunk * lwe_chunk_size;
+    uint32_t chunk_size = std::min(lwe_chunk_size, num_iterations - lwe_offset);
+    double2 *keybundle_slot = keybundle_fft;
+    if (op.type == PIPELINE_KEYBUNDLE || op.type == PIPELINE_ACCUMULATE)
+      keybundle_slot += op.index * keybundle_slot_size;
+
+    switch (op.type) {
+    case PIPELINE_RECORD:
+      check_cuda_error(cudaEventRecord(pipeline->events[op.index], op_stream));
+      break;
+    case PIPELINE_WAIT:
+      check_cuda_error(
+          cudaStreamWaitEvent(op_stream, pipeline->events[op.index], 0));
+      break;
+    case PIPELINE_KEYBUNDLE: {
+      // Compute a keybundle per distinct input
+      dim3 grid_keybundle(num_inputs * chunk_size,
+                          (glwe_dimension + 1) * (glwe_dimension + 1),
+                          level_count);
+      execute_multi_bit_keybundle<Torus, params>(
+          op_stream, grid_keybundle, thds, full_sm_keybundle, lwe_array_in,
+          lwe_input_indexes, keybundle_slot, bootstrapping_key, lwe_dimension,
+          glwe_dimension, polynomial_size, grouping_factor, base_log,
+          level_count, lwe_offset, chunk_size, keybundle_size_per_input,
+          num_samples_per_input);
+      break;
+    }
+    case PIPELINE_ACCUMULATE:
+      // Accumulate
+      for (int j = 0; j < chunk_size; j++) {
+        device_multi_bit_bootstrap_accumulate_step_one<Torus, params>
+            <<<grid_accumulate_step_one, thds, full_sm_accumulate_step_one,
+               op_stream>>>(lwe_array_in, lwe_input_indexes, lut_vector,
+                            lut_vector_indexes, global_accumulator,
+                            global_accumulator_fft, lwe_dimension,
+                            glwe_dimension, polynomial_size, base_log,
+                            level_count, j + lwe_offset);
+        check_cuda_error(cudaGetLastError());
+
+        device_multi_bit_bootstrap_accumulate_step_two<Torus, params>
+            <<<grid_accumulate_step_two, thds, full_sm_accumulate_step_two,
+               op_stream>>>(lwe_array_out, lwe_output_indexes, keybundle_slot,
+                            global_accumulator, global_accumulator_fft,
+                            lwe_dimension, glwe_dimension, polynomial_size,
+                            level_count, grouping_factor, j, lwe_offset,
+                            lwe_chunk_size, num_samples_per_input,
+                            num_many_lut, lut_stride);
+        check_cuda_error(cudaGetLastError());
+      }
+      break;
     }
   }
 }
@@ -5,6 +5,9 @@
 #include "bootstrap_multibit.h"
 #include "device.h"
 #include "fft/bnsmfft.cuh"
+#include "key_cache.h"
+#include "negacyclic_fft.h"
+#include "polynomial_size_dispatch.h"
 #include "polynomial/parameters.cuh"
 #include <atomic>
 #include <cstdint>
@@ -59,6 +62,88 @@ __device__ T *get_multi_bit_ith_lwe_gth_group_kth_block(
                                 glwe_dimension, level_count);
 }
 ////////////////////////////////////////////////
+// Number of bytes of the Torus key uploaded before the FFT of the
+// corresponding polynomials is enqueued, matches the size of a staging slot
+constexpr uint64_t bsk_conversion_chunk_size = 4 << 20;
+
+/*
+ *  Forward FFT of a batch of real polynomials of the key, one polynomial per
+ *  block. The compression into the complex domain is done while loading the
+ *  polynomial, so the key can be uploaded in its Torus representation.
+ */
+template <typename T, typename ST, class params, sharedMemDegree SMD>
+__global__ void batch_convert_and_forward_fft_bsk(double2 *dest,
+                                                  const ST *src,
+                                                  double2 *buffer) {
+  extern __shared__ double2 sharedMemoryFFT[];
+  double2 *fft = (SMD == NOSM) ? &buffer[blockIdx.x * params::degree / 2]
+                               : sharedMemoryFFT;
+  const ST *torus_poly = &src[blockIdx.x * params::degree];
+
+  int tid = threadIdx.x;
+#pragma unroll
+  for (int i = 0; i < params::opt / 2; i++) {
+    fft[tid] = compress_torus_coefficients<T, double2>(
+        torus_poly[tid], torus_poly[tid + params::degree / 2]);
+    tid = tid + params::degree / params::opt;
+  }
+  __syncthreads();
+  NSMFFT_direct<HalfDegree<params>>(fft);
+  __syncthreads();
+
+  tid = threadIdx.x;
+#pragma unroll
+  for (int i = 0; i < params::opt / 2; i++) {
+    dest[blockIdx.x * (params::degree / 2) + tid] = fft[tid];
+    tid = tid + params::degree / params::opt;
+  }
+}
+
+/*
+ *  Converts and transforms num_polynomials Torus polynomials. When the FFT
+ *  does not fit in shared memory, buffer must hold polynomial_size doubles
+ *  per polynomial. Looked up through polynomial_size_dispatch, the kernel
+ *  attributes are only set the first time a device uses it.
+ */
+template <typename T, typename ST> struct bsk_forward_fft {
+  template <int N> struct launch {
+    static void run(cuda_stream_t *stream, double2 *dest, const ST *d_src,
+                    double2 *buffer, uint32_t num_polynomials) {
+      using params = FFTDegree<AmortizedDegree<N>, ForwardFFT>;
+      int shared_memory_size = sizeof(double) * N;
+      int gridSize = num_polynomials;
+      int blockSize = N / params::opt;
+
+      if (shared_memory_size <=
+          cuda_get_max_shared_memory(stream->gpu_index)) {
+        call_once_per_device<launch>(stream->gpu_index, [&] {
+          check_cuda_error(cudaFuncSetAttribute(
+              batch_convert_and_forward_fft_bsk<T, ST, params, FULLSM>,
+              cudaFuncAttributeMaxDynamicSharedMemorySize,
+              shared_memory_size));
+          check_cuda_error(cudaFuncSetCacheConfig(
+              batch_convert_and_forward_fft_bsk<T, ST, params, FULLSM>,
+              cudaFuncCachePreferShared));
+        });
+        batch_convert_and_forward_fft_bsk<T, ST, params, FULLSM>
+            <<<gridSize, blockSize, shared_memory_size, stream->stream>>>(
+                dest, d_src, buffer);
+      } else {
+        batch_convert_and_forward_fft_bsk<T, ST, params, NOSM>
+            <<<gridSize, blockSize, 0, stream->stream>>>(dest, d_src, buffer);
+      }
+      check_cuda_error(cudaGetLastError());
+    }
+  };
+};
+
+/*
+ *  The key is uploaded in its Torus representation, chunk by chunk through
+ *  the staging pool, and the FFT of each chunk is enqueued right after its
+ *  copy. The compression into the complex domain happens in the FFT kernel,
+ *  so no intermediate host buffer is needed and, for 64-bit keys, half as
+ *  many bytes cross the bus as when uploading the compressed key.
+ */
 template <typename T, typename ST>
 void cuda_convert_lwe_bootstrap_key(double2 *dest, ST *src,
                                     cuda_stream_t *stream,
@@ -68,180 +153,41 @@ void cuda_convert_lwe_bootstrap_key(double2 *dest, ST *src,
                                     uint32_t total_polynomials) {
 
   cudaSetDevice(stream->gpu_index);
+  cuda_initialize_twiddles(stream->gpu_index);
   int shared_memory_size = sizeof(double) * polynomial_size;
+  bool full_sm =
+      shared_memory_size <= cuda_get_max_shared_memory(stream->gpu_index);
 
-  // Here the buffer size is the size of double2 times the number of polynomials
-  // times the polynomial size over 2 because the polynomials are compressed
-  // into the complex domain to perform the FFT
-  size_t buffer_size =
-      total_polynomials * polynomial_size / 2 * sizeof(double2);
-
-  int gridSize = total_polynomials;
-  int blockSize = polynomial_size / choose_opt_amortized(polynomial_size);
-
-  double2 *h_bsk = (double2 *)malloc(buffer_size);
-
-  double2 *d_bsk = (double2 *)cuda_malloc_async(buffer_size, stream);
-
-  // compress real bsk to complex and divide it on DOUBLE_MAX
-  for (int i = 0; i < total_polynomials; i++) {
-    int complex_current_poly_idx = i * polynomial_size / 2;
-    int torus_current_poly_idx = i * polynomial_size;
-    for (int j = 0; j < polynomial_size / 2; j++) {
-      h_bsk[complex_current_poly_idx + j].x = src[torus_current_poly_idx + j];
-      h_bsk[complex_current_poly_idx + j].y =
-          src[torus_current_poly_idx + j + polynomial_size / 2];
-      h_bsk[complex_current_poly_idx + j].x /=
-          (double)std::numeric_limits<T>::max();
-      h_bsk[complex_current_poly_idx + j].y /=
-          (double)std::numeric_limits<T>::max();
-    }
-  }
+  size_t torus_poly_size = polynomial_size * sizeof(ST);
+  uint32_t chunk_polynomials = bsk_conversion_chunk_size / torus_poly_size;
+  if (chunk_polynomials == 0)
+    chunk_polynomials = 1;
+  if (chunk_polynomials > total_polynomials)
+    chunk_polynomials = total_polynomials;
 
-  cuda_memcpy_async_to_gpu(d_bsk, h_bsk, buffer_size, stream);
+  ST *d_bsk =
+      (ST *)cuda_malloc_async(chunk_polynomials * torus_poly_size, stream);
+  double2 *buffer = (double2 *)cuda_malloc_async(
+      full_sm ? 0 : shared_memory_size * chunk_polynomials, stream);
 
-  double2 *buffer;
-  switch (polynomial_size) {
-  case 256:
-    if (shared_memory_size <= cuda_get_max_shared_memory(stream->gpu_index)) {
-      buffer = (double2 *)cuda_malloc_async(0, stream);
-      check_cuda_error(cudaFuncSetAttribute(
-          batch_NSMFFT<FFTDegree<AmortizedDegree<256>, ForwardFFT>, FULLSM>,
-          cudaFuncAttributeMaxDynamicSharedMemorySize, shared_memory_size));
-      check_cuda_error(cudaFuncSetCacheConfig(
-          batch_NSMFFT<FFTDegree<AmortizedDegree<256>, ForwardFFT>, FULLSM>,
-          cudaFuncCachePreferShared));
-      batch_NSMFFT<FFTDegree<AmortizedDegree<256>, ForwardFFT>, FULLSM>
-          <<<gridSize, blockSize, shared_memory_size, stream->stream>>>(
-              d_bsk, dest, buffer);
-    } else {
-      buffer = (double2 *)cuda_malloc_async(
-          shared_memory_size * total_polynomials, stream);
-      batch_NSMFFT<FFTDegree<AmortizedDegree<256>, ForwardFFT>, NOSM>
-          <<<gridSize, blockSize, 0, stream->stream>>>(d_bsk, dest, buffer);
-    }
-    break;
-  case 512:
-    if (shared_memory_size <= cuda_get_max_shared_memory(stream->gpu_index)) {
-      buffer = (double2 *)cuda_malloc_async(0, stream);
-      check_cuda_error(cudaFuncSetAttribute(
-          batch_NSMFFT<FFTDegree<AmortizedDegree<512>, ForwardFFT>, FULLSM>,
-          cudaFuncAttributeMaxDynamicSharedMemorySize, shared_memory_size));
-      check_cuda_error(cudaFuncSetCacheConfig(
-          batch_NSMFFT<FFTDegree<AmortizedDegree<512>, ForwardFFT>, FULLSM>,
-          cudaFuncCachePreferShared));
-      batch_NSMFFT<FFTDegree<AmortizedDegree<512>, ForwardFFT>, FULLSM>
-          <<<gridSize, blockSize, shared_memory_size, stream->stream>>>(
-              d_bsk, dest, buffer);
-    } else {
-      buffer = (double2 *)cuda_malloc_async(
-          shared_memory_size * total_polynomials, stream);
-      batch_NSMFFT<FFTDegree<AmortizedDegree<512>, ForwardFFT>, NOSM>
-          <<<gridSize, blockSize, 0, stream->stream>>>(d_bsk, dest, buffer);
-    }
-    break;
-  case 1024:
-    if (shared_memory_size <= cuda_get_max_shared_memory(stream->gpu_index)) {
-      buffer = (double2 *)cuda_malloc_async(0, stream);
-      check_cuda_error(cudaFuncSetAttribute(
-          batch_NSMFFT<FFTDegree<AmortizedDegree<1024>, ForwardFFT>, FULLSM>,
-          cudaFuncAttributeMaxDynamicSharedMemorySize, shared_memory_size));
-      check_cuda_error(cudaFuncSetCacheConfig(
-          batch_NSMFFT<FFTDegree<AmortizedDegree<1024>, ForwardFFT>, FULLSM>,
-          cudaFuncCachePreferShared));
-      batch_NSMFFT<FFTDegree<AmortizedDegree<1024>, ForwardFFT>, FULLSM>
-          <<<gridSize, blockSize, shared_memory_size, stream->stream>>>(
-              d_bsk, dest, buffer);
-    } else {
-      buffer = (double2 *)cuda_malloc_async(
-          shared_memory_size * total_polynomials, stream);
-      batch_NSMFFT<FFTDegree<AmortizedDegree<1024>, ForwardFFT>, NOSM>
-          <<<gridSize, blockSize, 0, stream->stream>>>(d_bsk, dest, buffer);
-    }
-    break;
-  case 2048:
-    if (shared_memory_size <= cuda_get_max_shared_memory(stream->gpu_index)) {
-      buffer = (double2 *)cuda_malloc_async(0, stream);
-      check_cuda_error(cudaFuncSetAttribute(
-          batch_NSMFFT<FFTDegree<AmortizedDegree<2048>, ForwardFFT>, FULLSM>,
-          cudaFuncAttributeMaxDynamicSharedMemorySize, shared_memory_size));
-      check_cuda_error(cudaFuncSetCacheConfig(
-          batch_NSMFFT<FFTDegree<AmortizedDegree<2048>, ForwardFFT>, FULLSM>,
-          cudaFuncCachePreferShared));
-      batch_NSMFFT<FFTDegree<AmortizedDegree<2048>, ForwardFFT>, FULLSM>
-          <<<gridSize, blockSize, shared_memory_size, stream->stream>>>(
-              d_bsk, dest, buffer);
-    } else {
-      buffer = (double2 *)cuda_malloc_async(
-          shared_memory_size * total_polynomials, stream);
-      batch_NSMFFT<FFTDegree<AmortizedDegree<2048>, ForwardFFT>, NOSM>
-          <<<gridSize, blockSize, 0, stream->stream>>>(d_bsk, dest, buffer);
-    }
-    break;
-  case 4096:
-    if (shared_memory_size <= cuda_get_max_shared_memory(stream->gpu_index)) {
-      buffer = (double2 *)cuda_malloc_async(0, stream);
-      check_cuda_error(cudaFuncSetAttribute(
-          batch_NSMFFT<FFTDegree<AmortizedDegree<4096>, ForwardFFT>, FULLSM>,
-          cudaFuncAttributeMaxDynamicSharedMemorySize, shared_memory_size));
-      check_cuda_error(cudaFuncSetCacheConfig(
-          batch_NSMFFT<FFTDegree<AmortizedDegree<4096>, ForwardFFT>, FULLSM>,
-          cudaFuncCachePreferShared));
-      batch_NSMFFT<FFTDegree<AmortizedDegree<4096>, ForwardFFT>, FULLSM>
-          <<<gridSize, blockSize, shared_memory_size, stream->stream>>>(
-              d_bsk, dest, buffer);
-    } else {
-      buffer = (double2 *)cuda_malloc_async(
-          shared_memory_size * total_polynomials, stream);
-      batch_NSMFFT<FFTDegree<AmortizedDegree<4096>, ForwardFFT>, NOSM>
-          <<<gridSize, blockSize, 0, stream->stream>>>(d_bsk, dest, buffer);
-    }
-    break;
-  case 8192:
-    if (shared_memory_size <= cuda_get_max_shared_memory(stream->gpu_index)) {
-      buffer = (double2 *)cuda_malloc_async(0, stream);
-      check_cuda_error(cudaFuncSetAttribute(
-          batch_NSMFFT<FFTDegree<AmortizedDegree<8192>, ForwardFFT>, FULLSM>,
-          cudaFuncAttributeMaxDynamicSharedMemorySize, shared_memory_size));
-      check_cuda_error(cudaFuncSetCacheConfig(
-          batch_NSMFFT<FFTDegree<AmortizedDegree<8192>, ForwardFFT>, FULLSM>,
-          cudaFuncCachePreferShared));
-      batch_NSMFFT<FFTDegree<AmortizedDegree<8192>, ForwardFFT>, FULLSM>
-          <<<gridSize, blockSize, shared_memory_size, stream->stream>>>(
-              d_bsk, dest, buffer);
-    } else {
-      buffer = (double2 *)cuda_malloc_async(
-          shared_memory_size * total_polynomials, stream);
-      batch_NSMFFT<FFTDegree<AmortizedDegree<8192>, ForwardFFT>, NOSM>
-          <<<gridSize, blockSize, 0, stream->stream>>>(d_bsk, dest, buffer);
-    }
-    break;
-  case 16384:
-    if (shared_memory_size <= cuda_get_max_shared_memory(stream->gpu_index)) {
-      buffer = (double2 *)cuda_malloc_async(0, stream);
-      check_cuda_error(cudaFuncSetAttribute(
-          batch_NSMFFT<FFTDegree<AmortizedDegree<16384>, ForwardFFT>, FULLSM>,
-          cudaFuncAttributeMaxDynamicSharedMemorySize, shared_memory_size));
-      check_cuda_error(cudaFuncSetCacheConfig(
-          batch_NSMFFT<FFTDegree<AmortizedDegree<16384>, ForwardFFT>, FULLSM>,
-          cudaFuncCachePreferShared));
-      batch_NSMFFT<FFTDegree<AmortizedDegree<16384>, ForwardFFT>, FULLSM>
-          <<<gridSize, blockSize, shared_memory_size, stream->stream>>>(
-              d_bsk, dest, buffer);
-    } else {
-      buffer = (double2 *)cuda_malloc_async(
-          shared_memory_size * total_polynomials, stream);
-      batch_NSMFFT<FFTDegree<AmortizedDegree<16384>, ForwardFFT>, NOSM>
-          <<<gridSize, blockSize, 0, stream->stream>>>(d_bsk, dest, buffer);
-    }
-    break;
-  default:
-    break;
+  for (uint32_t first = 0; first < total_polynomials;
+       first += chunk_polynomials) {
+    uint32_t num_polynomials = total_polynomials - first < chunk_polynomials
+                                   ? total_polynomials - first
+                                   : chunk_polynomials;
+
+    cuda_memcpy_async_to_gpu_staged(d_bsk,
+                                    src + (size_t)first * polynomial_size,
+                                    num_polynomials * torus_poly_size, stream);
+
+    double2 *chunk_dest = dest + (size_t)first * (polynomial_size / 2);
+    polynomial_size_dispatch<bsk_forward_fft<T, ST>::template launch,
+                             large_polynomial_sizes>::run(
+        polynomial_size, stream, chunk_dest, d_bsk, buffer, num_polynomials);
   }
 
   cuda_drop_async(d_bsk, stream);
   cuda_drop_async(buffer, stream);
-  free(h_bsk);
 }
 
 void cuda_convert_lwe_bootstrap_key_32(void *dest, void *src,
@@ -268,6 +214,19 @@ void cuda_convert_lwe_bootstrap_key_64(void *dest, void *src,
       level_count, polynomial_size, total_polynomials);
 }
 
+void cuda_convert_lwe_multi_bit_bootstrap_key_32(
+    void *dest, void *src, cuda_stream_t *stream, uint32_t input_lwe_dim,
+    uint32_t glwe_dim, uint32_t level_count, uint32_t polynomial_size,
+    uint32_t grouping_factor) {
+  uint32_t total_polynomials = input_lwe_dim * (glwe_dim + 1) * (glwe_dim + 1) *
+                               level_count * (1 << grouping_factor) /
+                               grouping_factor;
+  size_t buffer_size = total_polynomials * polynomial_size * sizeof(uint32_t);
+
+  cuda_memcpy_async_to_gpu_staged((uint32_t *)dest, (uint32_t *)src,
+                                  buffer_size, stream);
+}
+
 void cuda_convert_lwe_multi_bit_bootstrap_key_64(
     void *dest, void *src, cuda_stream_t *stream, uint32_t input_lwe_dim,
     uint32_t glwe_dim, uint32_t level_count, uint32_t polynomial_size,
@@ -277,185 +236,144 @@ void cuda_convert_lwe_multi_bit_bootstrap_key_64(
                                grouping_factor;
   size_t buffer_size = total_polynomials * polynomial_size * sizeof(uint64_t);
 
-  cuda_memcpy_async_to_gpu((uint64_t *)dest, (uint64_t *)src, buffer_size,
-                           stream);
+  cuda_memcpy_async_to_gpu_staged((uint64_t *)dest, (uint64_t *)src,
+                                  buffer_size, stream);
 }
 
-void cuda_fourier_polynomial_mul(void *_input1, void *_input2, void *_output,
-                                 cuda_stream_t *stream,
-                                 uint32_t polynomial_size,
-                                 uint32_t total_polynomials) {
+// Copies a converted key from the device and writes it to a key cache file.
+// Returns the error codes of key_cache_write, or -5 when there is no host
+// memory for the copy of the key
+inline int cuda_export_key_cache(const char *path, key_cache_header header,
+                                 void *src, cuda_stream_t *stream) {
+  void *h_key = malloc(header.payload_size);
+  if (h_key == nullptr && header.payload_size > 0) {
+    // error code: cannot allocate the host copy
+    return -5;
+  }
+  cuda_memcpy_async_to_cpu(h_key, src, header.payload_size, stream);
+  cuda_synchronize_stream(stream);
+  int err = key_cache_write(path, header, h_key);
+  free(h_key);
+  return err;
+}
 
-  auto input1 = (double2 *)_input1;
-  auto input2 = (double2 *)_input2;
-  auto output = (double2 *)_output;
+// Streams the payload of a key cache file straight into device memory, the
+// mapping can be released as soon as the staged copy returns
+inline int cuda_import_key_cache(void *dest, const char *path,
+                                 const key_cache_header &expected,
+                                 cuda_stream_t *stream) {
+  key_cache_mapping mapping;
+  int err = key_cache_map(path, expected, &mapping);
+  if (err != 0)
+    return err;
+  cuda_memcpy_async_to_gpu_staged(dest, (void *)mapping.payload,
+                                  mapping.payload_size, stream);
+  key_cache_unmap(&mapping);
+  return 0;
+}
 
-  size_t shared_memory_size = sizeof(double2) * polynomial_size / 2;
+/// Writes the Fourier bootstrap key src, as converted by
+/// cuda_convert_lwe_bootstrap_key_64, to a key cache file.
+/// Returns the error codes of cuda_export_key_cache
+int cuda_export_lwe_bootstrap_key_64(const char *path, void *src,
+                                     cuda_stream_t *stream,
+                                     uint32_t input_lwe_dim, uint32_t glwe_dim,
+                                     uint32_t level_count,
+                                     uint32_t polynomial_size) {
+  key_cache_header header =
+      make_key_cache_header(KEY_CACHE_FOURIER_BSK_64, input_lwe_dim, glwe_dim,
+                            level_count, polynomial_size, 0);
+  return cuda_export_key_cache(path, header, src, stream);
+}
 
-  int gridSize = total_polynomials;
-  int blockSize = polynomial_size / choose_opt_amortized(polynomial_size);
+/// Loads a Fourier bootstrap key exported with
+/// cuda_export_lwe_bootstrap_key_64 into dest, skipping the conversion.
+/// Returns the error codes of key_cache_map
+int cuda_import_lwe_bootstrap_key_64(void *dest, const char *path,
+                                     cuda_stream_t *stream,
+                                     uint32_t input_lwe_dim, uint32_t glwe_dim,
+                                     uint32_t level_count,
+                                     uint32_t polynomial_size) {
+  key_cache_header expected =
+      make_key_cache_header(KEY_CACHE_FOURIER_BSK_64, input_lwe_dim, glwe_dim,
+                            level_count, polynomial_size, 0);
+  return cuda_import_key_cache(dest, path, expected, stream);
+}
 
-  double2 *buffer;
-  switch (polynomial_size) {
-  case 256:
-    if (shared_memory_size <= cuda_get_max_shared_memory(stream->gpu_index)) {
-      buffer = (double2 *)cuda_malloc_async(0, stream);
-      check_cuda_error(cudaFuncSetAttribute(
-          batch_polynomial_mul<FFTDegree<AmortizedDegree<256>, ForwardFFT>,
-                               FULLSM>,
-          cudaFuncAttributeMaxDynamicSharedMemorySize, shared_memory_size));
-      check_cuda_error(cudaFuncSetCacheConfig(
-          batch_polynomial_mul<FFTDegree<AmortizedDegree<256>, ForwardFFT>,
-                               FULLSM>,
-          cudaFuncCachePreferShared));
-      batch_polynomial_mul<FFTDegree<AmortizedDegree<256>, ForwardFFT>, FULLSM>
-          <<<gridSize, blockSize, shared_memory_size, stream->stream>>>(
-              input1, input2, output, buffer);
-    } else {
-      buffer = (double2 *)cuda_malloc_async(
-          shared_memory_size * total_polynomials, stream);
-      batch_polynomial_mul<FFTDegree<AmortizedDegree<256>, ForwardFFT>, NOSM>
-          <<<gridSize, blockSize, 0, stream->stream>>>(input1, input2, output,
-                                                       buffer);
-    }
-    break;
-  case 512:
-    if (shared_memory_size <= cuda_get_max_shared_memory(stream->gpu_index)) {
-      buffer = (double2 *)cuda_malloc_async(0, stream);
-      check_cuda_error(cudaFuncSetAttribute(
-          batch_polynomial_mul<FFTDegree<AmortizedDegree<521>, ForwardFFT>,
-                               FULLSM>,
-          cudaFuncAttributeMaxDynamicSharedMemorySize, shared_memory_size));
-      check_cuda_error(cudaFuncSetCacheConfig(
-          batch_polynomial_mul<FFTDegree<AmortizedDegree<512>, ForwardFFT>,
-                               FULLSM>,
-          cudaFuncCachePreferShared));
-      batch_polynomial_mul<FFTDegree<AmortizedDegree<512>, ForwardFFT>, FULLSM>
-          <<<gridSize, blockSize, shared_memory_size, stream->stream>>>(
-              input1, input2, output, buffer);
-    } else {
-      buffer = (double2 *)cuda_malloc_async(
-          shared_memory_size * total_polynomials, stream);
-      batch_polynomial_mul<FFTDegree<AmortizedDegree<512>, ForwardFFT>, NOSM>
-          <<<gridSize, blockSize, 0, stream->stream>>>(input1, input2, output,
-                                                       buffer);
-    }
-    break;
-  case 1024:
-    if (shared_memory_size <= cuda_get_max_shared_memory(stream->gpu_index)) {
-      buffer = (double2 *)cuda_malloc_async(0, stream);
-      check_cuda_error(cudaFuncSetAttribute(
-          batch_polynomial_mul<FFTDegree<AmortizedDegree<1024>, ForwardFFT>,
-                               FULLSM>,
-          cudaFuncAttributeMaxDynamicSharedMemorySize, shared_memory_size));
-      check_cuda_error(cudaFuncSetCacheConfig(
-          batch_polynomial_mul<FFTDegree<AmortizedDegree<1024>, ForwardFFT>,
-                               FULLSM>,
-          cudaFuncCachePreferShared));
-      batch_polynomial_mul<FFTDegree<AmortizedDegree<1024>, ForwardFFT>, FULLSM>
-          <<<gridSize, blockSize, shared_memory_size, stream->stream>>>(
-              input1, input2, output, buffer);
-    } else {
-      buffer = (double2 *)cuda_malloc_async(
-          shared_memory_size * total_polynomials, stream);
-      batch_polynomial_mul<FFTDegree<AmortizedDegree<1024>, ForwardFFT>, NOSM>
-          <<<gridSize, blockSize, 0, stream->stream>>>(input1, input2, output,
-                                                       buffer);
-    }
-    break;
-  case 2048:
-    if (shared_memory_size <= cuda_get_max_shared_memory(stream->gpu_index)) {
-      buffer = (double2 *)cuda_malloc_async(0, stream);
-      check_cuda_error(cudaFuncSetAttribute(
-          batch_polynomial_mul<FFTDegree<AmortizedDegree<2048>, ForwardFFT>,
-                               FULLSM>,
-          cudaFuncAttributeMaxDynamicSharedMemorySize, shared_memory_size));
-      check_cuda_error(cudaFuncSetCacheConfig(
-          batch_polynomial_mul<FFTDegree<AmortizedDegree<2048>, ForwardFFT>,
-                               FULLSM>,
-          cudaFuncCachePreferShared));
-      batch_polynomial_mul<FFTDegree<AmortizedDegree<2048>, ForwardFFT>, FULLSM>
-          <<<gridSize, blockSize, shared_memory_size, stream->stream>>>(
-              input1, input2, output, buffer);
-    } else {
-      buffer = (double2 *)cuda_malloc_async(
-          shared_memory_size * total_polynomials, stream);
-      batch_polynomial_mul<FFTDegree<AmortizedDegree<2048>, ForwardFFT>, NOSM>
-          <<<gridSize, blockSize, 0, stream->stream>>>(input1, input2, output,
-                                                       buffer);
-    }
-    break;
-  case 4096:
-    if (shared_memory_size <= cuda_get_max_shared_memory(stream->gpu_index)) {
-      buffer = (double2 *)cuda_malloc_async(0, stream);
-      check_cuda_error(cudaFuncSetAttribute(
-          batch_polynomial_mul<FFTDegree<AmortizedDegree<4096>, ForwardFFT>,
-                               FULLSM>,
-          cudaFuncAttributeMaxDynamicSharedMemorySize, shared_memory_size));
-      check_cuda_error(cudaFuncSetCacheConfig(
-          batch_polynomial_mul<FFTDegree<AmortizedDegree<4096>, ForwardFFT>,
-                               FULLSM>,
-          cudaFuncCachePreferShared));
-      batch_polynomial_mul<FFTDegree<AmortizedDegree<4096>, ForwardFFT>, FULLSM>
-          <<<gridSize, blockSize, shared_memory_size, stream->stream>>>(
-              input1, input2, output, buffer);
-    } else {
-      buffer = (double2 *)cuda_malloc_async(
-          shared_memory_size * total_polynomials, stream);
-      batch_polynomial_mul<FFTDegree<AmortizedDegree<4096>, ForwardFFT>, NOSM>
-          <<<gridSize, blockSize, 0, stream->stream>>>(input1, input2, output,
-                                                       buffer);
-    }
-    break;
-  case 8192:
-    if (shared_memory_size <= cuda_get_max_shared_memory(stream->gpu_index)) {
-      buffer = (double2 *)cuda_malloc_async(0, stream);
-      check_cuda_error(cudaFuncSetAttribute(
-          batch_polynomial_mul<FFTDegree<AmortizedDegree<8192>, ForwardFFT>,
-                               FULLSM>,
-          cudaFuncAttributeMaxDynamicSharedMemorySize, shared_memory_size));
-      check_cuda_error(cudaFuncSetCacheConfig(
-          batch_polynomial_mul<FFTDegree<AmortizedDegree<8192>, ForwardFFT>,
-                               FULLSM>,
-          cudaFuncCachePreferShared));
-      batch_polynomial_mul<FFTDegree<AmortizedDegree<8192>, ForwardFFT>, FULLSM>
-          <<<gridSize, blockSize, shared_memory_size, stream->stream>>>(
-              input1, input2, output, buffer);
-    } else {
-      buffer = (double2 *)cuda_malloc_async(
-          shared_memory_size * total_polynomials, stream);
-      batch_polynomial_mul<FFTDegree<AmortizedDegree<8192>, ForwardFFT>, NOSM>
-          <<<gridSize, blockSize, 0, stream->stream>>>(input1, input2, output,
-                                                       buffer);
-    }
-    break;
-  case 16384:
+/// Writes the multi-bit bootstrap key src, as converted by
+/// cuda_convert_lwe_multi_bit_bootstrap_key_64, to a key cache file.
+/// Returns the error codes of cuda_export_key_cache
+int cuda_export_lwe_multi_bit_bootstrap_key_64(
+    const char *path, void *src, cuda_stream_t *stream, uint32_t input_lwe_dim,
+    uint32_t glwe_dim, uint32_t level_count, uint32_t polynomial_size,
+    uint32_t grouping_factor) {
+  key_cache_header header = make_key_cache_header(
+      KEY_CACHE_MULTI_BIT_BSK_64, input_lwe_dim, glwe_dim, level_count,
+      polynomial_size, grouping_factor);
+  return cuda_export_key_cache(path, header, src, stream);
+}
+
+/// Loads a multi-bit bootstrap key exported with
+/// cuda_export_lwe_multi_bit_bootstrap_key_64 into dest.
+/// Returns the error codes of key_cache_map
+int cuda_import_lwe_multi_bit_bootstrap_key_64(
+    void *dest, const char *path, cuda_stream_t *stream,
+    uint32_t input_lwe_dim, uint32_t glwe_dim, uint32_t level_count,
+    uint32_t polynomial_size, uint32_t grouping_factor) {
+  key_cache_header expected = make_key_cache_header(
+      KEY_CACHE_MULTI_BIT_BSK_64, input_lwe_dim, glwe_dim, level_count,
+      polynomial_size, grouping_factor);
+  return cuda_import_key_cache(dest, path, expected, stream);
+}
+
+/*
+ *  Product of polynomials in the Fourier domain, looked up through
+ *  polynomial_size_dispatch
+ */
+template <int N> struct fourier_polynomial_mul {
+  static void run(cuda_stream_t *stream, double2 *input1, double2 *input2,
+                  double2 *output, uint32_t total_polynomials) {
+    using params = FFTDegree<AmortizedDegree<N>, ForwardFFT>;
+    size_t shared_memory_size = sizeof(double2) * N / 2;
+    int gridSize = total_polynomials;
+    int blockSize = N / params::opt;
+
+    cuda_initialize_twiddles(stream->gpu_index);
+    double2 *buffer;
     if (shared_memory_size <= cuda_get_max_shared_memory(stream->gpu_index)) {
       buffer = (double2 *)cuda_malloc_async(0, stream);
-      check_cuda_error(cudaFuncSetAttribute(
-          batch_polynomial_mul<FFTDegree<AmortizedDegree<16384>, ForwardFFT>,
-                               FULLSM>,
-          cudaFuncAttributeMaxDynamicSharedMemorySize, shared_memory_size));
-      check_cuda_error(cudaFuncSetCacheConfig(
-          batch_polynomial_mul<FFTDegree<AmortizedDegree<16384>, ForwardFFT>,
-                               FULLSM>,
-          cudaFuncCachePreferShared));
-      batch_polynomial_mul<FFTDegree<AmortizedDegree<16384>, ForwardFFT>,
-                           FULLSM>
+      call_once_per_device<fourier_polynomial_mul>(stream->gpu_index, [&] {
+        check_cuda_error(cudaFuncSetAttribute(
+            batch_polynomial_mul<params, FULLSM>,
+            cudaFuncAttributeMaxDynamicSharedMemorySize, shared_memory_size));
+        check_cuda_error(cudaFuncSetCacheConfig(
+            batch_polynomial_mul<params, FULLSM>, cudaFuncCachePreferShared));
+      });
+      batch_polynomial_mul<params, FULLSM>
           <<<gridSize, blockSize, shared_memory_size, stream->stream>>>(
               input1, input2, output, buffer);
     } else {
       buffer = (double2 *)cuda_malloc_async(
           shared_memory_size * total_polynomials, stream);
-      batch_polynomial_mul<FFTDegree<AmortizedDegree<16384>, ForwardFFT>, NOSM>
+      batch_polynomial_mul<params, NOSM>
           <<<gridSize, blockSize, 0, stream->stream>>>(input1, input2, output,
                                                        buffer);
     }
-    break;
-  default:
-    break;
+    cuda_drop_async(buffer, stream);
   }
-  cuda_drop_async(buffer, stream);
+};
+
+void cuda_fourier_polynomial_mul(void *_input1, void *_input2, void *_output,
+                                 cuda_stream_t *stream,
+                                 uint32_t polynomial_size,
+                                 uint32_t total_polynomials) {
+
+  auto input1 = (double2 *)_input1;
+  auto input2 = (double2 *)_input2;
+  auto output = (double2 *)_output;
+
+  polynomial_size_dispatch<fourier_polynomial_mul>::run(
+      polynomial_size, stream, input1, input2, output, total_polynomials);
 }
 
 // We need these lines so the compiler knows how to specialize these functions
@@ -0,0 +1,442 @@
+#ifndef CUDA_KEYSWITCH_BOOTSTRAP_CUH
+#define CUDA_KEYSWITCH_BOOTSTRAP_CUH
+
+#include "bootstrap.h"
+#include "bootstrap_fast_low_latency.cuh"
+#include "crypto/keyswitch.cuh"
+#include "device.h"
+#include <cmath>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <tuple>
+#include <vector>
+
+/*
+ * Kernel fusing the keyswitch with the low latency PBS that uses cooperative
+ * groups.
+ *
+ * The keyswitch of a sample is computed once, split between the level_count *
+ * (glwe_dimension + 1) blocks of the sample, each one writing a slice of the
+ * output coefficients to lwe_array_after_ks. After a grid synchronization,
+ * every block copies the keyswitched LWE of its sample to shared memory, where
+ * the blind rotation reads the mask and body from. A single kernel is launched
+ * instead of two.
+ *
+ * - lwe_array_in: big LWE inputs, of size lwe_dimension_in + 1
+ * - lwe_array_after_ks: keyswitched LWEs, of size lwe_dimension + 1, at the
+ * same indexes as the inputs
+ * - ksk: keyswitch key from lwe_dimension_in to lwe_dimension
+ * The other arguments are the ones of device_bootstrap_fast_low_latency.
+ */
+template <typename Torus, class params, sharedMemDegree SMD>
+__global__ void device_keyswitch_bootstrap_fast_low_latency(
+    Torus *lwe_array_out, Torus *lwe_output_indexes, Torus *lut_vector,
+    Torus *lut_vector_indexes, Torus *lwe_array_in, Torus *lwe_input_indexes,
+    Torus *lwe_array_after_ks, Torus *ksk, double2 *bootstrapping_key,
+    double2 *join_buffer, uint32_t lwe_dimension_in, uint32_t lwe_dimension,
+    uint32_t polynomial_size, uint32_t ks_base_log, uint32_t ks_level_count,
+    uint32_t base_log, uint32_t level_count, int8_t *device_mem,
+    uint64_t device_memory_size_per_block) {
+
+  grid_group grid = this_grid();
+
+  extern __shared__ int8_t sharedmem[];
+  int8_t *selected_memory;
+  uint32_t glwe_dimension = gridDim.y - 1;
+
+  // The keyswitched LWE is stored in shared memory after the PBS data that
+  // lives there
+  Torus *block_lwe_array_ks;
+  if constexpr (SMD == FULLSM) {
+    selected_memory = sharedmem;
+    block_lwe_array_ks =
+        (Torus *)(sharedmem +
+                  get_buffer_size_full_sm_bootstrap_fast_low_latency<Torus>(
+                      polynomial_size));
+  } else {
+    int block_index = blockIdx.x + blockIdx.y * gridDim.x +
+                      blockIdx.z * gridDim.x * gridDim.y;
+    selected_memory = &device_mem[block_index * device_memory_size_per_block];
+    if constexpr (SMD == PARTIALSM)
+      block_lwe_array_ks =
+          (Torus *)(sharedmem +
+                    get_buffer_size_partial_sm_bootstrap_fast_low_latency<
+                        Torus>(polynomial_size));
+    else
+      block_lwe_array_ks = (Torus *)sharedmem;
+  }
+
+  double2 *accumulator_fft = (double2 *)selected_memory;
+  Torus *accumulator =
+      (Torus *)accumulator_fft +
+      (ptrdiff_t)(sizeof(double2) * polynomial_size / 2 / sizeof(Torus));
+  Torus *accumulator_rotated =
+      (Torus *)accumulator + (ptrdiff_t)polynomial_size;
+
+  if constexpr (SMD == PARTIALSM)
+    accumulator_fft = (double2 *)sharedmem;
+
+  Torus *sample_lwe_array_ks =
+      &lwe_array_after_ks[lwe_input_indexes[blockIdx.z] * (lwe_dimension + 1)];
+  keyswitch_block<Torus>(
+      sample_lwe_array_ks,
+      &lwe_array_in[lwe_input_indexes[blockIdx.z] * (lwe_dimension_in + 1)],
+      ksk, lwe_dimension_in, lwe_dimension, ks_base_log, ks_level_count,
+      blockIdx.x + blockIdx.y * gridDim.x, gridDim.x * gridDim.y);
+  grid.sync();
+  for (int k = threadIdx.x; k <= lwe_dimension; k += blockDim.x)
+    block_lwe_array_ks[k] = sample_lwe_array_ks[k];
+  synchronize_threads_in_block();
+
+  Torus *block_lut_vector = &lut_vector[lut_vector_indexes[blockIdx.z] *
+                                        params::degree * (glwe_dimension + 1)];
+
+  double2 *block_join_buffer =
+      &join_buffer[blockIdx.z * level_count * (glwe_dimension + 1) *
+                   params::degree / 2];
+
+  auto block_lwe_array_out =
+      &lwe_array_out[lwe_output_indexes[blockIdx.z] *
+                         (glwe_dimension * polynomial_size + 1) +
+                     blockIdx.y * polynomial_size];
+
+  blind_rotate_and_sample_extract_fast_low_latency<Torus, params>(
+      block_lwe_array_out, block_lwe_array_ks, block_lut_vector,
+      block_join_buffer, bootstrapping_key, accumulator, accumulator_rotated,
+      accumulator_fft, lwe_dimension, polynomial_size, glwe_dimension, base_log,
+      level_count, grid);
+}
+
+template <typename Torus>
+__host__ __device__ uint64_t
+get_buffer_size_sm_keyswitch_bootstrap(uint32_t lwe_dimension) {
+  return sizeof(Torus) * (lwe_dimension + 1); // keyswitched LWE
+}
+
+// Returns the dynamic shared memory used by the fused kernel when the PBS
+// buffer was scratched with max_shared_memory, and selects the kernel in
+// *kernel. Returns 0 if the fused kernel does not fit.
+template <typename Torus, class params>
+__host__ uint64_t select_keyswitch_bootstrap_fast_low_latency(
+    uint32_t lwe_dimension, uint32_t max_shared_memory, void **kernel) {
+
+  uint64_t full_sm =
+      get_buffer_size_full_sm_bootstrap_fast_low_latency<Torus>(params::degree);
+  uint64_t partial_sm =
+      get_buffer_size_partial_sm_bootstrap_fast_low_latency<Torus>(
+          params::degree);
+  uint64_t ks_sm = get_buffer_size_sm_keyswitch_bootstrap<Torus>(lwe_dimension);
+
+  // The PBS part must use the same memory mode as the one the buffer was
+  // scratched for, only the shared memory of the keyswitch is added
+  uint64_t shared_mem;
+  if (max_shared_memory < partial_sm) {
+    shared_mem = ks_sm;
+    *kernel = (void *)device_keyswitch_bootstrap_fast_low_latency<Torus, params,
+                                                                  NOSM>;
+  } else if (max_shared_memory < full_sm) {
+    shared_mem = partial_sm + ks_sm;
+    *kernel = (void *)device_keyswitch_bootstrap_fast_low_latency<Torus, params,
+                                                                  PARTIALSM>;
+  } else {
+    shared_mem = full_sm + ks_sm;
+    *kernel = (void *)device_keyswitch_bootstrap_fast_low_latency<Torus, params,
+                                                                  FULLSM>;
+  }
+  if (shared_mem > max_shared_memory)
+    return 0;
+  return shared_mem;
+}
+
+// Fused kernel selected at scratch for a device, lwe_dimension and
+// max_shared_memory
+struct keyswitch_bootstrap_config {
+  void *kernel;
+  uint64_t shared_mem;
+  // Number of blocks of the kernel that can be resident on the device at
+  // once, 0 if the kernel cannot be used
+  uint64_t max_blocks;
+};
+
+template <typename Torus, class params> struct keyswitch_bootstrap_configs {
+  typedef std::tuple<uint32_t, uint32_t, uint32_t> key_t;
+  static inline std::mutex mutex;
+  static inline std::map<key_t, keyswitch_bootstrap_config> configs;
+};
+
+// Sets the attributes of the fused kernel and computes its occupancy, so that
+// executions only have to look the result up
+template <typename Torus, class params>
+__host__ void
+scratch_keyswitch_bootstrap_fast_low_latency(cuda_stream_t *stream,
+                                             uint32_t lwe_dimension,
+                                             uint32_t max_shared_memory) {
+  cudaSetDevice(stream->gpu_index);
+
+  keyswitch_bootstrap_config config = {nullptr, 0, 0};
+  auto device = cuda_get_device_profile(stream->gpu_index);
+  if (device != nullptr && device->cooperative_launch)
+    config.shared_mem =
+        select_keyswitch_bootstrap_fast_low_latency<Torus, params>(
+            lwe_dimension, max_shared_memory, &config.kernel);
+
+  if (config.shared_mem != 0) {
+    check_cuda_error(cudaFuncSetAttribute(
+        config.kernel, cudaFuncAttributeMaxDynamicSharedMemorySize,
+        config.shared_mem));
+    cudaFuncSetCacheConfig(config.kernel, cudaFuncCachePreferShared);
+    check_cuda_error(cudaGetLastError());
+
+    int max_active_blocks_per_sm;
+    check_cuda_error(cudaOccupancyMaxActiveBlocksPerMultiprocessor(
+        &max_active_blocks_per_sm, config.kernel,
+        params::degree / params::opt, config.shared_mem));
+    config.max_blocks = (uint64_t)max_active_blocks_per_sm * device->sm_count;
+  }
+
+  typedef keyswitch_bootstrap_configs<Torus, params> configs_t;
+  std::lock_guard<std::mutex> lock(configs_t::mutex);
+  configs_t::configs[{stream->gpu_index, lwe_dimension, max_shared_memory}] =
+      config;
+}
+
+// Verify if the fused kernel was configured at scratch, and if its grid size
+// satisfies the cooperative group constraints
+template <typename Torus, class params>
+__host__ bool verify_cuda_keyswitch_bootstrap_fast_low_latency_grid_size(
+    uint32_t gpu_index, int glwe_dimension, int level_count, int num_samples,
+    uint32_t lwe_dimension, uint32_t max_shared_memory,
+    keyswitch_bootstrap_config *config) {
+
+  typedef keyswitch_bootstrap_configs<Torus, params> configs_t;
+  {
+    std::lock_guard<std::mutex> lock(configs_t::mutex);
+    auto it =
+        configs_t::configs.find({gpu_index, lwe_dimension, max_shared_memory});
+    if (it == configs_t::configs.end())
+      return false;
+    *config = it->second;
+  }
+
+  uint64_t number_of_blocks =
+      (uint64_t)level_count * (glwe_dimension + 1) * num_samples;
+  return number_of_blocks <= config->max_blocks;
+}
+
+/*
+ * Host wrapper to the fused keyswitch and low latency PBS. pbs_buffer is a
+ * buffer scratched for the low latency PBS with the fast variant.
+ */
+template <typename Torus, class params>
+__host__ void host_keyswitch_bootstrap_fast_low_latency(
+    cuda_stream_t *stream, Torus *lwe_array_out, Torus *lwe_output_indexes,
+    Torus *lut_vector, Torus *lut_vector_indexes, Torus *lwe_array_in,
+    Torus *lwe_input_indexes, Torus *lwe_array_after_ks, Torus *ksk,
+    double2 *bootstrapping_key, int8_t *pbs_buffer, uint32_t lwe_dimension_in,
+    uint32_t lwe_dimension, uint32_t glwe_dimension, uint32_t polynomial_size,
+    uint32_t ks_base_log, uint32_t ks_level_count, uint32_t base_log,
+    uint32_t level_count, uint32_t input_lwe_ciphertext_count,
+    uint32_t max_shared_memory, keyswitch_bootstrap_config config) {
+  cudaSetDevice(stream->gpu_index);
+
+  uint64_t full_sm = get_buffer_size_full_sm_bootstrap_fast_low_latency<Torus>(
+      polynomial_size);
+  uint64_t partial_sm =
+      get_buffer_size_partial_sm_bootstrap_fast_low_latency<Torus>(
+          polynomial_size);
+  uint64_t full_dm = full_sm;
+  uint64_t partial_dm = full_dm - partial_sm;
+  uint64_t no_dm = 0;
+
+  // Same layout as in host_bootstrap_fast_low_latency
+  int8_t *d_mem = pbs_buffer;
+  double2 *buffer_fft =
+      (double2 *)d_mem +
+      (ptrdiff_t)(get_buffer_size_bootstrap_fast_low_latency<Torus>(
+                      glwe_dimension, polynomial_size, level_count,
+                      input_lwe_ciphertext_count, max_shared_memory) /
+                      sizeof(double2) -
+                  (glwe_dimension + 1) * level_count *
+                      input_lwe_ciphertext_count * polynomial_size / 2);
+
+  int thds = polynomial_size / params::opt;
+  dim3 grid(level_count, glwe_dimension + 1, input_lwe_ciphertext_count);
+
+  void *kernel_args[19];
+  kernel_args[0] = &lwe_array_out;
+  kernel_args[1] = &lwe_output_indexes;
+  kernel_args[2] = &lut_vector;
+  kernel_args[3] = &lut_vector_indexes;
+  kernel_args[4] = &lwe_array_in;
+  kernel_args[5] = &lwe_input_indexes;
+  kernel_args[6] = &lwe_array_after_ks;
+  kernel_args[7] = &ksk;
+  kernel_args[8] = &bootstrapping_key;
+  kernel_args[9] = &buffer_fft;
+  kernel_args[10] = &lwe_dimension_in;
+  kernel_args[11] = &lwe_dimension;
+  kernel_args[12] = &polynomial_size;
+  kernel_args[13] = &ks_base_log;
+  kernel_args[14] = &ks_level_count;
+  kernel_args[15] = &base_log;
+  kernel_args[16] = &level_count;
+  kernel_args[17] = &d_mem;
+  if (max_shared_memory < partial_sm)
+    kernel_args[18] = &full_dm;
+  else if (max_shared_memory < full_sm)
+    kernel_args[18] = &partial_dm;
+  else
+    kernel_args[18] = &no_dm;
+
+  check_cuda_error(cudaLaunchCooperativeKernel(
+      config.kernel, grid, thds, (void **)kernel_args, config.shared_mem,
+      stream->stream));
+  check_cuda_error(cudaGetLastError());
+}
+
+/*
+ * Runs the fused keyswitch and PBS if it was configured at scratch and the
+ * parameters allow it, and returns false otherwise so that the caller can
+ * fall back to the two-step path.
+ */
+template <typename Torus, class params>
+__host__ bool execute_keyswitch_bootstrap_fast_low_latency(
+    cuda_stream_t *stream, Torus *lwe_array_out, Torus *lwe_output_indexes,
+    Torus *lut_vector, Torus *lut_vector_indexes, Torus *lwe_array_in,
+    Torus *lwe_input_indexes, Torus *lwe_array_after_ks, Torus *ksk,
+    double2 *bootstrapping_key, int8_t *pbs_buffer, uint32_t lwe_dimension_in,
+    uint32_t lwe_dimension, uint32_t glwe_dimension, uint32_t polynomial_size,
+    uint32_t ks_base_log, uint32_t ks_level_count, uint32_t base_log,
+    uint32_t level_count, uint32_t num_samples, uint32_t max_shared_memory) {
+  cudaSetDevice(stream->gpu_index);
+
+  // The fused kernel uses the buffer of the fast low latency PBS
+  keyswitch_bootstrap_config config;
+  if (!verify_cuda_bootstrap_fast_low_latency_grid_size<Torus, params>(
+          glwe_dimension, level_count, num_samples, max_shared_memory) ||
+      !verify_cuda_keyswitch_bootstrap_fast_low_latency_grid_size<Torus,
+                                                                  params>(
+          stream->gpu_index, glwe_dimension, level_count, num_samples,
+          lwe_dimension, max_shared_memory, &config))
+    return false;
+
+  host_keyswitch_bootstrap_fast_low_latency<Torus, params>(
+      stream, lwe_array_out, lwe_output_indexes, lut_vector,
+      lut_vector_indexes, lwe_array_in, lwe_input_indexes, lwe_array_after_ks,
+      ksk, bootstrapping_key, pbs_buffer, lwe_dimension_in, lwe_dimension,
+      glwe_dimension, polynomial_size, ks_base_log, ks_level_count, base_log,
+      level_count, num_samples, max_shared_memory, config);
+  return true;
+}
+
+/*
+ * Host reference of the keyswitch followed by the PBS, for correctness
+ * testing. All arrays are in host memory, and the bootstrapping key is in the
+ * standard domain, with the same layout as the one given to
+ * cuda_convert_lwe_bootstrap_key. Polynomial products are computed exactly,
+ * so the GPU outputs only match up to the floating point error of the FFT and
+ * have to be compared after decryption.
+ */
+template <typename Torus>
+__host__ void keyswitch_bootstrap_reference(
+    Torus *lwe_array_out, Torus *lwe_output_indexes, Torus *lut_vector,
+    Torus *lut_vector_indexes, Torus *lwe_array_in, Torus *lwe_input_indexes,
+    Torus *ksk, Torus *bootstrapping_key, uint32_t lwe_dimension_in,
+    uint32_t lwe_dimension, uint32_t glwe_dimension, uint32_t polynomial_size,
+    uint32_t ks_base_log, uint32_t ks_level_count, uint32_t base_log,
+    uint32_t level_count, uint32_t num_samples) {
+  uint32_t N = polynomial_size;
+  uint32_t glwe_size = glwe_dimension + 1;
+
+  // Same rounding as rescale_torus_element
+  auto rescale = [&](Torus x) -> uint32_t {
+    double r = round((double)x / (double(std::numeric_limits<Torus>::max()) +
+                                  1.0) *
+                     (double)(2 * N));
+    return (uint32_t)((Torus)r % (2 * N));
+  };
+  // result = poly * X^j in Z[X]/(X^N + 1), with j in [0, 2N[
+  auto multiply_by_monomial = [&](Torus *result, const Torus *poly,
+                                  uint32_t j) {
+    for (uint32_t k = 0; k < N; k++) {
+      uint32_t shifted = k + j;
+      Torus value = poly[k];
+      if ((shifted / N) % 2 == 1)
+        value = -value;
+      result[shifted % N] = value;
+    }
+  };
+
+  std::vector<Torus> lwe_ks(lwe_dimension + 1);
+  std::vector<Torus> accumulator(glwe_size * N);
+  std::vector<Torus> rotated(glwe_size * N);
+  std::vector<Torus> digits(level_count * glwe_size * N);
+  Torus identity_index = 0;
+  Torus mask_mod_b = (1ll << base_log) - 1ll;
+
+  for (uint32_t s = 0; s < num_samples; s++) {
+    keyswitch_lwe_ciphertext_vector_reference<Torus>(
+        lwe_ks.data(), &identity_index, lwe_array_in, &lwe_input_indexes[s],
+        ksk, lwe_dimension_in, lwe_dimension, ks_base_log, ks_level_count, 1);
+
+    // ACC = LUT * X^-b
+    Torus *lut = &lut_vector[lut_vector_indexes[s] * glwe_size * N];
+    uint32_t b_hat = rescale(lwe_ks[lwe_dimension]);
+    for (uint32_t p = 0; p < glwe_size; p++)
+      multiply_by_monomial(&accumulator[p * N], &lut[p * N],
+                           (2 * N - b_hat) % (2 * N));
+
+    for (uint32_t i = 0; i < lwe_dimension; i++) {
+      // ACC * (X^a - 1), rounded and decomposed
+      uint32_t a_hat = rescale(lwe_ks[i]);
+      for (uint32_t p = 0; p < glwe_size; p++) {
+        multiply_by_monomial(&rotated[p * N], &accumulator[p * N], a_hat);
+        for (uint32_t k = 0; k < N; k++) {
+          Torus state = round_to_closest_multiple(
+              rotated[p * N + k] - accumulator[p * N + k], base_log,
+              level_count);
+          state >>= sizeof(Torus) * 8 - base_log * level_count;
+          for (int l = level_count - 1; l >= 0; l--)
+            digits[(l * glwe_size + p) * N + k] =
+                decompose_one<Torus>(state, mask_mod_b, base_log);
+        }
+      }
+
+      // ACC += G^-1(ACC * (X^a - 1)) * GGSW_i
+      Torus *ggsw = &bootstrapping_key[(uint64_t)i * level_count * glwe_size *
+                                       glwe_size * N];
+      for (uint32_t l = 0; l < level_count; l++)
+        for (uint32_t row = 0; row < glwe_size; row++)
+          for (uint32_t col = 0; col < glwe_size; col++) {
+            Torus *digit_poly = &digits[(l * glwe_size + row) * N];
+            Torus *key_poly = &ggsw[((l * glwe_size + row) * glwe_size + col) *
+                                    N];
+            Torus *result = &accumulator[col * N];
+            for (uint32_t a = 0; a < N; a++) {
+              if (digit_poly[a] == 0)
+                continue;
+              for (uint32_t b = 0; b < N; b++) {
+                Torus product = digit_poly[a] * key_poly[b];
+                if (a + b < N)
+                  result[a + b] += product;
+                else
+                  result[a + b - N] -= product;
+              }
+            }
+          }
+    }
+
+    // Sample extract
+    Torus *lwe_out =
+        &lwe_array_out[lwe_output_indexes[s] * (glwe_dimension * N + 1)];
+    for (uint32_t p = 0; p < glwe_dimension; p++) {
+      lwe_out[p * N] = accumulator[p * N];
+      for (uint32_t k = 1; k < N; k++)
+        lwe_out[p * N + k] = -accumulator[p * N + N - k];
+    }
+    lwe_out[glwe_dimension * N] = accumulator[glwe_dimension * N];
+  }
+}
+
+#endif // CUDA_KEYSWITCH_BOOTSTRAP_CUH
@@ -302,4 +302,42 @@ __device__ void sample_extract_mask(Torus *lwe_array_out, Torus *accumulator,
   }
 }
 
+/*
+ * Extracts the LWEs of the functions 1 to num_many_lut - 1 of a many-LUT
+ * accumulator (see include/many_lut.h) from one GLWE polynomial: the LWE of
+ * function i encrypts coefficient i * lut_stride and is written lwe_stride
+ * elements after the one of function i - 1. lwe_array_out and accumulator
+ * point to the same element / polynomial as for sample_extract_mask, or for
+ * sample_extract_body when is_body is set. The accumulator is left untouched,
+ * function 0 is then extracted by the regular sample extraction.
+ */
+template <typename Torus, class params>
+__device__ void sample_extract_many_lut(Torus *lwe_array_out,
+                                        Torus *accumulator, bool is_body,
+                                        uint32_t num_many_lut,
+                                        uint32_t lut_stride,
+                                        uint64_t lwe_stride) {
+  // The accumulator was written by other threads
+  synchronize_threads_in_block();
+  for (uint32_t f = 1; f < num_many_lut; f++) {
+    uint32_t nth = f * lut_stride;
+    Torus *lwe_array_out_slice = lwe_array_out + f * lwe_stride;
+    if (is_body) {
+      lwe_array_out_slice[0] = accumulator[nth];
+      continue;
+    }
+    // Coefficient tid of the mask is ACC[nth - tid], negated when it wraps
+    // around
+    int tid = threadIdx.x;
+#pragma unroll
+    for (int i = 0; i < params::opt; i++) {
+      int x = (int)nth - tid + SEL(0, params::degree, tid > (int)nth);
+      lwe_array_out_slice[tid] = SEL(1, -1, tid > (int)nth) * accumulator[x];
+      tid = tid + params::degree / params::opt;
+    }
+  }
+  // The regular sample extraction modifies the accumulator in place
+  synchronize_threads_in_block();
+}
+
 #endif
@@ -12,8 +12,10 @@ constexpr int choose_opt_amortized(int degree) {
     return 16;
   else if (degree == 8192)
     return 32;
-  else
+  else if (degree <= 32768)
     return 64;
+  else
+    return 128;
 }
 
 constexpr int choose_opt(int degree) {
@@ -27,8 +29,10 @@ constexpr int choose_opt(int degree) {
     return 8;
   else if (degree == 16384)
     return 16;
-  else
+  else if (degree == 32768)
     return 64;
+  else
+    return 128;
 }
 template <class params> class HalfDegree {
 public:
@@ -1,6 +1,9 @@
 #ifndef KERNEL_DIMENSIONS_CUH
 #define KERNEL_DIMENSIONS_CUH
 
+#include "device.h"
+#include "polynomial_size_dispatch.h"
+
 inline int nextPow2(int x) {
   --x;
   x |= x >> 1;
@@ -18,4 +21,19 @@ inline void getNumBlocksAndThreads(const int n, const int maxBlockSize,
   blocks = (n + threads - 1) / threads;
 }
 
+// Max number of blocks of Kernel resident at once on an SM of gpu_index,
+// which must be the current device. A kernel instantiation always runs with
+// the same block size and shared memory, so the occupancy is only queried
+// the first time.
+template <auto Kernel>
+int get_max_active_blocks_per_sm(uint32_t gpu_index, int block_size,
+                                 size_t dynamic_shared_memory) {
+  return query_once_per_device<kernel_tag<Kernel>>(gpu_index, [&] {
+    int blocks_per_sm = 0;
+    check_cuda_error(cudaOccupancyMaxActiveBlocksPerMultiprocessor(
+        &blocks_per_sm, Kernel, block_size, dynamic_shared_memory));
+    return blocks_per_sm;
+  });
+}
+
 #endif // KERNEL_DIMENSIONS_H
@@ -0,0 +1,85 @@
+#include "benchmark_utils.cuh"
+#include "bootstrap.h"
+#include "device.h"
+#include "pbs/bootstrap_low_latency.cuh"
+#include "polynomial/parameters.cuh"
+#include <vector>
+
+/*
+ * Classic low latency PBS, as two kernels per LWE coefficient against a
+ * single persistent kernel. The templates are called directly so that the
+ * fast variant, which the dispatch prefers whenever its grid fits, doesn't
+ * take over. The ciphertexts, LUT and key are zeroed, only the timings are
+ * meaningful.
+ */
+static const uint32_t lwe_dimension = 742;
+static const uint32_t glwe_dimension = 1;
+static const uint32_t base_log = 23;
+static const uint32_t level_count = 1;
+
+template <int N, bool persistent>
+static void BM_ClassicLowLatencyPbs(benchmark::State &state) {
+  if (skip_without_gpu(state))
+    return;
+  using params = Degree<N>;
+  const uint32_t num_samples = state.range(0);
+  auto stream = cuda_create_stream(0);
+  uint32_t max_shared_memory = cuda_get_max_shared_memory(0);
+
+  auto zeroed = [&](uint64_t size) {
+    void *d_array = cuda_malloc_async(size, stream);
+    cuda_memset_async(d_array, 0, size, stream);
+    return d_array;
+  };
+  auto bsk = (double2 *)zeroed(
+      (uint64_t)lwe_dimension * (glwe_dimension + 1) * (glwe_dimension + 1) *
+      level_count * (N / 2) * sizeof(double2));
+  auto lut = (uint64_t *)zeroed((glwe_dimension + 1) * N * sizeof(uint64_t));
+  auto lut_indexes = (uint64_t *)zeroed(num_samples * sizeof(uint64_t));
+  auto lwe_in = (uint64_t *)zeroed((uint64_t)(lwe_dimension + 1) *
+                                   num_samples * sizeof(uint64_t));
+  auto lwe_out = (uint64_t *)zeroed((uint64_t)(glwe_dimension * N + 1) *
+                                    num_samples * sizeof(uint64_t));
+  std::vector<uint64_t> h_indexes(num_samples);
+  for (uint32_t i = 0; i < num_samples; i++)
+    h_indexes[i] = i;
+  auto indexes =
+      (uint64_t *)cuda_malloc_async(num_samples * sizeof(uint64_t), stream);
+  cuda_memcpy_async_to_gpu(indexes, h_indexes.data(),
+                           num_samples * sizeof(uint64_t), stream);
+
+  int8_t *pbs_buffer = nullptr;
+  scratch_bootstrap_low_latency<uint64_t, int64_t, params>(
+      stream, &pbs_buffer, glwe_dimension, N, level_count, num_samples,
+      max_shared_memory, true, persistent);
+  if (persistent && get_low_latency_persistent_max_grid_size(pbs_buffer) == 0) {
+    state.SkipWithError("no cooperative launch on this device");
+  } else {
+    time_on_stream(state, stream, [&] {
+      host_bootstrap_low_latency<uint64_t, params>(
+          stream, lwe_out, indexes, lut, lut_indexes, lwe_in, indexes, bsk,
+          pbs_buffer, glwe_dimension, lwe_dimension, N, base_log, level_count,
+          num_samples, 1, max_shared_memory);
+    });
+    state.counters["launches"] = persistent ? 1 : 2 * lwe_dimension;
+  }
+
+  cleanup_cuda_bootstrap_low_latency(stream, &pbs_buffer);
+  for (void *d_array : {(void *)bsk, (void *)lut, (void *)lut_indexes,
+                        (void *)lwe_in, (void *)lwe_out, (void *)indexes})
+    cuda_drop_async(d_array, stream);
+  cuda_destroy_stream(stream);
+}
+
+static void low_latency_pbs_arguments(benchmark::internal::Benchmark *b) {
+  b->ArgName("samples")->RangeMultiplier(4)->Range(1, 256)->UseManualTime();
+}
+
+BENCHMARK_TEMPLATE(BM_ClassicLowLatencyPbs, 2048, false)
+    ->Apply(low_latency_pbs_arguments);
+BENCHMARK_TEMPLATE(BM_ClassicLowLatencyPbs, 2048, true)
+    ->Apply(low_latency_pbs_arguments);
+BENCHMARK_TEMPLATE(BM_ClassicLowLatencyPbs, 8192, false)
+    ->Apply(low_latency_pbs_arguments);
+BENCHMARK_TEMPLATE(BM_ClassicLowLatencyPbs, 8192, true)
+    ->Apply(low_latency_pbs_arguments);
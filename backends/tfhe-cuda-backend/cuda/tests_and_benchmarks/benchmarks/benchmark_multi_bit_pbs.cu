@@ -0,0 +1,111 @@
+#include "benchmark_utils.cuh"
+#include "bootstrap_multibit.h"
+#include "device.h"
+#include "pbs/bootstrap_fast_multibit.cuh"
+#include "pbs/bootstrap_multibit.cuh"
+#include "polynomial/parameters.cuh"
+#include <vector>
+
+/*
+ * Multi-bit PBS with two accumulation kernels per LWE group against the
+ * cooperative variant, which accumulates a whole chunk in a single kernel.
+ * Both run with the chunk size their buffer was scratched with, so that the
+ * tuning cache of the machine doesn't change what is measured. The
+ * ciphertexts, LUT and key are zeroed, only the timings are meaningful.
+ */
+static const uint32_t lwe_dimension = 888;
+static const uint32_t glwe_dimension = 1;
+static const uint32_t grouping_factor = 3;
+static const uint32_t base_log = 21;
+static const uint32_t level_count = 1;
+
+template <int N, bool fast>
+static void BM_MultiBitPbs(benchmark::State &state) {
+  if (skip_without_gpu(state))
+    return;
+  using params = AmortizedDegree<N>;
+  const uint32_t num_samples = state.range(0);
+  auto stream = cuda_create_stream(0);
+  uint32_t max_shared_memory = cuda_get_max_shared_memory(0);
+
+  if (fast && !verify_cuda_bootstrap_fast_multi_bit_grid_size<uint64_t, params>(
+                  glwe_dimension, level_count, num_samples,
+                  max_shared_memory)) {
+    state.SkipWithError("cooperative grid does not fit on this device");
+    cuda_destroy_stream(stream);
+    return;
+  }
+
+  auto zeroed = [&](uint64_t size) {
+    void *d_array = cuda_malloc_async(size, stream);
+    cuda_memset_async(d_array, 0, size, stream);
+    return d_array;
+  };
+  auto bsk = (uint64_t *)zeroed(
+      (uint64_t)(lwe_dimension / grouping_factor) * (1 << grouping_factor) *
+      (glwe_dimension + 1) * (glwe_dimension + 1) * level_count * N *
+      sizeof(uint64_t));
+  auto lut = (uint64_t *)zeroed((glwe_dimension + 1) * N * sizeof(uint64_t));
+  auto lut_indexes = (uint64_t *)zeroed(num_samples * sizeof(uint64_t));
+  auto lwe_in = (uint64_t *)zeroed((uint64_t)(lwe_dimension + 1) *
+                                   num_samples * sizeof(uint64_t));
+  auto lwe_out = (uint64_t *)zeroed((uint64_t)(glwe_dimension * N + 1) *
+                                    num_samples * sizeof(uint64_t));
+  std::vector<uint64_t> h_indexes(num_samples);
+  for (uint32_t i = 0; i < num_samples; i++)
+    h_indexes[i] = i;
+  auto indexes =
+      (uint64_t *)cuda_malloc_async(num_samples * sizeof(uint64_t), stream);
+  cuda_memcpy_async_to_gpu(indexes, h_indexes.data(),
+                           num_samples * sizeof(uint64_t), stream);
+
+  int8_t *pbs_buffer = nullptr;
+  if (fast)
+    scratch_fast_multi_bit_pbs<uint64_t, int64_t, params>(
+        stream, &pbs_buffer, lwe_dimension, glwe_dimension, N, level_count,
+        num_samples, grouping_factor, max_shared_memory, true);
+  else
+    scratch_multi_bit_pbs<uint64_t, int64_t, params>(
+        stream, &pbs_buffer, lwe_dimension, glwe_dimension, N, level_count,
+        num_samples, grouping_factor, max_shared_memory, true);
+  uint32_t lwe_chunk_size =
+      get_multi_bit_pbs_buffer_layout(pbs_buffer, 0, num_samples)
+          .lwe_chunk_size;
+
+  time_on_stream(state, stream, [&] {
+    if (fast)
+      host_fast_multi_bit_pbs<uint64_t, int64_t, params>(
+          stream, lwe_out, indexes, lut, lut_indexes, lwe_in, indexes, bsk,
+          pbs_buffer, glwe_dimension, lwe_dimension, N, grouping_factor,
+          base_log, level_count, num_samples, 1, 0, max_shared_memory,
+          lwe_chunk_size);
+    else
+      host_multi_bit_pbs<uint64_t, int64_t, params>(
+          stream, lwe_out, indexes, lut, lut_indexes, lwe_in, indexes, bsk,
+          pbs_buffer, glwe_dimension, lwe_dimension, N, grouping_factor,
+          base_log, level_count, num_samples, 1, 0, max_shared_memory,
+          lwe_chunk_size);
+  });
+
+  // One keybundle kernel per chunk, then either one cooperative kernel per
+  // chunk or two kernels per LWE group
+  uint32_t num_iterations = lwe_dimension / grouping_factor;
+  uint32_t num_chunks = (num_iterations + lwe_chunk_size - 1) / lwe_chunk_size;
+  state.counters["chunk_size"] = lwe_chunk_size;
+  state.counters["launches"] =
+      num_chunks + (fast ? num_chunks : 2 * num_iterations);
+
+  cleanup_cuda_multi_bit_pbs(stream, &pbs_buffer);
+  for (void *d_array : {(void *)bsk, (void *)lut, (void *)lut_indexes,
+                        (void *)lwe_in, (void *)lwe_out, (void *)indexes})
+    cuda_drop_async(d_array, stream);
+  cuda_destroy_stream(stream);
+}
+
+static void multi_bit_pbs_arguments(benchmark::internal::Benchmark *b) {
+  b->ArgName("samples")->DenseRange(1, 8)->UseManualTime();
+}
+
+BENCHMARK_TEMPLATE(BM_MultiBitPbs, 2048, false)
+    ->Apply(multi_bit_pbs_arguments);
+BENCHMARK_TEMPLATE(BM_MultiBitPbs, 2048, true)->Apply(multi_bit_pbs_arguments);
@@ -0,0 +1,91 @@
+#include "benchmark_utils.cuh"
+#include "device.h"
+#include "fft/twiddles.cuh"
+#include "negacyclic_fft.h"
+#include "polynomial_size_dispatch.h"
+#include <vector>
+
+/*
+ * Twiddle reads of the FFT from the global table behind negtwiddles, against
+ * the same twiddles in constant memory, where the literal table used to live.
+ *
+ * The kernel reads the twiddles of every level the way the radix-2
+ * butterflies do: at level l, butterfly j of a polynomial uses
+ * T[2^(l-1) + j / distance]. The threads of a warp share one twiddle in the
+ * first levels, which is what constant memory is good at, and read 32
+ * different ones in the last levels, which constant memory serializes. One
+ * block per polynomial, each thread holding opt / 2 butterflies.
+ */
+// Half of the constant memory, the rest being left to the backend
+constexpr uint32_t constant_twiddles_size = 2048;
+__constant__ double2 constant_twiddles[constant_twiddles_size];
+
+struct constant_twiddle_source {
+  __device__ static double2 get(uint32_t index) {
+    return constant_twiddles[index];
+  }
+};
+
+struct global_twiddle_source {
+  __device__ static double2 get(uint32_t index) { return negtwiddles[index]; }
+};
+
+template <class Source>
+__global__ void read_fft_twiddles(double2 *output, uint32_t half_size,
+                                  uint32_t log2_half_size) {
+  double2 sum = {0, 0};
+  for (uint32_t level = 1; level <= log2_half_size; level++) {
+    uint32_t distance = half_size >> level;
+    for (uint32_t j = threadIdx.x; j < half_size / 2; j += blockDim.x) {
+      double2 w = Source::get((1u << (level - 1)) + j / distance);
+      sum.x += w.x;
+      sum.y += w.y;
+    }
+  }
+  output[blockIdx.x * blockDim.x + threadIdx.x] = sum;
+}
+
+template <class Source>
+static void BM_FftTwiddleReads(benchmark::State &state) {
+  if (skip_without_gpu(state))
+    return;
+  const uint32_t polynomial_size = state.range(0);
+  const uint32_t num_polynomials = state.range(1);
+  const uint32_t half_size = polynomial_size / 2;
+  const uint32_t log2_half_size = log2_polynomial_size(half_size);
+  // As the amortized PBS, 8 coefficients per thread
+  const uint32_t threads = polynomial_size / 8;
+
+  auto stream = cuda_create_stream(0);
+  cuda_initialize_twiddles(stream);
+  std::vector<double2> h_twiddles(constant_twiddles_size);
+  generate_negacyclic_twiddles(h_twiddles.data(), 0, constant_twiddles_size);
+  check_cuda_error(cudaMemcpyToSymbol(constant_twiddles, h_twiddles.data(),
+                                      sizeof(constant_twiddles)));
+  auto d_output = (double2 *)cuda_malloc_async(
+      num_polynomials * threads * sizeof(double2), stream);
+
+  time_on_stream(state, stream, [&] {
+    read_fft_twiddles<Source>
+        <<<num_polynomials, threads, 0, stream->stream>>>(
+            d_output, half_size, log2_half_size);
+    check_cuda_error(cudaGetLastError());
+  });
+
+  cuda_drop_async(d_output, stream);
+  cuda_destroy_stream(stream);
+}
+
+// constant_twiddles holds the twiddles of polynomials up to N = 4096
+static void fft_twiddle_read_arguments(benchmark::internal::Benchmark *b) {
+  b->ArgNames({"N", "polynomials"});
+  for (int64_t n = 512; n <= 4096; n *= 2)
+    for (int64_t polynomials : {1, 64, 1024})
+      b->Args({n, polynomials});
+  b->UseManualTime();
+}
+
+BENCHMARK_TEMPLATE(BM_FftTwiddleReads, constant_twiddle_source)
+    ->Apply(fft_twiddle_read_arguments);
+BENCHMARK_TEMPLATE(BM_FftTwiddleReads, global_twiddle_source)
+    ->Apply(fft_twiddle_read_arguments);
@@ -0,0 +1,38 @@
+#ifndef CUDA_BENCHMARK_UTILS_CUH
+#define CUDA_BENCHMARK_UTILS_CUH
+
+#include "device.h"
+#include <benchmark/benchmark.h>
+
+// Skips the benchmark when there is no GPU to run it on
+inline bool skip_without_gpu(benchmark::State &state) {
+  if (cuda_get_number_of_gpus() > 0)
+    return false;
+  state.SkipWithError("no GPU");
+  return true;
+}
+
+// Runs the benchmark loop, timing with CUDA events the work that run enqueues
+// on stream. Benchmarks using it are registered with UseManualTime().
+template <class F>
+void time_on_stream(benchmark::State &state, cuda_stream_t *stream, F &&run) {
+  cudaEvent_t start, stop;
+  check_cuda_error(cudaEventCreate(&start));
+  check_cuda_error(cudaEventCreate(&stop));
+  // Warm up, so that lazily configured kernels don't count
+  run();
+  stream->synchronize();
+  for (auto _ : state) {
+    check_cuda_error(cudaEventRecord(start, stream->stream));
+    run();
+    check_cuda_error(cudaEventRecord(stop, stream->stream));
+    check_cuda_error(cudaEventSynchronize(stop));
+    float milliseconds = 0;
+    check_cuda_error(cudaEventElapsedTime(&milliseconds, start, stop));
+    state.SetIterationTime(milliseconds / 1000.);
+  }
+  check_cuda_error(cudaEventDestroy(start));
+  check_cuda_error(cudaEventDestroy(stop));
+}
+
+#endif // CUDA_BENCHMARK_UTILS_CUH
@@ -0,0 +1,86 @@
+#include "bootstrap.h"
+#include "device.h"
+#include "key_cache.h"
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+static const uint32_t input_lwe_dim = 8;
+static const uint32_t glwe_dim = 1;
+static const uint32_t level_count = 2;
+static const uint32_t polynomial_size = 512;
+
+class KeyCacheExportTest : public ::testing::Test {
+protected:
+  cuda_stream_t *stream;
+  std::string path;
+  uint64_t size;
+  std::vector<uint8_t> h_key;
+  void *d_key;
+
+  void SetUp() override {
+    if (cuda_get_number_of_gpus() == 0)
+      GTEST_SKIP() << "no GPU";
+    stream = cuda_create_stream(0);
+    path = ::testing::TempDir() + "tfhe_cuda_key_cache_export_test";
+    size = key_cache_payload_size(KEY_CACHE_FOURIER_BSK_64, input_lwe_dim,
+                                  glwe_dim, level_count, polynomial_size, 0);
+    h_key.resize(size);
+    for (uint64_t i = 0; i < size; i++)
+      h_key[i] = (uint8_t)(i * 13 + 7);
+    d_key = cuda_malloc_async(size, stream);
+    cuda_memcpy_async_to_gpu(d_key, h_key.data(), size, stream);
+  }
+
+  void TearDown() override {
+    if (IsSkipped())
+      return;
+    std::remove(path.c_str());
+    cuda_drop_async(d_key, stream);
+    cuda_destroy_stream(stream);
+  }
+
+  int import(void *dest) {
+    return cuda_import_lwe_bootstrap_key_64(dest, path.c_str(), stream,
+                                            input_lwe_dim, glwe_dim,
+                                            level_count, polynomial_size);
+  }
+};
+
+TEST_F(KeyCacheExportTest, ImportsTheExportedKey) {
+  ASSERT_EQ(cuda_export_lwe_bootstrap_key_64(path.c_str(), d_key, stream,
+                                             input_lwe_dim, glwe_dim,
+                                             level_count, polynomial_size),
+            0);
+  void *d_imported = cuda_malloc_async(size, stream);
+  ASSERT_EQ(import(d_imported), 0);
+  std::vector<uint8_t> imported(size);
+  cuda_memcpy_async_to_cpu(imported.data(), d_imported, size, stream);
+  stream->synchronize();
+  EXPECT_EQ(imported, h_key);
+  cuda_drop_async(d_imported, stream);
+}
+
+TEST_F(KeyCacheExportTest, RejectsACorruptedHeader) {
+  ASSERT_EQ(cuda_export_lwe_bootstrap_key_64(path.c_str(), d_key, stream,
+                                             input_lwe_dim, glwe_dim,
+                                             level_count, polynomial_size),
+            0);
+  FILE *file = fopen(path.c_str(), "r+b");
+  ASSERT_NE(file, nullptr);
+  uint32_t key_type = KEY_CACHE_MULTI_BIT_BSK_64;
+  fseek(file, offsetof(key_cache_header, key_type), SEEK_SET);
+  fwrite(&key_type, sizeof(key_type), 1, file);
+  fclose(file);
+
+  void *d_imported = cuda_malloc_async(size, stream);
+  cuda_memset_async(d_imported, 0, size, stream);
+  EXPECT_EQ(import(d_imported), -3);
+  // Nothing was copied
+  std::vector<uint8_t> imported(size);
+  cuda_memcpy_async_to_cpu(imported.data(), d_imported, size, stream);
+  stream->synchronize();
+  EXPECT_EQ(imported, std::vector<uint8_t>(size, 0));
+  cuda_drop_async(d_imported, stream);
+}
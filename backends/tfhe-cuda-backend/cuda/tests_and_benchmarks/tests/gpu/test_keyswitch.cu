@@ -0,0 +1,112 @@
+#include "crypto/keyswitch.cuh"
+#include "device.h"
+#include "keyswitch.h"
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+
+struct keyswitch_shape {
+  uint32_t lwe_dimension_in;
+  uint32_t lwe_dimension_out;
+  uint32_t base_log;
+  uint32_t level_count;
+  uint32_t num_samples;
+};
+
+class KeyswitchTest : public ::testing::TestWithParam<keyswitch_shape> {
+protected:
+  cuda_stream_t *stream;
+
+  void SetUp() override {
+    if (cuda_get_number_of_gpus() == 0)
+      GTEST_SKIP() << "no GPU";
+    stream = cuda_create_stream(0);
+  }
+
+  void TearDown() override {
+    if (!IsSkipped())
+      cuda_destroy_stream(stream);
+  }
+
+  template <typename T> T *to_device(std::vector<T> &h_array) {
+    auto d_array =
+        (T *)cuda_malloc_async(h_array.size() * sizeof(T), stream);
+    cuda_memcpy_async_to_gpu(d_array, h_array.data(),
+                             h_array.size() * sizeof(T), stream);
+    return d_array;
+  }
+};
+
+// Both kernels and the host reference compute the same sums in the same
+// order, modulo 2^64: the results must be bit-exact
+TEST_P(KeyswitchTest, BatchedMatchesUntiledAndReference) {
+  auto shape = GetParam();
+  uint32_t lwe_size_in = shape.lwe_dimension_in + 1;
+  uint32_t lwe_size_out = shape.lwe_dimension_out + 1;
+  std::mt19937_64 rng(shape.num_samples * 1000 + shape.level_count);
+
+  std::vector<uint64_t> ksk((uint64_t)shape.lwe_dimension_in *
+                            shape.level_count * lwe_size_out);
+  std::vector<uint64_t> lwe_in((uint64_t)shape.num_samples * lwe_size_in);
+  for (auto &x : ksk)
+    x = rng();
+  for (auto &x : lwe_in)
+    x = rng();
+  // Gather and scatter through shuffled indexes
+  std::vector<uint64_t> input_indexes(shape.num_samples);
+  std::vector<uint64_t> output_indexes(shape.num_samples);
+  for (uint32_t s = 0; s < shape.num_samples; s++)
+    input_indexes[s] = output_indexes[s] = s;
+  std::shuffle(input_indexes.begin(), input_indexes.end(), rng);
+  std::shuffle(output_indexes.begin(), output_indexes.end(), rng);
+
+  std::vector<uint64_t> expected((uint64_t)shape.num_samples * lwe_size_out);
+  keyswitch_lwe_ciphertext_vector_reference<uint64_t>(
+      expected.data(), output_indexes.data(), lwe_in.data(),
+      input_indexes.data(), ksk.data(), shape.lwe_dimension_in,
+      shape.lwe_dimension_out, shape.base_log, shape.level_count,
+      shape.num_samples);
+
+  auto d_ksk = to_device(ksk);
+  auto d_lwe_in = to_device(lwe_in);
+  auto d_input_indexes = to_device(input_indexes);
+  auto d_output_indexes = to_device(output_indexes);
+  uint64_t out_bytes = expected.size() * sizeof(uint64_t);
+  auto d_untiled = (uint64_t *)cuda_malloc_async(out_bytes, stream);
+  auto d_batched = (uint64_t *)cuda_malloc_async(out_bytes, stream);
+
+  cuda_keyswitch_lwe_ciphertext_vector_64(
+      stream, d_untiled, d_output_indexes, d_lwe_in, d_input_indexes, d_ksk,
+      shape.lwe_dimension_in, shape.lwe_dimension_out, shape.base_log,
+      shape.level_count, shape.num_samples);
+  cuda_keyswitch_lwe_ciphertext_vector_batched_64(
+      stream, d_batched, d_output_indexes, d_lwe_in, d_input_indexes, d_ksk,
+      shape.lwe_dimension_in, shape.lwe_dimension_out, shape.base_log,
+      shape.level_count, shape.num_samples);
+
+  std::vector<uint64_t> untiled(expected.size()), batched(expected.size());
+  cuda_memcpy_async_to_cpu(untiled.data(), d_untiled, out_bytes, stream);
+  cuda_memcpy_async_to_cpu(batched.data(), d_batched, out_bytes, stream);
+  stream->synchronize();
+  ASSERT_EQ(cudaGetLastError(), cudaSuccess);
+  EXPECT_EQ(untiled, expected);
+  EXPECT_EQ(batched, expected);
+
+  cuda_drop_async(d_ksk, stream);
+  cuda_drop_async(d_lwe_in, stream);
+  cuda_drop_async(d_input_indexes, stream);
+  cuda_drop_async(d_output_indexes, stream);
+  cuda_drop_async(d_untiled, stream);
+  cuda_drop_async(d_batched, stream);
+}
+
+// Partial last blocks of samples and coefficients, and level counts that
+// don't divide the tile
+INSTANTIATE_TEST_SUITE_P(
+    Shapes, KeyswitchTest,
+    ::testing::Values(keyswitch_shape{1024, 500, 3, 5, 1},
+                      keyswitch_shape{1024, 500, 3, 5, 33},
+                      keyswitch_shape{2048, 744, 4, 3, 8},
+                      keyswitch_shape{2048, 744, 15, 1, 100},
+                      keyswitch_shape{700, 127, 2, 7, 17}));
@@ -0,0 +1,147 @@
+#include "bootstrap.h"
+#include "device.h"
+#include "keyswitch.h"
+#include "pbs/keyswitch_bootstrap.cuh"
+#include "polynomial/parameters.cuh"
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+
+static const uint32_t lwe_dimension_in = 2048;
+static const uint32_t lwe_dimension = 744;
+static const uint32_t glwe_dimension = 1;
+static const uint32_t polynomial_size = 2048;
+static const uint32_t ks_base_log = 3;
+static const uint32_t ks_level_count = 5;
+static const uint32_t base_log = 23;
+static const uint32_t level_count = 1;
+
+class KeyswitchBootstrapTest : public ::testing::TestWithParam<uint32_t> {
+protected:
+  cuda_stream_t *stream;
+  std::mt19937_64 rng;
+
+  void SetUp() override {
+    if (cuda_get_number_of_gpus() == 0)
+      GTEST_SKIP() << "no GPU";
+    stream = cuda_create_stream(0);
+    rng.seed(GetParam());
+  }
+
+  void TearDown() override {
+    if (!IsSkipped())
+      cuda_destroy_stream(stream);
+  }
+
+  uint64_t *random_device_array(uint64_t size) {
+    std::vector<uint64_t> h_array(size);
+    for (auto &x : h_array)
+      x = rng();
+    auto d_array =
+        (uint64_t *)cuda_malloc_async(size * sizeof(uint64_t), stream);
+    cuda_memcpy_async_to_gpu(d_array, h_array.data(), size * sizeof(uint64_t),
+                             stream);
+    stream->synchronize();
+    return d_array;
+  }
+
+  std::vector<uint64_t> to_host(uint64_t *d_array, uint64_t size) {
+    std::vector<uint64_t> h_array(size);
+    cuda_memcpy_async_to_cpu(h_array.data(), d_array, size * sizeof(uint64_t),
+                             stream);
+    stream->synchronize();
+    return h_array;
+  }
+};
+
+// The fused kernel and the unfused path run the same blind rotation on the
+// same keyswitched ciphertexts, the outputs must be bit-exact
+TEST_P(KeyswitchBootstrapTest, FusedMatchesKeyswitchThenBootstrap) {
+  uint32_t num_samples = GetParam();
+  uint32_t max_shared_memory = cuda_get_max_shared_memory(0);
+  uint64_t glwe_size = glwe_dimension + 1;
+  uint64_t lwe_out_size = glwe_dimension * polynomial_size + 1;
+
+  uint64_t bsk_size = (uint64_t)lwe_dimension * glwe_size * glwe_size *
+                      level_count * polynomial_size;
+  std::vector<uint64_t> h_bsk(bsk_size);
+  for (auto &x : h_bsk)
+    x = rng();
+  auto d_bsk = (double2 *)cuda_malloc_async(
+      bsk_size / 2 * sizeof(double2), stream);
+  cuda_convert_lwe_bootstrap_key_64(d_bsk, h_bsk.data(), stream,
+                                    lwe_dimension, glwe_dimension, level_count,
+                                    polynomial_size);
+
+  auto d_ksk = random_device_array((uint64_t)lwe_dimension_in *
+                                   ks_level_count * (lwe_dimension + 1));
+  auto d_lwe_in =
+      random_device_array((uint64_t)num_samples * (lwe_dimension_in + 1));
+  auto d_lut = random_device_array(glwe_size * polynomial_size);
+  std::vector<uint64_t> h_indexes(num_samples), h_lut_indexes(num_samples, 0);
+  for (uint32_t s = 0; s < num_samples; s++)
+    h_indexes[s] = num_samples - 1 - s;
+  auto d_indexes = (uint64_t *)cuda_malloc_async(
+      num_samples * sizeof(uint64_t), stream);
+  auto d_lut_indexes = (uint64_t *)cuda_malloc_async(
+      num_samples * sizeof(uint64_t), stream);
+  cuda_memcpy_async_to_gpu(d_indexes, h_indexes.data(),
+                           num_samples * sizeof(uint64_t), stream);
+  cuda_memcpy_async_to_gpu(d_lut_indexes, h_lut_indexes.data(),
+                           num_samples * sizeof(uint64_t), stream);
+
+  uint64_t ks_size = (uint64_t)num_samples * (lwe_dimension + 1);
+  uint64_t out_size = num_samples * lwe_out_size;
+  auto d_ks_fused =
+      (uint64_t *)cuda_malloc_async(ks_size * sizeof(uint64_t), stream);
+  auto d_ks_unfused =
+      (uint64_t *)cuda_malloc_async(ks_size * sizeof(uint64_t), stream);
+  auto d_out_fused =
+      (uint64_t *)cuda_malloc_async(out_size * sizeof(uint64_t), stream);
+  auto d_out_unfused =
+      (uint64_t *)cuda_malloc_async(out_size * sizeof(uint64_t), stream);
+
+  int8_t *pbs_buffer;
+  scratch_cuda_keyswitch_bootstrap_low_latency_64(
+      stream, &pbs_buffer, lwe_dimension, glwe_dimension, polynomial_size,
+      level_count, num_samples, max_shared_memory, true);
+
+  bool fused = execute_keyswitch_bootstrap_fast_low_latency<
+      uint64_t, AmortizedDegree<polynomial_size>>(
+      stream, d_out_fused, d_indexes, d_lut, d_lut_indexes, d_lwe_in,
+      d_indexes, d_ks_fused, d_ksk, d_bsk, pbs_buffer, lwe_dimension_in,
+      lwe_dimension, glwe_dimension, polynomial_size, ks_base_log,
+      ks_level_count, base_log, level_count, num_samples, max_shared_memory);
+
+  cuda_keyswitch_lwe_ciphertext_vector_64(
+      stream, d_ks_unfused, d_indexes, d_lwe_in, d_indexes, d_ksk,
+      lwe_dimension_in, lwe_dimension, ks_base_log, ks_level_count,
+      num_samples);
+  cuda_bootstrap_low_latency_lwe_ciphertext_vector_64(
+      stream, d_out_unfused, d_indexes, d_lut, d_lut_indexes, d_ks_unfused,
+      d_indexes, d_bsk, pbs_buffer, lwe_dimension, glwe_dimension,
+      polynomial_size, base_log, level_count, num_samples, 1, 0,
+      max_shared_memory);
+  stream->synchronize();
+  ASSERT_EQ(cudaGetLastError(), cudaSuccess);
+
+  if (fused) {
+    EXPECT_EQ(to_host(d_ks_fused, ks_size), to_host(d_ks_unfused, ks_size));
+    EXPECT_EQ(to_host(d_out_fused, out_size),
+              to_host(d_out_unfused, out_size));
+  }
+
+  cleanup_cuda_bootstrap_low_latency(stream, &pbs_buffer);
+  for (void *ptr :
+       {(void *)d_bsk, (void *)d_ksk, (void *)d_lwe_in, (void *)d_lut,
+        (void *)d_indexes, (void *)d_lut_indexes, (void *)d_ks_fused,
+        (void *)d_ks_unfused, (void *)d_out_fused, (void *)d_out_unfused})
+    cuda_drop_async(ptr, stream);
+  stream->synchronize();
+
+  if (!fused)
+    GTEST_SKIP() << "the fused kernel doesn't fit on this device";
+}
+
+INSTANTIATE_TEST_SUITE_P(NumSamples, KeyswitchBootstrapTest,
+                         ::testing::Values(1, 4, 16));
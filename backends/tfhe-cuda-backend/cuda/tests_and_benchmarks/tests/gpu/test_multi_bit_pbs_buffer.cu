@@ -0,0 +1,140 @@
+#include "bootstrap_multibit.h"
+#include "device.h"
+#include <cstdlib>
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+// Small parameters, so that tuning only takes a few seconds
+static const uint32_t lwe_dimension = 256;
+static const uint32_t glwe_dimension = 1;
+static const uint32_t polynomial_size = 1024;
+static const uint32_t grouping_factor = 2;
+static const uint32_t base_log = 22;
+static const uint32_t level_count = 1;
+
+class MultiBitPbsBufferTest : public ::testing::Test {
+protected:
+  cuda_stream_t *stream;
+  uint64_t *d_bsk;
+  uint32_t max_shared_memory;
+
+  void SetUp() override {
+    if (cuda_get_number_of_gpus() == 0)
+      GTEST_SKIP() << "no GPU";
+    // Keep the tuning results away from the user's cache
+    std::string cache = ::testing::TempDir() + "tfhe_cuda_tuning_cache_test";
+    setenv("TFHE_CUDA_TUNING_CACHE", cache.c_str(), 1);
+    std::remove(cache.c_str());
+
+    stream = cuda_create_stream(0);
+    max_shared_memory = cuda_get_max_shared_memory(0);
+    uint64_t bsk_size = (uint64_t)lwe_dimension * (glwe_dimension + 1) *
+                        (glwe_dimension + 1) * level_count *
+                        (1 << grouping_factor) / grouping_factor *
+                        polynomial_size;
+    d_bsk = (uint64_t *)cuda_malloc_async(bsk_size * sizeof(uint64_t), stream);
+    cuda_memset_async(d_bsk, 0, bsk_size * sizeof(uint64_t), stream);
+  }
+
+  void TearDown() override {
+    if (IsSkipped())
+      return;
+    cuda_drop_async(d_bsk, stream);
+    cuda_destroy_stream(stream);
+  }
+
+  // Runs a zeroed batch in pbs_buffer with the chunk size chosen by the
+  // backend, and checks that the kernels ran fine
+  void run_pbs(int8_t *pbs_buffer, uint32_t num_samples) {
+    uint64_t lwe_in_size = (uint64_t)num_samples * (lwe_dimension + 1);
+    uint64_t lwe_out_size =
+        (uint64_t)num_samples * (glwe_dimension * polynomial_size + 1);
+    uint64_t lut_size = (uint64_t)(glwe_dimension + 1) * polynomial_size;
+    auto d_lwe_in = (uint64_t *)cuda_malloc_async(
+        lwe_in_size * sizeof(uint64_t), stream);
+    auto d_lwe_out = (uint64_t *)cuda_malloc_async(
+        lwe_out_size * sizeof(uint64_t), stream);
+    auto d_lut =
+        (uint64_t *)cuda_malloc_async(lut_size * sizeof(uint64_t), stream);
+    auto d_lut_indexes = (uint64_t *)cuda_malloc_async(
+        num_samples * sizeof(uint64_t), stream);
+    auto d_lwe_indexes = (uint64_t *)cuda_malloc_async(
+        num_samples * sizeof(uint64_t), stream);
+    cuda_memset_async(d_lwe_in, 0, lwe_in_size * sizeof(uint64_t), stream);
+    cuda_memset_async(d_lut, 0, lut_size * sizeof(uint64_t), stream);
+    cuda_memset_async(d_lut_indexes, 0, num_samples * sizeof(uint64_t),
+                      stream);
+    std::vector<uint64_t> h_lwe_indexes(num_samples);
+    for (uint32_t i = 0; i < num_samples; i++)
+      h_lwe_indexes[i] = i;
+    cuda_memcpy_async_to_gpu(d_lwe_indexes, h_lwe_indexes.data(),
+                             num_samples * sizeof(uint64_t), stream);
+
+    cuda_multi_bit_pbs_lwe_ciphertext_vector_64(
+        stream, d_lwe_out, d_lwe_indexes, d_lut, d_lut_indexes, d_lwe_in,
+        d_lwe_indexes, d_bsk, pbs_buffer, lwe_dimension, glwe_dimension,
+        polynomial_size, grouping_factor, base_log, level_count, num_samples,
+        1, 0, max_shared_memory);
+    stream->synchronize();
+    EXPECT_EQ(cudaGetLastError(), cudaSuccess);
+
+    cuda_drop_async(d_lwe_in, stream);
+    cuda_drop_async(d_lwe_out, stream);
+    cuda_drop_async(d_lut, stream);
+    cuda_drop_async(d_lut_indexes, stream);
+    cuda_drop_async(d_lwe_indexes, stream);
+  }
+};
+
+TEST_F(MultiBitPbsBufferTest, TuningAfterScratchKeepsTheScratchedLayout) {
+  const uint32_t num_samples = 64;
+  uint32_t scratch_chunk_size = get_scratch_lwe_chunk_size(
+      0, lwe_dimension, glwe_dimension, polynomial_size, level_count,
+      grouping_factor, num_samples);
+  int8_t *pbs_buffer;
+  scratch_cuda_multi_bit_pbs_64(stream, &pbs_buffer, lwe_dimension,
+                                glwe_dimension, polynomial_size, level_count,
+                                grouping_factor, num_samples,
+                                max_shared_memory, true);
+
+  uint32_t tuned_chunk_size = cuda_tune_multi_bit_pbs_chunk_size_64(
+      stream, d_bsk, lwe_dimension, glwe_dimension, polynomial_size,
+      grouping_factor, base_log, level_count, num_samples, max_shared_memory);
+  ASSERT_GT(tuned_chunk_size, 0);
+  ASSERT_EQ(get_tuned_lwe_chunk_size(0, lwe_dimension, glwe_dimension,
+                                     polynomial_size, level_count,
+                                     grouping_factor, num_samples),
+            tuned_chunk_size);
+
+  // Whatever was tuned, the batch is executed within the scratched keybundles
+  for (uint32_t batch : {num_samples, num_samples / 4, 1u}) {
+    uint32_t chunk_size = get_execution_lwe_chunk_size(
+        pbs_buffer, 0, lwe_dimension, glwe_dimension, polynomial_size,
+        level_count, grouping_factor, batch, 0);
+    EXPECT_LE((uint64_t)chunk_size * batch,
+              (uint64_t)scratch_chunk_size * num_samples);
+    run_pbs(pbs_buffer, batch);
+  }
+  EXPECT_EQ(get_execution_lwe_chunk_size(
+                pbs_buffer, 0, lwe_dimension, glwe_dimension,
+                polynomial_size, level_count, grouping_factor, num_samples,
+                0),
+            tuned_chunk_size <= scratch_chunk_size ? tuned_chunk_size
+                                                   : scratch_chunk_size);
+
+  cleanup_cuda_multi_bit_pbs(stream, &pbs_buffer);
+
+  // A buffer scratched after tuning uses the tuned chunk size
+  scratch_cuda_multi_bit_pbs_64(stream, &pbs_buffer, lwe_dimension,
+                                glwe_dimension, polynomial_size, level_count,
+                                grouping_factor, num_samples,
+                                max_shared_memory, true);
+  EXPECT_EQ(get_execution_lwe_chunk_size(
+                pbs_buffer, 0, lwe_dimension, glwe_dimension,
+                polynomial_size, level_count, grouping_factor, num_samples,
+                0),
+            tuned_chunk_size);
+  run_pbs(pbs_buffer, num_samples);
+  cleanup_cuda_multi_bit_pbs(stream, &pbs_buffer);
+}
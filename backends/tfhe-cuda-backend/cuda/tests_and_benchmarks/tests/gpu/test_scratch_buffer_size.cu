@@ -0,0 +1,239 @@
+#include "device.h"
+#include "integer.h"
+#include <functional>
+#include <gtest/gtest.h>
+
+/*
+ * The get_buffer_size_* queries run the scratch functions on a measuring
+ * stream. Each scratch function is run here for real on a fresh stream, whose
+ * allocated_bytes counts every device allocation it made, the chunks of the
+ * scratch arena included, and both sizes must be equal. The twiddle table,
+ * created once per device, is not part of any buffer.
+ */
+
+// 2_2 parameters with the low latency PBS
+static const uint32_t glwe_dimension = 1;
+static const uint32_t polynomial_size = 2048;
+static const uint32_t big_lwe_dimension = glwe_dimension * polynomial_size;
+static const uint32_t small_lwe_dimension = 744;
+static const uint32_t ks_level = 5;
+static const uint32_t ks_base_log = 3;
+static const uint32_t pbs_level = 1;
+static const uint32_t pbs_base_log = 23;
+static const uint32_t grouping_factor = 0;
+static const uint32_t message_modulus = 4;
+static const uint32_t carry_modulus = 4;
+static const PBS_TYPE pbs_type = LOW_LAT;
+
+static const uint32_t block_counts[] = {2, 8, 32};
+
+using scratch_function = std::function<void(cuda_stream_t *, int8_t **)>;
+
+class ScratchBufferSizeTest : public ::testing::Test {
+protected:
+  uint32_t max_shared_memory;
+
+  void SetUp() override {
+    if (cuda_get_number_of_gpus() == 0)
+      GTEST_SKIP() << "no GPU";
+    max_shared_memory = cuda_get_max_shared_memory(0);
+  }
+
+  // Device memory taken by scratch on a fresh stream
+  template <typename Buffer>
+  uint64_t scratch_for_real(scratch_function scratch,
+                            scratch_function cleanup) {
+    cuda_stream_t *stream = cuda_create_stream(0);
+    int8_t *mem_ptr = nullptr;
+    scratch(stream, &mem_ptr);
+    stream->synchronize();
+    EXPECT_EQ(cudaGetLastError(), cudaSuccess);
+    uint64_t size = stream->allocated_bytes;
+
+    cleanup(stream, &mem_ptr);
+    delete (Buffer *)mem_ptr;
+    cuda_destroy_stream(stream);
+    delete stream;
+    return size;
+  }
+
+  template <typename Buffer>
+  void expect_measured(uint64_t measured, scratch_function scratch,
+                       scratch_function cleanup, uint32_t num_blocks) {
+    uint64_t allocated = scratch_for_real<Buffer>(scratch, cleanup);
+    EXPECT_GT(allocated, 0) << num_blocks << " blocks";
+    EXPECT_EQ(measured, allocated) << num_blocks << " blocks";
+  }
+};
+
+TEST_F(ScratchBufferSizeTest, Multiplication) {
+  // Schoolbook and Karatsuba plans
+  for (uint32_t karatsuba_threshold : {0u, 4u}) {
+    for (uint32_t num_blocks : block_counts) {
+      SCOPED_TRACE(karatsuba_threshold);
+      expect_measured<int_mul_memory<uint64_t>>(
+          get_buffer_size_integer_mult_radix_ciphertext_kb_64(
+              0, message_modulus, carry_modulus, glwe_dimension,
+              small_lwe_dimension, polynomial_size, pbs_base_log, pbs_level,
+              ks_base_log, ks_level, grouping_factor, num_blocks, pbs_type,
+              max_shared_memory, karatsuba_threshold),
+          [&](cuda_stream_t *stream, int8_t **mem_ptr) {
+            scratch_cuda_integer_mult_radix_ciphertext_kb_64(
+                stream, mem_ptr, message_modulus, carry_modulus,
+                glwe_dimension, small_lwe_dimension, polynomial_size,
+                pbs_base_log, pbs_level, ks_base_log, ks_level,
+                grouping_factor, num_blocks, pbs_type, max_shared_memory,
+                true, karatsuba_threshold);
+          },
+          cleanup_cuda_integer_mult, num_blocks);
+    }
+  }
+}
+
+TEST_F(ScratchBufferSizeTest, Comparison) {
+  // Equality and difference checks have their own buffers
+  for (COMPARISON_TYPE op : {EQ, GT, MAX}) {
+    for (uint32_t num_blocks : block_counts) {
+      SCOPED_TRACE(op);
+      expect_measured<int_comparison_buffer<uint64_t>>(
+          get_buffer_size_integer_radix_comparison_kb_64(
+              0, glwe_dimension, polynomial_size, big_lwe_dimension,
+              small_lwe_dimension, ks_level, ks_base_log, pbs_level,
+              pbs_base_log, grouping_factor, num_blocks, message_modulus,
+              carry_modulus, pbs_type, op),
+          [&](cuda_stream_t *stream, int8_t **mem_ptr) {
+            scratch_cuda_integer_radix_comparison_kb_64(
+                stream, mem_ptr, glwe_dimension, polynomial_size,
+                big_lwe_dimension, small_lwe_dimension, ks_level,
+                ks_base_log, pbs_level, pbs_base_log, grouping_factor,
+                num_blocks, message_modulus, carry_modulus, pbs_type, op,
+                true);
+          },
+          cleanup_cuda_integer_comparison, num_blocks);
+    }
+  }
+}
+
+TEST_F(ScratchBufferSizeTest, Bitop) {
+  for (BITOP_TYPE op : {BITAND, BITXOR}) {
+    for (uint32_t num_blocks : block_counts) {
+      SCOPED_TRACE(op);
+      expect_measured<int_bitop_buffer<uint64_t>>(
+          get_buffer_size_integer_radix_bitop_kb_64(
+              0, glwe_dimension, polynomial_size, big_lwe_dimension,
+              small_lwe_dimension, ks_level, ks_base_log, pbs_level,
+              pbs_base_log, grouping_factor, num_blocks, message_modulus,
+              carry_modulus, pbs_type, op),
+          [&](cuda_stream_t *stream, int8_t **mem_ptr) {
+            scratch_cuda_integer_radix_bitop_kb_64(
+                stream, mem_ptr, glwe_dimension, polynomial_size,
+                big_lwe_dimension, small_lwe_dimension, ks_level,
+                ks_base_log, pbs_level, pbs_base_log, grouping_factor,
+                num_blocks, message_modulus, carry_modulus, pbs_type, op,
+                true);
+          },
+          cleanup_cuda_integer_bitop, num_blocks);
+    }
+  }
+}
+
+TEST_F(ScratchBufferSizeTest, Cmux) {
+  for (uint32_t num_blocks : block_counts) {
+    expect_measured<int_cmux_buffer<uint64_t>>(
+        get_buffer_size_integer_radix_cmux_kb_64(
+            0, glwe_dimension, polynomial_size, big_lwe_dimension,
+            small_lwe_dimension, ks_level, ks_base_log, pbs_level,
+            pbs_base_log, grouping_factor, num_blocks, message_modulus,
+            carry_modulus, pbs_type),
+        [&](cuda_stream_t *stream, int8_t **mem_ptr) {
+          scratch_cuda_integer_radix_cmux_kb_64(
+              stream, mem_ptr, glwe_dimension, polynomial_size,
+              big_lwe_dimension, small_lwe_dimension, ks_level, ks_base_log,
+              pbs_level, pbs_base_log, grouping_factor, num_blocks,
+              message_modulus, carry_modulus, pbs_type, true);
+        },
+        cleanup_cuda_integer_radix_cmux, num_blocks);
+  }
+}
+
+TEST_F(ScratchBufferSizeTest, ScalarShift) {
+  for (SHIFT_TYPE shift_type : {LEFT_SHIFT, RIGHT_SHIFT}) {
+    for (uint32_t num_blocks : block_counts) {
+      SCOPED_TRACE(shift_type);
+      expect_measured<int_shift_buffer<uint64_t>>(
+          get_buffer_size_integer_radix_scalar_shift_kb_64(
+              0, glwe_dimension, polynomial_size, big_lwe_dimension,
+              small_lwe_dimension, ks_level, ks_base_log, pbs_level,
+              pbs_base_log, grouping_factor, num_blocks, message_modulus,
+              carry_modulus, pbs_type, shift_type),
+          [&](cuda_stream_t *stream, int8_t **mem_ptr) {
+            scratch_cuda_integer_radix_scalar_shift_kb_64(
+                stream, mem_ptr, glwe_dimension, polynomial_size,
+                big_lwe_dimension, small_lwe_dimension, ks_level,
+                ks_base_log, pbs_level, pbs_base_log, grouping_factor,
+                num_blocks, message_modulus, carry_modulus, pbs_type,
+                shift_type, true);
+          },
+          cleanup_cuda_integer_radix_scalar_shift, num_blocks);
+    }
+  }
+}
+
+TEST_F(ScratchBufferSizeTest, ScalarRotate) {
+  for (SHIFT_TYPE shift_type : {LEFT_SHIFT, RIGHT_SHIFT}) {
+    for (uint32_t num_blocks : block_counts) {
+      SCOPED_TRACE(shift_type);
+      expect_measured<int_shift_buffer<uint64_t>>(
+          get_buffer_size_integer_radix_scalar_rotate_kb_64(
+              0, glwe_dimension, polynomial_size, big_lwe_dimension,
+              small_lwe_dimension, ks_level, ks_base_log, pbs_level,
+              pbs_base_log, grouping_factor, num_blocks, message_modulus,
+              carry_modulus, pbs_type, shift_type),
+          [&](cuda_stream_t *stream, int8_t **mem_ptr) {
+            scratch_cuda_integer_radix_scalar_rotate_kb_64(
+                stream, mem_ptr, glwe_dimension, polynomial_size,
+                big_lwe_dimension, small_lwe_dimension, ks_level,
+                ks_base_log, pbs_level, pbs_base_log, grouping_factor,
+                num_blocks, message_modulus, carry_modulus, pbs_type,
+                shift_type, true);
+          },
+          cleanup_cuda_integer_radix_scalar_rotate, num_blocks);
+    }
+  }
+}
+
+TEST_F(ScratchBufferSizeTest, FullPropagation) {
+  for (uint32_t num_blocks : block_counts) {
+    expect_measured<int_fullprop_buffer<uint64_t>>(
+        get_buffer_size_full_propagation_64(
+            0, small_lwe_dimension, glwe_dimension, polynomial_size,
+            pbs_level, grouping_factor, num_blocks, message_modulus,
+            carry_modulus, pbs_type),
+        [&](cuda_stream_t *stream, int8_t **mem_ptr) {
+          scratch_cuda_full_propagation_64(
+              stream, mem_ptr, small_lwe_dimension, glwe_dimension,
+              polynomial_size, pbs_level, grouping_factor, num_blocks,
+              message_modulus, carry_modulus, pbs_type, true);
+        },
+        cleanup_cuda_full_propagation, num_blocks);
+  }
+}
+
+TEST_F(ScratchBufferSizeTest, TreeFullPropagation) {
+  for (uint32_t num_blocks : block_counts) {
+    expect_measured<int_fullprop_tree_memory<uint64_t>>(
+        get_buffer_size_full_propagation_tree_kb_64_inplace(
+            0, glwe_dimension, polynomial_size, big_lwe_dimension,
+            small_lwe_dimension, ks_level, ks_base_log, pbs_level,
+            pbs_base_log, grouping_factor, num_blocks, message_modulus,
+            carry_modulus, pbs_type),
+        [&](cuda_stream_t *stream, int8_t **mem_ptr) {
+          scratch_cuda_full_propagation_tree_kb_64_inplace(
+              stream, mem_ptr, glwe_dimension, polynomial_size,
+              big_lwe_dimension, small_lwe_dimension, ks_level, ks_base_log,
+              pbs_level, pbs_base_log, grouping_factor, num_blocks,
+              message_modulus, carry_modulus, pbs_type, true);
+        },
+        cleanup_cuda_full_propagation_tree, num_blocks);
+  }
+}
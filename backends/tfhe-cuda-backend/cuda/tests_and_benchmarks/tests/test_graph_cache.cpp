@@ -0,0 +1,133 @@
+#include "graph_cache.h"
+#include <gtest/gtest.h>
+
+// The cache is driven with the host stand-in of the launcher: nothing is
+// captured, the counters tell which path each call took
+class GraphCacheTest : public ::testing::Test {
+protected:
+  host_graph_launcher launcher;
+  graph_cache *cache;
+  uint64_t num_work_calls = 0;
+
+  int32_t lwe_a = 0, lwe_b = 0, bsk = 0, ksk = 0;
+
+  void SetUp() override { cache = new graph_cache(&launcher, false); }
+  void TearDown() override {
+    cache->release(nullptr);
+    delete cache;
+    EXPECT_EQ(launcher.num_live(), 0);
+    EXPECT_FALSE(launcher.capturing);
+  }
+
+  void call(uint64_t num_blocks, const void *lwe) {
+    cache->run(nullptr, {num_blocks}, {lwe, &bsk, &ksk},
+               [&]() { num_work_calls++; });
+  }
+};
+
+TEST_F(GraphCacheTest, CapturesOnTheSecondCallAndReplaysAfterwards) {
+  call(4, &lwe_a);
+  EXPECT_EQ(cache->num_eager_runs, 1);
+  EXPECT_EQ(launcher.num_captures, 0);
+
+  call(4, &lwe_a);
+  EXPECT_EQ(cache->num_captures, 1);
+  EXPECT_EQ(launcher.num_launches, 1);
+
+  for (int i = 0; i < 5; i++)
+    call(4, &lwe_a);
+  EXPECT_EQ(cache->num_replays, 5);
+  EXPECT_EQ(launcher.num_launches, 6);
+  // Once eagerly and once during the capture
+  EXPECT_EQ(num_work_calls, 2);
+}
+
+TEST_F(GraphCacheTest, UpdatesTheGraphInPlaceWhenOnlyPointersChange) {
+  call(4, &lwe_a);
+  call(4, &lwe_a);
+  void *graph = cache->graph;
+
+  call(4, &lwe_b);
+  EXPECT_EQ(cache->graph, graph);
+  EXPECT_EQ(cache->num_updates, 1);
+  EXPECT_EQ(launcher.num_destroyed, 0);
+  EXPECT_EQ(cache->num_eager_runs, 1);
+  EXPECT_EQ(launcher.num_launches, 2);
+
+  // The updated pointers are replayed without another capture
+  call(4, &lwe_b);
+  EXPECT_EQ(cache->num_replays, 1);
+  EXPECT_EQ(cache->num_captures, 2);
+
+  // Ping-ponging between buffers keeps the same graph
+  call(4, &lwe_a);
+  call(4, &lwe_b);
+  EXPECT_EQ(cache->graph, graph);
+  EXPECT_EQ(cache->num_updates, 3);
+  EXPECT_EQ(launcher.next_graph, 2);
+}
+
+TEST_F(GraphCacheTest, InstantiatesANewGraphWhenTheUpdateFails) {
+  call(4, &lwe_a);
+  call(4, &lwe_a);
+  void *graph = cache->graph;
+
+  launcher.fail_update = true;
+  call(4, &lwe_b);
+  EXPECT_NE(cache->graph, graph);
+  EXPECT_NE(cache->graph, nullptr);
+  EXPECT_EQ(cache->num_updates, 0);
+  EXPECT_EQ(launcher.num_destroyed, 1);
+  EXPECT_EQ(launcher.num_live(), 1);
+  EXPECT_EQ(launcher.num_launches, 2);
+}
+
+TEST_F(GraphCacheTest, StartsOverWhenTheShapeChanges) {
+  call(4, &lwe_a);
+  call(4, &lwe_a);
+
+  call(8, &lwe_a);
+  EXPECT_EQ(cache->graph, nullptr);
+  EXPECT_EQ(launcher.num_destroyed, 1);
+  EXPECT_EQ(cache->num_eager_runs, 2);
+
+  call(8, &lwe_a);
+  EXPECT_EQ(cache->num_captures, 2);
+  EXPECT_EQ(cache->num_updates, 0);
+}
+
+TEST_F(GraphCacheTest, InvalidateDropsTheGraphAndRunsEagerly) {
+  call(4, &lwe_a);
+  call(4, &lwe_a);
+  cache->invalidate(nullptr);
+  EXPECT_EQ(cache->graph, nullptr);
+  EXPECT_EQ(launcher.num_destroyed, 1);
+
+  // Same shape and pointers as before, but decided on the host again
+  call(4, &lwe_a);
+  EXPECT_EQ(cache->num_eager_runs, 2);
+  EXPECT_EQ(cache->num_replays, 0);
+  call(4, &lwe_a);
+  EXPECT_EQ(cache->num_captures, 2);
+}
+
+TEST_F(GraphCacheTest, RunsEagerlyWhenInstantiationFails) {
+  launcher.fail_instantiation = true;
+  call(4, &lwe_a);
+  call(4, &lwe_a);
+  EXPECT_EQ(cache->graph, nullptr);
+  EXPECT_TRUE(cache->capture_failed);
+  // The captured work did not run, it is executed again eagerly
+  EXPECT_EQ(num_work_calls, 3);
+
+  call(4, &lwe_b);
+  EXPECT_EQ(launcher.num_captures, 1);
+  EXPECT_EQ(launcher.num_launches, 0);
+  EXPECT_EQ(cache->num_eager_runs, 3);
+
+  // A new shape gets another chance
+  launcher.fail_instantiation = false;
+  call(8, &lwe_a);
+  call(8, &lwe_a);
+  EXPECT_NE(cache->graph, nullptr);
+}
@@ -0,0 +1,94 @@
+#include "key_cache.h"
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+class KeyCacheTest : public ::testing::Test {
+protected:
+  std::string path;
+  key_cache_header header;
+  std::vector<uint8_t> payload;
+
+  void SetUp() override {
+    path = ::testing::TempDir() + "tfhe_cuda_key_cache_test";
+    header = make_key_cache_header(KEY_CACHE_FOURIER_BSK_64, 4, 1, 2, 256, 0);
+    payload.resize(header.payload_size);
+    for (size_t i = 0; i < payload.size(); i++)
+      payload[i] = (uint8_t)(i * 37 + 11);
+    ASSERT_EQ(key_cache_write(path.c_str(), header, payload.data()), 0);
+  }
+
+  void TearDown() override { std::remove(path.c_str()); }
+
+  // Overwrites the file at offset with size bytes of data
+  void patch(uint64_t offset, const void *data, uint64_t size) {
+    FILE *file = fopen(path.c_str(), "r+b");
+    ASSERT_NE(file, nullptr);
+    fseek(file, offset, SEEK_SET);
+    fwrite(data, size, 1, file);
+    fclose(file);
+  }
+};
+
+TEST_F(KeyCacheTest, LoadsWhatWasWritten) {
+  std::vector<uint8_t> loaded(header.payload_size);
+  EXPECT_EQ(key_cache_load(path.c_str(), header, loaded.data()), 0);
+  EXPECT_EQ(loaded, payload);
+}
+
+TEST_F(KeyCacheTest, RejectsACorruptedHeader) {
+  std::vector<uint8_t> loaded(header.payload_size);
+  uint64_t magic = 0;
+  patch(offsetof(key_cache_header, magic), &magic, sizeof(magic));
+  EXPECT_EQ(key_cache_load(path.c_str(), header, loaded.data()), -2);
+
+  ASSERT_EQ(key_cache_write(path.c_str(), header, payload.data()), 0);
+  uint32_t version = key_cache_version + 1;
+  patch(offsetof(key_cache_header, version), &version, sizeof(version));
+  EXPECT_EQ(key_cache_load(path.c_str(), header, loaded.data()), -2);
+
+  ASSERT_EQ(key_cache_write(path.c_str(), header, payload.data()), 0);
+  uint32_t level_count = header.level_count + 1;
+  patch(offsetof(key_cache_header, level_count), &level_count,
+        sizeof(level_count));
+  EXPECT_EQ(key_cache_load(path.c_str(), header, loaded.data()), -3);
+
+  ASSERT_EQ(key_cache_write(path.c_str(), header, payload.data()), 0);
+  uint64_t checksum = 0;
+  patch(offsetof(key_cache_header, checksum), &checksum, sizeof(checksum));
+  EXPECT_EQ(key_cache_load(path.c_str(), header, loaded.data()), -4);
+}
+
+TEST_F(KeyCacheTest, RejectsAnotherFFTFormat) {
+  EXPECT_EQ(header.fft_format, negacyclic_fft_format);
+  EXPECT_EQ(make_key_cache_header(KEY_CACHE_MULTI_BIT_BSK_64, 4, 1, 2, 256, 2)
+                .fft_format,
+            0);
+
+  // A key converted with older twiddles
+  std::vector<uint8_t> loaded(header.payload_size);
+  uint32_t fft_format = negacyclic_fft_format - 1;
+  patch(offsetof(key_cache_header, fft_format), &fft_format,
+        sizeof(fft_format));
+  EXPECT_EQ(key_cache_load(path.c_str(), header, loaded.data()), -2);
+}
+
+TEST_F(KeyCacheTest, RejectsACorruptedPayload) {
+  std::vector<uint8_t> loaded(header.payload_size);
+  uint8_t byte = payload[100] ^ 1;
+  patch(sizeof(key_cache_header) + 100, &byte, 1);
+  EXPECT_EQ(key_cache_load(path.c_str(), header, loaded.data()), -4);
+
+  ASSERT_EQ(key_cache_write(path.c_str(), header, payload.data()), 0);
+  ASSERT_EQ(truncate(path.c_str(), sizeof(key_cache_header) + 8), 0);
+  EXPECT_EQ(key_cache_load(path.c_str(), header, loaded.data()), -4);
+}
+
+TEST_F(KeyCacheTest, RejectsAnotherKey) {
+  std::vector<uint8_t> loaded(header.payload_size);
+  auto other = make_key_cache_header(KEY_CACHE_FOURIER_BSK_64, 4, 1, 2, 512, 0);
+  EXPECT_EQ(key_cache_load(path.c_str(), other, loaded.data()), -3);
+  EXPECT_EQ(key_cache_load((path + ".missing").c_str(), header, loaded.data()),
+            -1);
+}
@@ -0,0 +1,133 @@
+#include "many_lut.h"
+#include <cstring>
+#include <gtest/gtest.h>
+
+template <typename Torus>
+using lut_functions = std::vector<std::function<Torus(Torus)>>;
+
+static const uint32_t glwe_dimension = 1;
+
+// Functions whose values all differ, so that a function read at the wrong
+// stride or a box read at the wrong input is caught
+template <typename Torus>
+static lut_functions<Torus> make_functions(uint32_t num_many_lut,
+                                           uint32_t modulus_sup) {
+  lut_functions<Torus> functions;
+  for (uint32_t f = 0; f < num_many_lut; f++)
+    functions.push_back([f, modulus_sup](Torus x) -> Torus {
+      return (x * (2 * f + 1) + f) % modulus_sup;
+    });
+  return functions;
+}
+
+template <typename Torus>
+static std::vector<Torus>
+generate(uint32_t polynomial_size, uint32_t message_modulus,
+         uint32_t carry_modulus, const lut_functions<Torus> &functions) {
+  std::vector<Torus> acc((glwe_dimension + 1) * polynomial_size, 1);
+  generate_many_lookup_table<Torus>(acc.data(), glwe_dimension,
+                                    polynomial_size, message_modulus,
+                                    carry_modulus, functions);
+  return acc;
+}
+
+template <typename Torus> static void check_generated_luts() {
+  const uint32_t moduli[][2] = {{2, 2}, {4, 4}, {8, 8}, {4, 1}};
+  for (uint32_t polynomial_size : {256, 2048})
+    for (auto modulus : moduli)
+      for (uint32_t num_many_lut = 1; num_many_lut <= 4; num_many_lut++) {
+        uint32_t message_modulus = modulus[0], carry_modulus = modulus[1];
+        auto functions = make_functions<Torus>(
+            num_many_lut, message_modulus * carry_modulus);
+        auto acc = generate<Torus>(polynomial_size, message_modulus,
+                                   carry_modulus, functions);
+        const char *error = "";
+        EXPECT_TRUE(check_many_lookup_table<Torus>(
+            &acc[glwe_dimension * polynomial_size], polynomial_size,
+            message_modulus, carry_modulus, functions, &error))
+            << error << ": N " << polynomial_size << ", message "
+            << message_modulus << ", carry " << carry_modulus << ", "
+            << num_many_lut << " functions";
+        for (uint32_t i = 0; i < glwe_dimension * polynomial_size; i++)
+          ASSERT_EQ(acc[i], 0) << "mask coefficient " << i;
+      }
+}
+
+TEST(ManyLutTest, GeneratedLutsPassTheCheck64) {
+  check_generated_luts<uint64_t>();
+}
+
+TEST(ManyLutTest, GeneratedLutsPassTheCheck32) {
+  check_generated_luts<uint32_t>();
+}
+
+TEST(ManyLutTest, CheckRejectsMisplacedFunctions) {
+  const uint32_t N = 256, message_modulus = 4, carry_modulus = 4;
+  auto functions = make_functions<uint64_t>(2, 16);
+  auto acc = generate<uint64_t>(N, message_modulus, carry_modulus, functions);
+  uint64_t *body = &acc[glwe_dimension * N];
+  const char *error = "";
+
+  // Swapped functions
+  lut_functions<uint64_t> swapped = {functions[1], functions[0]};
+  EXPECT_FALSE(check_many_lookup_table<uint64_t>(body, N, message_modulus,
+                                                 carry_modulus, swapped,
+                                                 &error));
+  EXPECT_STREQ(error, "wrong function value");
+
+  // Boxes not centered on their input
+  std::rotate(body, body + N - 8, body + N);
+  EXPECT_FALSE(check_many_lookup_table<uint64_t>(body, N, message_modulus,
+                                                 carry_modulus, functions));
+
+  // More functions than inputs
+  EXPECT_FALSE(check_many_lookup_table<uint64_t>(
+      body, N, message_modulus, carry_modulus,
+      make_functions<uint64_t>(32, 16), &error));
+  EXPECT_STREQ(error, "more functions than inputs");
+}
+
+// The accumulator of generate_lookup_table, as it was built before it was
+// expressed as a single-function many-LUT
+static void legacy_generate_lookup_table(uint64_t *acc,
+                                         uint32_t polynomial_size,
+                                         uint32_t message_modulus,
+                                         uint32_t carry_modulus,
+                                         std::function<uint64_t(uint64_t)> f) {
+  uint32_t modulus_sup = message_modulus * carry_modulus;
+  uint32_t box_size = polynomial_size / modulus_sup;
+  uint64_t delta = (1ul << 63) / modulus_sup;
+
+  memset(acc, 0, glwe_dimension * polynomial_size * sizeof(uint64_t));
+  auto body = &acc[glwe_dimension * polynomial_size];
+  for (uint32_t i = 0; i < modulus_sup; i++)
+    for (uint32_t j = i * box_size; j < (i + 1) * box_size; j++)
+      body[j] = f(i) * delta;
+
+  uint32_t half_box_size = box_size / 2;
+  for (uint32_t i = 0; i < half_box_size; i++)
+    body[i] = -body[i];
+  std::rotate(body, body + half_box_size % polynomial_size,
+              body + polynomial_size);
+}
+
+TEST(ManyLutTest, SingleFunctionMatchesTheLegacyAccumulator64) {
+  const uint32_t moduli[][2] = {{2, 2}, {4, 4}, {8, 8}, {4, 1}};
+  lut_functions<uint64_t> functions = {
+      [](uint64_t x) -> uint64_t { return x; },
+      [](uint64_t x) -> uint64_t { return x / 4; },
+      [](uint64_t x) -> uint64_t { return (3 * x + 1) % 8; }};
+  for (uint32_t polynomial_size : {256, 2048})
+    for (auto modulus : moduli)
+      for (auto &f : functions) {
+        std::vector<uint64_t> expected((glwe_dimension + 1) * polynomial_size,
+                                       1);
+        legacy_generate_lookup_table(expected.data(), polynomial_size,
+                                     modulus[0], modulus[1], f);
+        EXPECT_EQ(generate<uint64_t>(polynomial_size, modulus[0], modulus[1],
+                                     {f}),
+                  expected)
+            << "N " << polynomial_size << ", message " << modulus[0]
+            << ", carry " << modulus[1];
+      }
+}
@@ -0,0 +1,65 @@
+#include "multi_bit_pipeline.h"
+#include <algorithm>
+#include <gtest/gtest.h>
+
+TEST(MultiBitPipelineTest, ScheduleIsValidForAnyNumberOfChunks) {
+  for (uint32_t num_chunks = 0; num_chunks <= 8; num_chunks++) {
+    auto schedule = make_multi_bit_pipeline_schedule(num_chunks);
+    const char *error = "";
+    EXPECT_TRUE(check_multi_bit_pipeline_schedule(schedule, num_chunks, &error))
+        << num_chunks << " chunks: " << error;
+  }
+}
+
+TEST(MultiBitPipelineTest, SingleChunkStaysOnTheMainStream) {
+  auto schedule = make_multi_bit_pipeline_schedule(1);
+  ASSERT_EQ(schedule.size(), 2);
+  for (auto &op : schedule)
+    EXPECT_EQ(op.stream, PIPELINE_MAIN_STREAM);
+}
+
+TEST(MultiBitPipelineTest, OverlapsKeybundlesWithTheAccumulation) {
+  // The keybundles of chunk k + 1 are enqueued before the accumulation of
+  // chunk k, on the other stream and into the other slot
+  auto schedule = make_multi_bit_pipeline_schedule(4);
+  int64_t last_keybundle = -1;
+  for (uint32_t i = 0; i < schedule.size(); i++) {
+    auto &op = schedule[i];
+    if (op.type == PIPELINE_KEYBUNDLE) {
+      EXPECT_EQ(op.stream, PIPELINE_SIDE_STREAM);
+      EXPECT_EQ(op.index, op.chunk % multi_bit_pipeline_num_slots);
+      last_keybundle = op.chunk;
+    } else if (op.type == PIPELINE_ACCUMULATE) {
+      EXPECT_EQ(op.stream, PIPELINE_MAIN_STREAM);
+      EXPECT_EQ(last_keybundle, std::min<int64_t>(op.chunk + 1, 3));
+    }
+  }
+}
+
+TEST(MultiBitPipelineTest, RejectsASlotReusedBeforeItsAccumulation) {
+  // Without the wait of the side stream on the slot of chunk 0 being free,
+  // the keybundles of chunk 2 may overwrite it during its accumulation
+  auto schedule = make_multi_bit_pipeline_schedule(3);
+  bool removed = false;
+  for (auto it = schedule.begin(); it != schedule.end(); it++)
+    if (it->type == PIPELINE_WAIT && it->stream == PIPELINE_SIDE_STREAM &&
+        it->index == multi_bit_pipeline_slot_free(0)) {
+      schedule.erase(it);
+      removed = true;
+      break;
+    }
+  ASSERT_TRUE(removed);
+  const char *error = "";
+  EXPECT_FALSE(check_multi_bit_pipeline_schedule(schedule, 3, &error));
+  EXPECT_STREQ(error, "slot overwritten while it is accumulated");
+}
+
+TEST(MultiBitPipelineTest, RejectsAnAccumulationFromTheWrongSlot) {
+  auto schedule = make_multi_bit_pipeline_schedule(2);
+  for (auto &op : schedule)
+    if (op.type == PIPELINE_ACCUMULATE && op.chunk == 1)
+      op.index = 0;
+  const char *error = "";
+  EXPECT_FALSE(check_multi_bit_pipeline_schedule(schedule, 2, &error));
+  EXPECT_STREQ(error, "chunk accumulated from another slot");
+}
@@ -0,0 +1,269 @@
+#include "multi_bit_reference.h"
+#include <gtest/gtest.h>
+#include <random>
+
+/*
+ * The reference is checked end to end on noise-free ciphertexts: a
+ * bootstrapping key is built from known LWE and GLWE secrets, inputs encrypting
+ * every message are bootstrapped, and the outputs must decrypt to the LUT value
+ * of their message. Only the rounding of the mask, the body and the gadget
+ * decomposition remain, which the parameters keep far below half a box.
+ */
+
+static const uint32_t lwe_dimension = 12;
+static const uint32_t glwe_dimension = 1;
+static const uint32_t polynomial_size = 128;
+static const uint32_t message_modulus = 4;
+
+template <typename Torus> struct multi_bit_reference_context {
+  uint32_t grouping_factor;
+  uint32_t base_log;
+  uint32_t level_count;
+  std::mt19937_64 rng;
+  std::vector<Torus> lwe_secret;
+  // glwe_dimension binary polynomials, also the secret of the extracted LWE
+  std::vector<Torus> glwe_secret;
+  std::vector<Torus> bootstrapping_key;
+
+  multi_bit_reference_context(uint32_t grouping_factor, uint32_t base_log,
+                              uint32_t level_count)
+      : grouping_factor(grouping_factor), base_log(base_log),
+        level_count(level_count), rng(grouping_factor) {
+    for (uint32_t i = 0; i < lwe_dimension; i++)
+      lwe_secret.push_back(rng() & 1);
+    for (uint32_t i = 0; i < glwe_dimension * polynomial_size; i++)
+      glwe_secret.push_back(rng() & 1);
+    generate_bootstrapping_key();
+  }
+
+  Torus uniform() { return (Torus)rng(); }
+
+  // Encoding with a padding bit
+  static Torus delta() {
+    return ((Torus)1 << (sizeof(Torus) * 8 - 1)) / message_modulus;
+  }
+
+  // Noise-free GGSW of the constant mu, in the layout of the device key:
+  // level_count levels, each made of glwe_dimension + 1 GLWEs of zero, the
+  // r-th one with mu * q / B^(level + 1) added to its r-th polynomial
+  void encrypt_ggsw(Torus *ggsw, Torus mu) {
+    uint32_t N = polynomial_size;
+    uint32_t glwe_size = glwe_dimension + 1;
+    for (uint32_t level = 0; level < level_count; level++)
+      for (uint32_t row = 0; row < glwe_size; row++) {
+        Torus *glwe =
+            ggsw + (uint64_t)(level * glwe_size + row) * glwe_size * N;
+        for (uint32_t i = 0; i < glwe_size * N; i++)
+          glwe[i] = 0;
+        for (uint32_t p = 0; p < glwe_dimension; p++) {
+          for (uint32_t i = 0; i < N; i++)
+            glwe[p * N + i] = uniform();
+          multi_bit_reference_add_product(&glwe[glwe_dimension * N],
+                                          &glwe[p * N], &glwe_secret[p * N],
+                                          N);
+        }
+        glwe[row * N] +=
+            mu * ((Torus)1 << (sizeof(Torus) * 8 - base_log * (level + 1)));
+      }
+  }
+
+  // For each group of grouping_factor LWE coefficients, GGSW g encrypts 1 if
+  // the secret coefficients of the group are the bits of g, most significant
+  // first, and 0 otherwise. The keybundle then encrypts X^<s, a> for the
+  // group.
+  void generate_bootstrapping_key() {
+    uint64_t ggsw_size = (uint64_t)level_count * (glwe_dimension + 1) *
+                         (glwe_dimension + 1) * polynomial_size;
+    uint32_t num_groups = lwe_dimension / grouping_factor;
+    uint32_t num_ggsws = 1 << grouping_factor;
+    bootstrapping_key.resize(num_groups * num_ggsws * ggsw_size);
+    for (uint32_t group = 0; group < num_groups; group++)
+      for (uint32_t g = 0; g < num_ggsws; g++) {
+        Torus mu = 1;
+        for (uint32_t i = 0; i < grouping_factor; i++)
+          if (((g >> (grouping_factor - i - 1)) & 1) !=
+              lwe_secret[group * grouping_factor + i])
+            mu = 0;
+        encrypt_ggsw(&bootstrapping_key[(group * num_ggsws + g) * ggsw_size],
+                     mu);
+      }
+  }
+
+  std::vector<Torus> encrypt_lwe(uint32_t message) {
+    std::vector<Torus> lwe(lwe_dimension + 1);
+    lwe[lwe_dimension] = (Torus)message * delta();
+    for (uint32_t i = 0; i < lwe_dimension; i++) {
+      lwe[i] = uniform();
+      lwe[lwe_dimension] += lwe[i] * lwe_secret[i];
+    }
+    return lwe;
+  }
+
+  // Trivial GLWE of the negacyclic LUT of f, rotated by half a box so that the
+  // rounding error of the phase may be negative
+  std::vector<Torus> make_lut(uint32_t (*f)(uint32_t)) {
+    uint32_t N = polynomial_size;
+    uint32_t box_size = N / message_modulus;
+    std::vector<Torus> lut((glwe_dimension + 1) * N, 0);
+    Torus *body = &lut[glwe_dimension * N];
+    for (uint32_t i = 0; i < N; i++) {
+      uint32_t message = (i + box_size / 2) / box_size;
+      if (message < message_modulus)
+        body[i] = (Torus)f(message) * delta();
+      else
+        body[i] = -((Torus)f(0) * delta());
+    }
+    return lut;
+  }
+
+  uint32_t decrypt_extracted(const std::vector<Torus> &lwe) {
+    uint32_t dimension = glwe_dimension * polynomial_size;
+    Torus phase = lwe[dimension];
+    for (uint32_t i = 0; i < dimension; i++)
+      phase -= lwe[i] * glwe_secret[i];
+    Torus rounded = (phase + delta() / 2) / delta();
+    return (uint32_t)(rounded % (2 * message_modulus));
+  }
+};
+
+static uint32_t increment(uint32_t m) { return (m + 1) % message_modulus; }
+
+template <typename Torus>
+static void check_round_trip(uint32_t grouping_factor, uint32_t base_log,
+                             uint32_t level_count) {
+  multi_bit_reference_context<Torus> context(grouping_factor, base_log,
+                                             level_count);
+  auto lut = context.make_lut(increment);
+  for (uint32_t message = 0; message < message_modulus; message++)
+    for (int sample = 0; sample < 3; sample++) {
+      auto lwe_in = context.encrypt_lwe(message);
+      std::vector<Torus> lwe_out(glwe_dimension * polynomial_size + 1);
+      reference_multi_bit_pbs<Torus>(
+          lwe_out.data(), lwe_in.data(), lut.data(),
+          context.bootstrapping_key.data(), lwe_dimension, glwe_dimension,
+          polynomial_size, grouping_factor, base_log, level_count);
+      EXPECT_EQ(context.decrypt_extracted(lwe_out), increment(message))
+          << "message " << message << ", sample " << sample;
+    }
+}
+
+class MultiBitReferenceTest : public ::testing::TestWithParam<uint32_t> {};
+
+TEST_P(MultiBitReferenceTest, BootstrapsNoiseFreeCiphertexts64) {
+  check_round_trip<uint64_t>(GetParam(), 16, 3);
+}
+
+TEST_P(MultiBitReferenceTest, BootstrapsNoiseFreeCiphertexts32) {
+  check_round_trip<uint32_t>(GetParam(), 8, 3);
+}
+
+INSTANTIATE_TEST_SUITE_P(GroupingFactors, MultiBitReferenceTest,
+                         ::testing::Values(2, 3, 4));
+
+/*
+ * The shared-input reference must give the same outputs as bootstrapping each
+ * sample on its own, as long as the samples of a run share their mask. The
+ * key, inputs and LUTs are random: both sides compute the same function
+ * whether or not they encrypt anything.
+ */
+template <typename Torus> struct shared_input_batch {
+  static const uint32_t grouping_factor = 3;
+  static const uint32_t base_log = 6;
+  static const uint32_t level_count = 2;
+  static const uint32_t N = 64;
+  static const uint32_t num_inputs = 3;
+  static const uint32_t num_samples_per_input = 3;
+  static const uint32_t num_samples = num_inputs * num_samples_per_input;
+  static const uint32_t num_luts = 4;
+  static const uint64_t lwe_in_size = lwe_dimension + 1;
+  static const uint64_t lwe_out_size = glwe_dimension * N + 1;
+  static const uint64_t lut_size = (glwe_dimension + 1) * N;
+
+  std::mt19937_64 rng{42};
+  std::vector<Torus> bootstrapping_key, lwe_array_in, lut_vector;
+  std::vector<Torus> lwe_input_indexes, lwe_output_indexes, lut_vector_indexes;
+
+  shared_input_batch() {
+    uint64_t key_size = (uint64_t)(lwe_dimension / grouping_factor) *
+                        (1 << grouping_factor) * level_count *
+                        (glwe_dimension + 1) * (glwe_dimension + 1) * N;
+    fill(bootstrapping_key, key_size);
+    fill(lut_vector, num_luts * lut_size);
+    // One LWE per sample: the samples of a run get the same mask but their
+    // own body
+    fill(lwe_array_in, num_samples * lwe_in_size);
+    for (uint32_t s = 0; s < num_samples; s++) {
+      uint32_t first = s - s % num_samples_per_input;
+      for (uint32_t i = 0; i < lwe_dimension; i++)
+        lwe_array_in[s * lwe_in_size + i] =
+            lwe_array_in[first * lwe_in_size + i];
+    }
+    for (uint32_t s = 0; s < num_samples; s++) {
+      // Inputs and outputs in another order than the samples
+      lwe_input_indexes.push_back((s * 4) % num_samples);
+      lwe_output_indexes.push_back((s * 7 + 2) % num_samples);
+      lut_vector_indexes.push_back(s % num_luts);
+    }
+    // Runs of the sample order, not of the input order: the permuted inputs
+    // of a run must share the mask
+    std::vector<Torus> permuted(lwe_array_in.size());
+    for (uint32_t s = 0; s < num_samples; s++)
+      for (uint64_t i = 0; i < lwe_in_size; i++)
+        permuted[lwe_input_indexes[s] * lwe_in_size + i] =
+            lwe_array_in[s * lwe_in_size + i];
+    lwe_array_in = permuted;
+  }
+
+  void fill(std::vector<Torus> &v, uint64_t size) {
+    v.resize(size);
+    for (auto &x : v)
+      x = (Torus)rng();
+  }
+
+  std::vector<Torus> run_shared_input() {
+    std::vector<Torus> out(num_samples * lwe_out_size, 0);
+    reference_multi_bit_pbs_shared_input<Torus>(
+        out.data(), lwe_output_indexes.data(), lut_vector.data(),
+        lut_vector_indexes.data(), lwe_array_in.data(),
+        lwe_input_indexes.data(), bootstrapping_key.data(), lwe_dimension,
+        glwe_dimension, N, grouping_factor, base_log, level_count, num_samples,
+        num_samples_per_input);
+    return out;
+  }
+
+  std::vector<Torus> run_per_sample() {
+    std::vector<Torus> out(num_samples * lwe_out_size, 0);
+    for (uint32_t s = 0; s < num_samples; s++)
+      reference_multi_bit_pbs<Torus>(
+          &out[lwe_output_indexes[s] * lwe_out_size],
+          &lwe_array_in[lwe_input_indexes[s] * lwe_in_size],
+          &lut_vector[lut_vector_indexes[s] * lut_size],
+          bootstrapping_key.data(), lwe_dimension, glwe_dimension, N,
+          grouping_factor, base_log, level_count);
+    return out;
+  }
+};
+
+template <typename Torus> static void check_shared_input() {
+  shared_input_batch<Torus> batch;
+  EXPECT_EQ(batch.run_shared_input(), batch.run_per_sample());
+}
+
+TEST(MultiBitSharedInputTest, MatchesPerSampleBootstraps64) {
+  check_shared_input<uint64_t>();
+}
+
+TEST(MultiBitSharedInputTest, MatchesPerSampleBootstraps32) {
+  check_shared_input<uint32_t>();
+}
+
+// Outside of the contract: a sample whose mask differs from the first one of
+// its run is bootstrapped with the keybundles of the first one
+TEST(MultiBitSharedInputTest, UsesTheMaskOfTheFirstSampleOfARun) {
+  shared_input_batch<uint64_t> batch;
+  auto out = batch.run_shared_input();
+  batch.lwe_array_in[batch.lwe_input_indexes[1] * batch.lwe_in_size] +=
+      (uint64_t)1 << 62;
+  EXPECT_EQ(batch.run_shared_input(), out);
+  EXPECT_NE(batch.run_per_sample(), out);
+}
@@ -0,0 +1,77 @@
+#include "multi_bit_tuning.h"
+#include <gtest/gtest.h>
+
+static const char *fingerprint = "Test GPU/sm_80/108";
+static const multi_bit_pbs_shape shape = {888, 1, 2048, 1, 3};
+
+// Chunk size a buffer for max_num_samples is scratched with, same computation
+// as get_scratch_lwe_chunk_size once the device has been tuned
+static uint32_t scratch_chunk_size(const multi_bit_tuning_cache &cache,
+                                   uint32_t max_num_samples) {
+  uint64_t product =
+      cache.max_chunk_product(fingerprint, shape, max_num_samples);
+  return (product + max_num_samples - 1) / max_num_samples;
+}
+
+TEST(MultiBitTuningTest, LookupUsesTheClosestTunedBatchBelow) {
+  multi_bit_tuning_cache cache;
+  EXPECT_EQ(cache.lookup(fingerprint, shape, 10), 0);
+  cache.record(fingerprint, shape, 8, {20, 1.});
+  cache.record(fingerprint, shape, 64, {4, 1.});
+  EXPECT_EQ(cache.lookup(fingerprint, shape, 1), 20);
+  EXPECT_EQ(cache.lookup(fingerprint, shape, 63), 20);
+  EXPECT_EQ(cache.lookup(fingerprint, shape, 64), 4);
+  EXPECT_EQ(cache.lookup(fingerprint, shape, 1000), 4);
+  EXPECT_EQ(cache.max_chunk_product(fingerprint, shape, 100), 63 * 20);
+}
+
+TEST(MultiBitTuningTest, ExecutionKeepsTheRequestedChunkSizeWhenItFits) {
+  multi_bit_pbs_buffer_layout layout = {10, 64};
+  EXPECT_EQ(layout.execution_chunk_size(10, 64), 10);
+  EXPECT_EQ(layout.execution_chunk_size(5, 64), 5);
+  // A smaller batch may use larger chunks in the same memory
+  EXPECT_EQ(layout.execution_chunk_size(40, 16), 40);
+  EXPECT_EQ(layout.execution_chunk_size(41, 16), 10);
+  EXPECT_EQ(layout.execution_chunk_size(0, 16), 10);
+}
+
+TEST(MultiBitTuningTest, KeybundleSlotsFollowTheScratchedChunkSize) {
+  multi_bit_pbs_buffer_layout layout = {10, 64};
+  const uint64_t size_per_iteration = 3 * 3 * 2 * 1024;
+  uint64_t slot_size = layout.keybundle_slot_size(size_per_iteration);
+  EXPECT_EQ(slot_size, 64 * 10 * size_per_iteration);
+  // The keybundle of any batch executed in the buffer fits in a slot, so that
+  // the second slot never overlaps the first one
+  for (uint32_t num_samples = 1; num_samples <= 64; num_samples++)
+    for (uint32_t requested = 0; requested <= 700; requested += 7) {
+      uint32_t chunk_size = layout.execution_chunk_size(requested, num_samples);
+      EXPECT_LE((uint64_t)num_samples * chunk_size * size_per_iteration,
+                slot_size);
+    }
+}
+
+TEST(MultiBitTuningTest, TuningAfterScratchDoesNotOverflowTheBuffer) {
+  multi_bit_tuning_cache cache;
+  cache.record(fingerprint, shape, 128, {4, 1.});
+  multi_bit_pbs_buffer_layout layout = {scratch_chunk_size(cache, 128), 128};
+  EXPECT_EQ(layout.lwe_chunk_size, 4);
+
+  // The tuner now finds larger chunks faster, for this batch and a smaller one
+  cache.record(fingerprint, shape, 128, {12, 1.});
+  cache.record(fingerprint, shape, 32, {16, 1.});
+  for (uint32_t num_samples = 1; num_samples <= 128; num_samples++) {
+    uint32_t tuned = cache.lookup(fingerprint, shape, num_samples);
+    uint32_t chunk_size = layout.execution_chunk_size(tuned, num_samples);
+    EXPECT_LE((uint64_t)chunk_size * num_samples,
+              (uint64_t)layout.lwe_chunk_size * layout.max_num_samples)
+        << num_samples << " samples";
+    if ((uint64_t)tuned * num_samples <= 4 * 128)
+      EXPECT_EQ(chunk_size, tuned);
+    else
+      EXPECT_EQ(chunk_size, 4);
+  }
+
+  // Buffers scratched afterwards follow the new tuning, where 127 samples
+  // with chunks of 16 need the most memory
+  EXPECT_EQ(scratch_chunk_size(cache, 128), (127 * 16 + 127) / 128);
+}
@@ -0,0 +1,373 @@
+#include "negacyclic_fft.h"
+#include "polynomial/parameters.cuh"
+#include "polynomial_size_dispatch.h"
+#include <cmath>
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+
+struct complex_t {
+  double x;
+  double y;
+};
+
+// Host conversion of the key before the compression moved into the FFT
+// kernel, kept here as the reference of compress_torus_coefficients
+template <typename T, typename ST>
+static void previous_host_conversion(complex_t *h_bsk, const ST *src,
+                                     uint32_t total_polynomials,
+                                     uint32_t polynomial_size) {
+  for (uint32_t i = 0; i < total_polynomials; i++) {
+    int complex_current_poly_idx = i * polynomial_size / 2;
+    int torus_current_poly_idx = i * polynomial_size;
+    for (uint32_t j = 0; j < polynomial_size / 2; j++) {
+      h_bsk[complex_current_poly_idx + j].x = src[torus_current_poly_idx + j];
+      h_bsk[complex_current_poly_idx + j].y =
+          src[torus_current_poly_idx + j + polynomial_size / 2];
+      h_bsk[complex_current_poly_idx + j].x /=
+          (double)std::numeric_limits<T>::max();
+      h_bsk[complex_current_poly_idx + j].y /=
+          (double)std::numeric_limits<T>::max();
+    }
+  }
+}
+
+template <typename T, typename ST> static void check_compression() {
+  const uint32_t polynomial_size = 1024, total_polynomials = 4;
+  std::mt19937_64 rng(4);
+  std::vector<ST> src(total_polynomials * polynomial_size);
+  for (auto &coefficient : src)
+    coefficient = (ST)rng();
+  src[0] = std::numeric_limits<ST>::min();
+  src[1] = std::numeric_limits<ST>::max();
+  src[2] = 0;
+  src[polynomial_size / 2] = -1;
+
+  std::vector<complex_t> expected(total_polynomials * polynomial_size / 2);
+  previous_host_conversion<T, ST>(expected.data(), src.data(),
+                                  total_polynomials, polynomial_size);
+  for (uint32_t i = 0; i < total_polynomials; i++) {
+    for (uint32_t j = 0; j < polynomial_size / 2; j++) {
+      auto c = compress_torus_coefficients<T, complex_t>(
+          src[i * polynomial_size + j],
+          src[i * polynomial_size + j + polynomial_size / 2]);
+      auto &e = expected[i * polynomial_size / 2 + j];
+      // Bit exact
+      ASSERT_EQ(c.x, e.x) << "polynomial " << i << ", coefficient " << j;
+      ASSERT_EQ(c.y, e.y) << "polynomial " << i << ", coefficient " << j;
+    }
+  }
+}
+
+TEST(NegacyclicFftTest, CompressionMatchesThePreviousHostConversion) {
+  check_compression<uint32_t, int32_t>();
+  check_compression<uint64_t, int64_t>();
+}
+
+static const complex_t literal_negtwiddles[] = {
+#include "data/literal_negtwiddles.inc"
+};
+
+// Distance between two doubles in units in the last place of expected
+static double ulp_distance(double value, double expected) {
+  if (value == expected)
+    return 0;
+  double ulp = std::abs(std::nextafter(expected, value) - expected);
+  return std::abs(value - expected) / ulp;
+}
+
+// The literal table isn't correctly rounded everywhere, the generated one
+// computes each twiddle in long double: they may differ in the last bit
+TEST(NegacyclicFftTest, TwiddlesMatchThePreviousLiteralTableWithinOneUlp) {
+  const uint32_t size =
+      sizeof(literal_negtwiddles) / sizeof(literal_negtwiddles[0]);
+  std::vector<complex_t> twiddles(size);
+  generate_negacyclic_twiddles(twiddles.data(), 0, size);
+  for (uint32_t i = 0; i < size; i++) {
+    ASSERT_LE(ulp_distance(twiddles[i].x, literal_negtwiddles[i].x), 1)
+        << "twiddle " << i;
+    ASSERT_LE(ulp_distance(twiddles[i].y, literal_negtwiddles[i].y), 1)
+        << "twiddle " << i;
+  }
+
+  // A slice starts from the same values as the whole table
+  std::vector<complex_t> slice(size / 2);
+  generate_negacyclic_twiddles(slice.data(), size / 2, size / 2);
+  for (uint32_t i = 0; i < size / 2; i++) {
+    EXPECT_EQ(slice[i].x, twiddles[size / 2 + i].x);
+    EXPECT_EQ(slice[i].y, twiddles[size / 2 + i].y);
+  }
+}
+
+// Polynomial of polynomial_size coefficients, compressed as in the PBS: the
+// Torus values divided by the max of the Torus, so in [-0.5, 0.5)
+static std::vector<double> random_polynomial(uint32_t polynomial_size,
+                                             uint64_t seed) {
+  std::mt19937_64 rng(seed);
+  std::uniform_real_distribution<double> coefficient(-0.5, 0.5);
+  std::vector<double> a(polynomial_size);
+  for (auto &c : a)
+    c = coefficient(rng);
+  return a;
+}
+
+// Index of compute_negtwiddle, which reverses twid_id with __brev: level
+// 'level' has 2^(level-1) twiddles
+static uint64_t on_the_fly_bit_reverse(uint32_t twid_id, int level) {
+  return negacyclic_fft_bit_reverse(twid_id, 32) >> (33 - level);
+}
+
+// N = 32768 and 65536 go past the 16384 twiddles of the device table, their
+// last level computes its twiddles on the fly
+class NegacyclicFftLargeSizeTest : public ::testing::TestWithParam<uint32_t> {
+};
+
+TEST_P(NegacyclicFftLargeSizeTest, MatchesTheReferenceAndRoundTrips) {
+  const uint32_t polynomial_size = GetParam(), half = polynomial_size / 2;
+  const uint32_t table_size = 16384;
+
+  std::vector<complex_t> twiddles(half);
+  generate_negacyclic_twiddles(twiddles.data(), 0, half);
+  int last_level = 0;
+  while ((1u << last_level) < half)
+    last_level++;
+  for (int level = 1; level <= last_level; level++) {
+    if ((1u << level) <= table_size)
+      continue;
+    for (uint32_t j = 0; j < (1u << (level - 1)); j += 97)
+      ASSERT_EQ(on_the_fly_bit_reverse(j, level),
+                negacyclic_fft_bit_reverse(j, level - 1))
+          << "level " << level << ", twiddle " << j;
+  }
+
+  auto a = random_polynomial(polynomial_size, polynomial_size);
+  std::vector<complex_t> A(half);
+  for (uint32_t j = 0; j < half; j++)
+    A[j] = {a[j], a[j + half]};
+  negacyclic_fft_radix2(A.data(), twiddles.data(), polynomial_size);
+
+  // The reference is quadratic, only some of the values are checked
+  for (uint32_t k = 0; k < half; k += half / 32 + 1) {
+    auto expected =
+        reference_negacyclic_fft_value<complex_t>(a.data(), polynomial_size, k);
+    EXPECT_NEAR(A[k].x, expected.x, 1e-10) << "N = " << polynomial_size
+                                            << ", k = " << k;
+    EXPECT_NEAR(A[k].y, expected.y, 1e-10) << "N = " << polynomial_size
+                                            << ", k = " << k;
+  }
+
+  negacyclic_ifft_radix2(A.data(), twiddles.data(), polynomial_size);
+  double max_error = 0;
+  for (uint32_t j = 0; j < half; j++) {
+    max_error = std::max(max_error, std::abs(A[j].x - a[j]));
+    max_error = std::max(max_error, std::abs(A[j].y - a[j + half]));
+  }
+  EXPECT_LT(max_error, 1e-14) << "N = " << polynomial_size;
+}
+
+INSTANTIATE_TEST_SUITE_P(LargeSizes, NegacyclicFftLargeSizeTest,
+                         ::testing::Values(32768, 65536));
+
+/*
+ * Host emulation of NSMFFT_direct and NSMFFT_inverse (fft/bnsmfft.cuh) for
+ * the params of the half-size FFT. Each thread goes over its groups as on
+ * the device, and the 32 lanes of a warp stage advance together, every lane
+ * reading the value its partner had before the exchange.
+ */
+struct host_twiddles {
+  const complex_t *table;
+  complex_t operator()(int level, uint32_t twid_id) const {
+    return table[(1u << (level - 1)) + twid_id];
+  }
+};
+
+template <class params> constexpr size_t fft_threads() {
+  return params::degree / params::opt;
+}
+
+template <class params, int first_level, int last_level, bool inverse>
+static void emulate_stages(complex_t *A, host_twiddles twiddles) {
+  constexpr int stage_levels = negacyclic_fft_stage_levels(params::opt);
+  constexpr int remaining = last_level - first_level + 1;
+  constexpr int levels = stage_levels < remaining ? stage_levels : remaining;
+  // The inverse starts from the top levels, its shorter stage comes last
+  constexpr int stage_first_level =
+      inverse ? last_level - levels + 1 : first_level;
+  constexpr int radix = 1 << levels;
+  constexpr size_t stride = params::degree >> (stage_first_level + levels - 1);
+
+  for (size_t thread = 0; thread < fft_threads<params>(); thread++) {
+    size_t tid = thread;
+    for (size_t i = 0; i < params::opt / radix; i++) {
+      size_t first = negacyclic_fft_group_first(tid, stride, levels);
+      complex_t x[radix];
+      for (int t = 0; t < radix; t++)
+        x[t] = A[first + t * stride];
+      if (inverse)
+        negacyclic_fft_inverse_group<stage_first_level, levels>(
+            x, tid / stride, twiddles);
+      else
+        negacyclic_fft_direct_group<stage_first_level, levels>(
+            x, tid / stride, twiddles);
+      for (int t = 0; t < radix; t++)
+        A[first + t * stride] = x[t];
+      tid += fft_threads<params>();
+    }
+  }
+
+  if constexpr (levels < remaining) {
+    if constexpr (inverse)
+      emulate_stages<params, first_level, last_level - levels, true>(A,
+                                                                     twiddles);
+    else
+      emulate_stages<params, first_level + levels, last_level, false>(
+          A, twiddles);
+  }
+}
+
+template <class params>
+static void emulate_warp_stage(complex_t *A, host_twiddles twiddles,
+                               bool inverse) {
+  constexpr int first_level =
+      params::log2_degree - negacyclic_fft_warp_levels + 1;
+  constexpr size_t warps = fft_threads<params>() / 32;
+  static_assert(fft_threads<params>() % 32 == 0, "blocks of whole warps");
+
+  for (size_t warp = 0; warp < warps; warp++) {
+    for (size_t i = 0; i < params::opt / 2; i++) {
+      size_t chunk = warp + i * warps;
+      complex_t x0[32], x1[32];
+      for (size_t lane = 0; lane < 32; lane++) {
+        x0[lane] = A[chunk * 64 + lane];
+        x1[lane] = A[chunk * 64 + lane + 32];
+        if (inverse) {
+          x0[lane].x /= params::degree;
+          x0[lane].y /= params::degree;
+          x1[lane].x /= params::degree;
+          x1[lane].y /= params::degree;
+        }
+      }
+
+      auto exchange = [&](int s) {
+        int distance = 32 >> s;
+        complex_t p0[32], p1[32];
+        std::copy(x0, x0 + 32, p0);
+        std::copy(x1, x1 + 32, p1);
+        for (size_t lane = 0; lane < 32; lane++) {
+          bool upper = lane & distance;
+          size_t partner = lane ^ distance;
+          complex_t w0 =
+              twiddles(first_level + s,
+                       negacyclic_fft_warp_twiddle_index(chunk, lane, s));
+          complex_t w1 = twiddles(
+              first_level + s,
+              negacyclic_fft_warp_twiddle_index(chunk, lane + 32, s));
+          if (inverse) {
+            x0[lane] =
+                negacyclic_fft_inverse_lane(x0[lane], p0[partner], w0, upper);
+            x1[lane] =
+                negacyclic_fft_inverse_lane(x1[lane], p1[partner], w1, upper);
+          } else {
+            x0[lane] =
+                negacyclic_fft_direct_lane(x0[lane], p0[partner], w0, upper);
+            x1[lane] =
+                negacyclic_fft_direct_lane(x1[lane], p1[partner], w1, upper);
+          }
+        }
+      };
+
+      if (inverse) {
+        for (int s = negacyclic_fft_warp_levels - 1; s >= 1; s--)
+          exchange(s);
+        for (size_t lane = 0; lane < 32; lane++)
+          negacyclic_fft_inverse_butterfly(x0[lane], x1[lane],
+                                           twiddles(first_level, chunk));
+      } else {
+        for (size_t lane = 0; lane < 32; lane++)
+          negacyclic_fft_direct_butterfly(x0[lane], x1[lane],
+                                          twiddles(first_level, chunk));
+        for (int s = 1; s < negacyclic_fft_warp_levels; s++)
+          exchange(s);
+      }
+
+      for (size_t lane = 0; lane < 32; lane++) {
+        A[chunk * 64 + lane] = x0[lane];
+        A[chunk * 64 + lane + 32] = x1[lane];
+      }
+    }
+  }
+}
+
+template <class params>
+static void emulate_direct(complex_t *A, host_twiddles twiddles) {
+  emulate_stages<params, 1, params::log2_degree - negacyclic_fft_warp_levels,
+                 false>(A, twiddles);
+  emulate_warp_stage<params>(A, twiddles, false);
+}
+
+template <class params>
+static void emulate_inverse(complex_t *A, host_twiddles twiddles) {
+  emulate_warp_stage<params>(A, twiddles, true);
+  emulate_stages<params, 1, params::log2_degree - negacyclic_fft_warp_levels,
+                 true>(A, twiddles);
+}
+
+static bool same_values(const std::vector<complex_t> &a,
+                        const std::vector<complex_t> &b) {
+  for (size_t i = 0; i < a.size(); i++)
+    if (a[i].x != b[i].x || a[i].y != b[i].y)
+      return false;
+  return true;
+}
+
+// The stages only regroup the radix-2 butterflies, so the results must be
+// bit-identical to the level by level transform
+template <int N, class params> static void check_fft_schedule() {
+  SCOPED_TRACE("N = " + std::to_string(N) +
+               ", opt = " + std::to_string(params::opt));
+  const uint32_t half = N / 2;
+  std::vector<complex_t> table(half);
+  generate_negacyclic_twiddles(table.data(), 0, half);
+  host_twiddles twiddles{table.data()};
+
+  auto a = random_polynomial(N, N + params::opt);
+  std::vector<complex_t> A(half);
+  for (uint32_t j = 0; j < half; j++)
+    A[j] = {a[j], a[j + half]};
+
+  auto staged = A, radix2 = A;
+  emulate_direct<HalfDegree<params>>(staged.data(), twiddles);
+  negacyclic_fft_radix2(radix2.data(), table.data(), N);
+  ASSERT_TRUE(same_values(staged, radix2));
+  for (uint32_t k = 0; k < half; k += half / 16 + 1) {
+    auto expected = reference_negacyclic_fft_value<complex_t>(a.data(), N, k);
+    EXPECT_NEAR(staged[k].x, expected.x, 1e-10) << "k = " << k;
+    EXPECT_NEAR(staged[k].y, expected.y, 1e-10) << "k = " << k;
+  }
+
+  emulate_inverse<HalfDegree<params>>(staged.data(), twiddles);
+  negacyclic_ifft_radix2(radix2.data(), table.data(), N);
+  ASSERT_TRUE(same_values(staged, radix2));
+  for (uint32_t j = 0; j < half; j++) {
+    EXPECT_NEAR(staged[j].x, a[j], 1e-14) << "j = " << j;
+    EXPECT_NEAR(staged[j].y, a[j + half], 1e-14) << "j = " << j;
+  }
+}
+
+template <int... Sizes>
+static void check_low_latency_schedules(polynomial_size_list<Sizes...>) {
+  (check_fft_schedule<Sizes, Degree<Sizes>>(), ...);
+}
+
+template <int... Sizes>
+static void check_amortized_schedules(polynomial_size_list<Sizes...>) {
+  (check_fft_schedule<Sizes, AmortizedDegree<Sizes>>(), ...);
+}
+
+TEST(NegacyclicFftTest, LowLatencyScheduleMatchesTheRadix2Transform) {
+  check_low_latency_schedules(large_polynomial_sizes{});
+}
+
+TEST(NegacyclicFftTest, AmortizedScheduleMatchesTheRadix2Transform) {
+  check_amortized_schedules(supported_polynomial_sizes{});
+}
@@ -0,0 +1,69 @@
+#include "polynomial_size_dispatch.h"
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <vector>
+
+// Stand-in for the PBS and FFT operations, which return the size they were
+// instantiated on
+template <int N> struct polynomial_size_of {
+  static uint32_t run(uint32_t offset) { return N + offset; }
+};
+
+template <int... Sizes>
+std::vector<uint32_t> to_vector(polynomial_size_list<Sizes...>) {
+  return {Sizes...};
+}
+
+template <class Sizes> void expect_covers(const std::vector<uint32_t> &sizes) {
+  using dispatch = polynomial_size_dispatch<polynomial_size_of, Sizes>;
+  for (uint32_t n = 1; n <= (1u << 17); n++) {
+    bool listed = std::find(sizes.begin(), sizes.end(), n) != sizes.end();
+    EXPECT_EQ(dispatch::supports(n), listed) << "N = " << n;
+    if (listed) {
+      EXPECT_EQ(dispatch::run(n, 1u), n + 1) << "N = " << n;
+    }
+  }
+  EXPECT_FALSE(dispatch::supports(0));
+}
+
+TEST(PolynomialSizeDispatchTest, SupportedSizes) {
+  std::vector<uint32_t> sizes = {256, 512, 1024, 2048, 4096, 8192, 16384};
+  EXPECT_EQ(to_vector(supported_polynomial_sizes{}), sizes);
+  expect_covers<supported_polynomial_sizes>(sizes);
+}
+
+TEST(PolynomialSizeDispatchTest, LargeSizes) {
+  std::vector<uint32_t> sizes = {256,  512,  1024,  2048, 4096,
+                                 8192, 16384, 32768, 65536};
+  EXPECT_EQ(to_vector(large_polynomial_sizes{}), sizes);
+  expect_covers<large_polynomial_sizes>(sizes);
+  EXPECT_LT(log2_polynomial_size(sizes.back()),
+            polynomial_size_dispatch_slots);
+}
+
+TEST(PolynomialSizeDispatchTest, UnsupportedSizeAsserts) {
+  using dispatch = polynomial_size_dispatch<polynomial_size_of>;
+  EXPECT_DEATH(dispatch::run(128, 0u), "unsupported polynomial size");
+  EXPECT_DEATH(dispatch::run(100, 0u), "unsupported polynomial size");
+}
+
+struct first_query {};
+struct second_query {};
+
+TEST(PolynomialSizeDispatchTest, QueriesOncePerDeviceAndTag) {
+  int calls = 0;
+  auto query = [&] { return 10 * ++calls; };
+  for (int i = 0; i < 3; i++) {
+    EXPECT_EQ(query_once_per_device<first_query>(0, query), 10);
+    EXPECT_EQ(query_once_per_device<first_query>(1, query), 20);
+    EXPECT_EQ(query_once_per_device<second_query>(0, query), 30);
+  }
+  EXPECT_EQ(calls, 3);
+}
+
+TEST(PolynomialSizeDispatchTest, KernelTagsDependOnTheInstantiation) {
+  EXPECT_FALSE((std::is_same_v<kernel_tag<&polynomial_size_of<256>::run>,
+                               kernel_tag<&polynomial_size_of<512>::run>>));
+  EXPECT_TRUE((std::is_same_v<kernel_tag<&polynomial_size_of<256>::run>,
+                              kernel_tag<&polynomial_size_of<256>::run>>));
+}
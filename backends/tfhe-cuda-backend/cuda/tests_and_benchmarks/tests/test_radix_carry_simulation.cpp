@@ -0,0 +1,244 @@
+#include "radix_carry_simulation.h"
+#include <gtest/gtest.h>
+#include <random>
+
+static const CARRY_SCAN_TYPE scan_types[] = {
+    CARRY_SCAN_HILLIS_STEELE, CARRY_SCAN_SKLANSKY, CARRY_SCAN_BRENT_KUNG,
+    CARRY_SCAN_GROUPED_SKLANSKY};
+
+// (message_modulus, carry_modulus) of the parameter sets in use
+static const std::pair<uint32_t, uint32_t> moduli[] = {
+    {2, 2}, {4, 4}, {8, 8}, {16, 16}, {4, 2}};
+
+static const uint32_t max_num_blocks = 64;
+
+// Largest block value the sequential propagation accepts: a block receives a
+// carry of at most carry_modulus - 1 and must stay in the plaintext space
+static uint64_t max_block_value(uint32_t message_modulus,
+                                uint32_t carry_modulus) {
+  return (uint64_t)carry_modulus * (message_modulus - 1);
+}
+
+// Blocks up to max_block_value, the extreme cases first
+static std::vector<std::vector<uint64_t>>
+make_inputs(uint32_t num_blocks, uint32_t message_modulus,
+            uint32_t carry_modulus, std::mt19937_64 &rng) {
+  uint64_t max_value = max_block_value(message_modulus, carry_modulus);
+  std::vector<std::vector<uint64_t>> inputs;
+  inputs.push_back(std::vector<uint64_t>(num_blocks, 0));
+  inputs.push_back(std::vector<uint64_t>(num_blocks, max_value));
+  // A carry generated in the first block and propagated through all others
+  std::vector<uint64_t> ripple(num_blocks, message_modulus - 1);
+  ripple[0] = max_value;
+  inputs.push_back(ripple);
+  std::uniform_int_distribution<uint64_t> value(0, max_value);
+  for (int i = 0; i < 20; i++) {
+    std::vector<uint64_t> blocks(num_blocks);
+    for (auto &block : blocks)
+      block = value(rng);
+    inputs.push_back(blocks);
+  }
+  return inputs;
+}
+
+// Every scan leaves each block with the flag of all the blocks up to it:
+// combining a block covering [lo, hi] with the one covering the blocks right
+// below gives [src_lo, hi], so every block must end up covering [0, i]
+TEST(RadixCarrySimulationTest, ScansResolveEveryPrefix) {
+  for (auto scan_type : scan_types) {
+    for (uint32_t num_blocks = 1; num_blocks <= max_num_blocks;
+         num_blocks++) {
+      std::vector<std::pair<uint32_t, uint32_t>> cover(num_blocks);
+      for (uint32_t i = 0; i < num_blocks; i++)
+        cover[i] = {i, i};
+      auto rounds = generate_carry_scan(scan_type, num_blocks);
+      for (auto &round : rounds) {
+        auto before = cover;
+        for (auto &pair : round) {
+          auto dst = before[pair.first];
+          auto src = before[pair.second];
+          ASSERT_EQ(src.second + 1, dst.first)
+              << "scan " << scan_type << ", " << num_blocks << " blocks";
+          cover[pair.first] = {src.first, dst.second};
+        }
+      }
+      for (uint32_t i = 0; i < num_blocks; i++)
+        EXPECT_EQ(cover[i], std::make_pair(0u, i))
+            << "scan " << scan_type << ", " << num_blocks << " blocks, block "
+            << i;
+
+      uint32_t log = carry_scan_log2_ceil(num_blocks);
+      if (scan_type == CARRY_SCAN_HILLIS_STEELE ||
+          scan_type == CARRY_SCAN_SKLANSKY)
+        EXPECT_EQ(rounds.size(), log);
+      else if (scan_type == CARRY_SCAN_GROUPED_SKLANSKY)
+        EXPECT_LE(rounds.size(), log + 1);
+      else
+        EXPECT_LE(rounds.size(), 2 * log);
+    }
+  }
+}
+
+// Every sequence of generate/propagate flags, the first block never
+// propagating: after the scan, each flag must be the carry a ripple through
+// the blocks up to it outputs
+TEST(RadixCarrySimulationTest, ScannedFlagsMatchSequentialCarries) {
+  const uint64_t flag_values[] = {SIMULATED_NONE, SIMULATED_GENERATED,
+                                  SIMULATED_PROPAGATED};
+  for (uint32_t num_blocks = 1; num_blocks <= 8; num_blocks++) {
+    uint64_t num_inputs = 2;
+    for (uint32_t i = 1; i < num_blocks; i++)
+      num_inputs *= 3;
+    std::vector<uint64_t> flags(num_blocks);
+    for (uint64_t input = 0; input < num_inputs; input++) {
+      uint64_t digits = input;
+      flags[0] = flag_values[digits % 2];
+      digits /= 2;
+      for (uint32_t i = 1; i < num_blocks; i++) {
+        flags[i] = flag_values[digits % 3];
+        digits /= 3;
+      }
+
+      std::vector<uint64_t> expected(num_blocks);
+      uint64_t carry = 0;
+      for (uint32_t i = 0; i < num_blocks; i++) {
+        if (flags[i] != SIMULATED_PROPAGATED)
+          carry = flags[i];
+        expected[i] = carry;
+      }
+
+      for (auto scan_type : scan_types) {
+        auto result = flags;
+        std::vector<uint64_t> step_output;
+        for (auto &round : generate_carry_scan(scan_type, num_blocks)) {
+          step_output.clear();
+          for (auto &pair : round) {
+            uint64_t msb = result[pair.first], lsb = result[pair.second];
+            step_output.push_back(msb == SIMULATED_PROPAGATED ? lsb : msb);
+          }
+          for (size_t k = 0; k < round.size(); k++)
+            result[round[k].first] = step_output[k];
+        }
+        ASSERT_EQ(result, expected)
+            << "scan " << scan_type << ", input " << input;
+      }
+    }
+  }
+}
+
+// Same default as int_sc_prop_memory
+TEST(RadixCarrySimulationTest, DefaultsToHillisSteele) {
+  std::vector<uint64_t> blocks(16, 3);
+  blocks[0] = 6;
+  auto hillis_steele = blocks;
+  auto cost = simulate_propagate_single_carry(blocks, 4, 4);
+  auto expected_cost = simulate_propagate_single_carry(
+      hillis_steele, 4, 4, CARRY_SCAN_HILLIS_STEELE);
+  EXPECT_EQ(blocks, hillis_steele);
+  EXPECT_EQ(cost.pbs_rounds, expected_cost.pbs_rounds);
+  EXPECT_EQ(cost.pbs_count, expected_cost.pbs_count);
+}
+
+TEST(RadixCarrySimulationTest, SingleCarryMatchesSequential) {
+  std::mt19937_64 rng(1);
+  for (auto &m : moduli) {
+    uint32_t message_modulus = m.first, carry_modulus = m.second;
+    std::uniform_int_distribution<uint64_t> value(0,
+                                                  2 * message_modulus - 2);
+    for (uint32_t num_blocks = 1; num_blocks <= max_num_blocks;
+         num_blocks++) {
+      for (int i = 0; i < 20; i++) {
+        std::vector<uint64_t> blocks(num_blocks);
+        for (auto &block : blocks)
+          block = value(rng);
+        auto expected = blocks;
+        simulate_full_propagation_sequential(expected, message_modulus,
+                                             carry_modulus);
+        for (auto scan_type : scan_types) {
+          auto result = blocks;
+          auto cost = simulate_propagate_single_carry(
+              result, message_modulus, carry_modulus, scan_type);
+          EXPECT_EQ(result, expected)
+              << "scan " << scan_type << ", " << num_blocks << " blocks";
+          EXPECT_EQ(cost.pbs_rounds,
+                    generate_carry_scan(scan_type, num_blocks).size() + 2);
+        }
+      }
+    }
+  }
+}
+
+TEST(RadixCarrySimulationTest, TreePropagationMatchesSequential) {
+  std::mt19937_64 rng(2);
+  for (auto &m : moduli) {
+    uint32_t message_modulus = m.first, carry_modulus = m.second;
+    uint32_t split_rounds =
+        get_full_propagation_tree_split_rounds(message_modulus, carry_modulus);
+    for (uint32_t num_blocks = 1; num_blocks <= max_num_blocks;
+         num_blocks++) {
+      for (auto &blocks :
+           make_inputs(num_blocks, message_modulus, carry_modulus, rng)) {
+        auto expected = blocks;
+        auto sequential_cost = simulate_full_propagation_sequential(
+            expected, message_modulus, carry_modulus);
+        EXPECT_EQ(sequential_cost.pbs_rounds, num_blocks);
+        EXPECT_EQ(sequential_cost.pbs_count, 2 * num_blocks);
+
+        for (auto scan_type : scan_types) {
+          auto result = blocks;
+          auto cost = simulate_full_propagation_tree(
+              result, message_modulus, carry_modulus, scan_type);
+          EXPECT_EQ(result, expected)
+              << "scan " << scan_type << ", moduli " << message_modulus
+              << "_" << carry_modulus << ", " << num_blocks << " blocks";
+          EXPECT_EQ(cost.pbs_rounds,
+                    split_rounds +
+                        generate_carry_scan(scan_type, num_blocks).size() + 2);
+        }
+      }
+    }
+  }
+}
+
+// Every input of a few small radix ciphertexts
+TEST(RadixCarrySimulationTest, TreePropagationMatchesSequentialExhaustively) {
+  const uint32_t message_modulus = 4, carry_modulus = 4;
+  const uint64_t plaintext_space =
+      max_block_value(message_modulus, carry_modulus) + 1;
+  for (uint32_t num_blocks = 1; num_blocks <= 4; num_blocks++) {
+    uint64_t num_inputs = 1;
+    for (uint32_t i = 0; i < num_blocks; i++)
+      num_inputs *= plaintext_space;
+    std::vector<uint64_t> blocks(num_blocks);
+    for (uint64_t input = 0; input < num_inputs; input++) {
+      uint64_t digits = input;
+      for (auto &block : blocks) {
+        block = digits % plaintext_space;
+        digits /= plaintext_space;
+      }
+      auto expected = blocks;
+      simulate_full_propagation_sequential(expected, message_modulus,
+                                           carry_modulus);
+      for (auto scan_type : scan_types) {
+        auto result = blocks;
+        simulate_full_propagation_tree(result, message_modulus, carry_modulus,
+                                       scan_type);
+        ASSERT_EQ(result, expected) << "input " << input;
+      }
+    }
+  }
+}
+
+TEST(RadixCarrySimulationTest, SplitRoundsBringBlocksToOneCarry) {
+  EXPECT_EQ(get_full_propagation_tree_split_rounds(2, 2), 1);
+  EXPECT_EQ(get_full_propagation_tree_split_rounds(4, 4), 1);
+  EXPECT_EQ(get_full_propagation_tree_split_rounds(4, 1), 0);
+  for (auto &m : moduli) {
+    uint64_t max_value = (uint64_t)m.first * m.second - 1;
+    for (uint32_t round = 0;
+         round < get_full_propagation_tree_split_rounds(m.first, m.second);
+         round++)
+      max_value = m.first - 1 + max_value / m.first;
+    EXPECT_LE(max_value, 2 * (uint64_t)m.first - 2);
+  }
+}
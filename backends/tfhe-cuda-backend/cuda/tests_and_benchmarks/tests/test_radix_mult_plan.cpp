@@ -0,0 +1,153 @@
+#include "radix_mult_plan.h"
+#include <gtest/gtest.h>
+#include <random>
+
+// (message_modulus, carry_modulus) of the parameter sets plans support
+static const std::pair<uint32_t, uint32_t> moduli[] = {{4, 4}, {8, 8}, {4, 8}};
+
+static const uint32_t karatsuba_thresholds[] = {0, 2, 3, 8};
+
+// lhs * rhs modulo message_modulus^num_blocks, block by block
+static std::vector<uint64_t> schoolbook(const std::vector<uint64_t> &lhs,
+                                        const std::vector<uint64_t> &rhs,
+                                        uint64_t message_modulus) {
+  size_t num_blocks = lhs.size();
+  std::vector<uint64_t> columns(num_blocks, 0);
+  for (size_t i = 0; i < num_blocks; i++)
+    for (size_t j = 0; i + j < num_blocks; j++)
+      columns[i + j] += lhs[i] * rhs[j];
+  uint64_t carry = 0;
+  for (auto &column : columns) {
+    column += carry;
+    carry = column / message_modulus;
+    column %= message_modulus;
+  }
+  return columns;
+}
+
+// Largest noise level a sum of the plan reaches, every LUT output and
+// operand block being a fresh PBS output
+static uint64_t max_sum_noise_level(const radix_mult_plan &plan) {
+  std::vector<uint64_t> noise_levels(plan.num_slots, 1);
+  uint64_t max_noise_level = 0;
+  for (auto &step : plan.steps) {
+    std::vector<uint64_t> outputs;
+    if (step.is_lut) {
+      for (auto &item : step.luts) {
+        noise_levels[item.out] = 1;
+        if (item.carry_out != RADIX_PLAN_NO_SLOT)
+          noise_levels[item.carry_out] = 1;
+      }
+      continue;
+    }
+    for (auto &item : step.sums) {
+      uint64_t noise_level = 0;
+      for (uint32_t t = 0; t < item.num_terms; t++)
+        noise_level += noise_levels[step.terms[item.first_term + t].slot];
+      outputs.push_back(noise_level);
+      max_noise_level = std::max(max_noise_level, noise_level);
+    }
+    for (size_t k = 0; k < step.sums.size(); k++)
+      noise_levels[step.sums[k].out] = outputs[k];
+  }
+  return max_noise_level;
+}
+
+static void check_matches_schoolbook(bool many_lut) {
+  std::mt19937_64 rng(3);
+  for (auto &m : moduli) {
+    uint32_t message_modulus = m.first, carry_modulus = m.second;
+    std::uniform_int_distribution<uint64_t> value(0, message_modulus - 1);
+    for (auto threshold : karatsuba_thresholds) {
+      for (uint32_t num_blocks = 1; num_blocks <= 16; num_blocks++) {
+        auto plan = generate_radix_mult_plan(
+            num_blocks, message_modulus, carry_modulus, threshold,
+            CARRY_SCAN_SKLANSKY, many_lut);
+        ASSERT_EQ(plan.output_slots.size(), num_blocks);
+
+        std::vector<std::vector<uint64_t>> inputs;
+        inputs.push_back(std::vector<uint64_t>(num_blocks, 0));
+        inputs.push_back(
+            std::vector<uint64_t>(num_blocks, message_modulus - 1));
+        for (int i = 0; i < 20; i++) {
+          std::vector<uint64_t> blocks(num_blocks);
+          for (auto &block : blocks)
+            block = value(rng);
+          inputs.push_back(blocks);
+        }
+        for (auto &lhs : inputs) {
+          for (auto &rhs : {inputs[1], inputs.back(), lhs}) {
+            EXPECT_EQ(run_radix_mult_plan(plan, lhs, rhs),
+                      schoolbook(lhs, rhs, message_modulus))
+                << "moduli " << message_modulus << "_" << carry_modulus
+                << ", threshold " << threshold << ", " << num_blocks
+                << " blocks";
+          }
+        }
+      }
+    }
+  }
+}
+
+TEST(RadixMultPlanTest, MatchesSchoolbookMultiplication) {
+  check_matches_schoolbook(false);
+}
+
+// run_radix_mult_plan asserts that many-LUT inputs leave room for both
+// functions
+TEST(RadixMultPlanTest, MatchesSchoolbookMultiplicationWithManyLuts) {
+  check_matches_schoolbook(true);
+}
+
+TEST(RadixMultPlanTest, ManyLutsSaveMessageAndCarryPbs) {
+  for (auto &m : moduli) {
+    for (auto threshold : karatsuba_thresholds) {
+      for (uint32_t num_blocks = 1; num_blocks <= 32; num_blocks++) {
+        auto plan = generate_radix_mult_plan(num_blocks, m.first, m.second,
+                                             threshold);
+        auto fused = generate_radix_mult_plan(num_blocks, m.first, m.second,
+                                              threshold, CARRY_SCAN_SKLANSKY,
+                                              true);
+        uint64_t num_many_lut_items = 0;
+        for (auto &step : fused.steps) {
+          uint32_t leading = step.num_many_lut_items();
+          for (uint32_t k = 0; k < step.luts.size(); k++)
+            EXPECT_EQ(step.luts[k].lut == PLAN_LUT_MESSAGE_AND_CARRY,
+                      k < leading);
+          num_many_lut_items += leading;
+        }
+        // Each many-LUT item replaces a message and a carry PBS
+        EXPECT_EQ(fused.pbs_count() + num_many_lut_items, plan.pbs_count())
+            << "moduli " << m.first << "_" << m.second << ", threshold "
+            << threshold << ", " << num_blocks << " blocks";
+        EXPECT_EQ(fused.pbs_rounds(), plan.pbs_rounds());
+        if (num_blocks >= 8) {
+          EXPECT_GT(num_many_lut_items, 0);
+        }
+      }
+    }
+  }
+}
+
+TEST(RadixMultPlanTest, SumsStayUnderTheMaxNoiseLevel) {
+  EXPECT_EQ(radix_mult_plan_max_noise_level(4, 4), 5);
+  for (auto &m : moduli) {
+    uint64_t max_noise_level =
+        radix_mult_plan_max_noise_level(m.first, m.second);
+    for (auto threshold : karatsuba_thresholds) {
+      for (uint32_t num_blocks = 1; num_blocks <= 32; num_blocks++) {
+        auto plan = generate_radix_mult_plan(num_blocks, m.first, m.second,
+                                             threshold);
+        EXPECT_LE(max_sum_noise_level(plan), max_noise_level)
+            << "moduli " << m.first << "_" << m.second << ", threshold "
+            << threshold << ", " << num_blocks << " blocks";
+        auto fused = generate_radix_mult_plan(num_blocks, m.first, m.second,
+                                              threshold, CARRY_SCAN_SKLANSKY,
+                                              true);
+        EXPECT_LE(max_sum_noise_level(fused), max_noise_level)
+            << "moduli " << m.first << "_" << m.second << ", threshold "
+            << threshold << ", " << num_blocks << " blocks";
+      }
+    }
+  }
+}
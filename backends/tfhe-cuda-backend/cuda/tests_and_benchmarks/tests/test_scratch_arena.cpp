@@ -0,0 +1,141 @@
+#include "scratch_arena.h"
+#include <gtest/gtest.h>
+
+// The arena is exercised with the host stand-in of the device allocator, so
+// that every chunk it asks for and gives back is accounted for
+class ScratchArenaTest : public ::testing::Test {
+protected:
+  host_scratch_allocator allocator;
+  scratch_arena *arena;
+
+  void SetUp() override { arena = new scratch_arena(&allocator, false); }
+  void TearDown() override {
+    delete arena;
+    EXPECT_EQ(allocator.bytes_in_use, 0);
+    EXPECT_EQ(allocator.num_allocations, allocator.num_deallocations);
+  }
+};
+
+TEST_F(ScratchArenaTest, AlignsAllocations) {
+  auto a = (int8_t *)arena->allocate(1);
+  auto b = (int8_t *)arena->allocate(scratch_arena::alignment + 1);
+  auto c = (int8_t *)arena->allocate(3);
+  EXPECT_EQ(b - a, scratch_arena::alignment);
+  EXPECT_EQ(c - b, 2 * scratch_arena::alignment);
+  EXPECT_EQ(arena->current_usage, 4 * scratch_arena::alignment);
+  EXPECT_EQ(arena->allocate(0), nullptr);
+  arena->release(c);
+  arena->release(b);
+  arena->release(a);
+  EXPECT_EQ(arena->current_usage, 0);
+}
+
+TEST_F(ScratchArenaTest, ReusesMemoryOfReleasedAllocations) {
+  auto a = arena->allocate(1000);
+  auto b = arena->allocate(2000);
+  arena->release(b);
+  EXPECT_EQ(arena->allocate(3000), b);
+  arena->release(b);
+  arena->release(a);
+  EXPECT_EQ(arena->allocate(10), a);
+  arena->release(a);
+  EXPECT_EQ(allocator.num_allocations, 1);
+  EXPECT_EQ(arena->capacity, scratch_arena::min_chunk_size);
+  EXPECT_EQ(arena->peak_usage, scratch_arena::align(1000) + 3072);
+}
+
+TEST_F(ScratchArenaTest, CoalescesChunksAfterGrowing) {
+  uint64_t size = scratch_arena::min_chunk_size * 3 / 4;
+  auto a = arena->allocate(size);
+  auto b = arena->allocate(size);
+  EXPECT_EQ(arena->chunks.size(), 2);
+  arena->release(b);
+  arena->release(a);
+  EXPECT_EQ(arena->chunks.size(), 1);
+  EXPECT_EQ(arena->capacity, 2 * size);
+
+  // The same workload now fits in the coalesced chunk
+  uint64_t num_allocations = allocator.num_allocations;
+  a = arena->allocate(size);
+  b = arena->allocate(size);
+  arena->release(b);
+  arena->release(a);
+  EXPECT_EQ(allocator.num_allocations, num_allocations);
+}
+
+TEST_F(ScratchArenaTest, ShrinksAfterUnderusedCycles) {
+  uint64_t large = 8 * scratch_arena::min_chunk_size;
+  arena->release(arena->allocate(large));
+  EXPECT_EQ(arena->capacity, large);
+
+  for (uint32_t i = 0; i < scratch_arena::shrink_cycles - 1; i++) {
+    arena->release(arena->allocate(2 * scratch_arena::min_chunk_size));
+    EXPECT_EQ(arena->capacity, large);
+  }
+  arena->release(arena->allocate(scratch_arena::min_chunk_size));
+  // Largest peak of the underused cycles
+  EXPECT_EQ(arena->capacity, 2 * scratch_arena::min_chunk_size);
+}
+
+TEST_F(ScratchArenaTest, KeepsItsCapacityForAlternatingWorkloads) {
+  uint64_t large = 8 * scratch_arena::min_chunk_size;
+  arena->release(arena->allocate(large));
+  for (uint32_t i = 0; i < 4 * scratch_arena::shrink_cycles; i++) {
+    uint64_t size = i % 2 ? large : scratch_arena::min_chunk_size;
+    arena->release(arena->allocate(size));
+  }
+  EXPECT_EQ(arena->capacity, large);
+  EXPECT_EQ(allocator.num_allocations, 1);
+}
+
+TEST_F(ScratchArenaTest, NestedBuffersReleasedInReverseOrder) {
+  // Same pattern as a radix buffer holding LUT objects
+  std::vector<void *> ptrs;
+  for (uint32_t i = 0; i < 16; i++)
+    ptrs.push_back(arena->allocate(100 * (i + 1)));
+  uint64_t usage = arena->current_usage;
+  for (uint32_t i = 0; i < 16; i++) {
+    arena->release(ptrs.back());
+    ptrs.pop_back();
+    EXPECT_LT(arena->current_usage, usage);
+    usage = arena->current_usage;
+  }
+  EXPECT_TRUE(arena->live.empty());
+  EXPECT_EQ(arena->chunks[0].offset, 0);
+}
+
+TEST_F(ScratchArenaTest, ReleasingOutOfOrderAsserts) {
+  auto a = arena->allocate(1000);
+  auto b = arena->allocate(1000);
+  EXPECT_DEATH(arena->release(a), "reverse order");
+  EXPECT_DEATH(arena->release((int8_t *)b + 1), "reverse order");
+  arena->release(b);
+  arena->release(a);
+}
+
+TEST_F(ScratchArenaTest, FreesItsChunksWhenDestroyed) {
+  arena->allocate(10);
+  arena->allocate(2 * scratch_arena::min_chunk_size);
+  // TearDown checks that nothing is left
+}
+
+// Measuring streams report the capacity of their placeholder arena: it must
+// be what the same allocations take from an instrumented allocator, not the
+// peak usage, which leaves out the chunk rounding
+TEST_F(ScratchArenaTest, PlaceholderCapacityMatchesTheBackingAllocations) {
+  scratch_arena measured(new placeholder_scratch_allocator, true);
+  const uint64_t sizes[] = {100, scratch_arena::min_chunk_size / 2,
+                            3 * scratch_arena::min_chunk_size, 1000};
+  std::vector<void *> ptrs;
+  for (auto size : sizes) {
+    ptrs.push_back(arena->allocate(size));
+    measured.allocate(size);
+  }
+  EXPECT_EQ(measured.capacity, allocator.bytes_in_use);
+  EXPECT_EQ(arena->capacity, allocator.bytes_in_use);
+  EXPECT_LT(measured.peak_usage, measured.capacity);
+  while (!ptrs.empty()) {
+    arena->release(ptrs.back());
+    ptrs.pop_back();
+  }
+}
@@ -0,0 +1,87 @@
+#include "staging_pool.h"
+#include <gtest/gtest.h>
+#include <vector>
+
+class StagingPoolTest : public ::testing::Test {
+protected:
+  static constexpr uint64_t slot_size = 4096;
+  host_staging_backend backend;
+
+  std::vector<int8_t> make_data(uint64_t size) {
+    std::vector<int8_t> data(size);
+    for (uint64_t i = 0; i < size; i++)
+      data[i] = (int8_t)(i * 7 + 3);
+    return data;
+  }
+};
+
+TEST_F(StagingPoolTest, CopiesInSlotSizedChunks) {
+  staging_pool pool(&backend, false, slot_size);
+  auto src = make_data(2 * slot_size + 100);
+  std::vector<int8_t> dest(src.size(), 0);
+  pool.copy_to_device(dest.data(), src.data(), src.size());
+  EXPECT_EQ(dest, src);
+  EXPECT_EQ(pool.num_chunks, 3);
+  EXPECT_EQ(backend.num_staged_copies, 3);
+  EXPECT_EQ(pool.bytes_staged, src.size());
+  EXPECT_EQ(pool.bytes_direct, 0);
+}
+
+TEST_F(StagingPoolTest, ReusesSlotsWhoseCopiesAreDone) {
+  staging_pool pool(&backend, false, slot_size);
+  auto src = make_data(slot_size);
+  std::vector<int8_t> dest(src.size());
+  for (int i = 0; i < 10; i++)
+    pool.copy_to_device(dest.data(), src.data(), src.size());
+  EXPECT_EQ(backend.num_pinned_allocations, 1);
+  EXPECT_EQ(pool.num_stalls, 0);
+}
+
+TEST_F(StagingPoolTest, GrowsInsteadOfWaitingForABusyStream) {
+  staging_pool pool(&backend, false, slot_size);
+  backend.hold_copies = true;
+  auto src = make_data(5 * slot_size);
+  std::vector<int8_t> dest(src.size());
+  pool.copy_to_device(dest.data(), src.data(), src.size());
+  EXPECT_EQ(dest, src);
+  EXPECT_EQ(pool.slots.size(), 5);
+  EXPECT_EQ(backend.num_waits, 0);
+  EXPECT_EQ(pool.num_stalls, 0);
+}
+
+TEST_F(StagingPoolTest, WaitsForTheOldestSlotAtCapacity) {
+  staging_pool pool(&backend, false, slot_size, 2);
+  backend.hold_copies = true;
+  auto src = make_data(slot_size);
+  std::vector<int8_t> dest(src.size());
+  for (int i = 0; i < 3; i++)
+    pool.copy_to_device(dest.data(), src.data(), src.size());
+  EXPECT_EQ(pool.slots.size(), 2);
+  EXPECT_EQ(pool.num_stalls, 1);
+  EXPECT_EQ(backend.num_waits, 1);
+  // Slot 0 was the oldest, it was waited for and reused
+  EXPECT_EQ(pool.last_use[0], 2);
+  EXPECT_EQ(pool.last_use[1], 1);
+}
+
+TEST_F(StagingPoolTest, FallsBackToDirectCopies) {
+  staging_pool pool(&backend, false, slot_size);
+  backend.fail_pinned_allocation = true;
+  auto src = make_data(3 * slot_size);
+  std::vector<int8_t> dest(src.size());
+  pool.copy_to_device(dest.data(), src.data(), src.size());
+  EXPECT_EQ(dest, src);
+  EXPECT_EQ(backend.num_direct_copies, 1);
+  EXPECT_EQ(pool.bytes_direct, src.size());
+  EXPECT_TRUE(pool.pinned_unavailable);
+}
+
+TEST_F(StagingPoolTest, WaitsForCopiesInFlightWhenDestroyed) {
+  auto pool = new staging_pool(&backend, false, slot_size);
+  backend.hold_copies = true;
+  auto src = make_data(3 * slot_size);
+  std::vector<int8_t> dest(src.size());
+  pool->copy_to_device(dest.data(), src.data(), src.size());
+  delete pool;
+  EXPECT_EQ(backend.num_waits, 3);
+}
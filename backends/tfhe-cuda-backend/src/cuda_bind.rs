@@ -1,4 +1,4 @@
-use std::ffi::c_void;
+use std::ffi::{c_char, c_void};
 
 #[link(name = "tfhe_cuda_backend", kind = "static")]
 extern "C" {
@@ -30,6 +30,17 @@ extern "C" {
         v_stream: *const c_void,
     ) -> i32;
 
+    /// Copy `size` memory asynchronously from `src` on CPU to `dest` on GPU `gpu_index` using
+    /// the Cuda stream `v_stream`, going through the page-locked staging buffers of the stream.
+    /// `src` can be freed as soon as the function returns. The host only waits for the work
+    /// already enqueued in the stream when more than 64 MB of copies are pending on it.
+    pub fn cuda_memcpy_async_to_gpu_staged(
+        dest: *mut c_void,
+        src: *const c_void,
+        size: u64,
+        v_stream: *const c_void,
+    ) -> i32;
+
     /// Copy `size` memory asynchronously from `src` to `dest` on the same GPU `gpu_index` using
     /// the Cuda stream `v_stream`.
     pub fn cuda_memcpy_async_gpu_to_gpu(
@@ -66,6 +77,26 @@ extern "C" {
     /// Get the maximum amount of shared memory on GPU `gpu_index`
     pub fn cuda_get_max_shared_memory(gpu_index: u32) -> i32;
 
+    /// Get the current usage, peak usage and capacity in bytes of the scratch arena attached to
+    /// the Cuda stream `v_stream`. Returns -1 if the stream has not allocated any integer scratch
+    /// buffer yet.
+    pub fn cuda_get_scratch_arena_usage(
+        v_stream: *const c_void,
+        current_usage: *mut u64,
+        peak_usage: *mut u64,
+        capacity: *mut u64,
+    ) -> i32;
+
+    /// Get the number of bytes copied through the staging pool of the Cuda stream `v_stream`,
+    /// the number of bytes copied directly because page-locked memory was unavailable, and the
+    /// time in microseconds the host spent waiting for a staging buffer.
+    pub fn cuda_get_staging_pool_stats(
+        v_stream: *const c_void,
+        bytes_staged: *mut u64,
+        bytes_direct: *mut u64,
+        stall_time_us: *mut u64,
+    ) -> i32;
+
     /// Copy a bootstrap key `src` represented with 64 bits in the standard domain from the CPU to
     /// the GPU `gpu_index` using the stream `v_stream`, and convert it to the Fourier domain on the
     /// GPU. The resulting bootstrap key `dest` on the GPU is an array of f64 values.
@@ -79,6 +110,20 @@ extern "C" {
         polynomial_size: u32,
     );
 
+    /// Copy a multi-bit bootstrap key `src` represented with 32 bits in the standard domain from
+    /// the CPU to the GPU `gpu_index` using the stream `v_stream`. The resulting bootstrap key
+    /// `dest` on the GPU is an array of uint32_t values.
+    pub fn cuda_convert_lwe_multi_bit_bootstrap_key_32(
+        dest: *mut c_void,
+        src: *const c_void,
+        v_stream: *const c_void,
+        input_lwe_dim: u32,
+        glwe_dim: u32,
+        level_count: u32,
+        polynomial_size: u32,
+        grouping_factor: u32,
+    );
+
     /// Copy a multi-bit bootstrap key `src` represented with 64 bits in the standard domain from
     /// the CPU to the GPU `gpu_index` using the stream `v_stream`. The resulting bootstrap key
     /// `dest` on the GPU is an array of uint64_t values.
@@ -93,6 +138,60 @@ extern "C" {
         grouping_factor: u32,
     );
 
+    /// Write the Fourier bootstrap key `src` on the GPU, as converted by
+    /// `cuda_convert_lwe_bootstrap_key_64`, to a versioned and checksummed key cache file at the
+    /// nul-terminated `path`. Returns 0 on success, -1 if the file cannot be written and -5 if
+    /// the host copy of the key cannot be allocated.
+    pub fn cuda_export_lwe_bootstrap_key_64(
+        path: *const c_char,
+        src: *const c_void,
+        v_stream: *const c_void,
+        input_lwe_dim: u32,
+        glwe_dim: u32,
+        level_count: u32,
+        polynomial_size: u32,
+    ) -> i32;
+
+    /// Load a Fourier bootstrap key written by `cuda_export_lwe_bootstrap_key_64` from `path`
+    /// straight into `dest` on the GPU, skipping the conversion. Returns 0 on success, -1 if the
+    /// file cannot be read, -2 if it is not a key cache of a supported version, -3 if the key does
+    /// not match the parameters and -4 if the file is corrupted.
+    pub fn cuda_import_lwe_bootstrap_key_64(
+        dest: *mut c_void,
+        path: *const c_char,
+        v_stream: *const c_void,
+        input_lwe_dim: u32,
+        glwe_dim: u32,
+        level_count: u32,
+        polynomial_size: u32,
+    ) -> i32;
+
+    /// Write the multi-bit bootstrap key `src` on the GPU to a key cache file at `path`, see
+    /// `cuda_export_lwe_bootstrap_key_64`.
+    pub fn cuda_export_lwe_multi_bit_bootstrap_key_64(
+        path: *const c_char,
+        src: *const c_void,
+        v_stream: *const c_void,
+        input_lwe_dim: u32,
+        glwe_dim: u32,
+        level_count: u32,
+        polynomial_size: u32,
+        grouping_factor: u32,
+    ) -> i32;
+
+    /// Load a multi-bit bootstrap key written by `cuda_export_lwe_multi_bit_bootstrap_key_64`
+    /// from `path` into `dest` on the GPU, see `cuda_import_lwe_bootstrap_key_64`.
+    pub fn cuda_import_lwe_multi_bit_bootstrap_key_64(
+        dest: *mut c_void,
+        path: *const c_char,
+        v_stream: *const c_void,
+        input_lwe_dim: u32,
+        glwe_dim: u32,
+        level_count: u32,
+        polynomial_size: u32,
+        grouping_factor: u32,
+    ) -> i32;
+
     /// Copy `number_of_cts` LWE ciphertext represented with 64 bits in the standard domain from the
     /// CPU to the GPU `gpu_index` using the stream `v_stream`. All ciphertexts must be
     /// concatenated.
@@ -129,6 +228,21 @@ extern "C" {
         allocate_gpu_memory: bool,
     );
 
+    /// Same as `scratch_cuda_bootstrap_low_latency_64`, and also opts the buffer into running the
+    /// classic low latency PBS as a single persistent kernel instead of two kernels per LWE
+    /// coefficient, when the fast variant can't be used and the device supports cooperative
+    /// launches. The buffer must be released with `cleanup_cuda_bootstrap_low_latency`.
+    pub fn scratch_cuda_bootstrap_low_latency_persistent_64(
+        v_stream: *const c_void,
+        pbs_buffer: *mut *mut i8,
+        glwe_dimension: u32,
+        polynomial_size: u32,
+        level_count: u32,
+        input_lwe_ciphertext_count: u32,
+        max_shared_memory: u32,
+        allocate_gpu_memory: bool,
+    );
+
     /// Perform bootstrapping on a batch of input u64 LWE ciphertexts.
     ///
     /// - `v_stream` is a void pointer to the Cuda stream to be used in the kernel launch
@@ -218,10 +332,132 @@ extern "C" {
         max_shared_memory: u32,
     );
 
+    /// Perform a low latency PBS on a batch of input u32 LWE ciphertexts with a many-LUT
+    /// accumulator. See `cuda_bootstrap_low_latency_many_lut_lwe_ciphertext_vector_64`.
+    pub fn cuda_bootstrap_low_latency_many_lut_lwe_ciphertext_vector_32(
+        v_stream: *const c_void,
+        lwe_array_out: *mut c_void,
+        lwe_output_indexes: *const c_void,
+        lut_vector: *const c_void,
+        lut_vector_indexes: *const c_void,
+        lwe_array_in: *const c_void,
+        lwe_input_indexes: *const c_void,
+        bootstrapping_key: *const c_void,
+        pbs_buffer: *mut i8,
+        lwe_dimension: u32,
+        glwe_dimension: u32,
+        polynomial_size: u32,
+        base_log: u32,
+        level: u32,
+        num_samples: u32,
+        num_lut_vectors: u32,
+        lwe_idx: u32,
+        max_shared_memory: u32,
+        num_many_lut: u32,
+        lut_stride: u32,
+    );
+
+    /// Perform a low latency PBS on a batch of input u64 LWE ciphertexts, evaluating the
+    /// `num_many_lut` functions packed `lut_stride` coefficients apart in each LUT with a single
+    /// blind rotation. The inputs must be smaller than `message_modulus * carry_modulus /
+    /// num_many_lut`. `lwe_array_out` holds `num_many_lut * num_samples` LWE ciphertexts, output
+    /// `i` of sample `s` being at index `i * num_samples + lwe_output_indexes[s]`. The other
+    /// arguments are the ones of `cuda_bootstrap_low_latency_lwe_ciphertext_vector_64`.
+    pub fn cuda_bootstrap_low_latency_many_lut_lwe_ciphertext_vector_64(
+        v_stream: *const c_void,
+        lwe_array_out: *mut c_void,
+        lwe_output_indexes: *const c_void,
+        lut_vector: *const c_void,
+        lut_vector_indexes: *const c_void,
+        lwe_array_in: *const c_void,
+        lwe_input_indexes: *const c_void,
+        bootstrapping_key: *const c_void,
+        pbs_buffer: *mut i8,
+        lwe_dimension: u32,
+        glwe_dimension: u32,
+        polynomial_size: u32,
+        base_log: u32,
+        level: u32,
+        num_samples: u32,
+        num_lut_vectors: u32,
+        lwe_idx: u32,
+        max_shared_memory: u32,
+        num_many_lut: u32,
+        lut_stride: u32,
+    );
+
+    /// Same as `scratch_cuda_bootstrap_low_latency_64`, and also configures the kernel fusing the
+    /// keyswitch to `lwe_dimension` with the PBS, used by
+    /// `cuda_keyswitch_bootstrap_low_latency_lwe_ciphertext_vector_64`.
+    pub fn scratch_cuda_keyswitch_bootstrap_low_latency_64(
+        v_stream: *const c_void,
+        pbs_buffer: *mut *mut i8,
+        lwe_dimension: u32,
+        glwe_dimension: u32,
+        polynomial_size: u32,
+        level_count: u32,
+        input_lwe_ciphertext_count: u32,
+        max_shared_memory: u32,
+        allocate_gpu_memory: bool,
+    );
+
+    /// Perform a keyswitch followed by a low latency PBS on a batch of input u64 LWE ciphertexts.
+    ///
+    /// - `lwe_array_in`: input batch of num_samples LWE ciphertexts of dimension
+    /// `lwe_dimension_in`, keyswitched to `lwe_dimension` with `ksk` before the PBS
+    /// - `lwe_array_after_ks`: temporary array receiving the keyswitched ciphertexts
+    /// - `pbs_buffer`: buffer allocated by `scratch_cuda_keyswitch_bootstrap_low_latency_64`, or by
+    /// `scratch_cuda_bootstrap_low_latency_64` in which case the two steps are never fused
+    ///
+    /// The other arguments are the ones of `cuda_bootstrap_low_latency_lwe_ciphertext_vector_64`
+    /// and `cuda_keyswitch_lwe_ciphertext_vector_64`. When the fast variant of the low latency
+    /// PBS can be used, a single kernel is launched.
+    pub fn cuda_keyswitch_bootstrap_low_latency_lwe_ciphertext_vector_64(
+        v_stream: *const c_void,
+        lwe_array_out: *mut c_void,
+        lwe_output_indexes: *const c_void,
+        lut_vector: *const c_void,
+        lut_vector_indexes: *const c_void,
+        lwe_array_in: *const c_void,
+        lwe_input_indexes: *const c_void,
+        keyswitch_key: *const c_void,
+        bootstrapping_key: *const c_void,
+        pbs_buffer: *mut i8,
+        lwe_array_after_ks: *mut c_void,
+        lwe_dimension_in: u32,
+        lwe_dimension: u32,
+        glwe_dimension: u32,
+        polynomial_size: u32,
+        ks_base_log: u32,
+        ks_level_count: u32,
+        base_log: u32,
+        level: u32,
+        num_samples: u32,
+        num_lut_vectors: u32,
+        lwe_idx: u32,
+        max_shared_memory: u32,
+    );
+
     /// This cleanup function frees the data for the low latency PBS on GPU
     /// contained in pbs_buffer for 32 or 64-bit inputs.
     pub fn cleanup_cuda_bootstrap_low_latency(v_stream: *const c_void, pbs_buffer: *mut *mut i8);
 
+    /// This scratch function allocates the necessary amount of data on the GPU for
+    /// the multi-bit PBS on 32-bit inputs into `pbs_buffer`.
+    pub fn scratch_cuda_multi_bit_pbs_32(
+        v_stream: *const c_void,
+        pbs_buffer: *mut *mut i8,
+        lwe_dimension: u32,
+        glwe_dimension: u32,
+        polynomial_size: u32,
+        level_count: u32,
+        grouping_factor: u32,
+        input_lwe_ciphertext_count: u32,
+        max_shared_memory: u32,
+        allocate_gpu_memory: bool,
+        lwe_chunk_size: u32,
+    );
+
     /// This scratch function allocates the necessary amount of data on the GPU for
     /// the multi-bit PBS on 64-bit inputs into `pbs_buffer`.
     pub fn scratch_cuda_multi_bit_pbs_64(
@@ -238,6 +474,31 @@ extern "C" {
         lwe_chunk_size: u32,
     );
 
+    /// Perform bootstrapping on a batch of input u32 LWE ciphertexts using the multi-bit algorithm.
+    /// See `cuda_multi_bit_pbs_lwe_ciphertext_vector_64` for the meaning of the arguments.
+    pub fn cuda_multi_bit_pbs_lwe_ciphertext_vector_32(
+        v_stream: *const c_void,
+        lwe_array_out: *mut c_void,
+        lwe_output_indexes: *const c_void,
+        lut_vector: *const c_void,
+        lut_vector_indexes: *const c_void,
+        lwe_array_in: *const c_void,
+        lwe_input_indexes: *const c_void,
+        bootstrapping_key: *const c_void,
+        pbs_buffer: *mut i8,
+        lwe_dimension: u32,
+        glwe_dimension: u32,
+        polynomial_size: u32,
+        grouping_factor: u32,
+        base_log: u32,
+        level: u32,
+        num_samples: u32,
+        num_lut_vectors: u32,
+        lwe_idx: u32,
+        max_shared_memory: u32,
+        lwe_chunk_size: u32,
+    );
+
     /// Perform bootstrapping on a batch of input u64 LWE ciphertexts using the multi-bit algorithm.
     ///
     /// - `v_stream` is a void pointer to the Cuda stream to be used in the kernel launch
@@ -300,10 +561,142 @@ extern "C" {
         lwe_chunk_size: u32,
     );
 
+    /// Perform bootstrapping on a batch of input u32 LWE ciphertexts sharing inputs, using the
+    /// multi-bit algorithm. See `cuda_multi_bit_pbs_shared_input_lwe_ciphertext_vector_64`.
+    pub fn cuda_multi_bit_pbs_shared_input_lwe_ciphertext_vector_32(
+        v_stream: *const c_void,
+        lwe_array_out: *mut c_void,
+        lwe_output_indexes: *const c_void,
+        lut_vector: *const c_void,
+        lut_vector_indexes: *const c_void,
+        lwe_array_in: *const c_void,
+        lwe_input_indexes: *const c_void,
+        bootstrapping_key: *const c_void,
+        pbs_buffer: *mut i8,
+        lwe_dimension: u32,
+        glwe_dimension: u32,
+        polynomial_size: u32,
+        grouping_factor: u32,
+        base_log: u32,
+        level: u32,
+        num_samples: u32,
+        num_samples_per_input: u32,
+        num_lut_vectors: u32,
+        lwe_idx: u32,
+        max_shared_memory: u32,
+        lwe_chunk_size: u32,
+    );
+
+    /// Perform bootstrapping on a batch of input u64 LWE ciphertexts using the multi-bit algorithm,
+    /// where the samples come in runs of `num_samples_per_input` consecutive samples that read the
+    /// same input LWE, for instance to evaluate several LUTs on one ciphertext. The keybundles only
+    /// depend on the input mask, so they are computed once per run, from the mask of the first
+    /// sample of the run. Each sample still reads its own body, LUT and output index. The samples
+    /// of a run must have the same mask, which is not checked. `num_samples` must be a multiple
+    /// of `num_samples_per_input`, the other arguments are the ones of
+    /// `cuda_multi_bit_pbs_lwe_ciphertext_vector_64`.
+    pub fn cuda_multi_bit_pbs_shared_input_lwe_ciphertext_vector_64(
+        v_stream: *const c_void,
+        lwe_array_out: *mut c_void,
+        lwe_output_indexes: *const c_void,
+        lut_vector: *const c_void,
+        lut_vector_indexes: *const c_void,
+        lwe_array_in: *const c_void,
+        lwe_input_indexes: *const c_void,
+        bootstrapping_key: *const c_void,
+        pbs_buffer: *mut i8,
+        lwe_dimension: u32,
+        glwe_dimension: u32,
+        polynomial_size: u32,
+        grouping_factor: u32,
+        base_log: u32,
+        level: u32,
+        num_samples: u32,
+        num_samples_per_input: u32,
+        num_lut_vectors: u32,
+        lwe_idx: u32,
+        max_shared_memory: u32,
+        lwe_chunk_size: u32,
+    );
+
+    /// Perform a multi-bit PBS on a batch of input u32 LWE ciphertexts with a many-LUT
+    /// accumulator. See `cuda_multi_bit_pbs_many_lut_lwe_ciphertext_vector_64`.
+    pub fn cuda_multi_bit_pbs_many_lut_lwe_ciphertext_vector_32(
+        v_stream: *const c_void,
+        lwe_array_out: *mut c_void,
+        lwe_output_indexes: *const c_void,
+        lut_vector: *const c_void,
+        lut_vector_indexes: *const c_void,
+        lwe_array_in: *const c_void,
+        lwe_input_indexes: *const c_void,
+        bootstrapping_key: *const c_void,
+        pbs_buffer: *mut i8,
+        lwe_dimension: u32,
+        glwe_dimension: u32,
+        polynomial_size: u32,
+        grouping_factor: u32,
+        base_log: u32,
+        level: u32,
+        num_samples: u32,
+        num_lut_vectors: u32,
+        lwe_idx: u32,
+        max_shared_memory: u32,
+        num_many_lut: u32,
+        lut_stride: u32,
+        lwe_chunk_size: u32,
+    );
+
+    /// Perform a multi-bit PBS on a batch of input u64 LWE ciphertexts with a many-LUT
+    /// accumulator, see `cuda_bootstrap_low_latency_many_lut_lwe_ciphertext_vector_64` for the
+    /// layout of the LUTs and of the output. The other arguments are the ones of
+    /// `cuda_multi_bit_pbs_lwe_ciphertext_vector_64`.
+    pub fn cuda_multi_bit_pbs_many_lut_lwe_ciphertext_vector_64(
+        v_stream: *const c_void,
+        lwe_array_out: *mut c_void,
+        lwe_output_indexes: *const c_void,
+        lut_vector: *const c_void,
+        lut_vector_indexes: *const c_void,
+        lwe_array_in: *const c_void,
+        lwe_input_indexes: *const c_void,
+        bootstrapping_key: *const c_void,
+        pbs_buffer: *mut i8,
+        lwe_dimension: u32,
+        glwe_dimension: u32,
+        polynomial_size: u32,
+        grouping_factor: u32,
+        base_log: u32,
+        level: u32,
+        num_samples: u32,
+        num_lut_vectors: u32,
+        lwe_idx: u32,
+        max_shared_memory: u32,
+        num_many_lut: u32,
+        lut_stride: u32,
+        lwe_chunk_size: u32,
+    );
+
     /// This cleanup function frees the data for the multi-bit PBS on GPU
-    /// contained in pbs_buffer for 64-bit inputs.
+    /// contained in pbs_buffer for 32 or 64-bit inputs.
     pub fn cleanup_cuda_multi_bit_pbs(v_stream: *const c_void, pbs_buffer: *mut *mut i8);
 
+    /// Benchmarks the multi-bit PBS for 64-bit inputs over a range of chunk sizes and records
+    /// the fastest one for this device, parameter set and batch size in the tuning cache. The
+    /// cache is saved to the file pointed by `TFHE_CUDA_TUNING_CACHE`, or to
+    /// `$HOME/.tfhe_cuda_backend_tuning_cache`, and is used by the multi-bit PBS scratch
+    /// functions called afterwards. Returns the selected chunk size, or 0 if none could be run.
+    pub fn cuda_tune_multi_bit_pbs_chunk_size_64(
+        v_stream: *const c_void,
+        bootstrapping_key: *const c_void,
+        lwe_dimension: u32,
+        glwe_dimension: u32,
+        polynomial_size: u32,
+        grouping_factor: u32,
+        base_log: u32,
+        level_count: u32,
+        num_samples: u32,
+        max_shared_memory: u32,
+    ) -> u32;
+
     /// Perform keyswitch on a batch of 64 bits input LWE ciphertexts.
     ///
     /// - `v_stream` is a void pointer to the Cuda stream to be used in the kernel launch
@@ -335,6 +728,26 @@ extern "C" {
         num_samples: u32,
     );
 
+    /// Perform keyswitch on a batch of 64 bits input LWE ciphertexts, with the same arguments
+    /// and result as `cuda_keyswitch_lwe_ciphertext_vector_64`.
+    ///
+    /// Several ciphertexts are processed per block of threads and the keyswitch key is tiled
+    /// through shared memory, so that it is read once per block instead of once per ciphertext.
+    /// This pays off for large values of `num_samples`.
+    pub fn cuda_keyswitch_lwe_ciphertext_vector_batched_64(
+        v_stream: *const c_void,
+        lwe_array_out: *mut c_void,
+        lwe_output_indexes: *const c_void,
+        lwe_array_in: *const c_void,
+        lwe_input_indexes: *const c_void,
+        keyswitch_key: *const c_void,
+        input_lwe_dimension: u32,
+        output_lwe_dimension: u32,
+        base_log: u32,
+        level_count: u32,
+        num_samples: u32,
+    );
+
     /// Perform the negation of a u64 input LWE ciphertext vector.
     /// - `v_stream` is a void pointer to the Cuda stream to be used in the kernel launch
     /// - `gpu_index` is the index of the GPU to be used in the kernel launch
@@ -481,8 +894,27 @@ extern "C" {
         pbs_type: u32,
         max_shared_memory: u32,
         allocate_gpu_memory: bool,
+        karatsuba_threshold: u32,
     );
 
+    pub fn get_buffer_size_integer_mult_radix_ciphertext_kb_64(
+        gpu_index: u32,
+        message_modulus: u32,
+        carry_modulus: u32,
+        glwe_dimension: u32,
+        lwe_dimension: u32,
+        polynomial_size: u32,
+        pbs_base_log: u32,
+        pbs_level: u32,
+        ks_base_log: u32,
+        ks_level: u32,
+        grouping_factor: u32,
+        num_blocks: u32,
+        pbs_type: u32,
+        max_shared_memory: u32,
+        karatsuba_threshold: u32,
+    ) -> u64;
+
     pub fn cuda_integer_mult_radix_ciphertext_kb_64(
         v_stream: *const c_void,
         radix_lwe_out: *mut c_void,
@@ -508,6 +940,10 @@ extern "C" {
 
     pub fn cleanup_cuda_integer_mult(v_stream: *const c_void, mem_ptr: *mut *mut i8);
 
+    pub fn enable_graph_cuda_integer_mult(v_stream: *const c_void, mem_ptr: *mut i8);
+
+    pub fn invalidate_graph_cuda_integer_mult(v_stream: *const c_void, mem_ptr: *mut i8);
+
     pub fn cuda_scalar_addition_integer_radix_ciphertext_64_inplace(
         v_stream: *const c_void,
         lwe_array: *mut c_void,
@@ -546,6 +982,24 @@ extern "C" {
         allocate_gpu_memory: bool,
     );
 
+    pub fn get_buffer_size_integer_radix_bitop_kb_64(
+        gpu_index: u32,
+        glwe_dimension: u32,
+        polynomial_size: u32,
+        big_lwe_dimension: u32,
+        small_lwe_dimension: u32,
+        ks_level: u32,
+        ks_base_log: u32,
+        pbs_level: u32,
+        pbs_base_log: u32,
+        grouping_factor: u32,
+        lwe_ciphertext_count: u32,
+        message_modulus: u32,
+        carry_modulus: u32,
+        pbs_type: u32,
+        op_type: u32,
+    ) -> u64;
+
     pub fn cuda_bitop_integer_radix_ciphertext_kb_64(
         v_stream: *const c_void,
         radix_lwe_out: *mut c_void,
@@ -602,6 +1056,24 @@ extern "C" {
         allocate_gpu_memory: bool,
     );
 
+    pub fn get_buffer_size_integer_radix_comparison_kb_64(
+        gpu_index: u32,
+        glwe_dimension: u32,
+        polynomial_size: u32,
+        big_lwe_dimension: u32,
+        small_lwe_dimension: u32,
+        ks_level: u32,
+        ks_base_log: u32,
+        pbs_level: u32,
+        pbs_base_log: u32,
+        grouping_factor: u32,
+        lwe_ciphertext_count: u32,
+        message_modulus: u32,
+        carry_modulus: u32,
+        pbs_type: u32,
+        op_type: u32,
+    ) -> u64;
+
     pub fn cuda_comparison_integer_radix_ciphertext_kb_64(
         v_stream: *const c_void,
         radix_lwe_out: *mut c_void,
@@ -627,6 +1099,10 @@ extern "C" {
 
     pub fn cleanup_cuda_integer_comparison(v_stream: *const c_void, mem_ptr: *mut *mut i8);
 
+    pub fn enable_graph_cuda_integer_comparison(v_stream: *const c_void, mem_ptr: *mut i8);
+
+    pub fn invalidate_graph_cuda_integer_comparison(v_stream: *const c_void, mem_ptr: *mut i8);
+
     pub fn scratch_cuda_full_propagation_64(
         v_stream: *const c_void,
         mem_ptr: *mut *mut i8,
@@ -642,6 +1118,19 @@ extern "C" {
         allocate_gpu_memory: bool,
     );
 
+    pub fn get_buffer_size_full_propagation_64(
+        gpu_index: u32,
+        lwe_dimension: u32,
+        glwe_dimension: u32,
+        polynomial_size: u32,
+        level_count: u32,
+        grouping_factor: u32,
+        input_lwe_ciphertext_count: u32,
+        message_modulus: u32,
+        carry_modulus: u32,
+        pbs_type: u32,
+    ) -> u64;
+
     pub fn cuda_full_propagation_64_inplace(
         v_stream: *const c_void,
         radix_lwe_right: *mut c_void,
@@ -681,6 +1170,24 @@ extern "C" {
         allocate_gpu_memory: bool,
     );
 
+    pub fn get_buffer_size_integer_radix_scalar_shift_kb_64(
+        gpu_index: u32,
+        glwe_dimension: u32,
+        polynomial_size: u32,
+        big_lwe_dimension: u32,
+        small_lwe_dimension: u32,
+        ks_level: u32,
+        ks_base_log: u32,
+        pbs_level: u32,
+        pbs_base_log: u32,
+        grouping_factor: u32,
+        num_blocks: u32,
+        message_modulus: u32,
+        carry_modulus: u32,
+        pbs_type: u32,
+        shift_type: u32,
+    ) -> u64;
+
     pub fn cuda_integer_radix_scalar_shift_kb_64_inplace(
         v_stream: *const c_void,
         radix_lwe: *mut c_void,
@@ -712,6 +1219,23 @@ extern "C" {
         allocate_gpu_memory: bool,
     );
 
+    pub fn get_buffer_size_integer_radix_cmux_kb_64(
+        gpu_index: u32,
+        glwe_dimension: u32,
+        polynomial_size: u32,
+        big_lwe_dimension: u32,
+        small_lwe_dimension: u32,
+        ks_level: u32,
+        ks_base_log: u32,
+        pbs_level: u32,
+        pbs_base_log: u32,
+        grouping_factor: u32,
+        lwe_ciphertext_count: u32,
+        message_modulus: u32,
+        carry_modulus: u32,
+        pbs_type: u32,
+    ) -> u64;
+
     pub fn cuda_cmux_integer_radix_ciphertext_kb_64(
         v_stream: *const c_void,
         lwe_array_out: *mut c_void,
@@ -746,6 +1270,24 @@ extern "C" {
         allocate_gpu_memory: bool,
     );
 
+    pub fn get_buffer_size_integer_radix_scalar_rotate_kb_64(
+        gpu_index: u32,
+        glwe_dimension: u32,
+        polynomial_size: u32,
+        big_lwe_dimension: u32,
+        small_lwe_dimension: u32,
+        ks_level: u32,
+        ks_base_log: u32,
+        pbs_level: u32,
+        pbs_base_log: u32,
+        grouping_factor: u32,
+        num_blocks: u32,
+        message_modulus: u32,
+        carry_modulus: u32,
+        pbs_type: u32,
+        shift_type: u32,
+    ) -> u64;
+
     pub fn cuda_integer_radix_scalar_rotate_kb_64_inplace(
         v_stream: *const c_void,
         radix_lwe: *mut c_void,
@@ -774,9 +1316,28 @@ extern "C" {
         message_modulus: u32,
         carry_modulus: u32,
         pbs_type: u32,
+        scan_type: u32,
         allocate_gpu_memory: bool,
     );
 
+    pub fn get_buffer_size_propagate_single_carry_low_latency_kb_64_inplace(
+        gpu_index: u32,
+        glwe_dimension: u32,
+        polynomial_size: u32,
+        big_lwe_dimension: u32,
+        small_lwe_dimension: u32,
+        ks_level: u32,
+        ks_base_log: u32,
+        pbs_level: u32,
+        pbs_base_log: u32,
+        grouping_factor: u32,
+        num_blocks: u32,
+        message_modulus: u32,
+        carry_modulus: u32,
+        pbs_type: u32,
+        scan_type: u32,
+    ) -> u64;
+
     pub fn cuda_propagate_single_carry_low_latency_kb_64_inplace(
         v_stream: *const c_void,
         radix_lwe: *mut c_void,
@@ -791,4 +1352,61 @@ extern "C" {
         mem_ptr: *mut *mut i8,
     );
 
+    pub fn enable_graph_cuda_propagate_single_carry_low_latency(
+        v_stream: *const c_void,
+        mem_ptr: *mut i8,
+    );
+
+    pub fn invalidate_graph_cuda_propagate_single_carry_low_latency(
+        v_stream: *const c_void,
+        mem_ptr: *mut i8,
+    );
+
+    pub fn scratch_cuda_full_propagation_tree_kb_64_inplace(
+        v_stream: *const c_void,
+        mem_ptr: *mut *mut i8,
+        glwe_dimension: u32,
+        polynomial_size: u32,
+        big_lwe_dimension: u32,
+        small_lwe_dimension: u32,
+        ks_level: u32,
+        ks_base_log: u32,
+        pbs_level: u32,
+        pbs_base_log: u32,
+        grouping_factor: u32,
+        num_blocks: u32,
+        message_modulus: u32,
+        carry_modulus: u32,
+        pbs_type: u32,
+        allocate_gpu_memory: bool,
+    );
+
+    pub fn get_buffer_size_full_propagation_tree_kb_64_inplace(
+        gpu_index: u32,
+        glwe_dimension: u32,
+        polynomial_size: u32,
+        big_lwe_dimension: u32,
+        small_lwe_dimension: u32,
+        ks_level: u32,
+        ks_base_log: u32,
+        pbs_level: u32,
+        pbs_base_log: u32,
+        grouping_factor: u32,
+        num_blocks: u32,
+        message_modulus: u32,
+        carry_modulus: u32,
+        pbs_type: u32,
+    ) -> u64;
+
+    pub fn cuda_full_propagation_tree_kb_64_inplace(
+        v_stream: *const c_void,
+        radix_lwe: *mut c_void,
+        mem_ptr: *mut i8,
+        bsk: *const c_void,
+        ksk: *const c_void,
+        num_blocks: u32,
+    );
+
+    pub fn cleanup_cuda_full_propagation_tree(v_stream: *const c_void, mem_ptr: *mut *mut i8);
+
 }
@@ -38,6 +38,16 @@ enum ShiftType {
     Right = 1,
 }
 
+#[allow(dead_code)]
+#[repr(u32)]
+enum CarryScanType {
+    Auto = 0,
+    HillisSteele = 1,
+    Sklansky = 2,
+    BrentKung = 3,
+    GroupedSklansky = 4,
+}
+
 #[repr(u32)]
 pub enum ComparisonType {
     EQ = 0,
@@ -242,6 +252,7 @@ impl CudaStream {
                 PBSType::ClassicalLowLat as u32,
                 self.device().get_max_shared_memory() as u32,
                 true,
+                0,
             );
             cuda_integer_mult_radix_ciphertext_kb_64(
                 self.as_c_ptr(),
@@ -308,6 +319,7 @@ impl CudaStream {
                 PBSType::MultiBit as u32,
                 self.device().get_max_shared_memory() as u32,
                 true,
+                0,
             );
             cuda_integer_mult_radix_ciphertext_kb_64(
                 self.as_c_ptr(),
@@ -372,6 +384,7 @@ impl CudaStream {
                 PBSType::ClassicalLowLat as u32,
                 self.device().get_max_shared_memory() as u32,
                 true,
+                0,
             );
             cuda_integer_mult_radix_ciphertext_kb_64(
                 self.as_c_ptr(),
@@ -437,6 +450,7 @@ impl CudaStream {
                 PBSType::MultiBit as u32,
                 self.device().get_max_shared_memory() as u32,
                 true,
+                0,
             );
             cuda_integer_mult_radix_ciphertext_kb_64(
                 self.as_c_ptr(),
@@ -1283,6 +1297,7 @@ impl CudaStream {
                 message_modulus.0 as u32,
                 carry_modulus.0 as u32,
                 PBSType::ClassicalLowLat as u32,
+                CarryScanType::HillisSteele as u32,
                 true,
             );
             cuda_propagate_single_carry_low_latency_kb_64_inplace(
@@ -1337,6 +1352,7 @@ impl CudaStream {
                 message_modulus.0 as u32,
                 carry_modulus.0 as u32,
                 PBSType::MultiBit as u32,
+                CarryScanType::HillisSteele as u32,
                 true,
             );
             cuda_propagate_single_carry_low_latency_kb_64_inplace(